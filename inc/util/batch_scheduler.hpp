@@ -0,0 +1,76 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_BATCH_SCHEDULER_HPP
+#define UTIL_BATCH_SCHEDULER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace ebi
+{
+  namespace util
+  {
+    /**
+     * Runs independent jobs (e.g. the validation of several files) on a pool of threads.
+     *
+     * The biggest jobs are started first, so a big job that arrives late doesn't keep a single thread busy after the
+     * rest have finished. A job is only started while the memory it is expected to use fits in the budget along with
+     * the jobs already running; a job bigger than the whole budget is run alone.
+     */
+    class BatchScheduler
+    {
+      public:
+        struct Job
+        {
+            size_t index;   ///< position of the job in the caller's list
+            size_t size;    ///< amount of work, jobs are started from the biggest to the smallest
+            size_t memory;  ///< memory the job is expected to use while running
+        };
+
+        /**
+         * @param memory_budget maximum memory used by the jobs running at the same time, or 0 for no limit
+         */
+        BatchScheduler(size_t n_threads, size_t memory_budget);
+
+        /**
+         * Calls `process(job.index)` for each job and waits for all of them to finish. A call that throws doesn't
+         * stop the other jobs, and the first exception is rethrown once all of them have finished.
+         */
+        void run(std::vector<Job> jobs, std::function<void(size_t)> const & process);
+
+      private:
+        void work(std::vector<Job> const & jobs, std::function<void(size_t)> const & process);
+        bool can_start(Job const & job) const;
+
+        size_t n_threads;
+        size_t memory_budget;
+
+        std::mutex mutex;
+        std::condition_variable finished_job;
+        size_t next_job;
+        size_t memory_in_use;
+        size_t n_running;
+        std::exception_ptr error;
+    };
+  }
+}
+
+#endif // UTIL_BATCH_SCHEDULER_HPP
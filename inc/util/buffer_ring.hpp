@@ -0,0 +1,149 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_BUFFER_RING_HPP
+#define UTIL_BUFFER_RING_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace ebi
+{
+  namespace util
+  {
+    /**
+     * Fixed set of buffers that circulate between a producer thread, which fills them, and a consumer thread, which
+     * reads them in the same order they were filled and then gives them back to be refilled.
+     *
+     * The amount of buffers bounds how far the producer can go ahead of the consumer.
+     *
+     * Producer side:
+     * ~~~
+     * while (Buffer * buffer = ring.acquire_empty()) {
+     *     buffer->size = fill(buffer->data.data(), buffer->data.size());
+     *     ring.push_full(buffer);
+     * }
+     * ring.finish();
+     * ~~~
+     * Consumer side:
+     * ~~~
+     * while (Buffer * buffer = ring.pop_full()) {
+     *     use(buffer->data.data(), buffer->size);
+     *     ring.release(buffer);
+     * }
+     * ~~~
+     */
+    class BufferRing
+    {
+      public:
+        struct Buffer
+        {
+            std::vector<char> data;
+            size_t size;    ///< amount of bytes of `data` in use
+        };
+
+        BufferRing(size_t n_buffers, size_t buffer_size) : buffers(n_buffers), finished{false}, closed{false}
+        {
+            for (auto & buffer : buffers) {
+                buffer.data.resize(buffer_size);
+                buffer.size = 0;
+                empty.push_back(&buffer);
+            }
+        }
+
+        /**
+         * Blocks until a buffer can be filled by the producer.
+         * @return the buffer, or nullptr if the consumer closed the ring and nothing else should be produced
+         */
+        Buffer * acquire_empty()
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            changed.wait(lock, [this] { return closed || !empty.empty(); });
+            if (closed) {
+                return nullptr;
+            }
+            Buffer * buffer = empty.front();
+            empty.pop_front();
+            return buffer;
+        }
+
+        void push_full(Buffer * buffer)
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            full.push_back(buffer);
+            changed.notify_all();
+        }
+
+        /**
+         * Called by the producer after the last buffer has been pushed
+         */
+        void finish()
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            finished = true;
+            changed.notify_all();
+        }
+
+        /**
+         * Blocks until a buffer filled by the producer is available.
+         * @return the buffer, or nullptr if the producer finished and every buffer has been already consumed
+         */
+        Buffer * pop_full()
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            changed.wait(lock, [this] { return finished || !full.empty(); });
+            if (full.empty()) {
+                return nullptr;
+            }
+            Buffer * buffer = full.front();
+            full.pop_front();
+            return buffer;
+        }
+
+        void release(Buffer * buffer)
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            buffer->size = 0;
+            empty.push_back(buffer);
+            changed.notify_all();
+        }
+
+        /**
+         * Called by the consumer when it won't read any more buffers, so the producer can stop
+         */
+        void close()
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            closed = true;
+            changed.notify_all();
+        }
+
+      private:
+        std::vector<Buffer> buffers;
+        std::deque<Buffer *> empty;
+        std::deque<Buffer *> full;
+        bool finished;
+        bool closed;
+
+        std::mutex mutex;
+        std::condition_variable changed;
+    };
+  }
+}
+
+#endif // UTIL_BUFFER_RING_HPP
@@ -0,0 +1,237 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_COMPRESSION_HPP
+#define UTIL_COMPRESSION_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+#include <zlib.h>
+
+#include "util/buffer_ring.hpp"
+
+namespace ebi
+{
+  namespace util
+  {
+    size_t const default_compressed_chunk_size = 256 * 1024;
+    size_t const default_inflated_buffer_size = 1024 * 1024;
+    size_t const default_inflated_buffers = 4;
+
+    /**
+     * Virtual offset past the end of any BGZF input
+     */
+    uint64_t const bgzf_end_of_input = UINT64_MAX;
+
+    /**
+     * @return whether the next bytes in the stream look like the beginning of a gzip (or BGZF) file. The stream is
+     * not consumed.
+     */
+    bool is_gzip(std::istream &input);
+
+    /**
+     * @return whether a gzip header at the beginning of `data` contains the BGZF extra subfield ("BC")
+     */
+    bool is_bgzf_header(char const * data, size_t size);
+
+    /**
+     * Creates a stream buffer with the decompressed contents of a gzip (or BGZF) input. The beginning of the input
+     * is read to tell both formats apart: BGZF inputs are decompressed by a BgzfStreambuf when more than one thread
+     * is requested, and the rest by a GzipStreambuf.
+     *
+     * Decompression errors are rethrown as std::runtime_error from the reading thread. When wrapping the returned
+     * buffer in an std::istream, call `exceptions(std::ios::badbit)` on it so those errors are not silently turned
+     * into EOF.
+     *
+     * @param bgzf return by reference whether the input is a BGZF file, as specified in the SAM specification
+     */
+    std::unique_ptr<std::streambuf> make_gzip_streambuf(std::istream &input, size_t n_threads, bool &bgzf);
+
+    /**
+     * Stream buffer that provides the decompressed contents of a gzip input.
+     *
+     * The decompression runs in a separate thread that fills a ring of buffers ahead of the reader, so inflating
+     * and parsing the text overlap. Concatenated gzip members, as in BGZF files, are read one after another.
+     */
+    class GzipStreambuf : public std::streambuf
+    {
+      public:
+        /**
+         * @param first_chunk compressed bytes already read from the beginning of `input`
+         */
+        GzipStreambuf(std::istream &input,
+                      std::vector<char> const & first_chunk,
+                      size_t buffer_size = default_inflated_buffer_size,
+                      size_t n_buffers = default_inflated_buffers);
+
+        ~GzipStreambuf();
+
+        GzipStreambuf(GzipStreambuf const &) = delete;
+        GzipStreambuf & operator=(GzipStreambuf const &) = delete;
+
+      protected:
+        int_type underflow() override;
+
+      private:
+        void inflate_input();
+        size_t read_compressed();
+
+        std::istream &input;
+        std::vector<char> compressed;
+        size_t first_chunk_size;
+
+        BufferRing ring;
+        BufferRing::Buffer * current;
+
+        std::exception_ptr error;
+        std::thread inflater;
+    };
+
+    /**
+     * Stream buffer that provides the decompressed contents of a BGZF input, inflating several blocks in parallel.
+     *
+     * BGZF blocks are independent gzip members of at most 64 KB, whose size is stored in the BSIZE field of their
+     * header. A reader thread splits the input in blocks, a pool of worker threads inflates them and checks their
+     * CRC32 and ISIZE, and the blocks are provided in their original order.
+     */
+    class BgzfStreambuf : public std::streambuf
+    {
+      public:
+        /**
+         * @param first_chunk compressed bytes already read from the beginning of `input`
+         * @param n_threads amount of threads inflating blocks
+         */
+        BgzfStreambuf(std::istream &input, std::vector<char> const & first_chunk, size_t n_threads);
+
+        ~BgzfStreambuf();
+
+        BgzfStreambuf(BgzfStreambuf const &) = delete;
+        BgzfStreambuf & operator=(BgzfStreambuf const &) = delete;
+
+      protected:
+        int_type underflow() override;
+
+      private:
+        enum class BlockState { empty, compressed, inflated };
+
+        struct Block
+        {
+            std::vector<char> compressed;
+            std::vector<char> inflated;
+            size_t compressed_size;
+            size_t inflated_size;
+            size_t offset;          ///< position of the block in the compressed input, for error reporting
+            BlockState state;
+            std::exception_ptr error;
+        };
+
+        void read_blocks();
+        bool read_block(Block & block);
+        size_t read_compressed(char * data, size_t size);
+        void inflate_blocks();
+        void inflate_block(Block & block, z_stream & stream);
+
+        std::istream &input;
+        std::vector<char> first_chunk;
+        size_t first_chunk_position;
+        size_t input_position;
+
+        std::vector<Block> blocks;      ///< the block with sequence number `n` is stored in `blocks[n % blocks.size()]`
+        std::deque<Block *> to_inflate;
+        size_t n_read;                  ///< amount of blocks read so far
+        size_t n_consumed;              ///< amount of blocks provided to the reader so far
+        bool end_of_input;
+        bool closed;
+        std::exception_ptr read_error;
+
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::thread reader;
+        std::vector<std::thread> inflaters;
+    };
+
+    /**
+     * Stream buffer that provides the decompressed contents of some ranges of a BGZF input, seeking to the first
+     * block of each range. Blocks are inflated one at a time, in the calling thread.
+     *
+     * The ranges are given as virtual offsets, as in the tabix and CSI indexes: the position of a block in the
+     * compressed input in the upper 48 bits, and a position in the inflated block in the lower 16 bits.
+     */
+    class BgzfRangeStreambuf : public std::streambuf
+    {
+      public:
+        struct Range
+        {
+            uint64_t begin;
+            uint64_t end;   ///< not included in the range
+        };
+
+        /**
+         * @param input seekable BGZF input
+         * @param ranges ranges to read, in the same order they will be provided
+         */
+        BgzfRangeStreambuf(std::istream &input, std::vector<Range> const & ranges);
+
+        ~BgzfRangeStreambuf();
+
+        BgzfRangeStreambuf(BgzfRangeStreambuf const &) = delete;
+        BgzfRangeStreambuf & operator=(BgzfRangeStreambuf const &) = delete;
+
+        /**
+         * @return virtual offset of the next character to read
+         */
+        uint64_t tell() const;
+
+        /**
+         * @return offset in the compressed input right after the block being read
+         */
+        uint64_t block_end() const;
+
+      protected:
+        int_type underflow() override;
+
+      private:
+        /**
+         * @return whether there was a block at `offset`, which is now inflated
+         */
+        bool read_block(uint64_t offset);
+
+        std::istream &input;
+        std::vector<Range> ranges;
+        size_t current_range;
+        bool has_block;             ///< whether a block of the current range has been read
+        uint64_t input_position;    ///< unknown until the first seek
+
+        std::vector<char> compressed;
+        std::vector<char> inflated;
+        uint64_t block_offset;
+        size_t block_size;
+        size_t inflated_size;
+        z_stream stream;
+    };
+  }
+}
+
+#endif // UTIL_COMPRESSION_HPP
@@ -0,0 +1,173 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_LINE_SCANNER_HPP
+#define UTIL_LINE_SCANNER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+/**
+ * The parsers call some of the functions below for most values in a line, from functions far too large for the
+ * compiler to inline anything into them otherwise
+ */
+#ifdef __GNUC__
+#define UTIL_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define UTIL_ALWAYS_INLINE inline
+#endif
+
+namespace ebi
+{
+  namespace util
+  {
+    /**
+     * Returns the first line break character ('\r' or '\n') in [begin, end), or `end` if there is none.
+     *
+     * This and count_newlines compare blocks of 16 or 32 characters at once using SSE2 or AVX2, whichever the
+     * processor supports (checked at runtime), and fall back to comparing one character at a time elsewhere.
+     *
+     * The columns and subfields of a line are searched through a StructuralIndex instead.
+     */
+    char const * find_line_break(char const * begin, char const * end);
+
+    /**
+     * Returns the amount of '\n' in [begin, end)
+     */
+    size_t count_newlines(char const * begin, char const * end);
+
+    /**
+     * Positions of the characters that delimit the columns and subfields of the lines in a buffer
+     *
+     * The buffer is compared in blocks of 64 characters (using SSE2 or AVX2 like find_line_break), keeping a
+     * bitmap per kind of character and block. With it, the parsers jump over the rest of a long value to the
+     * first character of the given kinds, instead of stepping through it one character at a time.
+     */
+    class StructuralIndex
+    {
+      public:
+        enum Kind : unsigned
+        {
+            newline = 1 << 0,
+            tab = 1 << 1,
+            semicolon = 1 << 2,
+            colon = 1 << 3,
+            comma = 1 << 4,
+            equals = 1 << 5,
+            space = 1 << 6,
+            control = 1 << 7,   // Any other character below ' ', DEL, or any character outside ASCII
+        };
+
+        static size_t const n_kinds = 8;
+        static size_t const block_size = 64;
+
+        StructuralIndex();
+
+        /**
+         * Starts indexing [begin, end), replacing the previous buffer. The blocks are compared as `find` reaches
+         * them, so the parts of the buffer never searched cost nothing.
+         */
+        void build(char const * begin, char const * end);
+
+        /**
+         * Returns the first character in [from, end) of any of the `kinds`, or the end of the buffer if there is
+         * none. `from` must point into the last buffer indexed.
+         */
+        char const * find(char const * from, unsigned kinds);
+
+        /**
+         * Like `find`, but only when at least 8 characters not of the `kinds` come first, returning nullptr
+         * otherwise.
+         *
+         * Stepping through a few characters is faster than searching the index, so short runs are told apart by
+         * looking at their characters directly, which is not done again for the characters already looked at.
+         */
+        UTIL_ALWAYS_INLINE char const * find_after_long_run(char const * from, unsigned kinds)
+        {
+            if (from < m_short_run_end || m_end - from <= static_cast<std::ptrdiff_t>(sizeof(uint64_t))) {
+                return nullptr;
+            }
+            uint64_t chars;
+            std::memcpy(&chars, from, sizeof(chars));
+            if (any_of_kinds(chars, kinds)) {
+                m_short_run_end = from + sizeof(chars);
+                return nullptr;
+            }
+            return find(from + sizeof(chars), kinds);
+        }
+
+      private:
+        /**
+         * Returns whether any of the characters packed in `chars` are of the `kinds`. With `control` it is also true
+         * for tabs and newlines, which only makes a run look shorter than it is.
+         */
+        UTIL_ALWAYS_INLINE static bool any_of_kinds(uint64_t chars, unsigned kinds)
+        {
+            uint64_t const ones = 0x0101010101010101;
+            uint64_t const highs = ones * 0x80;
+            // Whether any byte is below `limit` (up to 0x80), or equal to `c`
+            auto any_below = [&](uint64_t bytes, uint64_t limit) { return (bytes - ones * limit) & ~bytes & highs; };
+            auto any_equal = [&](uint64_t c) { return any_below(chars ^ (ones * c), 1); };
+
+            uint64_t found = 0;
+            if (kinds & control) {
+                // Adding 1 carries into the high bit of the DELs, and the bytes outside ASCII have it already
+                found |= any_below(chars, (kinds & space) ? ' ' + 1 : ' ') | ((chars | (chars + ones)) & highs);
+            } else {
+                found |= (kinds & newline) ? any_equal('\n') : 0;
+                found |= (kinds & tab) ? any_equal('\t') : 0;
+                found |= (kinds & space) ? any_equal(' ') : 0;
+            }
+            found |= (kinds & semicolon) ? any_equal(';') : 0;
+            found |= (kinds & colon) ? any_equal(':') : 0;
+            found |= (kinds & comma) ? any_equal(',') : 0;
+            found |= (kinds & equals) ? any_equal('=') : 0;
+            return found != 0;
+        }
+
+        /**
+         * Compares the characters of `block` and some of the blocks after it
+         */
+        void index_blocks(size_t block);
+
+        char const * m_begin;
+        char const * m_end;
+
+        /**
+         * The characters before this one are part of a short run already looked at by find_after_long_run
+         */
+        char const * m_short_run_end;
+
+        /**
+         * Blocks [m_indexed_begin, m_indexed_end) have already been compared
+         */
+        size_t m_indexed_begin;
+        size_t m_indexed_end;
+
+        /**
+         * n_kinds bitmaps per block, in the order of Kind. Bit i of a bitmap is set if the character i of the block
+         * is of that kind.
+         */
+        std::unique_ptr<uint64_t[]> m_bitmaps;
+        size_t m_n_blocks;
+        size_t m_capacity;
+    };
+  }
+}
+
+#endif // UTIL_LINE_SCANNER_HPP
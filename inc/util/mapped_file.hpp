@@ -0,0 +1,119 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_MAPPED_FILE_HPP
+#define UTIL_MAPPED_FILE_HPP
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ebi
+{
+  namespace util
+  {
+    /**
+     * Read-only memory mapping of a whole regular file.
+     *
+     * The file is expected to be read sequentially from the beginning, and the pages already read can be dropped
+     * with `release_until`, so the resident memory does not grow with the size of the file.
+     */
+    class MappedFile
+    {
+      public:
+        /**
+         * @return whether `path` is a regular file that can be mapped (i.e. not a pipe, socket or terminal)
+         */
+        static bool is_mappable(std::string const & path)
+        {
+            struct stat info;
+            return stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode);
+        }
+
+        /**
+         * @throw std::runtime_error if the file can't be opened or mapped
+         */
+        MappedFile(std::string const & path) : data{nullptr}, length{0}, released{0}
+        {
+            int fd = open(path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                throw std::runtime_error{"Couldn't open file " + path + ": " + std::strerror(errno)};
+            }
+
+            struct stat info;
+            if (fstat(fd, &info) != 0) {
+                close(fd);
+                throw std::runtime_error{"Couldn't read the size of file " + path + ": " + std::strerror(errno)};
+            }
+            length = static_cast<size_t>(info.st_size);
+
+            if (length > 0) {
+                void * mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapping == MAP_FAILED) {
+                    close(fd);
+                    throw std::runtime_error{"Couldn't map file " + path + ": " + std::strerror(errno)};
+                }
+                data = static_cast<char const *>(mapping);
+                madvise(mapping, length, MADV_SEQUENTIAL);
+            }
+
+            // The mapping is kept even after closing the file descriptor
+            close(fd);
+        }
+
+        ~MappedFile()
+        {
+            if (data != nullptr) {
+                munmap(const_cast<char *>(data), length);
+            }
+        }
+
+        MappedFile(MappedFile const &) = delete;
+        MappedFile & operator=(MappedFile const &) = delete;
+
+        char const * begin() const { return data; }
+        char const * end() const { return data + length; }
+        size_t size() const { return length; }
+
+        /**
+         * Drops from memory the whole pages between the beginning of the file and `position`, which must not be
+         * accessed again. Partial pages are kept until a later call covers them completely.
+         */
+        void release_until(char const * position)
+        {
+            size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            size_t offset = static_cast<size_t>(position - data) / page_size * page_size;
+            if (offset > released) {
+                madvise(const_cast<char *>(data + released), offset - released, MADV_DONTNEED);
+                released = offset;
+            }
+        }
+
+      private:
+        char const * data;
+        size_t length;
+        size_t released;    ///< bytes at the beginning of the mapping that have been already dropped from memory
+    };
+  }
+}
+
+#endif // UTIL_MAPPED_FILE_HPP
@@ -0,0 +1,52 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef UTIL_NUMBER_SCANNER_HPP
+#define UTIL_NUMBER_SCANNER_HPP
+
+#include <cstdint>
+
+namespace ebi
+{
+  namespace util
+  {
+    enum class NumberStatus
+    {
+        valid,
+        invalid,        ///< the text is not a number of the requested kind
+        out_of_range    ///< the syntax is right but the value doesn't fit, `value` is left at the nearest limit
+    };
+
+    /**
+     * Reads the whole of [begin, end) as a decimal integer: an optional sign followed by digits.
+     *
+     * Unlike std::stoi, nothing is allocated or thrown, and whitespace or any text after the digits make it invalid.
+     */
+    NumberStatus scan_integer(char const * begin, char const * end, int64_t & value);
+
+    /**
+     * Reads the whole of [begin, end) as a floating-point number, with the syntax of the VCF specification:
+     * `[-+]?(\.[0-9]+|[0-9]+(\.[0-9]*)?)([eE][-+]?[0-9]+)?`, or `[-+]?(INF|INFINITY|NAN)` in any case.
+     *
+     * Unlike std::stof, the decimal separator is always '.', whatever the locale. Numbers too small to be represented
+     * are valid and read as zero.
+     */
+    NumberStatus scan_float(char const * begin, char const * end, double & value);
+  }
+}
+
+#endif // UTIL_NUMBER_SCANNER_HPP
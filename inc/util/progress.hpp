@@ -0,0 +1,93 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_PROGRESS_HPP
+#define UTIL_PROGRESS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace ebi
+{
+  namespace util
+  {
+    size_t const default_progress_interval = 10;
+
+    /**
+     * Amount of work done by all the validations of the process. Parsers add to the counters once per buffer, and
+     * report writers once per error or warning, with relaxed operations: the values are only used to show progress.
+     */
+    struct ProgressCounters
+    {
+        std::atomic<uint64_t> lines{0};
+        std::atomic<uint64_t> bytes{0};     ///< text parsed, after any decompression
+        std::atomic<uint64_t> records{0};
+        std::atomic<uint64_t> errors{0};
+        std::atomic<uint64_t> warnings{0};
+    };
+
+    ProgressCounters & progress_counters();
+
+    struct ProgressOptions
+    {
+        size_t interval;        ///< seconds between reports, or 0 to report only on SIGUSR1
+        std::string path;       ///< JSON file rewritten on each report, or empty to write to stderr
+        uint64_t total_bytes;   ///< size of the text to parse, or 0 if unknown (then there is no ETA)
+    };
+
+    /**
+     * Writes the progress counters from a background thread: periodically, whenever the process receives SIGUSR1,
+     * and once more when destroyed. Only one reporter should exist at a time, as it owns the SIGUSR1 handler.
+     */
+    class ProgressReporter
+    {
+      public:
+        explicit ProgressReporter(ProgressOptions const & options);
+        ~ProgressReporter();
+
+        ProgressReporter(ProgressReporter const &) = delete;
+        ProgressReporter & operator=(ProgressReporter const &) = delete;
+
+        /**
+         * Writes the current values of the counters, with the rate since the previous report
+         */
+        void report();
+
+      private:
+        void run();
+
+        ProgressOptions options;
+        std::chrono::steady_clock::time_point start;
+
+        std::mutex report_mutex;
+        std::chrono::steady_clock::time_point last_report;
+        uint64_t last_bytes;
+
+        std::mutex mutex;
+        std::condition_variable stopped;
+        bool stopping;
+        void (*previous_handler)(int);
+        std::thread thread;
+    };
+  }
+}
+
+#endif // UTIL_PROGRESS_HPP
@@ -0,0 +1,72 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UTIL_READ_AHEAD_HPP
+#define UTIL_READ_AHEAD_HPP
+
+#include <exception>
+#include <iostream>
+#include <streambuf>
+#include <thread>
+
+#include "util/buffer_ring.hpp"
+
+namespace ebi
+{
+  namespace util
+  {
+    size_t const default_read_ahead_buffer_size = 4 * 1024 * 1024;
+    size_t const default_read_ahead_buffers = 3;
+
+    /**
+     * Stream buffer that reads another stream ahead of its reader.
+     *
+     * A separate thread fills a ring of buffers from the input, so waiting for the disk (or the network, or the
+     * process writing to a pipe) overlaps with the parsing of the data already read.
+     *
+     * Reading errors are rethrown from the reading thread. When wrapping this buffer in an std::istream, call
+     * `exceptions(std::ios::badbit)` on it so those errors are not silently turned into EOF.
+     */
+    class ReadAheadStreambuf : public std::streambuf
+    {
+      public:
+        ReadAheadStreambuf(std::istream &input,
+                           size_t buffer_size = default_read_ahead_buffer_size,
+                           size_t n_buffers = default_read_ahead_buffers);
+
+        ~ReadAheadStreambuf();
+
+        ReadAheadStreambuf(ReadAheadStreambuf const &) = delete;
+        ReadAheadStreambuf & operator=(ReadAheadStreambuf const &) = delete;
+
+      protected:
+        int_type underflow() override;
+
+      private:
+        void read_input();
+
+        std::istream &input;
+
+        BufferRing ring;
+        BufferRing::Buffer * current;
+
+        std::exception_ptr error;
+        std::thread reader;
+    };
+  }
+}
+
+#endif // UTIL_READ_AHEAD_HPP
@@ -20,8 +20,11 @@
 #include <iostream>
 #include <vector>
 #include <map>
+#include <mutex>
 #include <string>
 #include <functional>
+#include <streambuf>
+#include <utility>
 
 namespace ebi
 {
@@ -63,6 +66,91 @@ namespace ebi
         return container;
     }
 
+    /**
+     * Reads up to `size` characters, or until end of file, without looking for line boundaries. The last line in the
+     * returned block may be incomplete and continue in the next block.
+     *
+     *  ```
+     *  while (readblock(stream, block, size).size() != 0) {
+     *      parser.parse(block);
+     *  }
+     *  ```
+     * @param stream input stream that will be consumed
+     * @param container will be cleared and filled with the characters read
+     * @param size maximum amount of characters to read, must be greater than zero
+     * @return the block read. this is another reference to the second parameter.
+     */
+    template <typename Container>
+    Container &readblock(std::istream & stream, Container & container, size_t size)
+    {
+        container.resize(size);
+        stream.read(&container[0], size);
+        container.resize(static_cast<size_t>(stream.gcount()));
+
+        return container;
+    }
+
+    /**
+     * Stream buffer that reads from a range of memory without copying it, so it can be used through an std::istream
+     */
+    class RangeStreambuf : public std::streambuf
+    {
+      public:
+        RangeStreambuf(char const * begin, char const * end)
+        {
+            // The get area is never written to, so casting away the const is safe
+            char * first = const_cast<char *>(begin);
+            setg(first, first, const_cast<char *>(end));
+        }
+    };
+
+    /**
+     * Stream buffer that writes each complete line to another stream after a prefix, holding a mutex shared with
+     * other writers of that stream, so the lines of several threads are not mixed. Only the current line is kept in
+     * memory; an incomplete last line is written when the buffer is destroyed.
+     */
+    class PrefixedLineStreambuf : public std::streambuf
+    {
+      public:
+        PrefixedLineStreambuf(std::ostream & output, std::mutex & output_mutex, std::string prefix)
+            : output(output), output_mutex(output_mutex), prefix(std::move(prefix))
+        {
+        }
+
+        ~PrefixedLineStreambuf()
+        {
+            if (!line.empty()) {
+                line.push_back('\n');
+                write_line();
+            }
+        }
+
+      protected:
+        int_type overflow(int_type c) override
+        {
+            if (!traits_type::eq_int_type(c, traits_type::eof())) {
+                line.push_back(traits_type::to_char_type(c));
+                if (c == '\n') {
+                    write_line();
+                }
+            }
+            return traits_type::not_eof(c);
+        }
+
+      private:
+        void write_line()
+        {
+            std::lock_guard<std::mutex> lock{output_mutex};
+            output << prefix << line << std::flush;
+            line.clear();
+        }
+
+        std::ostream & output;
+        std::mutex & output_mutex;
+        std::string prefix;
+        std::string line;
+    };
+
     template <typename Container>
     std::ostream & writeline(std::ostream & stream, const Container & container)
     {
@@ -0,0 +1,216 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_BCF_PARSER_HPP
+#define VCF_BCF_PARSER_HPP
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Size of the magic string "BCF\2\2" plus the length of the header text, which start a BCF file
+     */
+    size_t const bcf_fixed_header_size = 9;
+
+    /**
+     * @return whether `data` starts like an uncompressed BCF2 file
+     */
+    bool is_bcf(char const * data, size_t size);
+
+    /**
+     * Dictionaries that BCF records use instead of the names of contigs, filters, INFO and FORMAT fields. They are
+     * read from the meta section of the header text, following the BCF2 specification.
+     */
+    struct BcfHeader
+    {
+        BcfHeader(std::string const & text);
+
+        std::vector<std::string> strings;   ///< IDs of FILTER, INFO and FORMAT, with PASS always first
+        std::vector<std::string> contigs;
+        std::set<std::string> info_flags;   ///< INFO fields of type Flag, which are written without value
+        size_t n_samples;
+    };
+
+    /**
+     * Decodes the typed values of a BCF record into the tokens of each column of the equivalent VCF line, grouped
+     * as the VCF parsers do: CHROM, POS, ID, REF, ALT, QUAL, FILTER, INFO, and then FORMAT and a token per sample
+     * if the record contains samples. The numbers among them are also stored in `typed`, so the checks of the
+     * record don't need to read them back from their text.
+     *
+     * @throw BodySectionError* (or a subclass) if the record is not well-formed
+     */
+    void decode_bcf_record(char const * shared,
+                           size_t l_shared,
+                           char const * indiv,
+                           size_t l_indiv,
+                           BcfHeader const & header,
+                           size_t line,
+                           std::vector<std::vector<std::string>> & columns,
+                           TypedFields & typed);
+
+    /**
+     * Parser for the records of a BCF file, once its header has been validated by a VCF parser sharing the same
+     * Source.
+     *
+     * Each record is decoded into the same tokens the VCF parsers provide to the ParsePolicy, so the records are
+     * built and checked exactly as those in a VCF file. Errors are reported with the number of the line the record
+     * would have in the equivalent VCF file.
+     */
+    template <typename Configuration>
+    class BcfParser
+    : public ParserImpl,
+      Configuration::ParsePolicy,
+      Configuration::ErrorPolicy,
+      Configuration::OptionalPolicy
+    {
+      public:
+        using ParsePolicy = typename Configuration::ParsePolicy;
+        using ErrorPolicy = typename Configuration::ErrorPolicy;
+        using OptionalPolicy = typename Configuration::OptionalPolicy;
+
+        /**
+         * @param n_lines line number of the first record
+         */
+        BcfParser(std::shared_ptr<Source> source, BcfHeader const & header, size_t n_lines);
+
+      private:
+        void parse_buffer(char const * p, char const * pe, char const * eof) override;
+
+        /**
+         * @return amount of bytes of [begin, end) used by complete records
+         */
+        size_t parse_records(char const * begin, char const * end);
+        void parse_record(char const * shared, size_t l_shared, char const * indiv, size_t l_indiv);
+
+        BcfHeader header;
+        std::vector<char> pending;  ///< beginning of a record that continues in the next buffer
+        std::vector<std::vector<std::string>> columns;
+        TypedFields typed;
+    };
+
+    using QuickBcfValidator = BcfParser<QuickValidatorCfg>;
+    using FullBcfValidator = BcfParser<FullValidatorCfg>;
+    using BcfReader = BcfParser<ReaderCfg>;
+
+    inline uint32_t read_bcf_uint32(char const * data)
+    {
+        auto bytes = reinterpret_cast<unsigned char const *>(data);
+        return uint32_t(bytes[0]) | (uint32_t(bytes[1]) << 8) | (uint32_t(bytes[2]) << 16)
+                | (uint32_t(bytes[3]) << 24);
+    }
+
+    template <typename Configuration>
+    BcfParser<Configuration>::BcfParser(std::shared_ptr<Source> source, BcfHeader const & header, size_t n_lines)
+    : ParserImpl{source}, header(header), pending{}, columns{}, typed{}
+    {
+        ParsingState::n_lines = n_lines;
+        // The records are checked with the values decoded from each of them, instead of their text
+        typed_fields = &typed;
+    }
+
+    template <typename Configuration>
+    void BcfParser<Configuration>::parse_buffer(char const * p, char const * pe, char const * eof)
+    {
+        if (pending.empty()) {
+            // Records are read in place, and only an incomplete one at the end is kept for the next buffer
+            p += parse_records(p, pe);
+            pending.assign(p, pe);
+        } else {
+            pending.insert(pending.end(), p, pe);
+            size_t used = parse_records(pending.data(), pending.data() + pending.size());
+            pending.erase(pending.begin(), pending.begin() + used);
+        }
+
+        if (eof != nullptr && !pending.empty()) {
+            pending.clear();
+            ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "The last BCF record is truncated"});
+        }
+    }
+
+    template <typename Configuration>
+    size_t BcfParser<Configuration>::parse_records(char const * begin, char const * end)
+    {
+        char const * record = begin;
+        while (end - record >= 8) {
+            size_t l_shared = read_bcf_uint32(record);
+            size_t l_indiv = read_bcf_uint32(record + 4);
+            if (static_cast<size_t>(end - record - 8) < l_shared + l_indiv) {
+                break;
+            }
+            parse_record(record + 8, l_shared, record + 8 + l_shared, l_indiv);
+            record += 8 + l_shared + l_indiv;
+        }
+        return record - begin;
+    }
+
+    template <typename Configuration>
+    void BcfParser<Configuration>::parse_record(char const * shared, size_t l_shared,
+                                                char const * indiv, size_t l_indiv)
+    {
+        ++n_records;
+        try {
+            columns.clear();
+            typed.clear();
+            decode_bcf_record(shared, l_shared, indiv, l_indiv, header, n_lines, columns, typed);
+            for (size_t i = 0; i < columns.size(); ++i) {
+                for (auto & token : columns[i]) {
+                    ParsePolicy::handle_token_end(*this, token);
+                }
+                ParsePolicy::handle_column_end(*this, i + 1);
+            }
+
+            // From here on, the same as the record_end action of the VCF parsers
+            ParsePolicy::handle_body_line(*this);
+
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
+
+            if (record != nullptr) {
+                auto duplicated_errors = previous_records.check_duplicates(*record);
+                for (auto &error_ptr : duplicated_errors) {
+                    ErrorPolicy::handle_error(*this, error_ptr.release());
+                }
+            }
+
+            try {
+                if (record != nullptr) {
+                    OptionalPolicy::optional_check_body_entry(*this, *record);
+                }
+            } catch (Error *warn) {
+                ErrorPolicy::handle_warning(*this, warn);
+            }
+        } catch (Error *error) {
+            ErrorPolicy::handle_error(*this, error);
+        }
+
+        ParsePolicy::handle_newline(*this);
+        ++n_lines;
+    }
+  }
+}
+
+#endif // VCF_BCF_PARSER_HPP
@@ -0,0 +1,113 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_CHECKPOINT_HPP
+#define VCF_CHECKPOINT_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vcf/normalizer.hpp"
+#include "vcf/sorting_checker.hpp"
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    size_t const default_checkpoint_interval = 300;
+
+    /**
+     * State of a validation at the beginning of a line of the body, from which it can be resumed later.
+     *
+     * The meta and header sections are not stored: they are parsed again when resuming, which rebuilds the Source
+     * without reporting their errors a second time. Offsets are counted in the text, after any decompression.
+     */
+    struct Checkpoint
+    {
+        std::string source;         ///< name of the validated input
+        ValidationLevel level;
+        Version version;
+
+        uint64_t header_end;        ///< length of the meta and header sections
+        uint64_t offset;            ///< position of the next line to parse
+        size_t n_lines;             ///< number of that line
+        int state;                  ///< state of the parser at the beginning of that line, see Parser::state
+        bool valid;                 ///< whether the input was valid up to that line
+        size_t n_reports;           ///< errors and warnings written before that line
+
+        SortingChecker sorting;
+        std::vector<RecordCore> records;    ///< previous records remembered to detect duplicates
+    };
+
+    /**
+     * Where and how often checkpoints are written, and whether the validation resumes from the one in `path`
+     */
+    struct CheckpointOptions
+    {
+        std::string path;
+        size_t interval;            ///< seconds between checkpoints, 0 to write one after each block of text
+        bool resume;
+    };
+
+    /**
+     * Writes a checkpoint as a text file. A temporary file is replaced at the end, so an interruption while writing
+     * leaves the previous checkpoint intact.
+     *
+     * @throw std::runtime_error if the file can't be written
+     */
+    void write_checkpoint(std::string const & path, Checkpoint const & checkpoint);
+
+    /**
+     * @throw std::runtime_error if the file can't be read or is not a checkpoint
+     */
+    Checkpoint read_checkpoint(std::string const & path);
+
+    /**
+     * Validates the VCF contents of a stream, which may be compressed with gzip or BGZF, writing checkpoints
+     * periodically. If `options.resume` is set, the validation continues from the checkpoint instead of the
+     * beginning, and the report writers are told to drop the reports written after it.
+     *
+     * The body is always parsed by a single thread, so the checkpoints are taken at line boundaries of one parser.
+     * Plain files are seeked to the checkpoint, while compressed ones are decompressed up to it.
+     *
+     * @param n_threads amount of threads decompressing BGZF blocks
+     * @throw std::runtime_error if the input is BCF, or if the checkpoint doesn't belong to this input
+     */
+    bool is_valid_vcf_file(std::istream &input,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           Ploidy ploidy,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           CheckpointOptions const &options,
+                           size_t n_threads = 1);
+
+    /**
+     * Same as above, for a memory-mapped VCF file
+     */
+    bool is_valid_vcf_file(util::MappedFile &input,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           Ploidy ploidy,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           CheckpointOptions const &options);
+  }
+}
+
+#endif // VCF_CHECKPOINT_HPP
@@ -0,0 +1,68 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VCF_ERROR_THROWER_HPP
+#define VCF_ERROR_THROWER_HPP
+
+#include "error.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Throws an error as a pointer to its dynamic type, like a `throw new XxxError{...}` would.
+     *
+     * This is needed to throw errors that were collected before as `Error *`, so callers can still catch each specific
+     * type of error. Use it like this:
+     * ~~~
+     * ErrorThrower{}.raise(error.release());
+     * ~~~
+     */
+    class ErrorThrower : public ErrorVisitor
+    {
+      public:
+        [[noreturn]] void raise(Error *error)
+        {
+            error->apply_visitor(*this);
+            throw error;    // not reached, every visit throws
+        }
+
+        virtual void visit(Error &error) { throw &error; }
+        virtual void visit(MetaSectionError &error) { throw &error; }
+        virtual void visit(HeaderSectionError &error) { throw &error; }
+        virtual void visit(BodySectionError &error) { throw &error; }
+        virtual void visit(NoMetaDefinitionError &error) { throw &error; }
+        virtual void visit(FileformatError &error) { throw &error; }
+        virtual void visit(ChromosomeBodyError &error) { throw &error; }
+        virtual void visit(PositionBodyError &error) { throw &error; }
+        virtual void visit(IdBodyError &error) { throw &error; }
+        virtual void visit(ReferenceAlleleBodyError &error) { throw &error; }
+        virtual void visit(AlternateAllelesBodyError &error) { throw &error; }
+        virtual void visit(QualityBodyError &error) { throw &error; }
+        virtual void visit(FilterBodyError &error) { throw &error; }
+        virtual void visit(InfoBodyError &error) { throw &error; }
+        virtual void visit(FormatBodyError &error) { throw &error; }
+        virtual void visit(SamplesBodyError &error) { throw &error; }
+        virtual void visit(SamplesFieldBodyError &error) { throw &error; }
+        virtual void visit(NormalizationError &error) { throw &error; }
+        virtual void visit(DuplicationError &error) { throw &error; }
+    };
+  }
+}
+
+#endif // VCF_ERROR_THROWER_HPP
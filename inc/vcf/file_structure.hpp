@@ -23,12 +23,14 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/variant.hpp>
 
 #include "util/stream_utils.hpp"
 #include "vcf/error.hpp"
+#include "vcf/genotype.hpp"
 #include "vcf/ploidy.hpp"
 
 namespace ebi
@@ -39,7 +41,7 @@ namespace ebi
     struct MetaEntry;
     struct Record;
     
-    typedef std::multimap<std::string, MetaEntry>::iterator meta_iterator;
+    typedef std::multimap<std::string, MetaEntry>::const_iterator meta_iterator;
 
     enum InputFormat 
     {
@@ -186,6 +188,32 @@ namespace ebi
         void check_value();
     };
     
+    /**
+     * How many values an INFO or FORMAT field has: a fixed count, one per alternate allele (A), one per allele
+     * including the reference (R), one per genotype (G), or unknown (.)
+     */
+    enum class NumberKind { fixed, alternate_alleles, alleles, genotypes, unknown, invalid };
+
+    enum class FieldType { integer, floating, flag, character, string, other };
+
+    /**
+     * Number and Type of an INFO or FORMAT field, parsed once from their text
+     */
+    struct FieldDefinition
+    {
+        std::string id;
+        std::string number;         ///< as written in the meta section, to be shown in error messages
+        std::string type;
+
+        NumberKind number_kind;
+        long number_count;          ///< count of values if number_kind is fixed
+        FieldType field_type;
+
+        FieldDefinition(std::string const & id, std::string const & number, std::string const & type);
+    };
+
+    typedef std::unordered_map<std::string, FieldDefinition> FieldDictionary;
+
     struct Source 
     {
         std::string name;           /**< Name of the source to interact with (file, stdin...) */
@@ -193,7 +221,6 @@ namespace ebi
         Version version;            /**< VCF version */
         Ploidy ploidy;              /**< Class that keeps track of the ploidy of every contig */
 
-        std::multimap<std::string, MetaEntry> meta_entries; /**< Entries in the file meta-data */
         std::vector<std::string> samples_names; /**< Names of the sequenced samples */
         
         Source(std::string const & name,
@@ -202,9 +229,94 @@ namespace ebi
                Ploidy ploidy,
                std::multimap<std::string, MetaEntry> const & meta_entries = {},
                std::vector<std::string> const & samples_names = {});
-        
+
+        /**
+         * Entries in the file meta-data
+         */
+        std::multimap<std::string, MetaEntry> const & meta_entries() const;
+
+        /**
+         * Adds an entry to the meta-data. INFO and FORMAT definitions are added to the dictionaries that the records
+         * are checked against, unless one with the same ID was added before.
+         */
+        void add_meta(MetaEntry const & meta);
+
+        /**
+         * Definitions of the INFO and FORMAT fields described in the meta section, or nullptr if there is none with
+         * that ID. If there are several, the first one is returned. The definitions returned stay valid while the
+         * Source lives, even if more entries are added.
+         */
+        FieldDefinition const * info_definition(std::string const & id) const;
+        FieldDefinition const * format_definition(std::string const & id) const;
+
+      private:
+        void add_field_definition(MetaEntry const & meta);
+
+        // Only changed through add_meta, so the dictionaries never miss an entry
+        std::multimap<std::string, MetaEntry> meta_entry_map;
+        FieldDictionary info_definitions;
+        FieldDictionary format_definitions;
     };
     
+    /**
+     * What the checks of a record need from its FORMAT column. Most records of a file share one of a few FORMAT
+     * columns, so a parser resolves each of them once and passes the result to all the records that list it.
+     */
+    struct FormatSpec
+    {
+        std::vector<FieldDefinition const *> definitions;   ///< by position, nullptr if not in the meta section
+        bool gt_misplaced;          ///< whether GT is listed, but not in the first position
+        bool duplicated;            ///< whether some field is listed more than once
+
+        FormatSpec(Source const & source, std::vector<std::string> const & format);
+    };
+
+    /**
+     * Errors found in a record, in the order they were found
+     */
+    typedef std::vector<std::unique_ptr<Error>> RecordErrors;
+
+    enum class ValueKind { text, integer, floating };
+
+    /**
+     * Values of an INFO field or a sample subfield as a binary file (BCF) stores them, so the numeric ones are
+     * checked without reading them back from their text
+     */
+    struct TypedValues
+    {
+        struct Value
+        {
+            bool missing;
+            double number;  ///< integers are stored in 32 bits, so they are exact too
+        };
+
+        ValueKind kind;     ///< text if the values are strings or genotypes, which are checked from their text
+        std::vector<Value> values;
+    };
+
+    /**
+     * Typed values of the fields of a record read from a binary file
+     */
+    struct TypedFields
+    {
+        float quality;                                  ///< 0 if missing, as in the Record
+        std::map<std::string, TypedValues> info;        ///< by key
+        std::vector<std::vector<TypedValues>> samples;  ///< by sample, and then by position in the FORMAT column
+
+        void clear();
+
+        /**
+         * @return the numeric values of an INFO field, or nullptr if they are only available as text
+         */
+        TypedValues const * info_values(std::string const & key) const;
+
+        /**
+         * @return the numeric values of the subfield `j` of the sample `i`, or nullptr if they are only available
+         * as text
+         */
+        TypedValues const * sample_values(size_t i, size_t j) const;
+    };
+
     struct Record 
     {
         size_t line;
@@ -222,10 +334,21 @@ namespace ebi
         std::map<std::string, std::string> info;
         std::vector<std::string> format;
 
-        std::vector<std::string> samples;
+        std::vector<std::string> samples;   ///< split into subfields once, on demand, so not to be modified later
 
         std::shared_ptr<Source> source;
+        std::shared_ptr<FormatSpec const> format_spec;
+        size_t ploidy;                      ///< of the contig of the record, resolved once from the source
 
+        /**
+         * Builds a record and runs all its checks. If `errors` is provided, every error found is added there and the
+         * record is built anyway; otherwise the first error is thrown.
+         *
+         * @param format_spec resolution of `format`, which is built from the source if not provided
+         * @param typed values of the INFO fields and samples as read from a binary file, checked instead of their
+         * text when they are numeric
+         * @throw Error* if some check fails and `errors` is not provided
+         */
         Record(size_t line,
                 std::string const & chromosome,
                 size_t position,
@@ -236,65 +359,97 @@ namespace ebi
                 std::vector<std::string> const & filters,
                 std::map<std::string, std::string> const & info,
                 std::vector<std::string> const & format,
-                std::vector<std::string> const & samples,
-                std::shared_ptr<Source> source);
+                std::vector<std::string> samples,
+                std::shared_ptr<Source> source,
+                std::shared_ptr<FormatSpec const> format_spec = nullptr,
+                RecordErrors * errors = nullptr,
+                TypedFields const * typed = nullptr);
         
         bool operator==(Record const &) const;
 
         bool operator!=(Record const &) const;
+
+        /**
+         * Number of subfields in the sample `i`, split by colons
+         */
+        size_t n_sample_subfields(size_t i) const;
+
+        /**
+         * Subfield `j` of the sample `i`, or an empty string if the sample has less subfields
+         */
+        std::string sample_subfield(size_t i, size_t j) const;
+
+        /**
+         * Alleles of the GT subfield of the sample `i`, checked against the alternate alleles. The FORMAT column
+         * must start with GT. All the genotypes are read together the first time this is called.
+         */
+        GenotypeAlleles const & sample_genotype(size_t i) const;
         
     private:
+
+        /**
+         * Offsets where each subfield of the samples ends, all the samples one after another, and the index of the
+         * first subfield of each sample (plus one past the last sample). They are empty until the samples are split
+         * for the first time, so the samples are only tokenized when some check needs their subfields.
+         */
+        mutable std::vector<size_t> sample_subfield_ends;
+        mutable std::vector<size_t> sample_first_subfield;
+        mutable std::vector<GenotypeAlleles> sample_genotypes;
+
+        void split_sample_subfields() const;
+
+        void sample_subfield_bounds(size_t i, size_t j, size_t & begin, size_t & end) const;
         
         void set_types();
         
         /**
          * Checks that chromosome does not contain colons or white-spaces
          * 
-         * @throw ChromosomeBodyError
+         * @param errors where the ChromosomeBodyErrors found are added
          */
-        void check_chromosome() const;
+        void check_chromosome(RecordErrors & errors) const;
 
         /**
          * Checks that chromosome does not contain any colons
          * 
-         * @throw ChromosomeBodyError
+         * @param errors where the ChromosomeBodyErrors found are added
          */
-        void check_chromosome_no_colons() const;
+        void check_chromosome_no_colons(RecordErrors & errors) const;
 
         /**
          * Checks that chromosome does not contain any white-spaces
          * 
-         * @throw ChromosomeBodyError
+         * @param errors where the ChromosomeBodyErrors found are added
          */
-        void check_chromosome_no_whitespaces() const;
+        void check_chromosome_no_whitespaces(RecordErrors & errors) const;
 
         /**
          * Checks that IDs are alphanumeric and do not contain duplicate values
          * 
-         * @throw IdBodyError
+         * @param errors where the IdBodyErrors found are added
          */
-        void check_ids() const;
+        void check_ids(RecordErrors & errors) const;
         
         /**
          * Checks that ID contains no semicolons or white-spaces
          * 
-         * @throw IdBodyError
+         * @param errors where the IdBodyErrors found are added
          */
-        void check_ids_no_semicolons_whitespaces() const;
+        void check_ids_no_semicolons_whitespaces(RecordErrors & errors) const;
 
         /**
          * Checks that ID contains no duplicate values in the same line
          * 
-         * @throw IdBodyError
+         * @param errors where the IdBodyErrors found are added
          */
-        void check_ids_no_duplicates() const;
+        void check_ids_no_duplicates(RecordErrors & errors) const;
 
         /**
          * Checks the structure of an alternate allele and its accordance to the meta section
          * 
-         * @throw AlternateAllelesBodyError
+         * @param errors where the AlternateAllelesBodyErrors found are added
          */
-        void check_alternate_alleles() const;
+        void check_alternate_alleles(RecordErrors & errors) const;
         
         /**
          * Checks the structure of an alternate allele against the reference:
@@ -302,74 +457,77 @@ namespace ebi
          * - Is not the same as the reference
          * - Shares the first nucleotide with the reference (does not apply to SV, break-ends and custom ALTs)
          * 
-         * @throw AlternateAllelesBodyError
+         * @param errors where the AlternateAllelesBodyErrors found are added
          */
-        void check_alternate_allele_structure(std::string const & alternate, RecordType type) const;
+        void check_alternate_allele_structure(std::string const & alternate, RecordType type, RecordErrors & errors) const;
         
         /**
          * Check that alternates of the form <SOME_ALT> begin with DEL, INS, DUP, INV or CNV
          * 
-         * @throw AlternateAllelesBodyError
+         * @param errors where the AlternateAllelesBodyErrors found are added
          */
-        void check_alternate_allele_symbolic_prefix(std::string const & alternate) const;
+        void check_alternate_allele_symbolic_prefix(std::string const & alternate, RecordErrors & errors) const;
         
         /**
          * Checks that quality is zero or greater
          * 
-         * @throw QualityBodyError
+         * @param errors where the QualityBodyErrors found are added
          */
-        void check_quality() const;
+        void check_quality(RecordErrors & errors) const;
         
         /**
          * Checks that all the filters are listed in the meta section
          * 
-         * @throw FilterBodyError
+         * @param errors where the FilterBodyErrors found are added
          */
-        void check_filter() const;
+        void check_filter(RecordErrors & errors) const;
         
         /**
          * Checks that all the INFO fields are listed in the meta section, and their number and 
          * type match those specifications
          * 
-         * @throw InfoBodyError
+         * @param typed numeric values of the INFO fields, checked instead of their text
+         * @param errors where the InfoBodyErrors found are added
          */
-        void check_info() const;
+        void check_info(TypedFields const * typed, RecordErrors & errors) const;
         
         /**
          * Checks that format starts with GT and has no duplicate fields
          * 
-         * @throw FormatBodyError
+         * @param errors where the FormatBodyErrors found are added
          */
-        void check_format() const;
+        void check_format(RecordErrors & errors) const;
 
         /**
          * Checks that GT is the first field in the FORMAT column
          * 
-         * @throw FormatBodyError
+         * @param errors where the FormatBodyErrors found are added
          */
-        void check_format_GT() const;
+        void check_format_GT(RecordErrors & errors) const;
 
         /**
          * Checks that format has no duplicate fields
          * 
-         * @throw FormatBodyError
+         * @param errors where the FormatBodyErrors found are added
          */
-        void check_format_no_duplicates() const;
+        void check_format_no_duplicates(RecordErrors & errors) const;
 
         /**
          * Checks that predefined tags are consistent with the specification
          *
-         * @throw std::invalid_argument
+         * @return whether they are, leaving the reason in `message` otherwise
          */
-        void check_predefined_tag(std::string const & field_key, std::string const & field_value, std::vector<std::string> const & values,
-                                  std::map<std::string, std::pair<std::string, std::string>> const & tags) const;
+        bool check_predefined_tag(std::string const & field_key, std::string const & field_value, std::vector<std::string> const & values,
+                                  TypedValues const * typed, FieldDictionary const & tags, std::string & message) const;
 
         /**
          * Strict validation of predefined INFO tags
          *
-         * @throw InfoBodyError
+         * @param errors where the InfoBodyErrors found are added
+         * @return whether no error was found
          */
-        void strict_validation_info_predefined_tags(std::string const & field_key, std::string const & field_value) const;
+        bool strict_validation_info_predefined_tags(std::string const & field_key, std::string const & field_value,
+                                                    TypedValues const * typed, RecordErrors & errors) const;
 
        /**
          * Checks that the samples in the record:
@@ -377,113 +535,110 @@ namespace ebi
          * - Their allele indexes are not greater than the total number of alleles
          * - The number and type of the fields match the FORMAT meta information
          * 
-         * @throw SamplesBodyError
+         * @param typed numeric values of the samples, checked instead of their text
+         * @param errors where the SamplesBodyErrors found are added
          */
-        void check_samples() const;
+        void check_samples(TypedFields const * typed, RecordErrors & errors) const;
 
         /**
          * Checks that the number of samples matches those listed in the header line
          * 
-         * @throw SamplesBodyError
+         * @param errors where the SamplesBodyErrors found are added
          */
-        void check_samples_count() const;
-
-        /**
-         * Returns a vector of MetaEntry objects in the same order as they are displayed in the samples
-         */
-        std::vector<MetaEntry> get_meta_entry_objects() const;
+        void check_samples_count(RecordErrors & errors) const;
 
         /**
          * Checks the sample contents and accordance to the meta section
          * 
-         * @throw SamplesBodyError
-         * @throw SamplesFieldBodyError
+         * @param errors where the SamplesBodyErrors and SamplesFieldBodyErrors found are added
          */
-        void check_sample(size_t i, std::vector<MetaEntry> const & format_meta) const;
+        void check_sample(size_t i, std::vector<FieldDefinition const *> const & format_definitions,
+                          TypedFields const * typed, RecordErrors & errors) const;
 
         /**
          * Checks that the number of subfields in the sample is not greater than the number in the FORMAT column
          * 
-         * @throw SamplesBodyError
+         * @param errors where the SamplesBodyErrors found are added
+         * @return whether no error was found
          */
-        void check_sample_subfields_count(size_t i, std::vector<std::string> const & subfields) const;
+        bool check_sample_subfields_count(size_t i, RecordErrors & errors) const;
 
         /**
          * Checks that the cardinality and type of the fields in the sample match the FORMAT meta information
          * 
-         * @throw SamplesFieldBodyError
+         * @param errors where the SamplesFieldBodyErrors found are added
          */
-        void check_sample_subfields_cardinality_type(size_t i, std::vector<std::string> const & subfields, std::vector<MetaEntry> const & format_meta) const;
+        void check_sample_subfields_cardinality_type(size_t i,
+                                                     std::vector<FieldDefinition const *> const & format_definitions,
+                                                     TypedFields const * typed,
+                                                     RecordErrors & errors) const;
         
         /**
-         * Check that the allele indexes in a sample are not greater than the total number of alleles
-         * 
-         * @throw SamplesFieldBodyError
-         */
-        void check_sample_alleles(std::vector<std::string> const & subfields) const;
-
-        /**
-         * Checks that the allele index in a sample is an integer number
-         * 
-         * @throw SamplesFieldBodyError
-         */        
-        void check_sample_alleles_is_integer(std::string const & allele, long ploidy) const;
-
-        /**
-         * Checks that the allele index is in range
+         * Check that the allele indexes in a sample are integer numbers not greater than the total number of alleles
          * 
-         * @throw SamplesFieldBodyError
+         * @param errors where the SamplesFieldBodyErrors found are added
+         * @return whether no error was found
          */
-        void check_sample_alleles_range(std::string const & allele, long ploidy) const;
+        bool check_sample_alleles(size_t i, RecordErrors & errors) const;
 
         /**
-         * returns the expected number of elements, given a string code
-         * @param number one of ["A", "R", "G", ".", number], where
+         * returns the expected number of elements, given the Number of a field, which is one of ["A", "R", "G", ".", number], where
          *  - "A" is the amount of alleles,
          *  - "R" the amount of reference (1) plus alleles (A)
-         *  - "G" is `ploidy`-combination with repetition: ((R + ploidy -1) choose ploidy)
+         *  - "G" is `ploidy`-combination with repetition: ((R + ploidy -1) choose ploidy), see count_genotypes
          *  (e.g. with 1 reference, 2 alternate alleles (3 total alleles) and ploidy 2, it's 3 + 2 -1 choose 2, which is 6: 00, 01, 11, 02, 12, 22)
          *  - "." means unknown number of elements
          *  - number is a positive number [0, +inf)
-         * @param ploidy is the number of sets of chromosomes, so a given position in a chromosome needs `ploidy` bases to be completely specified
+         * The ploidy is the number of sets of chromosomes, so a given position in a chromosome needs `ploidy` bases to be completely specified
          * @param cardinality return by reference [0, +inf) for valid numbers. -1 if unknown number. 
-         * @throw std::invalid_argument if it's not a number
-         * @throw std::out_of_range if it's out of range.
          * @return bool: whether the number was valid or not
          */
-        bool is_valid_cardinality(std::string const & number, size_t alternate_allele_number, long & cardinality) const;
+        bool is_valid_cardinality(FieldDefinition const & definition, size_t alternate_allele_number, long & cardinality) const;
 
         /**
          * Checks that the values match either their type specified in the meta or the VCF specification for predefined tags not in meta
+         *
+         * @return whether it matches, leaving the reason in `message` otherwise (if there is a specific one)
          */
-        void check_value_type(std::string const & type, std::string const & value, std::string & message) const;
+        bool check_value_type(FieldType type, std::string const & value, std::string & message) const;
+
+        /**
+         * Same as the check of the text of a value, for a number read from a binary file. A number stored as a float
+         * is never an integer, even if it has no decimal digits.
+         */
+        bool check_value_type(FieldType type, ValueKind kind, double number, std::string & message) const;
 
 
         /**
          * Checks that every field in a sample matches the Number specification in the meta
          * Or if it is not present in the meta and is a predefined tag, check that it matches the VCF specification
          * 
-         * @throw std::invalid_argument
+         * @return whether it matches, leaving the reason in `message` otherwise
          */
-        void check_field_cardinality(std::string const & field,
-                                     std::vector<std::string> const & values,
-                                     std::string const & number) const;
+        bool check_field_cardinality(std::string const & field,
+                                     size_t n_values,
+                                     FieldDefinition const & definition,
+                                     std::string & message) const;
         
         /**
          * Checks that every field in a column matches the Type specification in the meta
          * Or if it is not present in the meta and is a predefined tag, check that it matches the VCF specification
+         * The typed values are checked instead of the text ones if provided.
          *
-         * @throw std::invalid_argument
+         * @return whether it matches, leaving the reason in `message` otherwise
          */
-        void check_field_type(std::vector<std::string> const & values,
-                              std::string const & type) const;
+        bool check_field_type(std::vector<std::string> const & values,
+                              TypedValues const * typed,
+                              FieldDefinition const & definition,
+                              std::string & message) const;
 
         /**
          * Checks that predefined tags with Type Integer have non-negative values
          *
-         * @throw std::invalid_argument
+         * @return whether they have, leaving the reason in `message` otherwise
          */
-        void check_field_integer_range(std::string const & field, std::vector<std::string> const & value) const;
+        bool check_field_integer_range(std::string const & field, std::vector<std::string> const & value,
+                                       TypedValues const * typed, std::string & message) const;
     };
 
     std::ostream &operator<<(std::ostream &os, const Record &record);
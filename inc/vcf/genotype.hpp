@@ -0,0 +1,65 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef VCF_GENOTYPE_HPP
+#define VCF_GENOTYPE_HPP
+
+#include <cstddef>
+
+namespace ebi
+{
+  namespace vcf
+  {
+    enum class AlleleError { none, not_integer, out_of_range };
+
+    /**
+     * Alleles of a GT subfield, summarized in a single pass over its characters
+     */
+    struct GenotypeAlleles
+    {
+        size_t ploidy;          ///< number of alleles, missing ones included
+        bool phased;            ///< whether no alleles are separated by '/'
+        long max_allele;        ///< greatest allele index, -1 if all the alleles are missing
+
+        AlleleError error;      ///< problem with the first allele that is not "." nor a valid index
+        size_t error_begin;     ///< offsets of that allele in the GT subfield
+        size_t error_end;
+        size_t error_value;     ///< index of that allele, if it is out of range
+    };
+
+    /**
+     * Reads the alleles of the GT subfield in [begin, end), separated by '/' or '|', and checks that each of them
+     * is "." or an index not greater than `max_index`.
+     *
+     * The alleles are split like util::string_split does, so a separator at the beginning is part of the first
+     * allele and one at the end is ignored. Diploid genotypes with single-digit alleles, like "0/1" or ".|.", are
+     * checked without looping over their characters.
+     */
+    GenotypeAlleles scan_genotype(char const * begin, char const * end, size_t max_index);
+
+    /**
+     * Number of different genotypes that `ploidy` alleles can form when chosen from `n_alleles`, which is the
+     * combination with repetition ((n_alleles + ploidy - 1) choose ploidy). This is the cardinality of Number=G fields.
+     *
+     * The common ploidies and allele counts are read from a table built on the first call. The result is exact, and
+     * std::numeric_limits<long>::max() if it doesn't fit in a long.
+     */
+    long count_genotypes(size_t ploidy, size_t n_alleles);
+  }
+}
+
+#endif // VCF_GENOTYPE_HPP
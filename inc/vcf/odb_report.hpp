@@ -39,11 +39,11 @@ namespace ebi
 
         OdbReportRW(const std::string &db_name);
         virtual ~OdbReportRW();
-        void flush();   // before reading, make sure you destroy or flush the writer OdbReportRW
-
         // ReportWriter implementation
         virtual void write_error(Error &error) override;
         virtual void write_warning(Error &error) override;
+        virtual void flush() override;   // before reading, make sure you destroy or flush the writer OdbReportRW
+        virtual void resume(size_t n_reports) override;
 
         // ReportReader implementation
         virtual size_t count_warnings() override;
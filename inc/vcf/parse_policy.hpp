@@ -17,12 +17,15 @@
 #ifndef VCF_PARSE_POLICY_HPP
 #define VCF_PARSE_POLICY_HPP
 
+#include <array>
+#include <deque>
 #include <map>
 #include <string>
 #include <vector>
 
 #include "parsing_state.hpp"
 #include "file_structure.hpp"
+#include "util/line_scanner.hpp"
 #include "util/string_utils.hpp"
 #include "error.hpp"
 
@@ -37,8 +40,19 @@ namespace ebi
     class IgnoreParsePolicy
     {
       public:
+        void handle_buffer_begin(ParsingState const & state, char const * p) {}
+        void handle_buffer_end(ParsingState const & state, char const * pe) {}
         void handle_token_begin(ParsingState const & state) {}
-        void handle_token_char(ParsingState const & state, char c) {}
+        void handle_token_char(ParsingState const & state, char const * p) {}
+        /**
+         * Token characters are not read, so parsing just goes on after `p`: stepping through a value costs less
+         * than looking for its end
+         */
+        char const * handle_long_value(ParsingState const & state, util::StructuralIndex & index, char const * p,
+                                       unsigned stop_kinds)
+        {
+            return p + 1;
+        }
         void handle_token_end(ParsingState const & state) {}
         void handle_token_end(ParsingState const & state, std::string token) {}
         void handle_newline(ParsingState const & state) {}
@@ -62,13 +76,42 @@ namespace ebi
 
     /**
      * Parsing policy that stores the parsed tokens for more thorough validations or future usage
+     *
+     * Tokens are kept as spans of the buffer being parsed, and only copied when the buffer ends before the line
+     * does. Those copies live in an arena that is reused line after line.
      */
     class StoreParsePolicy
     {
       public:
-
+        void handle_buffer_begin(ParsingState const & state, char const * p);
+        void handle_buffer_end(ParsingState const & state, char const * pe);
         void handle_token_begin(ParsingState const & state);
-        void handle_token_char(ParsingState const & state, char c);
+        void handle_token_char(ParsingState const & state, char const * p)
+        {
+            if (m_token_end != p) {
+                add_token_prefix();
+                m_token_begin = p;
+            }
+            m_token_end = p + 1;
+        }
+        /**
+         * Reads the characters after `p` up to the end of a value at once, if there are many of them. The last one
+         * is left to handle_token_char, and parsing goes on from the returned position.
+         */
+        char const * handle_long_value(ParsingState const & state, util::StructuralIndex & index, char const * p,
+                                       unsigned stop_kinds)
+        {
+            char const * value_end = index.find_after_long_run(p + 1, stop_kinds);
+            if (value_end == nullptr) {
+                return p + 1;
+            }
+            if (m_token_end != p) {
+                add_token_prefix();
+                m_token_begin = p;
+            }
+            m_token_end = value_end - 1;
+            return value_end;
+        }
         void handle_token_end(ParsingState const & state);
         void handle_token_end(ParsingState const & state, std::string token);
         void handle_newline(ParsingState const & state);
@@ -92,12 +135,53 @@ namespace ebi
 
       private:
 
-        void check_sorted(ParsingState &state, size_t position);
+        /**
+         * Characters [begin, end) of a token, either in the buffer being parsed or in the line arena
+         */
+        struct TokenSpan
+        {
+            char const * begin;
+            char const * end;
+
+            std::string str() const { return {begin, end}; }
+        };
+
+        /**
+         * Returns the token being currently parsed, which keeps growing if more characters are added to it
+         */
+        TokenSpan take_token();
+
+        /**
+         * Moves [begin, end) of the current token to its prefix
+         */
+        void add_token_prefix();
 
         /**
-         * Token being currently parsed
+         * Copies a token into the line arena
          */
-        std::string m_current_token;
+        TokenSpan store(char const * begin, char const * end);
+
+        std::vector<std::string> strings(std::vector<TokenSpan> const & tokens) const;
+
+        /**
+         * Token being currently parsed: the characters that can't be referenced by a single span, like those read
+         * from previous buffers, followed by [begin, end) of the current buffer
+         */
+        std::string m_token_prefix;
+        char const * m_token_begin = nullptr;
+        char const * m_token_end = nullptr;
+
+        /**
+         * Beginning of the buffer being parsed
+         */
+        char const * m_buffer_begin = nullptr;
+
+        /**
+         * Tokens of the current line copied out of the buffers they were read from. A deque never moves its
+         * elements, and the first `m_arena_size` strings are in use while the rest keep their memory for next lines.
+         */
+        std::deque<std::string> m_line_arena;
+        size_t m_arena_size = 0;
         
         /**
          * Token that acts as type ID for the whole line, like ALT/FILTER in meta entries
@@ -107,35 +191,27 @@ namespace ebi
         /**
          * Tokens that must be grouped, like all key-value pairs in the INFO column
          */
-        std::vector<std::string> m_grouped_tokens;
+        std::vector<TokenSpan> m_grouped_tokens;
         
         /**
-         * Tokens read in a line and grouped by an ID
+         * Columns of a record, in the order they are read. All the samples are kept in the last one, each of them as
+         * a single token.
          */
-        std::map<std::string, std::vector<std::string>> m_line_tokens;
+        enum Column : size_t { CHROM, POS, ID, REF, ALT, QUAL, FILTER, INFO, FORMAT, SAMPLES, N_COLUMNS };
 
         /**
-         * Tool to check that the chromosomes (and contigs) are contiguous.
-         * 
-         * Map keys are contig names, and the values flag whether they have been "fully read". Values mean the following:
-         * - Not found in the map: This contig has not appeared yet.
-         * - False: This contig has been found but not all its records have been listed yet.
-         * - True: Previously read records belonged to this contig and a record of another contig has been already found, 
-         *         so the former is considered "fully read".
-         * 
-         * For a contig block to be contiguous, no record should be found that belongs to a "fully read" contig.
-         */
-        std::map<std::string, bool> finished_contigs;
-        
-        /**
-         * Contig name previously read.
+         * Tokens read in each column of a line. The vectors are cleared but not released at the end of the line, so
+         * their memory is reused by the next ones.
          */
-        std::string previous_contig;
+        std::array<std::vector<TokenSpan>, N_COLUMNS> m_line_columns;
 
         /**
-         * Position previously read within a contig.
+         * Resolved FORMAT columns, by their text, shared by the records that list them. The definitions they point
+         * to don't change once the body is reached. Some bound is kept in case every record has its own FORMAT.
          */
-        size_t previous_position;
+        std::map<std::string, std::shared_ptr<FormatSpec const>> m_format_specs;
+        std::string m_format_key;
+        static size_t const max_format_specs = 1024;
     };
       
   }
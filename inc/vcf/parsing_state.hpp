@@ -25,6 +25,7 @@
 #include "file_structure.hpp"
 #include "error.hpp"
 #include "normalizer.hpp"
+#include "sorting_checker.hpp"
 
 namespace ebi
 {
@@ -34,6 +35,7 @@ namespace ebi
     struct ParsingState
     {
         size_t n_lines;
+        size_t n_records;
         size_t n_columns;
         size_t n_batches;
 
@@ -42,11 +44,40 @@ namespace ebi
         
         std::shared_ptr<Source> source;
         std::unique_ptr<Record> record;
+
+        /**
+         * Errors found in the last body line, all of them reported together. If there are any, `record` is null.
+         */
+        RecordErrors record_errors;
+
+        /**
+         * Typed values of the body line being parsed, if it was read from a binary file, or nullptr
+         */
+        TypedFields const * typed_fields;
+
         std::vector<std::unique_ptr<Error>> errors;
         std::vector<std::unique_ptr<Error>> warnings;
 
+        /**
+         * Value of n_lines when each of the errors and warnings was found. A buffer may contain several lines, so
+         * these are needed to report errors and warnings in the same order they would be found line by line.
+         */
+        std::vector<size_t> error_n_lines;
+        std::vector<size_t> warning_n_lines;
+
         std::multimap<std::string, std::string> defined_metadata;
 
+        /**
+         * Whether the checks that compare each record against the previous ones (sorting and duplicates) are left
+         * to the caller, as done when the body is validated in several chunks at once
+         */
+        bool record_checks_deferred;
+
+        /**
+         * Checks that the records are grouped by contig and sorted by position
+         */
+        SortingChecker sorting;
+
         ParsingState(std::shared_ptr<Source> source);
         virtual ~ParsingState() = default;
 
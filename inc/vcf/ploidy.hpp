@@ -46,13 +46,16 @@ namespace ebi
         explicit Ploidy(size_t default_ploidy, const std::map<std::string, size_t> &contig_ploidies = {})
                 : default_ploidy(default_ploidy), contig_ploidies(contig_ploidies) {}
 
-        size_t get_ploidy()
+        size_t get_ploidy() const
         {
             return default_ploidy;
         }
 
-        size_t get_ploidy(std::string contig)
+        size_t get_ploidy(std::string const & contig) const
         {
+            if (contig_ploidies.empty()) {
+                return default_ploidy;
+            }
             auto it = contig_ploidies.find(contig);
             if (it != contig_ploidies.end()) {
                 return it->second;
@@ -20,8 +20,6 @@
 #include <iostream>
 
 #include <boost/algorithm/string/predicate.hpp>
-#include <boost/math/special_functions/binomial.hpp>
-#include <boost/regex.hpp>
 
 #include "util/string_utils.hpp"
 
@@ -31,8 +29,14 @@ namespace ebi
   {
     
     bool is_record_subfield_in_header(std::string const & field_value,
-                                      std::multimap<std::string, MetaEntry>::iterator begin,
-                                      std::multimap<std::string, MetaEntry>::iterator end);
+                                      std::multimap<std::string, MetaEntry>::const_iterator begin,
+                                      std::multimap<std::string, MetaEntry>::const_iterator end);
+
+    /**
+     * Tells whether an alternate allele is symbolic, like <ID>, with an ID made of letters, digits, ':' and '_'.
+     * If so, the ID begins right after the '<' and is `id_length` characters long.
+     */
+    bool is_symbolic_allele(std::string const & alternate, size_t & id_length);
     
   }
 }
@@ -20,6 +20,7 @@
 
 #include <set>
 #include <sstream>
+#include <vector>
 #include "normalizer.hpp"
 #include "file_structure.hpp"
 
@@ -28,6 +29,17 @@ namespace ebi
   namespace vcf
   {
 
+    /**
+     * Data needed to check a record against the previous ones, stored while those checks are deferred
+     */
+    struct DeferredRecord
+    {
+        size_t line;
+        std::string chromosome;
+        size_t position;
+        std::vector<RecordCore> record_cores;
+    };
+
     /**
      * Stores a summary of a Record to check that there are no duplicates.
      *
@@ -47,7 +59,39 @@ namespace ebi
          * @param capacity: maximum amount of RecordCores that this instance can hold at any time.
          * A value of 0 disables the limit, thus storing every RecordCore received. Use with caution.
          */
-        RecordCache(size_t capacity) : capacity{capacity}, unlimited{capacity == 0} { }
+        RecordCache(size_t capacity) : capacity{capacity}, unlimited{capacity == 0}, deferred{false} { }
+
+        /**
+         * From now on, `check_duplicates` will only store the records in `deferred_records`, for a later
+         * `check_duplicates` call with each of them.
+         */
+        void defer_checks()
+        {
+            deferred = true;
+        }
+
+        std::vector<DeferredRecord> & deferred_records()
+        {
+            return deferred_list;
+        }
+
+        /**
+         * @return the RecordCores currently held, in the order they are compared
+         */
+        std::vector<RecordCore> contents() const
+        {
+            return {cache.begin(), cache.end()};
+        }
+
+        /**
+         * Replaces the RecordCores held with some returned by `contents`, e.g. from a cache of a previous validation
+         */
+        void restore(std::vector<RecordCore> const & record_cores)
+        {
+            cache.clear();
+            cache.insert(record_cores.begin(), record_cores.end());
+            shrink_to_fit();
+        }
 
         /**
          * For a given Record, returns a vector of RecordCores that are duplicates.
@@ -62,10 +106,21 @@ namespace ebi
          */
         std::vector<std::unique_ptr<Error>> check_duplicates(const Record &record)
         {
-            auto record_cores = normalize(record);
+            if (deferred) {
+                deferred_list.push_back(DeferredRecord{record.line, record.chromosome, record.position, normalize(record)});
+                return {};
+            }
+            return check_duplicates(normalize(record));
+        }
+
+        /**
+         * Same as `check_duplicates(Record const &)`, with the RecordCores of a record already normalized
+         */
+        std::vector<std::unique_ptr<Error>> check_duplicates(std::vector<RecordCore> const & record_cores)
+        {
             std::vector<std::unique_ptr<Error>> duplicates{};
 
-            for (RecordCore &record_core: record_cores) {
+            for (RecordCore const &record_core: record_cores) {
                 std::pair<std::multiset<RecordCore>::iterator, std::multiset<RecordCore>::iterator> range =
                         cache.equal_range(record_core);
 
@@ -115,6 +170,8 @@ namespace ebi
         std::multiset<RecordCore> cache;
         size_t capacity;    ///< max amount of RecorCores that the cache can hold
         bool unlimited; ///< if true, the set is not capped and will not erase any RecordCore
+        bool deferred;  ///< if true, the records are stored in `deferred_list` instead of being checked
+        std::vector<DeferredRecord> deferred_list;
     };
   }
 }
@@ -20,6 +20,7 @@
 #include <iostream>
 #include <string>
 #include <stdexcept>
+#include "util/progress.hpp"
 #include "vcf/error.hpp"
 
 namespace ebi
@@ -32,6 +33,17 @@ namespace ebi
         virtual ~ReportWriter() {}  // needed if using raw pointers, instead of references or shared_ptrs in children
         virtual void write_error(Error &error) = 0;
         virtual void write_warning(Error &error) = 0;
+
+        /**
+         * Makes the reports written so far durable, before a checkpoint is written
+         */
+        virtual void flush() {}
+
+        /**
+         * Called when a validation is resumed from a checkpoint, with the amount of errors and warnings written
+         * before it. Writers that keep the reports of the interrupted validation must drop any written after those.
+         */
+        virtual void resume(size_t n_reports) {}
     };
 
     class StdoutReportWriter : public ReportWriter
@@ -46,6 +58,22 @@ namespace ebi
           std::cout << error.what() << " (warning)" << std::endl;
         }
     };
+
+    /**
+     * Counts the errors and warnings written, to be shown in the progress reports
+     */
+    class ProgressReportWriter : public ReportWriter
+    {
+      public:
+        virtual void write_error(Error &error) override
+        {
+          util::progress_counters().errors.fetch_add(1, std::memory_order_relaxed);
+        }
+        virtual void write_warning(Error &error) override
+        {
+          util::progress_counters().warnings.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
   }
 }
 
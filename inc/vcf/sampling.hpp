@@ -0,0 +1,96 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_SAMPLING_HPP
+#define VCF_SAMPLING_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    size_t const default_sample_window_size = 1024 * 1024;
+
+    /**
+     * How many windows of the body are validated when sampling a file. If `fraction` is greater than 0, enough
+     * windows are validated to cover roughly that fraction of the file, and `n_windows` is ignored.
+     */
+    struct SamplingOptions
+    {
+        size_t n_windows;
+        double fraction;
+        size_t window_size;
+        uint64_t seed;
+    };
+
+    /**
+     * Results of the validation of a sample of the body of a file
+     */
+    struct SampleSummary
+    {
+        bool sampled;               ///< false if the body was small enough to be validated in full
+        size_t n_windows;
+        size_t n_records;
+        size_t n_erroneous_records; ///< records with at least one error, warnings are not counted
+
+        double error_rate;
+        double error_rate_low;      ///< bounds of the 95% confidence interval of the error rate (Wilson score)
+        double error_rate_high;
+    };
+
+    /**
+     * Validates the meta and header sections of a file, and then only some windows of its body: the first one, the
+     * last one, and others chosen randomly. Each window starts at the beginning of a line and covers whole lines.
+     *
+     * Each window is validated by its own parser, so the checks that compare records (sorting and duplicates) only
+     * apply within a window. Records are numbered as if the windows came one after another right after the header.
+     *
+     * @param begin, end contents of a plain text file
+     */
+    bool is_valid_vcf_sample(char const * begin,
+                             char const * end,
+                             const std::string &sourceName,
+                             ValidationLevel validationLevel,
+                             Ploidy ploidy,
+                             std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                             SamplingOptions const &options,
+                             SampleSummary &summary);
+
+    /**
+     * Same as above, for a bgzipped file. The windows start at BGZF blocks found from random positions of the
+     * compressed file, so the blocks before them are not read.
+     *
+     * @param input seekable bgzipped file
+     * @throw std::runtime_error if the input is not a bgzipped file
+     */
+    bool is_valid_vcf_sample(std::istream &input,
+                             const std::string &sourceName,
+                             ValidationLevel validationLevel,
+                             Ploidy ploidy,
+                             std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                             SamplingOptions const &options,
+                             SampleSummary &summary);
+  }
+}
+
+#endif // VCF_SAMPLING_HPP
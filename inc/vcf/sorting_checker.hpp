@@ -0,0 +1,113 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_SORTING_CHECKER_HPP
+#define VCF_SORTING_CHECKER_HPP
+
+#include <map>
+#include <sstream>
+#include <string>
+
+#include "error.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+
+    /**
+     * Checks that the records of a file are grouped by contig, and sorted by position within each contig.
+     */
+    class SortingChecker
+    {
+      public:
+        SortingChecker() : finished_contigs{}, previous_contig{}, previous_position{0} { }
+
+        /**
+         * Creates a checker that continues after the records seen by another one, as returned by its accessors
+         */
+        SortingChecker(std::map<std::string, bool> const & finished_contigs,
+                       std::string const & previous_contig,
+                       size_t previous_position)
+        : finished_contigs{finished_contigs}, previous_contig{previous_contig}, previous_position{previous_position} { }
+
+        /**
+         * Checks a record against the ones checked before it.
+         *
+         * @throw BodySectionError* if the contig of the record has been already finished
+         * @throw PositionBodyError* if the position is lower than the previous one in the same contig
+         */
+        void check(size_t line, std::string const & chromosome, size_t position)
+        {
+            // check contigs are contiguous
+            auto iterator = finished_contigs.find(chromosome);
+            if (iterator == finished_contigs.end()) {
+                // contig not found in the map: finishing the previous contig, and starting a new one
+                if (finished_contigs.size() != 0) {
+                    // with the first contig there's no previous contig
+                    finished_contigs[previous_contig] = true;
+                }
+                finished_contigs[chromosome] = false;
+                previous_contig = chromosome;
+                previous_position = 0;  // position sorting is reset
+            } else if (iterator->second) {
+                std::stringstream ss;
+                ss << "Variant " << chromosome << ":" << position << " is not contiguous to the rest of the contig";
+                throw new BodySectionError{line, ss.str()};
+            }
+
+            // check all positions are sorted within a contig
+            if (position < previous_position) {
+                std::stringstream ss;
+                ss << "Contig " << chromosome << " is not sorted by position: "
+                   << position << " found after " << previous_position;
+                throw new PositionBodyError{line, ss.str()};
+            }
+            previous_position = position;
+        }
+
+        std::map<std::string, bool> const & contigs() const { return finished_contigs; }
+        std::string const & contig() const { return previous_contig; }
+        size_t position() const { return previous_position; }
+
+      private:
+        /**
+         * Tool to check that the chromosomes (and contigs) are contiguous.
+         *
+         * Map keys are contig names, and the values flag whether they have been "fully read". Values mean the following:
+         * - Not found in the map: This contig has not appeared yet.
+         * - False: This contig has been found but not all its records have been listed yet.
+         * - True: Previously read records belonged to this contig and a record of another contig has been already found,
+         *         so the former is considered "fully read".
+         *
+         * For a contig block to be contiguous, no record should be found that belongs to a "fully read" contig.
+         */
+        std::map<std::string, bool> finished_contigs;
+
+        /**
+         * Contig name previously read.
+         */
+        std::string previous_contig;
+
+        /**
+         * Position previously read within a contig.
+         */
+        size_t previous_position;
+    };
+  }
+}
+
+#endif // VCF_SORTING_CHECKER_HPP
@@ -0,0 +1,99 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VCF_TABIX_INDEX_HPP
+#define VCF_TABIX_INDEX_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "util/compression.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    /**
+     * Region of a contig, with 1-based positions and both ends included
+     */
+    struct Region
+    {
+        std::string contig;
+        uint64_t begin;
+        uint64_t end;
+    };
+
+    /**
+     * Parses a region written as CHROM, CHROM:BEGIN or CHROM:BEGIN-END, e.g. chr1:1-5,000,000
+     *
+     * @throw std::invalid_argument if the region is not well-formed
+     */
+    Region parse_region(std::string const & text);
+
+    /**
+     * @return path of the tabix (.tbi) or CSI (.csi) index of a bgzipped file, or an empty string if there is none
+     */
+    std::string find_tabix_index(std::string const & path);
+
+    /**
+     * Binning index of a bgzipped file, read from a tabix (.tbi) or CSI (.csi) file as described in the tabix and
+     * CSI specifications.
+     *
+     * Records are assigned to bins of a hierarchy that covers each contig, and the index stores, for each bin, the
+     * ranges of virtual offsets (chunks) in the compressed file that contain its records.
+     */
+    class TabixIndex
+    {
+      public:
+        /**
+         * @param input contents of the index file, which is itself compressed with BGZF
+         * @throw std::runtime_error if the index is not well-formed
+         */
+        TabixIndex(std::istream &input);
+
+        /**
+         * @return sorted and non-overlapping ranges of virtual offsets that contain all the records overlapping any
+         * of the regions, and maybe some records around them. Contigs not in the index have no records.
+         */
+        std::vector<util::BgzfRangeStreambuf::Range> chunks(std::vector<Region> const & regions) const;
+
+      private:
+        struct Bin
+        {
+            uint64_t loffset;   ///< virtual offset of the first record that overlaps the bin (CSI only)
+            std::vector<util::BgzfRangeStreambuf::Range> chunks;
+        };
+
+        struct Reference
+        {
+            std::map<uint32_t, Bin> bins;
+            std::vector<uint64_t> intervals;    ///< linear index of the first offset in each window (tabix only)
+        };
+
+        uint64_t min_offset(Reference const & reference, uint64_t begin) const;
+
+        int min_shift;  ///< the finest bins span 2^min_shift positions
+        int depth;      ///< amount of levels of bins, besides the root bin
+        std::map<std::string, size_t> contigs;
+        std::vector<Reference> references;
+    };
+  }
+}
+
+#endif // VCF_TABIX_INDEX_HPP
@@ -17,6 +17,7 @@
 #ifndef VCF_VALIDATOR_HPP
 #define VCF_VALIDATOR_HPP
 
+#include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -32,9 +33,13 @@
 #include "parse_policy.hpp"
 #include "parsing_state.hpp"
 #include "record_cache.hpp"
+#include "sorting_checker.hpp"
+#include "util/line_scanner.hpp"
+#include "util/mapped_file.hpp"
 #include "util/string_utils.hpp"
 #include "vcf/ploidy.hpp"
 #include "vcf/report_writer.hpp"
+#include "vcf/tabix_index.hpp"
 
 
 namespace ebi
@@ -42,7 +47,10 @@ namespace ebi
   namespace vcf
   {
 
+    struct Checkpoint;
+
     size_t const default_line_buffer_size = 64 * 1024;
+    size_t const default_read_block_size = 4 * 1024 * 1024;
     enum class ValidationLevel { error, warning, stop };
 
     // Only check syntax
@@ -76,12 +84,43 @@ namespace ebi
 
         virtual void parse(std::string const & text) = 0;
         virtual void parse(std::vector<char> const & text) = 0;
+        virtual void parse(char const * begin, char const * end) = 0;
 
         virtual void end() = 0;
 
         virtual bool is_valid() const = 0;
         virtual const std::vector<std::unique_ptr<Error>> & errors() const = 0;
         virtual const std::vector<std::unique_ptr<Error>> & warnings() const = 0;
+
+        /**
+         * Line that was being read when each of the errors (or warnings) was found, in the same order as `errors()`
+         * (or `warnings()`). Used to interleave both when a single `parse` call reads several lines.
+         */
+        virtual const std::vector<size_t> & error_n_lines() const = 0;
+        virtual const std::vector<size_t> & warning_n_lines() const = 0;
+
+        /**
+         * Support for validating several chunks of the body at once, see ChunkValidator:
+         * - `state` and `resume` copy the position of a parser at a line boundary into another parser that shares
+         *   its Source, which will then find the same errors in the lines that follow.
+         * - `defer_record_checks` stops checking each record against the previous ones (sorting and duplicates).
+         *   The records are stored in `deferred_records` instead, so the caller can run those checks in file order.
+         * - `defer_record_checks` also stops adding each `parse` call to the progress counters, because a chunk may
+         *   be parsed again from another state. `count_progress` adds the last call once its result is kept.
+         */
+        virtual int state() const = 0;
+        virtual void resume(int state, size_t n_lines) = 0;
+        virtual void defer_record_checks() = 0;
+        virtual std::vector<DeferredRecord> & deferred_records() = 0;
+        virtual void count_progress() const = 0;
+
+        /**
+         * Support for checkpoints, see Checkpoint: `save` copies the position of a parser at a line boundary of the
+         * body, along with the records it remembers, and `restore` copies them into a parser that has just read the
+         * same meta and header sections.
+         */
+        virtual void save(Checkpoint & checkpoint) const = 0;
+        virtual void restore(Checkpoint const & checkpoint) = 0;
     };
     
     class ParserImpl
@@ -94,12 +133,22 @@ namespace ebi
 
         void parse(std::string const & text) override;
         void parse(std::vector<char> const & text) override;
+        void parse(char const * begin, char const * end) override;
 
         void end() override;
 
         bool is_valid() const override;
         const std::vector<std::unique_ptr<Error>> & errors() const override;
         const std::vector<std::unique_ptr<Error>> & warnings() const override;
+        const std::vector<size_t> & error_n_lines() const override;
+        const std::vector<size_t> & warning_n_lines() const override;
+        int state() const override;
+        void resume(int state, size_t n_lines) override;
+        void defer_record_checks() override;
+        std::vector<DeferredRecord> & deferred_records() override;
+        void count_progress() const override;
+        void save(Checkpoint & checkpoint) const override;
+        void restore(Checkpoint const & checkpoint) override;
 
        
       protected:
@@ -109,6 +158,19 @@ namespace ebi
          * Previously seen records
          */
         RecordCache previous_records;
+
+        /**
+         * Delimiters of the columns and subfields in the buffer being parsed, used to read long values at once
+         */
+        util::StructuralIndex structural_index;
+
+      private:
+        /**
+         * Amount of text, lines and records read by the last `parse` call
+         */
+        size_t last_parse_bytes;
+        size_t last_parse_lines;
+        size_t last_parse_records;
     };
     
     template <typename Configuration>
@@ -178,16 +240,130 @@ namespace ebi
     using FullValidator_v43 = ParserImpl_v43<FullValidatorCfg>;
     using Reader_v43 = ParserImpl_v43<ReaderCfg>;
 
+    // The parsers are instantiated only for these configurations, each version in its own validator_v4x.cpp
+    extern template class ParserImpl_v41<QuickValidatorCfg>;
+    extern template class ParserImpl_v41<FullValidatorCfg>;
+    extern template class ParserImpl_v41<ReaderCfg>;
+
+    extern template class ParserImpl_v42<QuickValidatorCfg>;
+    extern template class ParserImpl_v42<FullValidatorCfg>;
+    extern template class ParserImpl_v42<ReaderCfg>;
+
+    extern template class ParserImpl_v43<QuickValidatorCfg>;
+    extern template class ParserImpl_v43<FullValidatorCfg>;
+    extern template class ParserImpl_v43<ReaderCfg>;
+
+    /**
+     * Validates the body of a file in chunks that are parsed at the same time by several parsers, reporting the same
+     * errors, in the same order, as a single parser reading the whole file.
+     *
+     * The meta and header sections, and the first record, are read by a single parser. Then the text is given in
+     * rounds of complete lines, which are split at newlines into a chunk per thread. Each chunk is parsed by its own
+     * parser, resumed at the line number where the chunk starts and at the state the previous chunk is expected to
+     * end in. If a chunk ends in a different state (e.g. after an erroneous line), the next one is parsed again.
+     *
+     * The checks that compare a record with the previous ones (sorting and duplicates) are deferred by the parsers,
+     * and run here in file order when the errors of each chunk are reported.
+     */
+    class ChunkValidator
+    {
+      public:
+        /**
+         * @param parser parser for the beginning of the file, which must not have parsed anything yet
+         * @param build_parser creates parsers that share the Source of `parser`
+         */
+        ChunkValidator(Parser &parser,
+                       size_t n_threads,
+                       std::function<std::unique_ptr<Parser>()> const & build_parser,
+                       std::vector<std::unique_ptr<ReportWriter>> &outputs);
+
+        /**
+         * Amount of text that keeps all the threads busy in a call to `parse`
+         */
+        size_t round_size() const;
+
+        /**
+         * Validates the range [begin, end), which must end at a line boundary
+         */
+        void parse(char const * begin, char const * end);
+
+        /**
+         * Validates the last range of the file, which may not end with a newline
+         */
+        void end(char const * begin, char const * end);
+
+        bool is_valid() const;
+
+      private:
+        void parse_sequentially(char const * begin, char const * end);
+        void write_errors(Parser &parser);
+
+        std::vector<std::unique_ptr<Parser>> parsers;
+        std::vector<std::unique_ptr<ReportWriter>> &outputs;
+
+        Parser *current;    ///< parser that read the last line so far
+        size_t n_lines;     ///< number of the next line to parse
+        bool in_body;       ///< whether the first record has been parsed
+
+        RecordCache previous_records;
+        SortingChecker sorting;
+        bool valid;
+    };
+
+    /**
+     * Validates the VCF contents of a stream, which may be compressed with gzip or BGZF, or encoded as BCF. The stream
+     * is read (or decompressed) on a separate thread, ahead of the parser.
+     *
+     * @param n_threads amount of threads decompressing BGZF blocks and validating chunks of the body in parallel
+     *        (except for the stop validation level, which is always sequential)
+     */
     bool is_valid_vcf_file(std::istream &input,
                            const std::string &sourceName,
                            ValidationLevel validationLevel,
                            Ploidy ploidy,
-                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs);
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t n_threads = 1);
+
+    /**
+     * Validates the meta and header sections of a bgzipped VCF file, and then only the records in the BGZF blocks
+     * that overlap some regions, which are found using the index of the file. The rest of the file is not read.
+     *
+     * Records are numbered as if the ones validated came right after the header.
+     *
+     * @param input seekable bgzipped VCF file
+     * @throw std::runtime_error if the input is not a bgzipped VCF file
+     */
+    bool is_valid_vcf_file(std::istream &input,
+                           TabixIndex const &index,
+                           std::vector<Region> const &regions,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           Ploidy ploidy,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t n_threads = 1);
+
+    /**
+     * Validates the VCF contents in the range [begin, end), which are parsed in place without being copied
+     */
+    bool is_valid_vcf_file(char const * begin,
+                           char const * end,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           Ploidy ploidy,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t n_threads = 1);
+
+    /**
+     * Validates a memory-mapped VCF file. The pages already parsed are released from memory as the validation
+     * advances, so the whole file is never resident at once.
+     */
+    bool is_valid_vcf_file(util::MappedFile &input,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           Ploidy ploidy,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t n_threads = 1);
   }
 }
 
-#include "validator_detail_v41.hpp"
-#include "validator_detail_v42.hpp"
-#include "validator_detail_v43.hpp"
-
 #endif // VCF_VALIDATOR_HPP
@@ -17,7 +17,7 @@
  */
 
 
-#line 229 "src/vcf/vcf_v41.ragel"
+#line 241 "src/vcf/vcf_v41.ragel"
 
 
 namespace
@@ -35,7 +35,7 @@ static const int vcf_v41_en_meta_section_skip = 519;
 static const int vcf_v41_en_body_section_skip = 520;
 
 
-#line 235 "src/vcf/vcf_v41.ragel"
+#line 247 "src/vcf/vcf_v41.ragel"
 
 }
 
@@ -54,15 +54,21 @@ namespace ebi
 	cs = vcf_v41_start;
 	}
 
-#line 249 "src/vcf/vcf_v41.ragel"
+#line 261 "src/vcf/vcf_v41.ragel"
 
     }
 
     template <typename Configuration>
     void ParserImpl_v41<Configuration>::parse_buffer(char const * p, char const * pe, char const * eof)
     {
+      if (cs == vcf_v41_error) {
+          // The state machine stopped at an error it can't recover from, so nothing else can be read
+          return;
+      }
+      ParsePolicy::handle_buffer_begin(*this, p);
+      structural_index.build(p, pe);
       
-#line 66 "inc/vcf/validator_detail_v41.hpp"
+#line 72 "inc/vcf/validator_detail_v41.hpp"
 	{
 	if ( p == pe )
 		goto _test_eof;
@@ -73,10 +79,10 @@ case 1:
 		goto st2;
 	goto tr0;
 tr0:
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr14:
@@ -84,26 +90,26 @@ tr14:
 	{
         ErrorPolicy::handle_error(*this,
                 new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.1'"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr24:
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -115,9 +121,9 @@ tr24:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -128,16 +134,16 @@ tr24:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr26:
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -149,9 +155,9 @@ tr26:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -162,602 +168,602 @@ tr26:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr29:
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr39:
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr125:
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr133:
-#line 252 "src/vcf/vcf.ragel"
+#line 257 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
             "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr152:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr162:
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr165:
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr175:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr194:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr204:
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr214:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr227:
 #line 36 "src/vcf/vcf_v41.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, G or dot"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr236:
-#line 293 "src/vcf/vcf.ragel"
+#line 298 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr253:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr264:
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr273:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr286:
 #line 42 "src/vcf/vcf_v41.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, G or dot"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr295:
-#line 293 "src/vcf/vcf.ragel"
+#line 298 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr312:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr323:
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr333:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr345:
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr356:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr361:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 352 "src/vcf/vcf.ragel"
+#line 357 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr363:
-#line 352 "src/vcf/vcf.ragel"
+#line 357 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr373:
-#line 352 "src/vcf/vcf.ragel"
+#line 357 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 357 "src/vcf/vcf.ragel"
+#line 362 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr376:
-#line 357 "src/vcf/vcf.ragel"
+#line 362 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr386:
-#line 357 "src/vcf/vcf.ragel"
+#line 362 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr389:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr412:
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr421:
-#line 373 "src/vcf/vcf.ragel"
+#line 378 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr442:
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr453:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr491:
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr503:
-#line 373 "src/vcf/vcf.ragel"
+#line 378 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	goto st0;
 tr526:
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -769,9 +775,9 @@ tr526:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -782,11 +788,11 @@ tr526:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr566:
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -797,183 +803,183 @@ tr566:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr581:
-#line 396 "src/vcf/vcf.ragel"
+#line 401 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr584:
-#line 402 "src/vcf/vcf.ragel"
+#line 407 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr588:
-#line 408 "src/vcf/vcf.ragel"
+#line 413 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr593:
-#line 414 "src/vcf/vcf.ragel"
+#line 419 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr597:
-#line 420 "src/vcf/vcf.ragel"
+#line 425 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr606:
-#line 426 "src/vcf/vcf.ragel"
+#line 431 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr617:
-#line 432 "src/vcf/vcf.ragel"
+#line 437 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr625:
-#line 443 "src/vcf/vcf.ragel"
+#line 448 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 443 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr629:
 #line 50 "src/vcf/vcf_v41.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr634:
-#line 461 "src/vcf/vcf.ragel"
+#line 466 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
         ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "GT"});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 459 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
         ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr642:
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr644:
-#line 454 "src/vcf/vcf.ragel"
+#line 459 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
         ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr650:
-#line 448 "src/vcf/vcf.ragel"
+#line 453 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 443 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr699:
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -984,32 +990,32 @@ tr699:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 396 "src/vcf/vcf.ragel"
+#line 401 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
 tr706:
-#line 438 "src/vcf/vcf.ragel"
+#line 443 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	goto st0;
-#line 1013 "inc/vcf/validator_detail_v41.hpp"
+#line 1019 "inc/vcf/validator_detail_v41.hpp"
 st0:
 cs = 0;
 	goto _out;
@@ -1111,111 +1117,111 @@ tr15:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st15;
 st15:
 	if ( ++p == pe )
 		goto _test_eof15;
 case 15:
-#line 1122 "inc/vcf/validator_detail_v41.hpp"
+#line 1128 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 67 )
 		goto tr16;
 	goto tr14;
 tr16:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st16;
 st16:
 	if ( ++p == pe )
 		goto _test_eof16;
 case 16:
-#line 1136 "inc/vcf/validator_detail_v41.hpp"
+#line 1142 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 70 )
 		goto tr17;
 	goto tr14;
 tr17:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st17;
 st17:
 	if ( ++p == pe )
 		goto _test_eof17;
 case 17:
-#line 1150 "inc/vcf/validator_detail_v41.hpp"
+#line 1156 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 118 )
 		goto tr18;
 	goto tr14;
 tr18:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st18;
 st18:
 	if ( ++p == pe )
 		goto _test_eof18;
 case 18:
-#line 1164 "inc/vcf/validator_detail_v41.hpp"
+#line 1170 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 52 )
 		goto tr19;
 	goto tr14;
 tr19:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st19;
 st19:
 	if ( ++p == pe )
 		goto _test_eof19;
 case 19:
-#line 1178 "inc/vcf/validator_detail_v41.hpp"
+#line 1184 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 46 )
 		goto tr20;
 	goto tr14;
 tr20:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st20;
 st20:
 	if ( ++p == pe )
 		goto _test_eof20;
 case 20:
-#line 1192 "inc/vcf/validator_detail_v41.hpp"
+#line 1198 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 49 )
 		goto tr21;
 	goto tr14;
 tr21:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st21;
 st21:
 	if ( ++p == pe )
 		goto _test_eof21;
 case 21:
-#line 1206 "inc/vcf/validator_detail_v41.hpp"
+#line 1212 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr22;
 		case 13: goto tr23;
 	}
 	goto tr14;
 tr22:
-#line 99 "src/vcf/vcf.ragel"
+#line 98 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_fileformat(*this);
         } catch (Error *error) {
           ErrorPolicy::handle_error(*this, error);
-          p--; {goto st519;}
+          {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
         }
     }
 #line 43 "src/vcf/vcf.ragel"
@@ -1223,17 +1229,13 @@ tr22:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st22;
 st22:
 	if ( ++p == pe )
 		goto _test_eof22;
 case 22:
-#line 1237 "inc/vcf/validator_detail_v41.hpp"
+#line 1239 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 35 )
 		goto st23;
 	goto tr24;
@@ -1273,27 +1275,27 @@ tr30:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st25;
 tr40:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st25;
 st25:
 	if ( ++p == pe )
 		goto _test_eof25;
 case 25:
-#line 1290 "inc/vcf/validator_detail_v41.hpp"
+#line 1292 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 61 )
 		goto tr41;
 	if ( 32 <= (*p) && (*p) <= 126 )
 		goto tr40;
 	goto tr39;
 tr41:
-#line 188 "src/vcf/vcf.ragel"
+#line 187 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this);
     }
@@ -1302,7 +1304,7 @@ st26:
 	if ( ++p == pe )
 		goto _test_eof26;
 case 26:
-#line 1306 "inc/vcf/validator_detail_v41.hpp"
+#line 1308 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto st30;
 		case 60: goto st35;
@@ -1317,20 +1319,20 @@ tr42:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st27;
 tr47:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st27;
 st27:
 	if ( ++p == pe )
 		goto _test_eof27;
 case 27:
-#line 1334 "inc/vcf/validator_detail_v41.hpp"
+#line 1336 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr45;
 		case 13: goto tr46;
@@ -1343,7 +1345,7 @@ tr45:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1356,14 +1358,10 @@ tr45:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st28;
 tr55:
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1376,17 +1374,13 @@ tr55:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st28;
 st28:
 	if ( ++p == pe )
 		goto _test_eof28;
 case 28:
-#line 1390 "inc/vcf/validator_detail_v41.hpp"
+#line 1384 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 35 )
 		goto st23;
 	goto tr26;
@@ -1395,7 +1389,7 @@ tr46:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1408,14 +1402,10 @@ tr46:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st29;
 tr56:
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1428,17 +1418,13 @@ tr56:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st29;
 st29:
 	if ( ++p == pe )
 		goto _test_eof29;
 case 29:
-#line 1442 "inc/vcf/validator_detail_v41.hpp"
+#line 1428 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 10 )
 		goto st28;
 	goto tr39;
@@ -1460,20 +1446,20 @@ tr49:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st31;
 tr52:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st31;
 st31:
 	if ( ++p == pe )
 		goto _test_eof31;
 case 31:
-#line 1477 "inc/vcf/validator_detail_v41.hpp"
+#line 1463 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr53;
 		case 92: goto tr54;
@@ -1501,7 +1487,7 @@ st32:
 	if ( ++p == pe )
 		goto _test_eof32;
 case 32:
-#line 1505 "inc/vcf/validator_detail_v41.hpp"
+#line 1491 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -1514,20 +1500,20 @@ tr51:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st33;
 tr54:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st33;
 st33:
 	if ( ++p == pe )
 		goto _test_eof33;
 case 33:
-#line 1531 "inc/vcf/validator_detail_v41.hpp"
+#line 1517 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr57;
 		case 92: goto tr54;
@@ -1538,7 +1524,7 @@ case 33:
 tr57:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1549,7 +1535,7 @@ st34:
 	if ( ++p == pe )
 		goto _test_eof34;
 case 34:
-#line 1553 "inc/vcf/validator_detail_v41.hpp"
+#line 1539 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -1597,20 +1583,20 @@ tr61:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st37;
 tr64:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st37;
 st37:
 	if ( ++p == pe )
 		goto _test_eof37;
 case 37:
-#line 1614 "inc/vcf/validator_detail_v41.hpp"
+#line 1600 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr65;
 		case 92: goto tr66;
@@ -1638,7 +1624,7 @@ st38:
 	if ( ++p == pe )
 		goto _test_eof38;
 case 38:
-#line 1642 "inc/vcf/validator_detail_v41.hpp"
+#line 1628 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 62 )
 		goto st32;
 	goto tr39;
@@ -1649,20 +1635,20 @@ tr63:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st39;
 tr66:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st39;
 st39:
 	if ( ++p == pe )
 		goto _test_eof39;
 case 39:
-#line 1666 "inc/vcf/validator_detail_v41.hpp"
+#line 1652 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr68;
 		case 92: goto tr66;
@@ -1673,7 +1659,7 @@ case 39:
 tr68:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1684,7 +1670,7 @@ st40:
 	if ( ++p == pe )
 		goto _test_eof40;
 case 40:
-#line 1688 "inc/vcf/validator_detail_v41.hpp"
+#line 1674 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr65;
 		case 62: goto tr69;
@@ -1696,14 +1682,14 @@ case 40:
 tr69:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st41;
 st41:
 	if ( ++p == pe )
 		goto _test_eof41;
 case 41:
-#line 1707 "inc/vcf/validator_detail_v41.hpp"
+#line 1693 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -1723,7 +1709,7 @@ st42:
 	if ( ++p == pe )
 		goto _test_eof42;
 case 42:
-#line 1727 "inc/vcf/validator_detail_v41.hpp"
+#line 1713 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 95 )
 		goto st42;
 	if ( (*p) < 48 ) {
@@ -1745,20 +1731,20 @@ tr60:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st43;
 tr71:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st43;
 st43:
 	if ( ++p == pe )
 		goto _test_eof43;
 case 43:
-#line 1762 "inc/vcf/validator_detail_v41.hpp"
+#line 1748 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr72;
 		case 95: goto tr71;
@@ -1776,7 +1762,7 @@ case 43:
 		goto tr71;
 	goto tr39;
 tr72:
-#line 192 "src/vcf/vcf.ragel"
+#line 191 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -1785,7 +1771,7 @@ st44:
 	if ( ++p == pe )
 		goto _test_eof44;
 case 44:
-#line 1789 "inc/vcf/validator_detail_v41.hpp"
+#line 1775 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 34 )
 		goto st63;
 	if ( (*p) < 45 ) {
@@ -1804,20 +1790,20 @@ tr73:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st45;
 tr75:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st45;
 st45:
 	if ( ++p == pe )
 		goto _test_eof45;
 case 45:
-#line 1821 "inc/vcf/validator_detail_v41.hpp"
+#line 1807 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 44: goto tr76;
 		case 62: goto tr53;
@@ -1838,7 +1824,7 @@ st46:
 	if ( ++p == pe )
 		goto _test_eof46;
 case 46:
-#line 1842 "inc/vcf/validator_detail_v41.hpp"
+#line 1828 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 95 )
 		goto tr77;
 	if ( (*p) < 48 ) {
@@ -1863,7 +1849,7 @@ st47:
 	if ( ++p == pe )
 		goto _test_eof47;
 case 47:
-#line 1867 "inc/vcf/validator_detail_v41.hpp"
+#line 1853 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 95 )
 		goto st47;
 	if ( (*p) < 48 ) {
@@ -1885,20 +1871,20 @@ tr78:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st48;
 tr80:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st48;
 st48:
 	if ( ++p == pe )
 		goto _test_eof48;
 case 48:
-#line 1902 "inc/vcf/validator_detail_v41.hpp"
+#line 1888 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr81;
 		case 95: goto tr80;
@@ -1916,7 +1902,7 @@ case 48:
 		goto tr80;
 	goto tr39;
 tr81:
-#line 192 "src/vcf/vcf.ragel"
+#line 191 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -1925,7 +1911,7 @@ st49:
 	if ( ++p == pe )
 		goto _test_eof49;
 case 49:
-#line 1929 "inc/vcf/validator_detail_v41.hpp"
+#line 1915 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 34 )
 		goto st50;
 	if ( (*p) < 45 ) {
@@ -1955,20 +1941,20 @@ tr83:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st51;
 tr86:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st51;
 st51:
 	if ( ++p == pe )
 		goto _test_eof51;
 case 51:
-#line 1972 "inc/vcf/validator_detail_v41.hpp"
+#line 1958 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 92: goto tr88;
@@ -1996,7 +1982,7 @@ st52:
 	if ( ++p == pe )
 		goto _test_eof52;
 case 52:
-#line 2000 "inc/vcf/validator_detail_v41.hpp"
+#line 1986 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 44: goto st46;
 		case 62: goto st32;
@@ -2009,20 +1995,20 @@ tr85:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st53;
 tr88:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st53;
 st53:
 	if ( ++p == pe )
 		goto _test_eof53;
 case 53:
-#line 2026 "inc/vcf/validator_detail_v41.hpp"
+#line 2012 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr90;
 		case 92: goto tr88;
@@ -2033,7 +2019,7 @@ case 53:
 tr90:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2044,7 +2030,7 @@ st54:
 	if ( ++p == pe )
 		goto _test_eof54;
 case 54:
-#line 2048 "inc/vcf/validator_detail_v41.hpp"
+#line 2034 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 44: goto tr91;
@@ -2061,19 +2047,19 @@ tr105:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st55;
 tr91:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st55;
 tr102:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2084,7 +2070,7 @@ st55:
 	if ( ++p == pe )
 		goto _test_eof55;
 case 55:
-#line 2088 "inc/vcf/validator_detail_v41.hpp"
+#line 2074 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr86;
@@ -2122,20 +2108,20 @@ tr93:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st56;
 tr95:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st56;
 st56:
 	if ( ++p == pe )
 		goto _test_eof56;
 case 56:
-#line 2139 "inc/vcf/validator_detail_v41.hpp"
+#line 2125 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr86;
@@ -2173,20 +2159,20 @@ tr94:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st57;
 tr96:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st57;
 st57:
 	if ( ++p == pe )
 		goto _test_eof57;
 case 57:
-#line 2190 "inc/vcf/validator_detail_v41.hpp"
+#line 2176 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr86;
@@ -2216,20 +2202,20 @@ case 57:
 		goto tr96;
 	goto tr39;
 tr97:
-#line 192 "src/vcf/vcf.ragel"
+#line 191 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st58;
 st58:
 	if ( ++p == pe )
 		goto _test_eof58;
 case 58:
-#line 2233 "inc/vcf/validator_detail_v41.hpp"
+#line 2219 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr99;
 		case 44: goto tr86;
@@ -2242,13 +2228,13 @@ case 58:
 tr101:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st59;
 tr98:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2259,7 +2245,7 @@ st59:
 	if ( ++p == pe )
 		goto _test_eof59;
 case 59:
-#line 2263 "inc/vcf/validator_detail_v41.hpp"
+#line 2249 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 44: goto tr102;
@@ -2276,19 +2262,19 @@ tr106:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st60;
 tr92:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st60;
 tr103:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2299,7 +2285,7 @@ st60:
 	if ( ++p == pe )
 		goto _test_eof60;
 case 60:
-#line 2303 "inc/vcf/validator_detail_v41.hpp"
+#line 2289 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -2312,13 +2298,13 @@ case 60:
 tr104:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st61;
 tr100:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2329,7 +2315,7 @@ st61:
 	if ( ++p == pe )
 		goto _test_eof61;
 case 61:
-#line 2333 "inc/vcf/validator_detail_v41.hpp"
+#line 2319 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr90;
 		case 44: goto tr102;
@@ -2349,7 +2335,7 @@ st62:
 	if ( ++p == pe )
 		goto _test_eof62;
 case 62:
-#line 2353 "inc/vcf/validator_detail_v41.hpp"
+#line 2339 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr84;
 		case 44: goto tr105;
@@ -2377,20 +2363,20 @@ tr107:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st64;
 tr109:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st64;
 st64:
 	if ( ++p == pe )
 		goto _test_eof64;
 case 64:
-#line 2394 "inc/vcf/validator_detail_v41.hpp"
+#line 2380 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 92: goto tr110;
@@ -2405,20 +2391,20 @@ tr108:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st65;
 tr110:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st65;
 st65:
 	if ( ++p == pe )
 		goto _test_eof65;
 case 65:
-#line 2422 "inc/vcf/validator_detail_v41.hpp"
+#line 2408 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr111;
 		case 92: goto tr110;
@@ -2429,7 +2415,7 @@ case 65:
 tr111:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2440,7 +2426,7 @@ st66:
 	if ( ++p == pe )
 		goto _test_eof66;
 case 66:
-#line 2444 "inc/vcf/validator_detail_v41.hpp"
+#line 2430 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 44: goto tr112;
@@ -2453,13 +2439,13 @@ case 66:
 tr112:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st67;
 tr122:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2470,7 +2456,7 @@ st67:
 	if ( ++p == pe )
 		goto _test_eof67;
 case 67:
-#line 2474 "inc/vcf/validator_detail_v41.hpp"
+#line 2460 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr109;
@@ -2504,13 +2490,13 @@ case 67:
 tr116:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st68;
 tr114:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2521,7 +2507,7 @@ st68:
 	if ( ++p == pe )
 		goto _test_eof68;
 case 68:
-#line 2525 "inc/vcf/validator_detail_v41.hpp"
+#line 2511 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr109;
@@ -2555,13 +2541,13 @@ case 68:
 tr117:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st69;
 tr115:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2572,7 +2558,7 @@ st69:
 	if ( ++p == pe )
 		goto _test_eof69;
 case 69:
-#line 2576 "inc/vcf/validator_detail_v41.hpp"
+#line 2562 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr109;
@@ -2604,9 +2590,9 @@ case 69:
 tr118:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
-#line 192 "src/vcf/vcf.ragel"
+#line 191 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -2615,7 +2601,7 @@ st70:
 	if ( ++p == pe )
 		goto _test_eof70;
 case 70:
-#line 2619 "inc/vcf/validator_detail_v41.hpp"
+#line 2605 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr99;
 		case 44: goto tr109;
@@ -2628,13 +2614,13 @@ case 70:
 tr121:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st71;
 tr119:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2645,7 +2631,7 @@ st71:
 	if ( ++p == pe )
 		goto _test_eof71;
 case 71:
-#line 2649 "inc/vcf/validator_detail_v41.hpp"
+#line 2635 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 44: goto tr122;
@@ -2658,13 +2644,13 @@ case 71:
 tr113:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st72;
 tr123:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2675,7 +2661,7 @@ st72:
 	if ( ++p == pe )
 		goto _test_eof72;
 case 72:
-#line 2679 "inc/vcf/validator_detail_v41.hpp"
+#line 2665 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -2688,13 +2674,13 @@ case 72:
 tr124:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st73;
 tr120:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2705,7 +2691,7 @@ st73:
 	if ( ++p == pe )
 		goto _test_eof73;
 case 73:
-#line 2709 "inc/vcf/validator_detail_v41.hpp"
+#line 2695 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr111;
 		case 44: goto tr122;
@@ -2722,14 +2708,14 @@ tr31:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st74;
 st74:
 	if ( ++p == pe )
 		goto _test_eof74;
 case 74:
-#line 2733 "inc/vcf/validator_detail_v41.hpp"
+#line 2719 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 76: goto tr126;
@@ -2740,14 +2726,14 @@ case 74:
 tr126:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st75;
 st75:
 	if ( ++p == pe )
 		goto _test_eof75;
 case 75:
-#line 2751 "inc/vcf/validator_detail_v41.hpp"
+#line 2737 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 84: goto st76;
@@ -2765,7 +2751,7 @@ case 76:
 		goto tr40;
 	goto tr125;
 tr128:
-#line 108 "src/vcf/vcf.ragel"
+#line 107 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "ALT");
     }
@@ -2774,7 +2760,7 @@ st77:
 	if ( ++p == pe )
 		goto _test_eof77;
 case 77:
-#line 2778 "inc/vcf/validator_detail_v41.hpp"
+#line 2764 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 60 )
 		goto st78;
 	goto tr125;
@@ -2833,7 +2819,7 @@ case 81:
 		goto tr134;
 	goto tr133;
 tr134:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -2846,7 +2832,7 @@ st82:
 	if ( ++p == pe )
 		goto _test_eof82;
 case 82:
-#line 2850 "inc/vcf/validator_detail_v41.hpp"
+#line 2836 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 61 )
 		goto st82;
 	if ( (*p) < 63 ) {
@@ -2879,11 +2865,11 @@ case 82:
 tr137:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st83;
 tr135:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -2893,14 +2879,14 @@ tr135:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st83;
 st83:
 	if ( ++p == pe )
 		goto _test_eof83;
 case 83:
-#line 2904 "inc/vcf/validator_detail_v41.hpp"
+#line 2890 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 44: goto tr138;
 		case 61: goto tr137;
@@ -2921,7 +2907,7 @@ st84:
 	if ( ++p == pe )
 		goto _test_eof84;
 case 84:
-#line 2925 "inc/vcf/validator_detail_v41.hpp"
+#line 2911 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 68 )
 		goto st85;
 	goto tr125;
@@ -3010,7 +2996,7 @@ case 96:
 		goto tr151;
 	goto tr125;
 tr151:
-#line 156 "src/vcf/vcf.ragel"
+#line 155 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -3019,7 +3005,7 @@ st97:
 	if ( ++p == pe )
 		goto _test_eof97;
 case 97:
-#line 3023 "inc/vcf/validator_detail_v41.hpp"
+#line 3009 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr154;
 		case 92: goto tr155;
@@ -3034,20 +3020,20 @@ tr153:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st98;
 tr156:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st98;
 st98:
 	if ( ++p == pe )
 		goto _test_eof98;
 case 98:
-#line 3051 "inc/vcf/validator_detail_v41.hpp"
+#line 3037 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 92: goto tr158;
@@ -3075,7 +3061,7 @@ st99:
 	if ( ++p == pe )
 		goto _test_eof99;
 case 99:
-#line 3079 "inc/vcf/validator_detail_v41.hpp"
+#line 3065 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 62 )
 		goto st100;
 	goto tr152;
@@ -3095,20 +3081,20 @@ tr155:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st101;
 tr158:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st101;
 st101:
 	if ( ++p == pe )
 		goto _test_eof101;
 case 101:
-#line 3112 "inc/vcf/validator_detail_v41.hpp"
+#line 3098 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr160;
 		case 92: goto tr158;
@@ -3119,7 +3105,7 @@ case 101:
 tr160:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3130,7 +3116,7 @@ st102:
 	if ( ++p == pe )
 		goto _test_eof102;
 case 102:
-#line 3134 "inc/vcf/validator_detail_v41.hpp"
+#line 3120 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 62: goto tr161;
@@ -3142,14 +3128,14 @@ case 102:
 tr161:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st103;
 st103:
 	if ( ++p == pe )
 		goto _test_eof103;
 case 103:
-#line 3153 "inc/vcf/validator_detail_v41.hpp"
+#line 3139 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -3166,14 +3152,14 @@ tr32:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st104;
 st104:
 	if ( ++p == pe )
 		goto _test_eof104;
 case 104:
-#line 3177 "inc/vcf/validator_detail_v41.hpp"
+#line 3163 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 73: goto tr163;
@@ -3185,14 +3171,14 @@ case 104:
 tr163:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st105;
 st105:
 	if ( ++p == pe )
 		goto _test_eof105;
 case 105:
-#line 3196 "inc/vcf/validator_detail_v41.hpp"
+#line 3182 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 76: goto tr166;
@@ -3203,14 +3189,14 @@ case 105:
 tr166:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st106;
 st106:
 	if ( ++p == pe )
 		goto _test_eof106;
 case 106:
-#line 3214 "inc/vcf/validator_detail_v41.hpp"
+#line 3200 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 84: goto tr167;
@@ -3221,14 +3207,14 @@ case 106:
 tr167:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st107;
 st107:
 	if ( ++p == pe )
 		goto _test_eof107;
 case 107:
-#line 3232 "inc/vcf/validator_detail_v41.hpp"
+#line 3218 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto tr168;
@@ -3239,14 +3225,14 @@ case 107:
 tr168:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st108;
 st108:
 	if ( ++p == pe )
 		goto _test_eof108;
 case 108:
-#line 3250 "inc/vcf/validator_detail_v41.hpp"
+#line 3236 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 82: goto st109;
@@ -3264,7 +3250,7 @@ case 109:
 		goto tr40;
 	goto tr165;
 tr170:
-#line 120 "src/vcf/vcf.ragel"
+#line 119 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "FILTER");
     }
@@ -3273,7 +3259,7 @@ st110:
 	if ( ++p == pe )
 		goto _test_eof110;
 case 110:
-#line 3277 "inc/vcf/validator_detail_v41.hpp"
+#line 3263 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 60 )
 		goto st111;
 	goto tr165;
@@ -3317,7 +3303,7 @@ case 114:
 		goto tr177;
 	goto tr175;
 tr176:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -3330,7 +3316,7 @@ st115:
 	if ( ++p == pe )
 		goto _test_eof115;
 case 115:
-#line 3334 "inc/vcf/validator_detail_v41.hpp"
+#line 3320 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 95 )
 		goto st115;
 	if ( (*p) < 48 ) {
@@ -3348,11 +3334,11 @@ case 115:
 tr179:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st116;
 tr177:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -3362,14 +3348,14 @@ tr177:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st116;
 st116:
 	if ( ++p == pe )
 		goto _test_eof116;
 case 116:
-#line 3373 "inc/vcf/validator_detail_v41.hpp"
+#line 3359 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 44: goto tr180;
 		case 95: goto tr179;
@@ -3396,7 +3382,7 @@ st117:
 	if ( ++p == pe )
 		goto _test_eof117;
 case 117:
-#line 3400 "inc/vcf/validator_detail_v41.hpp"
+#line 3386 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 68 )
 		goto st118;
 	goto tr165;
@@ -3485,7 +3471,7 @@ case 129:
 		goto tr193;
 	goto tr165;
 tr193:
-#line 156 "src/vcf/vcf.ragel"
+#line 155 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -3494,7 +3480,7 @@ st130:
 	if ( ++p == pe )
 		goto _test_eof130;
 case 130:
-#line 3498 "inc/vcf/validator_detail_v41.hpp"
+#line 3484 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr196;
 		case 92: goto tr197;
@@ -3509,20 +3495,20 @@ tr195:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st131;
 tr198:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st131;
 st131:
 	if ( ++p == pe )
 		goto _test_eof131;
 case 131:
-#line 3526 "inc/vcf/validator_detail_v41.hpp"
+#line 3512 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr199;
 		case 92: goto tr200;
@@ -3550,7 +3536,7 @@ st132:
 	if ( ++p == pe )
 		goto _test_eof132;
 case 132:
-#line 3554 "inc/vcf/validator_detail_v41.hpp"
+#line 3540 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 62 )
 		goto st133;
 	goto tr194;
@@ -3570,20 +3556,20 @@ tr197:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st134;
 tr200:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st134;
 st134:
 	if ( ++p == pe )
 		goto _test_eof134;
 case 134:
-#line 3587 "inc/vcf/validator_detail_v41.hpp"
+#line 3573 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr202;
 		case 92: goto tr200;
@@ -3594,7 +3580,7 @@ case 134:
 tr202:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3605,7 +3591,7 @@ st135:
 	if ( ++p == pe )
 		goto _test_eof135;
 case 135:
-#line 3609 "inc/vcf/validator_detail_v41.hpp"
+#line 3595 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr199;
 		case 62: goto tr203;
@@ -3617,14 +3603,14 @@ case 135:
 tr203:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st136;
 st136:
 	if ( ++p == pe )
 		goto _test_eof136;
 case 136:
-#line 3628 "inc/vcf/validator_detail_v41.hpp"
+#line 3614 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -3637,14 +3623,14 @@ case 136:
 tr164:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st137;
 st137:
 	if ( ++p == pe )
 		goto _test_eof137;
 case 137:
-#line 3648 "inc/vcf/validator_detail_v41.hpp"
+#line 3634 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 82: goto tr205;
@@ -3655,14 +3641,14 @@ case 137:
 tr205:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st138;
 st138:
 	if ( ++p == pe )
 		goto _test_eof138;
 case 138:
-#line 3666 "inc/vcf/validator_detail_v41.hpp"
+#line 3652 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 77: goto tr206;
@@ -3673,14 +3659,14 @@ case 138:
 tr206:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st139;
 st139:
 	if ( ++p == pe )
 		goto _test_eof139;
 case 139:
-#line 3684 "inc/vcf/validator_detail_v41.hpp"
+#line 3670 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 65: goto tr207;
@@ -3691,14 +3677,14 @@ case 139:
 tr207:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st140;
 st140:
 	if ( ++p == pe )
 		goto _test_eof140;
 case 140:
-#line 3702 "inc/vcf/validator_detail_v41.hpp"
+#line 3688 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 84: goto st141;
@@ -3716,7 +3702,7 @@ case 141:
 		goto tr40;
 	goto tr204;
 tr209:
-#line 124 "src/vcf/vcf.ragel"
+#line 123 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "FORMAT");
     }
@@ -3725,7 +3711,7 @@ st142:
 	if ( ++p == pe )
 		goto _test_eof142;
 case 142:
-#line 3729 "inc/vcf/validator_detail_v41.hpp"
+#line 3715 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 60 )
 		goto st143;
 	goto tr204;
@@ -3769,7 +3755,7 @@ case 146:
 		goto tr216;
 	goto tr214;
 tr215:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -3782,7 +3768,7 @@ st147:
 	if ( ++p == pe )
 		goto _test_eof147;
 case 147:
-#line 3786 "inc/vcf/validator_detail_v41.hpp"
+#line 3772 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 95 )
 		goto st147;
 	if ( (*p) < 48 ) {
@@ -3800,11 +3786,11 @@ case 147:
 tr218:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st148;
 tr216:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -3814,14 +3800,14 @@ tr216:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st148;
 st148:
 	if ( ++p == pe )
 		goto _test_eof148;
 case 148:
-#line 3825 "inc/vcf/validator_detail_v41.hpp"
+#line 3811 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 44: goto tr219;
 		case 95: goto tr218;
@@ -3848,7 +3834,7 @@ st149:
 	if ( ++p == pe )
 		goto _test_eof149;
 case 149:
-#line 3852 "inc/vcf/validator_detail_v41.hpp"
+#line 3838 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 78 )
 		goto st150;
 	goto tr204;
@@ -3907,7 +3893,7 @@ case 156:
 		goto tr229;
 	goto tr227;
 tr228:
-#line 148 "src/vcf/vcf.ragel"
+#line 147 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
@@ -3917,14 +3903,14 @@ tr228:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st157;
 st157:
 	if ( ++p == pe )
 		goto _test_eof157;
 case 157:
-#line 3928 "inc/vcf/validator_detail_v41.hpp"
+#line 3914 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 44 )
 		goto tr230;
 	goto tr227;
@@ -3938,7 +3924,7 @@ st158:
 	if ( ++p == pe )
 		goto _test_eof158;
 case 158:
-#line 3942 "inc/vcf/validator_detail_v41.hpp"
+#line 3928 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 84 )
 		goto st159;
 	goto tr204;
@@ -3983,11 +3969,11 @@ case 163:
 tr239:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st164;
 tr237:
-#line 152 "src/vcf/vcf.ragel"
+#line 151 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Type");
     }
@@ -3997,14 +3983,14 @@ tr237:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st164;
 st164:
 	if ( ++p == pe )
 		goto _test_eof164;
 case 164:
-#line 4008 "inc/vcf/validator_detail_v41.hpp"
+#line 3994 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 44 )
 		goto tr238;
 	if ( (*p) > 90 ) {
@@ -4023,7 +4009,7 @@ st165:
 	if ( ++p == pe )
 		goto _test_eof165;
 case 165:
-#line 4027 "inc/vcf/validator_detail_v41.hpp"
+#line 4013 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 68 )
 		goto st166;
 	goto tr204;
@@ -4112,7 +4098,7 @@ case 177:
 		goto tr252;
 	goto tr204;
 tr252:
-#line 156 "src/vcf/vcf.ragel"
+#line 155 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -4121,7 +4107,7 @@ st178:
 	if ( ++p == pe )
 		goto _test_eof178;
 case 178:
-#line 4125 "inc/vcf/validator_detail_v41.hpp"
+#line 4111 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr255;
 		case 92: goto tr256;
@@ -4136,20 +4122,20 @@ tr254:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st179;
 tr257:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st179;
 st179:
 	if ( ++p == pe )
 		goto _test_eof179;
 case 179:
-#line 4153 "inc/vcf/validator_detail_v41.hpp"
+#line 4139 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr258;
 		case 92: goto tr259;
@@ -4177,7 +4163,7 @@ st180:
 	if ( ++p == pe )
 		goto _test_eof180;
 case 180:
-#line 4181 "inc/vcf/validator_detail_v41.hpp"
+#line 4167 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 62 )
 		goto st181;
 	goto tr253;
@@ -4197,20 +4183,20 @@ tr256:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st182;
 tr259:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st182;
 st182:
 	if ( ++p == pe )
 		goto _test_eof182;
 case 182:
-#line 4214 "inc/vcf/validator_detail_v41.hpp"
+#line 4200 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr261;
 		case 92: goto tr259;
@@ -4221,7 +4207,7 @@ case 182:
 tr261:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4232,7 +4218,7 @@ st183:
 	if ( ++p == pe )
 		goto _test_eof183;
 case 183:
-#line 4236 "inc/vcf/validator_detail_v41.hpp"
+#line 4222 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr258;
 		case 62: goto tr262;
@@ -4244,14 +4230,14 @@ case 183:
 tr262:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st184;
 st184:
 	if ( ++p == pe )
 		goto _test_eof184;
 case 184:
-#line 4255 "inc/vcf/validator_detail_v41.hpp"
+#line 4241 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -4264,11 +4250,11 @@ case 184:
 tr263:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st185;
 tr229:
-#line 148 "src/vcf/vcf.ragel"
+#line 147 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
@@ -4278,14 +4264,14 @@ tr229:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st185;
 st185:
 	if ( ++p == pe )
 		goto _test_eof185;
 case 185:
-#line 4289 "inc/vcf/validator_detail_v41.hpp"
+#line 4275 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 44 )
 		goto tr230;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -4298,14 +4284,14 @@ tr33:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st186;
 st186:
 	if ( ++p == pe )
 		goto _test_eof186;
 case 186:
-#line 4309 "inc/vcf/validator_detail_v41.hpp"
+#line 4295 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 78: goto tr265;
@@ -4316,14 +4302,14 @@ case 186:
 tr265:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st187;
 st187:
 	if ( ++p == pe )
 		goto _test_eof187;
 case 187:
-#line 4327 "inc/vcf/validator_detail_v41.hpp"
+#line 4313 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 70: goto tr266;
@@ -4334,14 +4320,14 @@ case 187:
 tr266:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st188;
 st188:
 	if ( ++p == pe )
 		goto _test_eof188;
 case 188:
-#line 4345 "inc/vcf/validator_detail_v41.hpp"
+#line 4331 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 79: goto st189;
@@ -4359,7 +4345,7 @@ case 189:
 		goto tr40;
 	goto tr264;
 tr268:
-#line 128 "src/vcf/vcf.ragel"
+#line 127 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "INFO");
     }
@@ -4368,7 +4354,7 @@ st190:
 	if ( ++p == pe )
 		goto _test_eof190;
 case 190:
-#line 4372 "inc/vcf/validator_detail_v41.hpp"
+#line 4358 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 60 )
 		goto st191;
 	goto tr264;
@@ -4412,7 +4398,7 @@ case 194:
 		goto tr275;
 	goto tr273;
 tr274:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -4425,7 +4411,7 @@ st195:
 	if ( ++p == pe )
 		goto _test_eof195;
 case 195:
-#line 4429 "inc/vcf/validator_detail_v41.hpp"
+#line 4415 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 95 )
 		goto st195;
 	if ( (*p) < 48 ) {
@@ -4443,11 +4429,11 @@ case 195:
 tr277:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st196;
 tr275:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -4457,14 +4443,14 @@ tr275:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st196;
 st196:
 	if ( ++p == pe )
 		goto _test_eof196;
 case 196:
-#line 4468 "inc/vcf/validator_detail_v41.hpp"
+#line 4454 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 44: goto tr278;
 		case 95: goto tr277;
@@ -4491,7 +4477,7 @@ st197:
 	if ( ++p == pe )
 		goto _test_eof197;
 case 197:
-#line 4495 "inc/vcf/validator_detail_v41.hpp"
+#line 4481 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 78 )
 		goto st198;
 	goto tr264;
@@ -4550,7 +4536,7 @@ case 204:
 		goto tr288;
 	goto tr286;
 tr287:
-#line 148 "src/vcf/vcf.ragel"
+#line 147 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
@@ -4560,14 +4546,14 @@ tr287:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st205;
 st205:
 	if ( ++p == pe )
 		goto _test_eof205;
 case 205:
-#line 4571 "inc/vcf/validator_detail_v41.hpp"
+#line 4557 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 44 )
 		goto tr289;
 	goto tr286;
@@ -4581,7 +4567,7 @@ st206:
 	if ( ++p == pe )
 		goto _test_eof206;
 case 206:
-#line 4585 "inc/vcf/validator_detail_v41.hpp"
+#line 4571 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 84 )
 		goto st207;
 	goto tr264;
@@ -4626,11 +4612,11 @@ case 211:
 tr298:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st212;
 tr296:
-#line 152 "src/vcf/vcf.ragel"
+#line 151 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Type");
     }
@@ -4640,14 +4626,14 @@ tr296:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st212;
 st212:
 	if ( ++p == pe )
 		goto _test_eof212;
 case 212:
-#line 4651 "inc/vcf/validator_detail_v41.hpp"
+#line 4637 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 44 )
 		goto tr297;
 	if ( (*p) > 90 ) {
@@ -4666,7 +4652,7 @@ st213:
 	if ( ++p == pe )
 		goto _test_eof213;
 case 213:
-#line 4670 "inc/vcf/validator_detail_v41.hpp"
+#line 4656 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 68 )
 		goto st214;
 	goto tr264;
@@ -4755,7 +4741,7 @@ case 225:
 		goto tr311;
 	goto tr264;
 tr311:
-#line 156 "src/vcf/vcf.ragel"
+#line 155 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -4764,7 +4750,7 @@ st226:
 	if ( ++p == pe )
 		goto _test_eof226;
 case 226:
-#line 4768 "inc/vcf/validator_detail_v41.hpp"
+#line 4754 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr314;
 		case 92: goto tr315;
@@ -4779,20 +4765,20 @@ tr313:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st227;
 tr316:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st227;
 st227:
 	if ( ++p == pe )
 		goto _test_eof227;
 case 227:
-#line 4796 "inc/vcf/validator_detail_v41.hpp"
+#line 4782 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr317;
 		case 92: goto tr318;
@@ -4820,7 +4806,7 @@ st228:
 	if ( ++p == pe )
 		goto _test_eof228;
 case 228:
-#line 4824 "inc/vcf/validator_detail_v41.hpp"
+#line 4810 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 62 )
 		goto st229;
 	goto tr312;
@@ -4840,20 +4826,20 @@ tr315:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st230;
 tr318:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st230;
 st230:
 	if ( ++p == pe )
 		goto _test_eof230;
 case 230:
-#line 4857 "inc/vcf/validator_detail_v41.hpp"
+#line 4843 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 92: goto tr318;
@@ -4864,7 +4850,7 @@ case 230:
 tr320:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4875,7 +4861,7 @@ st231:
 	if ( ++p == pe )
 		goto _test_eof231;
 case 231:
-#line 4879 "inc/vcf/validator_detail_v41.hpp"
+#line 4865 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr317;
 		case 62: goto tr321;
@@ -4887,14 +4873,14 @@ case 231:
 tr321:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st232;
 st232:
 	if ( ++p == pe )
 		goto _test_eof232;
 case 232:
-#line 4898 "inc/vcf/validator_detail_v41.hpp"
+#line 4884 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -4907,11 +4893,11 @@ case 232:
 tr322:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st233;
 tr288:
-#line 148 "src/vcf/vcf.ragel"
+#line 147 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
@@ -4921,14 +4907,14 @@ tr288:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st233;
 st233:
 	if ( ++p == pe )
 		goto _test_eof233;
 case 233:
-#line 4932 "inc/vcf/validator_detail_v41.hpp"
+#line 4918 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 44 )
 		goto tr289;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -4941,14 +4927,14 @@ tr34:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st234;
 st234:
 	if ( ++p == pe )
 		goto _test_eof234;
 case 234:
-#line 4952 "inc/vcf/validator_detail_v41.hpp"
+#line 4938 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto tr324;
@@ -4959,14 +4945,14 @@ case 234:
 tr324:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st235;
 st235:
 	if ( ++p == pe )
 		goto _test_eof235;
 case 235:
-#line 4970 "inc/vcf/validator_detail_v41.hpp"
+#line 4956 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 68: goto tr325;
@@ -4977,14 +4963,14 @@ case 235:
 tr325:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st236;
 st236:
 	if ( ++p == pe )
 		goto _test_eof236;
 case 236:
-#line 4988 "inc/vcf/validator_detail_v41.hpp"
+#line 4974 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 73: goto tr326;
@@ -4995,14 +4981,14 @@ case 236:
 tr326:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st237;
 st237:
 	if ( ++p == pe )
 		goto _test_eof237;
 case 237:
-#line 5006 "inc/vcf/validator_detail_v41.hpp"
+#line 4992 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 71: goto tr327;
@@ -5013,14 +4999,14 @@ case 237:
 tr327:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st238;
 st238:
 	if ( ++p == pe )
 		goto _test_eof238;
 case 238:
-#line 5024 "inc/vcf/validator_detail_v41.hpp"
+#line 5010 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 82: goto tr328;
@@ -5031,14 +5017,14 @@ case 238:
 tr328:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st239;
 st239:
 	if ( ++p == pe )
 		goto _test_eof239;
 case 239:
-#line 5042 "inc/vcf/validator_detail_v41.hpp"
+#line 5028 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto tr329;
@@ -5049,14 +5035,14 @@ case 239:
 tr329:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st240;
 st240:
 	if ( ++p == pe )
 		goto _test_eof240;
 case 240:
-#line 5060 "inc/vcf/validator_detail_v41.hpp"
+#line 5046 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto st241;
@@ -5074,7 +5060,7 @@ case 241:
 		goto tr40;
 	goto tr323;
 tr331:
-#line 132 "src/vcf/vcf.ragel"
+#line 131 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "PEDIGREE");
     }
@@ -5083,7 +5069,7 @@ st242:
 	if ( ++p == pe )
 		goto _test_eof242;
 case 242:
-#line 5087 "inc/vcf/validator_detail_v41.hpp"
+#line 5073 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 60 )
 		goto st243;
 	goto tr323;
@@ -5097,7 +5083,7 @@ st243:
 	if ( ++p == pe )
 		goto _test_eof243;
 case 243:
-#line 5101 "inc/vcf/validator_detail_v41.hpp"
+#line 5087 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 95 )
 		goto tr334;
 	if ( (*p) < 48 ) {
@@ -5122,7 +5108,7 @@ st244:
 	if ( ++p == pe )
 		goto _test_eof244;
 case 244:
-#line 5126 "inc/vcf/validator_detail_v41.hpp"
+#line 5112 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 95 )
 		goto st244;
 	if ( (*p) < 48 ) {
@@ -5144,20 +5130,20 @@ tr335:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st245;
 tr337:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st245;
 st245:
 	if ( ++p == pe )
 		goto _test_eof245;
 case 245:
-#line 5161 "inc/vcf/validator_detail_v41.hpp"
+#line 5147 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr338;
 		case 95: goto tr337;
@@ -5184,7 +5170,7 @@ st246:
 	if ( ++p == pe )
 		goto _test_eof246;
 case 246:
-#line 5188 "inc/vcf/validator_detail_v41.hpp"
+#line 5174 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 95 )
 		goto tr339;
 	if ( (*p) < 48 ) {
@@ -5209,7 +5195,7 @@ st247:
 	if ( ++p == pe )
 		goto _test_eof247;
 case 247:
-#line 5213 "inc/vcf/validator_detail_v41.hpp"
+#line 5199 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 95 )
 		goto st247;
 	if ( (*p) < 48 ) {
@@ -5231,20 +5217,20 @@ tr340:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st248;
 tr342:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st248;
 st248:
 	if ( ++p == pe )
 		goto _test_eof248;
 case 248:
-#line 5248 "inc/vcf/validator_detail_v41.hpp"
+#line 5234 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 44: goto tr343;
 		case 62: goto tr344;
@@ -5272,7 +5258,7 @@ st249:
 	if ( ++p == pe )
 		goto _test_eof249;
 case 249:
-#line 5276 "inc/vcf/validator_detail_v41.hpp"
+#line 5262 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -5285,14 +5271,14 @@ tr35:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st250;
 st250:
 	if ( ++p == pe )
 		goto _test_eof250;
 case 250:
-#line 5296 "inc/vcf/validator_detail_v41.hpp"
+#line 5282 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 65: goto tr346;
@@ -5303,14 +5289,14 @@ case 250:
 tr346:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st251;
 st251:
 	if ( ++p == pe )
 		goto _test_eof251;
 case 251:
-#line 5314 "inc/vcf/validator_detail_v41.hpp"
+#line 5300 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 77: goto tr347;
@@ -5321,14 +5307,14 @@ case 251:
 tr347:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st252;
 st252:
 	if ( ++p == pe )
 		goto _test_eof252;
 case 252:
-#line 5332 "inc/vcf/validator_detail_v41.hpp"
+#line 5318 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 80: goto tr348;
@@ -5339,14 +5325,14 @@ case 252:
 tr348:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st253;
 st253:
 	if ( ++p == pe )
 		goto _test_eof253;
 case 253:
-#line 5350 "inc/vcf/validator_detail_v41.hpp"
+#line 5336 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 76: goto tr349;
@@ -5357,14 +5343,14 @@ case 253:
 tr349:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st254;
 st254:
 	if ( ++p == pe )
 		goto _test_eof254;
 case 254:
-#line 5368 "inc/vcf/validator_detail_v41.hpp"
+#line 5354 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto st255;
@@ -5382,7 +5368,7 @@ case 255:
 		goto tr40;
 	goto tr345;
 tr351:
-#line 140 "src/vcf/vcf.ragel"
+#line 139 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "SAMPLE");
     }
@@ -5391,7 +5377,7 @@ st256:
 	if ( ++p == pe )
 		goto _test_eof256;
 case 256:
-#line 5395 "inc/vcf/validator_detail_v41.hpp"
+#line 5381 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 60 )
 		goto st257;
 	goto tr345;
@@ -5435,7 +5421,7 @@ case 260:
 		goto tr358;
 	goto tr356;
 tr357:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -5448,7 +5434,7 @@ st261:
 	if ( ++p == pe )
 		goto _test_eof261;
 case 261:
-#line 5452 "inc/vcf/validator_detail_v41.hpp"
+#line 5438 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 95 )
 		goto st261;
 	if ( (*p) < 48 ) {
@@ -5466,11 +5452,11 @@ case 261:
 tr360:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st262;
 tr358:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -5480,14 +5466,14 @@ tr358:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st262;
 st262:
 	if ( ++p == pe )
 		goto _test_eof262;
 case 262:
-#line 5491 "inc/vcf/validator_detail_v41.hpp"
+#line 5477 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 44: goto tr362;
 		case 95: goto tr360;
@@ -5514,7 +5500,7 @@ st263:
 	if ( ++p == pe )
 		goto _test_eof263;
 case 263:
-#line 5518 "inc/vcf/validator_detail_v41.hpp"
+#line 5504 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 71 )
 		goto st264;
 	goto tr363;
@@ -5586,11 +5572,11 @@ case 271:
 tr374:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st272;
 tr372:
-#line 160 "src/vcf/vcf.ragel"
+#line 159 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Genomes");
     }
@@ -5600,14 +5586,14 @@ tr372:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st272;
 st272:
 	if ( ++p == pe )
 		goto _test_eof272;
 case 272:
-#line 5611 "inc/vcf/validator_detail_v41.hpp"
+#line 5597 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 44 )
 		goto tr375;
 	if ( (*p) < 35 ) {
@@ -5629,7 +5615,7 @@ st273:
 	if ( ++p == pe )
 		goto _test_eof273;
 case 273:
-#line 5633 "inc/vcf/validator_detail_v41.hpp"
+#line 5619 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 77 )
 		goto st274;
 	goto tr376;
@@ -5701,11 +5687,11 @@ case 281:
 tr387:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st282;
 tr385:
-#line 164 "src/vcf/vcf.ragel"
+#line 163 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Mixture");
     }
@@ -5715,14 +5701,14 @@ tr385:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st282;
 st282:
 	if ( ++p == pe )
 		goto _test_eof282;
 case 282:
-#line 5726 "inc/vcf/validator_detail_v41.hpp"
+#line 5712 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 44 )
 		goto tr388;
 	if ( (*p) < 35 ) {
@@ -5744,7 +5730,7 @@ st283:
 	if ( ++p == pe )
 		goto _test_eof283;
 case 283:
-#line 5748 "inc/vcf/validator_detail_v41.hpp"
+#line 5734 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 68 )
 		goto st284;
 	goto tr389;
@@ -5833,7 +5819,7 @@ case 295:
 		goto tr402;
 	goto tr389;
 tr402:
-#line 156 "src/vcf/vcf.ragel"
+#line 155 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -5842,7 +5828,7 @@ st296:
 	if ( ++p == pe )
 		goto _test_eof296;
 case 296:
-#line 5846 "inc/vcf/validator_detail_v41.hpp"
+#line 5832 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr404;
 		case 92: goto tr405;
@@ -5857,20 +5843,20 @@ tr403:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st297;
 tr406:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st297;
 st297:
 	if ( ++p == pe )
 		goto _test_eof297;
 case 297:
-#line 5874 "inc/vcf/validator_detail_v41.hpp"
+#line 5860 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr407;
 		case 92: goto tr408;
@@ -5898,7 +5884,7 @@ st298:
 	if ( ++p == pe )
 		goto _test_eof298;
 case 298:
-#line 5902 "inc/vcf/validator_detail_v41.hpp"
+#line 5888 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 62 )
 		goto st299;
 	goto tr389;
@@ -5918,20 +5904,20 @@ tr405:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st300;
 tr408:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st300;
 st300:
 	if ( ++p == pe )
 		goto _test_eof300;
 case 300:
-#line 5935 "inc/vcf/validator_detail_v41.hpp"
+#line 5921 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr410;
 		case 92: goto tr408;
@@ -5942,7 +5928,7 @@ case 300:
 tr410:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -5953,7 +5939,7 @@ st301:
 	if ( ++p == pe )
 		goto _test_eof301;
 case 301:
-#line 5957 "inc/vcf/validator_detail_v41.hpp"
+#line 5943 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr407;
 		case 62: goto tr411;
@@ -5965,14 +5951,14 @@ case 301:
 tr411:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st302;
 st302:
 	if ( ++p == pe )
 		goto _test_eof302;
 case 302:
-#line 5976 "inc/vcf/validator_detail_v41.hpp"
+#line 5962 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -5989,14 +5975,14 @@ tr36:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st303;
 st303:
 	if ( ++p == pe )
 		goto _test_eof303;
 case 303:
-#line 6000 "inc/vcf/validator_detail_v41.hpp"
+#line 5986 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 115: goto tr413;
@@ -6007,14 +5993,14 @@ case 303:
 tr413:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st304;
 st304:
 	if ( ++p == pe )
 		goto _test_eof304;
 case 304:
-#line 6018 "inc/vcf/validator_detail_v41.hpp"
+#line 6004 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 115: goto tr414;
@@ -6025,14 +6011,14 @@ case 304:
 tr414:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st305;
 st305:
 	if ( ++p == pe )
 		goto _test_eof305;
 case 305:
-#line 6036 "inc/vcf/validator_detail_v41.hpp"
+#line 6022 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 101: goto tr415;
@@ -6043,14 +6029,14 @@ case 305:
 tr415:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st306;
 st306:
 	if ( ++p == pe )
 		goto _test_eof306;
 case 306:
-#line 6054 "inc/vcf/validator_detail_v41.hpp"
+#line 6040 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 109: goto tr416;
@@ -6061,14 +6047,14 @@ case 306:
 tr416:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st307;
 st307:
 	if ( ++p == pe )
 		goto _test_eof307;
 case 307:
-#line 6072 "inc/vcf/validator_detail_v41.hpp"
+#line 6058 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 98: goto tr417;
@@ -6079,14 +6065,14 @@ case 307:
 tr417:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st308;
 st308:
 	if ( ++p == pe )
 		goto _test_eof308;
 case 308:
-#line 6090 "inc/vcf/validator_detail_v41.hpp"
+#line 6076 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 108: goto tr418;
@@ -6097,14 +6083,14 @@ case 308:
 tr418:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st309;
 st309:
 	if ( ++p == pe )
 		goto _test_eof309;
 case 309:
-#line 6108 "inc/vcf/validator_detail_v41.hpp"
+#line 6094 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 121: goto st310;
@@ -6122,7 +6108,7 @@ case 310:
 		goto tr40;
 	goto tr412;
 tr420:
-#line 112 "src/vcf/vcf.ragel"
+#line 111 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "assembly");
     }
@@ -6131,7 +6117,7 @@ st311:
 	if ( ++p == pe )
 		goto _test_eof311;
 case 311:
-#line 6135 "inc/vcf/validator_detail_v41.hpp"
+#line 6121 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) > 90 ) {
 		if ( 97 <= (*p) && (*p) <= 122 )
 			goto tr422;
@@ -6148,7 +6134,7 @@ st312:
 	if ( ++p == pe )
 		goto _test_eof312;
 case 312:
-#line 6152 "inc/vcf/validator_detail_v41.hpp"
+#line 6138 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr421;
 		case 13: goto tr424;
@@ -6164,17 +6150,13 @@ tr424:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st313;
 st313:
 	if ( ++p == pe )
 		goto _test_eof313;
 case 313:
-#line 6178 "inc/vcf/validator_detail_v41.hpp"
+#line 6160 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr421;
 		case 13: goto tr424;
@@ -6262,7 +6244,7 @@ case 322:
 tr429:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st323;
 tr438:
@@ -6271,20 +6253,16 @@ tr438:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -6297,7 +6275,7 @@ st323:
 	if ( ++p == pe )
 		goto _test_eof323;
 case 323:
-#line 6301 "inc/vcf/validator_detail_v41.hpp"
+#line 6279 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr45;
 		case 13: goto tr438;
@@ -6358,14 +6336,14 @@ tr37:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st330;
 st330:
 	if ( ++p == pe )
 		goto _test_eof330;
 case 330:
-#line 6369 "inc/vcf/validator_detail_v41.hpp"
+#line 6347 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 111: goto tr443;
@@ -6376,14 +6354,14 @@ case 330:
 tr443:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st331;
 st331:
 	if ( ++p == pe )
 		goto _test_eof331;
 case 331:
-#line 6387 "inc/vcf/validator_detail_v41.hpp"
+#line 6365 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 110: goto tr444;
@@ -6394,14 +6372,14 @@ case 331:
 tr444:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st332;
 st332:
 	if ( ++p == pe )
 		goto _test_eof332;
 case 332:
-#line 6405 "inc/vcf/validator_detail_v41.hpp"
+#line 6383 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 116: goto tr445;
@@ -6412,14 +6390,14 @@ case 332:
 tr445:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st333;
 st333:
 	if ( ++p == pe )
 		goto _test_eof333;
 case 333:
-#line 6423 "inc/vcf/validator_detail_v41.hpp"
+#line 6401 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 105: goto tr446;
@@ -6430,14 +6408,14 @@ case 333:
 tr446:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st334;
 st334:
 	if ( ++p == pe )
 		goto _test_eof334;
 case 334:
-#line 6441 "inc/vcf/validator_detail_v41.hpp"
+#line 6419 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 103: goto st335;
@@ -6455,7 +6433,7 @@ case 335:
 		goto tr40;
 	goto tr442;
 tr448:
-#line 116 "src/vcf/vcf.ragel"
+#line 115 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "contig");
     }
@@ -6464,7 +6442,7 @@ st336:
 	if ( ++p == pe )
 		goto _test_eof336;
 case 336:
-#line 6468 "inc/vcf/validator_detail_v41.hpp"
+#line 6446 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 60 )
 		goto st337;
 	goto tr442;
@@ -6505,11 +6483,11 @@ case 340:
 tr455:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st341;
 tr454:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -6519,14 +6497,14 @@ tr454:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st341;
 st341:
 	if ( ++p == pe )
 		goto _test_eof341;
 case 341:
-#line 6530 "inc/vcf/validator_detail_v41.hpp"
+#line 6508 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 44: goto tr456;
 		case 59: goto tr455;
@@ -6548,7 +6526,7 @@ st342:
 	if ( ++p == pe )
 		goto _test_eof342;
 case 342:
-#line 6552 "inc/vcf/validator_detail_v41.hpp"
+#line 6530 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 95 )
 		goto tr458;
 	if ( (*p) < 48 ) {
@@ -6573,7 +6551,7 @@ st343:
 	if ( ++p == pe )
 		goto _test_eof343;
 case 343:
-#line 6577 "inc/vcf/validator_detail_v41.hpp"
+#line 6555 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 95 )
 		goto st343;
 	if ( (*p) < 48 ) {
@@ -6595,20 +6573,20 @@ tr459:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st344;
 tr461:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st344;
 st344:
 	if ( ++p == pe )
 		goto _test_eof344;
 case 344:
-#line 6612 "inc/vcf/validator_detail_v41.hpp"
+#line 6590 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr462;
 		case 95: goto tr461;
@@ -6635,7 +6613,7 @@ st345:
 	if ( ++p == pe )
 		goto _test_eof345;
 case 345:
-#line 6639 "inc/vcf/validator_detail_v41.hpp"
+#line 6617 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 34 )
 		goto st348;
 	if ( (*p) < 45 ) {
@@ -6654,20 +6632,20 @@ tr463:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st346;
 tr465:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st346;
 st346:
 	if ( ++p == pe )
 		goto _test_eof346;
 case 346:
-#line 6671 "inc/vcf/validator_detail_v41.hpp"
+#line 6649 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 44: goto tr456;
 		case 62: goto tr457;
@@ -6688,7 +6666,7 @@ st347:
 	if ( ++p == pe )
 		goto _test_eof347;
 case 347:
-#line 6692 "inc/vcf/validator_detail_v41.hpp"
+#line 6670 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -6712,20 +6690,20 @@ tr466:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st349;
 tr469:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st349;
 st349:
 	if ( ++p == pe )
 		goto _test_eof349;
 case 349:
-#line 6729 "inc/vcf/validator_detail_v41.hpp"
+#line 6707 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr470;
 		case 92: goto tr471;
@@ -6753,7 +6731,7 @@ st350:
 	if ( ++p == pe )
 		goto _test_eof350;
 case 350:
-#line 6757 "inc/vcf/validator_detail_v41.hpp"
+#line 6735 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 44: goto st342;
 		case 62: goto st347;
@@ -6766,20 +6744,20 @@ tr468:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st351;
 tr471:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st351;
 st351:
 	if ( ++p == pe )
 		goto _test_eof351;
 case 351:
-#line 6783 "inc/vcf/validator_detail_v41.hpp"
+#line 6761 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr474;
 		case 92: goto tr471;
@@ -6790,7 +6768,7 @@ case 351:
 tr474:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6801,7 +6779,7 @@ st352:
 	if ( ++p == pe )
 		goto _test_eof352;
 case 352:
-#line 6805 "inc/vcf/validator_detail_v41.hpp"
+#line 6783 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr470;
 		case 44: goto tr475;
@@ -6818,19 +6796,19 @@ tr489:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st353;
 tr475:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st353;
 tr486:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6841,7 +6819,7 @@ st353:
 	if ( ++p == pe )
 		goto _test_eof353;
 case 353:
-#line 6845 "inc/vcf/validator_detail_v41.hpp"
+#line 6823 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr470;
 		case 47: goto tr469;
@@ -6879,20 +6857,20 @@ tr477:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st354;
 tr479:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st354;
 st354:
 	if ( ++p == pe )
 		goto _test_eof354;
 case 354:
-#line 6896 "inc/vcf/validator_detail_v41.hpp"
+#line 6874 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr470;
 		case 47: goto tr469;
@@ -6930,20 +6908,20 @@ tr478:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st355;
 tr480:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st355;
 st355:
 	if ( ++p == pe )
 		goto _test_eof355;
 case 355:
-#line 6947 "inc/vcf/validator_detail_v41.hpp"
+#line 6925 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr470;
 		case 47: goto tr469;
@@ -6979,14 +6957,14 @@ tr481:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st356;
 st356:
 	if ( ++p == pe )
 		goto _test_eof356;
 case 356:
-#line 6990 "inc/vcf/validator_detail_v41.hpp"
+#line 6968 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr483;
 		case 44: goto tr469;
@@ -6999,13 +6977,13 @@ case 356:
 tr485:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st357;
 tr482:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -7016,7 +6994,7 @@ st357:
 	if ( ++p == pe )
 		goto _test_eof357;
 case 357:
-#line 7020 "inc/vcf/validator_detail_v41.hpp"
+#line 6998 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr470;
 		case 44: goto tr486;
@@ -7033,19 +7011,19 @@ tr490:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st358;
 tr476:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st358;
 tr487:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -7056,7 +7034,7 @@ st358:
 	if ( ++p == pe )
 		goto _test_eof358;
 case 358:
-#line 7060 "inc/vcf/validator_detail_v41.hpp"
+#line 7038 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -7069,13 +7047,13 @@ case 358:
 tr488:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st359;
 tr484:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -7086,7 +7064,7 @@ st359:
 	if ( ++p == pe )
 		goto _test_eof359;
 case 359:
-#line 7090 "inc/vcf/validator_detail_v41.hpp"
+#line 7068 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr474;
 		case 44: goto tr486;
@@ -7106,7 +7084,7 @@ st360:
 	if ( ++p == pe )
 		goto _test_eof360;
 case 360:
-#line 7110 "inc/vcf/validator_detail_v41.hpp"
+#line 7088 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 34: goto tr467;
 		case 44: goto tr489;
@@ -7123,14 +7101,14 @@ tr38:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st361;
 st361:
 	if ( ++p == pe )
 		goto _test_eof361;
 case 361:
-#line 7134 "inc/vcf/validator_detail_v41.hpp"
+#line 7112 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 101: goto tr492;
@@ -7141,14 +7119,14 @@ case 361:
 tr492:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st362;
 st362:
 	if ( ++p == pe )
 		goto _test_eof362;
 case 362:
-#line 7152 "inc/vcf/validator_detail_v41.hpp"
+#line 7130 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 100: goto tr493;
@@ -7159,14 +7137,14 @@ case 362:
 tr493:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st363;
 st363:
 	if ( ++p == pe )
 		goto _test_eof363;
 case 363:
-#line 7170 "inc/vcf/validator_detail_v41.hpp"
+#line 7148 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 105: goto tr494;
@@ -7177,14 +7155,14 @@ case 363:
 tr494:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st364;
 st364:
 	if ( ++p == pe )
 		goto _test_eof364;
 case 364:
-#line 7188 "inc/vcf/validator_detail_v41.hpp"
+#line 7166 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 103: goto tr495;
@@ -7195,14 +7173,14 @@ case 364:
 tr495:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st365;
 st365:
 	if ( ++p == pe )
 		goto _test_eof365;
 case 365:
-#line 7206 "inc/vcf/validator_detail_v41.hpp"
+#line 7184 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 114: goto tr496;
@@ -7213,14 +7191,14 @@ case 365:
 tr496:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st366;
 st366:
 	if ( ++p == pe )
 		goto _test_eof366;
 case 366:
-#line 7224 "inc/vcf/validator_detail_v41.hpp"
+#line 7202 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 101: goto tr497;
@@ -7231,14 +7209,14 @@ case 366:
 tr497:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st367;
 st367:
 	if ( ++p == pe )
 		goto _test_eof367;
 case 367:
-#line 7242 "inc/vcf/validator_detail_v41.hpp"
+#line 7220 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 101: goto tr498;
@@ -7249,14 +7227,14 @@ case 367:
 tr498:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st368;
 st368:
 	if ( ++p == pe )
 		goto _test_eof368;
 case 368:
-#line 7260 "inc/vcf/validator_detail_v41.hpp"
+#line 7238 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 68: goto tr499;
@@ -7267,14 +7245,14 @@ case 368:
 tr499:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st369;
 st369:
 	if ( ++p == pe )
 		goto _test_eof369;
 case 369:
-#line 7278 "inc/vcf/validator_detail_v41.hpp"
+#line 7256 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 66: goto st370;
@@ -7292,7 +7270,7 @@ case 370:
 		goto tr40;
 	goto tr491;
 tr501:
-#line 136 "src/vcf/vcf.ragel"
+#line 135 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "pedigreeDB");
     }
@@ -7301,7 +7279,7 @@ st371:
 	if ( ++p == pe )
 		goto _test_eof371;
 case 371:
-#line 7305 "inc/vcf/validator_detail_v41.hpp"
+#line 7283 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 60 )
 		goto st372;
 	goto tr491;
@@ -7325,7 +7303,7 @@ st373:
 	if ( ++p == pe )
 		goto _test_eof373;
 case 373:
-#line 7329 "inc/vcf/validator_detail_v41.hpp"
+#line 7307 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr503;
 		case 13: goto tr506;
@@ -7341,17 +7319,13 @@ tr506:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st374;
 st374:
 	if ( ++p == pe )
 		goto _test_eof374;
 case 374:
-#line 7355 "inc/vcf/validator_detail_v41.hpp"
+#line 7329 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr503;
 		case 13: goto tr506;
@@ -7439,7 +7413,7 @@ case 383:
 tr511:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st384;
 tr520:
@@ -7448,21 +7422,17 @@ tr520:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st384;
 st384:
 	if ( ++p == pe )
 		goto _test_eof384;
 case 384:
-#line 7466 "inc/vcf/validator_detail_v41.hpp"
+#line 7436 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr503;
 		case 13: goto tr520;
@@ -7472,7 +7442,7 @@ case 384:
 tr521:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -7483,7 +7453,7 @@ st385:
 	if ( ++p == pe )
 		goto _test_eof385;
 case 385:
-#line 7487 "inc/vcf/validator_detail_v41.hpp"
+#line 7457 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr522;
@@ -7496,16 +7466,12 @@ tr522:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -7518,7 +7484,7 @@ st386:
 	if ( ++p == pe )
 		goto _test_eof386;
 case 386:
-#line 7522 "inc/vcf/validator_detail_v41.hpp"
+#line 7488 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto st28;
 		case 13: goto tr520;
@@ -7609,7 +7575,7 @@ case 397:
 		goto tr531;
 	goto tr526;
 tr531:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7618,7 +7584,7 @@ st398:
 	if ( ++p == pe )
 		goto _test_eof398;
 case 398:
-#line 7622 "inc/vcf/validator_detail_v41.hpp"
+#line 7588 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 80 )
 		goto st399;
 	goto tr526;
@@ -7644,7 +7610,7 @@ case 401:
 		goto tr535;
 	goto tr526;
 tr535:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7653,7 +7619,7 @@ st402:
 	if ( ++p == pe )
 		goto _test_eof402;
 case 402:
-#line 7657 "inc/vcf/validator_detail_v41.hpp"
+#line 7623 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 73 )
 		goto st403;
 	goto tr526;
@@ -7672,7 +7638,7 @@ case 404:
 		goto tr538;
 	goto tr526;
 tr538:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7681,7 +7647,7 @@ st405:
 	if ( ++p == pe )
 		goto _test_eof405;
 case 405:
-#line 7685 "inc/vcf/validator_detail_v41.hpp"
+#line 7651 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 82 )
 		goto st406;
 	goto tr526;
@@ -7707,7 +7673,7 @@ case 408:
 		goto tr542;
 	goto tr526;
 tr542:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7716,7 +7682,7 @@ st409:
 	if ( ++p == pe )
 		goto _test_eof409;
 case 409:
-#line 7720 "inc/vcf/validator_detail_v41.hpp"
+#line 7686 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 65 )
 		goto st410;
 	goto tr526;
@@ -7742,7 +7708,7 @@ case 412:
 		goto tr546;
 	goto tr526;
 tr546:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7751,7 +7717,7 @@ st413:
 	if ( ++p == pe )
 		goto _test_eof413;
 case 413:
-#line 7755 "inc/vcf/validator_detail_v41.hpp"
+#line 7721 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 81 )
 		goto st414;
 	goto tr526;
@@ -7784,7 +7750,7 @@ case 417:
 		goto tr551;
 	goto tr526;
 tr551:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7793,7 +7759,7 @@ st418:
 	if ( ++p == pe )
 		goto _test_eof418;
 case 418:
-#line 7797 "inc/vcf/validator_detail_v41.hpp"
+#line 7763 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 70 )
 		goto st419;
 	goto tr526;
@@ -7840,7 +7806,7 @@ case 424:
 		goto tr558;
 	goto tr526;
 tr558:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7849,7 +7815,7 @@ st425:
 	if ( ++p == pe )
 		goto _test_eof425;
 case 425:
-#line 7853 "inc/vcf/validator_detail_v41.hpp"
+#line 7819 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 73 )
 		goto st426;
 	goto tr526;
@@ -7885,7 +7851,7 @@ case 429:
 	}
 	goto tr526;
 tr563:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7894,7 +7860,7 @@ st430:
 	if ( ++p == pe )
 		goto _test_eof430;
 case 430:
-#line 7898 "inc/vcf/validator_detail_v41.hpp"
+#line 7864 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 70 )
 		goto st431;
 	goto tr566;
@@ -7941,17 +7907,17 @@ case 436:
 		goto tr573;
 	goto tr566;
 tr573:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
 	goto st437;
 tr575:
-#line 204 "src/vcf/vcf.ragel"
+#line 203 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -7960,7 +7926,7 @@ st437:
 	if ( ++p == pe )
 		goto _test_eof437;
 case 437:
-#line 7964 "inc/vcf/validator_detail_v41.hpp"
+#line 7930 "inc/vcf/validator_detail_v41.hpp"
 	if ( 32 <= (*p) && (*p) <= 126 )
 		goto tr574;
 	goto tr566;
@@ -7971,20 +7937,20 @@ tr574:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st438;
 tr578:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st438;
 st438:
 	if ( ++p == pe )
 		goto _test_eof438;
 case 438:
-#line 7988 "inc/vcf/validator_detail_v41.hpp"
+#line 7954 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr575;
 		case 10: goto tr576;
@@ -7994,7 +7960,7 @@ case 438:
 		goto tr578;
 	goto tr566;
 tr564:
-#line 208 "src/vcf/vcf.ragel"
+#line 207 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
@@ -8003,18 +7969,14 @@ tr564:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st521;
 tr576:
-#line 204 "src/vcf/vcf.ragel"
+#line 203 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 208 "src/vcf/vcf.ragel"
+#line 207 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
@@ -8023,17 +7985,13 @@ tr576:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st521;
 st521:
 	if ( ++p == pe )
 		goto _test_eof521;
 case 521:
-#line 8037 "inc/vcf/validator_detail_v41.hpp"
+#line 7995 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr700;
 		case 13: goto tr701;
@@ -8054,14 +8012,10 @@ tr704:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st522;
 tr700:
-#line 70 "src/vcf/vcf.ragel"
+#line 69 "src/vcf/vcf.ragel"
 	{
         try {
           OptionalPolicy::optional_check_meta_section(*this);
@@ -8074,17 +8028,13 @@ tr700:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st522;
 st522:
 	if ( ++p == pe )
 		goto _test_eof522;
 case 522:
-#line 8088 "inc/vcf/validator_detail_v41.hpp"
+#line 8038 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr704;
 		case 13: goto tr705;
@@ -8096,14 +8046,10 @@ tr705:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st439;
 tr701:
-#line 70 "src/vcf/vcf.ragel"
+#line 69 "src/vcf/vcf.ragel"
 	{
         try {
           OptionalPolicy::optional_check_meta_section(*this);
@@ -8116,17 +8062,13 @@ tr701:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st439;
 st439:
 	if ( ++p == pe )
 		goto _test_eof439;
 case 439:
-#line 8130 "inc/vcf/validator_detail_v41.hpp"
+#line 8072 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 10 )
 		goto st522;
 	goto st0;
@@ -8137,17 +8079,17 @@ tr711:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st440;
 tr583:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st440;
 tr702:
-#line 70 "src/vcf/vcf.ragel"
+#line 69 "src/vcf/vcf.ragel"
 	{
         try {
           OptionalPolicy::optional_check_meta_section(*this);
@@ -8161,14 +8103,14 @@ tr702:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st440;
 st440:
 	if ( ++p == pe )
 		goto _test_eof440;
 case 440:
-#line 8172 "inc/vcf/validator_detail_v41.hpp"
+#line 8114 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr582;
 		case 59: goto tr583;
@@ -8188,21 +8130,21 @@ tr582:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
 	goto st441;
 tr641:
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8211,7 +8153,7 @@ st441:
 	if ( ++p == pe )
 		goto _test_eof441;
 case 441:
-#line 8215 "inc/vcf/validator_detail_v41.hpp"
+#line 8157 "inc/vcf/validator_detail_v41.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr585;
 	goto tr584;
@@ -8222,20 +8164,20 @@ tr585:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st442;
 tr587:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st442;
 st442:
 	if ( ++p == pe )
 		goto _test_eof442;
 case 442:
-#line 8239 "inc/vcf/validator_detail_v41.hpp"
+#line 8181 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 9 )
 		goto tr586;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -8252,11 +8194,11 @@ tr586:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8265,7 +8207,7 @@ st443:
 	if ( ++p == pe )
 		goto _test_eof443;
 case 443:
-#line 8269 "inc/vcf/validator_detail_v41.hpp"
+#line 8211 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) > 58 ) {
 		if ( 60 <= (*p) && (*p) <= 126 )
 			goto tr589;
@@ -8279,20 +8221,20 @@ tr589:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st444;
 tr591:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st444;
 st444:
 	if ( ++p == pe )
 		goto _test_eof444;
 case 444:
-#line 8296 "inc/vcf/validator_detail_v41.hpp"
+#line 8238 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr590;
 		case 59: goto tr592;
@@ -8305,11 +8247,11 @@ tr590:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8318,7 +8260,7 @@ st445:
 	if ( ++p == pe )
 		goto _test_eof445;
 case 445:
-#line 8322 "inc/vcf/validator_detail_v41.hpp"
+#line 8264 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 65: goto tr594;
 		case 67: goto tr594;
@@ -8339,20 +8281,20 @@ tr594:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st446;
 tr596:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st446;
 st446:
 	if ( ++p == pe )
 		goto _test_eof446;
 case 446:
-#line 8356 "inc/vcf/validator_detail_v41.hpp"
+#line 8298 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr595;
 		case 65: goto tr596;
@@ -8372,11 +8314,11 @@ tr595:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8385,7 +8327,7 @@ st447:
 	if ( ++p == pe )
 		goto _test_eof447;
 case 447:
-#line 8389 "inc/vcf/validator_detail_v41.hpp"
+#line 8331 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 42: goto tr598;
 		case 46: goto tr599;
@@ -8411,20 +8353,20 @@ tr598:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st448;
 tr662:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st448;
 st448:
 	if ( ++p == pe )
 		goto _test_eof448;
 case 448:
-#line 8428 "inc/vcf/validator_detail_v41.hpp"
+#line 8370 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr604;
 		case 44: goto tr605;
@@ -8435,11 +8377,11 @@ tr604:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8448,7 +8390,7 @@ st449:
 	if ( ++p == pe )
 		goto _test_eof449;
 case 449:
-#line 8452 "inc/vcf/validator_detail_v41.hpp"
+#line 8394 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 43: goto tr607;
 		case 45: goto tr607;
@@ -8466,14 +8408,14 @@ tr607:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st450;
 st450:
 	if ( ++p == pe )
 		goto _test_eof450;
 case 450:
-#line 8477 "inc/vcf/validator_detail_v41.hpp"
+#line 8419 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 73 )
 		goto tr613;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -8486,20 +8428,20 @@ tr609:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st451;
 tr612:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st451;
 st451:
 	if ( ++p == pe )
 		goto _test_eof451;
 case 451:
-#line 8503 "inc/vcf/validator_detail_v41.hpp"
+#line 8445 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr614;
 		case 46: goto tr615;
@@ -8514,11 +8456,11 @@ tr614:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8527,7 +8469,7 @@ st452:
 	if ( ++p == pe )
 		goto _test_eof452;
 case 452:
-#line 8531 "inc/vcf/validator_detail_v41.hpp"
+#line 8473 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 46: goto tr619;
 		case 58: goto tr618;
@@ -8563,7 +8505,7 @@ st453:
 	if ( ++p == pe )
 		goto _test_eof453;
 case 453:
-#line 8567 "inc/vcf/validator_detail_v41.hpp"
+#line 8509 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 58 )
 		goto st453;
 	if ( (*p) < 65 ) {
@@ -8594,20 +8536,20 @@ tr620:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st454;
 tr622:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st454;
 st454:
 	if ( ++p == pe )
 		goto _test_eof454;
 case 454:
-#line 8611 "inc/vcf/validator_detail_v41.hpp"
+#line 8553 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr623;
 		case 59: goto tr624;
@@ -8620,11 +8562,11 @@ tr623:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8633,7 +8575,7 @@ st455:
 	if ( ++p == pe )
 		goto _test_eof455;
 case 455:
-#line 8637 "inc/vcf/validator_detail_v41.hpp"
+#line 8579 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 46: goto tr626;
 		case 49: goto tr627;
@@ -8652,14 +8594,14 @@ tr626:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st523;
 st523:
 	if ( ++p == pe )
 		goto _test_eof523;
 case 523:
-#line 8663 "inc/vcf/validator_detail_v41.hpp"
+#line 8605 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr707;
 		case 10: goto tr708;
@@ -8677,11 +8619,11 @@ tr707:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8690,7 +8632,7 @@ st456:
 	if ( ++p == pe )
 		goto _test_eof456;
 case 456:
-#line 8694 "inc/vcf/validator_detail_v41.hpp"
+#line 8636 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr630;
@@ -8707,20 +8649,20 @@ tr630:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st457;
 tr632:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st457;
 st457:
 	if ( ++p == pe )
 		goto _test_eof457;
 case 457:
-#line 8724 "inc/vcf/validator_detail_v41.hpp"
+#line 8666 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr631;
 		case 58: goto tr633;
@@ -8739,11 +8681,11 @@ tr631:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -8752,7 +8694,7 @@ st458:
 	if ( ++p == pe )
 		goto _test_eof458;
 case 458:
-#line 8756 "inc/vcf/validator_detail_v41.hpp"
+#line 8698 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 46 )
 		goto tr636;
 	if ( (*p) < 48 ) {
@@ -8771,20 +8713,27 @@ tr635:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st524;
 tr645:
+#line 478 "src/vcf/vcf.ragel"
+	{
+        {p = ((ParsePolicy::handle_long_value(*this, structural_index, p,
+                ebi::util::StructuralIndex::colon | ebi::util::StructuralIndex::tab |
+                ebi::util::StructuralIndex::newline | ebi::util::StructuralIndex::space |
+                ebi::util::StructuralIndex::control)))-1;}
+    }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st524;
 st524:
 	if ( ++p == pe )
 		goto _test_eof524;
 case 524:
-#line 8788 "inc/vcf/validator_detail_v41.hpp"
+#line 8737 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr631;
 		case 10: goto tr708;
@@ -8799,16 +8748,22 @@ tr708:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 217 "src/vcf/vcf.ragel"
 	{
+        ++n_records;
         try {
             // Handle all columns and build record
             ParsePolicy::handle_body_line(*this);
 
+            // A record with errors is not kept, but all of them are reported
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
+
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
                 for(auto &error_ptr : duplicated_errors) {
@@ -8833,17 +8788,13 @@ tr708:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st525;
 st525:
 	if ( ++p == pe )
 		goto _test_eof525;
 case 525:
-#line 8847 "inc/vcf/validator_detail_v41.hpp"
+#line 8798 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr704;
 		case 13: goto tr705;
@@ -8859,7 +8810,7 @@ case 525:
 		goto tr711;
 	goto tr581;
 tr703:
-#line 70 "src/vcf/vcf.ragel"
+#line 69 "src/vcf/vcf.ragel"
 	{
         try {
           OptionalPolicy::optional_check_meta_section(*this);
@@ -8872,7 +8823,7 @@ st459:
 	if ( ++p == pe )
 		goto _test_eof459;
 case 459:
-#line 8876 "inc/vcf/validator_detail_v41.hpp"
+#line 8827 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr638;
@@ -8889,20 +8840,20 @@ tr638:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st460;
 tr639:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st460;
 st460:
 	if ( ++p == pe )
 		goto _test_eof460;
 case 460:
-#line 8906 "inc/vcf/validator_detail_v41.hpp"
+#line 8857 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 59: goto tr639;
 		case 62: goto tr640;
@@ -8926,7 +8877,7 @@ st461:
 	if ( ++p == pe )
 		goto _test_eof461;
 case 461:
-#line 8930 "inc/vcf/validator_detail_v41.hpp"
+#line 8881 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 9 )
 		goto tr641;
 	goto tr581;
@@ -8935,16 +8886,22 @@ tr709:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 217 "src/vcf/vcf.ragel"
 	{
+        ++n_records;
         try {
             // Handle all columns and build record
             ParsePolicy::handle_body_line(*this);
 
+            // A record with errors is not kept, but all of them are reported
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
+
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
                 for(auto &error_ptr : duplicated_errors) {
@@ -8969,31 +8926,27 @@ tr709:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st462;
 st462:
 	if ( ++p == pe )
 		goto _test_eof462;
 case 462:
-#line 8983 "inc/vcf/validator_detail_v41.hpp"
+#line 8936 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 10 )
 		goto st525;
 	goto tr642;
 tr710:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st463;
 st463:
 	if ( ++p == pe )
 		goto _test_eof463;
 case 463:
-#line 8997 "inc/vcf/validator_detail_v41.hpp"
+#line 8950 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) > 57 ) {
 		if ( 59 <= (*p) && (*p) <= 126 )
 			goto tr645;
@@ -9007,20 +8960,20 @@ tr636:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st526;
 tr714:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st526;
 st526:
 	if ( ++p == pe )
 		goto _test_eof526;
 case 526:
-#line 9024 "inc/vcf/validator_detail_v41.hpp"
+#line 8977 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr631;
 		case 10: goto tr708;
@@ -9035,14 +8988,14 @@ case 526:
 tr713:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st527;
 st527:
 	if ( ++p == pe )
 		goto _test_eof527;
 case 527:
-#line 9046 "inc/vcf/validator_detail_v41.hpp"
+#line 8999 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr631;
 		case 10: goto tr708;
@@ -9066,20 +9019,20 @@ tr637:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st528;
 tr715:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st528;
 st528:
 	if ( ++p == pe )
 		goto _test_eof528;
 case 528:
-#line 9083 "inc/vcf/validator_detail_v41.hpp"
+#line 9036 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr631;
 		case 10: goto tr708;
@@ -9104,70 +9057,70 @@ tr627:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st464;
 st464:
 	if ( ++p == pe )
 		goto _test_eof464;
 case 464:
-#line 9115 "inc/vcf/validator_detail_v41.hpp"
+#line 9068 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 48 )
 		goto tr646;
 	goto tr625;
 tr646:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st465;
 st465:
 	if ( ++p == pe )
 		goto _test_eof465;
 case 465:
-#line 9129 "inc/vcf/validator_detail_v41.hpp"
+#line 9082 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 48 )
 		goto tr647;
 	goto tr625;
 tr647:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st466;
 st466:
 	if ( ++p == pe )
 		goto _test_eof466;
 case 466:
-#line 9143 "inc/vcf/validator_detail_v41.hpp"
+#line 9096 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 48 )
 		goto tr648;
 	goto tr625;
 tr648:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st467;
 st467:
 	if ( ++p == pe )
 		goto _test_eof467;
 case 467:
-#line 9157 "inc/vcf/validator_detail_v41.hpp"
+#line 9110 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 71 )
 		goto tr649;
 	goto tr625;
 tr649:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st529;
 st529:
 	if ( ++p == pe )
 		goto _test_eof529;
 case 529:
-#line 9171 "inc/vcf/validator_detail_v41.hpp"
+#line 9124 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr707;
 		case 10: goto tr708;
@@ -9186,7 +9139,7 @@ st468:
 	if ( ++p == pe )
 		goto _test_eof468;
 case 468:
-#line 9190 "inc/vcf/validator_detail_v41.hpp"
+#line 9143 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 49: goto tr627;
 		case 95: goto tr628;
@@ -9204,20 +9157,20 @@ tr628:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st530;
 tr718:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st530;
 st530:
 	if ( ++p == pe )
 		goto _test_eof530;
 case 530:
-#line 9221 "inc/vcf/validator_detail_v41.hpp"
+#line 9174 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr707;
 		case 10: goto tr708;
@@ -9239,14 +9192,14 @@ case 530:
 tr717:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st469;
 st469:
 	if ( ++p == pe )
 		goto _test_eof469;
 case 469:
-#line 9250 "inc/vcf/validator_detail_v41.hpp"
+#line 9203 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) > 58 ) {
 		if ( 60 <= (*p) && (*p) <= 126 )
 			goto tr651;
@@ -9254,16 +9207,23 @@ case 469:
 		goto tr651;
 	goto tr650;
 tr651:
+#line 60 "src/vcf/vcf_v41.ragel"
+	{
+        {p = ((ParsePolicy::handle_long_value(*this, structural_index, p,
+                ebi::util::StructuralIndex::semicolon | ebi::util::StructuralIndex::tab |
+                ebi::util::StructuralIndex::newline | ebi::util::StructuralIndex::space |
+                ebi::util::StructuralIndex::control)))-1;}
+    }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st531;
 st531:
 	if ( ++p == pe )
 		goto _test_eof531;
 case 531:
-#line 9267 "inc/vcf/validator_detail_v41.hpp"
+#line 9227 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr707;
 		case 10: goto tr708;
@@ -9283,7 +9243,7 @@ st470:
 	if ( ++p == pe )
 		goto _test_eof470;
 case 470:
-#line 9287 "inc/vcf/validator_detail_v41.hpp"
+#line 9247 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 58 )
 		goto tr618;
 	if ( (*p) < 65 ) {
@@ -9314,14 +9274,14 @@ tr619:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st471;
 st471:
 	if ( ++p == pe )
 		goto _test_eof471;
 case 471:
-#line 9325 "inc/vcf/validator_detail_v41.hpp"
+#line 9285 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr623;
 		case 58: goto st453;
@@ -9350,28 +9310,28 @@ case 471:
 tr615:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st472;
 st472:
 	if ( ++p == pe )
 		goto _test_eof472;
 case 472:
-#line 9361 "inc/vcf/validator_detail_v41.hpp"
+#line 9321 "inc/vcf/validator_detail_v41.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr652;
 	goto tr606;
 tr652:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st473;
 st473:
 	if ( ++p == pe )
 		goto _test_eof473;
 case 473:
-#line 9375 "inc/vcf/validator_detail_v41.hpp"
+#line 9335 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr614;
 		case 69: goto tr616;
@@ -9383,14 +9343,14 @@ case 473:
 tr616:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st474;
 st474:
 	if ( ++p == pe )
 		goto _test_eof474;
 case 474:
-#line 9394 "inc/vcf/validator_detail_v41.hpp"
+#line 9354 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 43: goto tr653;
 		case 45: goto tr653;
@@ -9401,28 +9361,28 @@ case 474:
 tr653:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st475;
 st475:
 	if ( ++p == pe )
 		goto _test_eof475;
 case 475:
-#line 9412 "inc/vcf/validator_detail_v41.hpp"
+#line 9372 "inc/vcf/validator_detail_v41.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr654;
 	goto tr606;
 tr654:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st476;
 st476:
 	if ( ++p == pe )
 		goto _test_eof476;
 case 476:
-#line 9426 "inc/vcf/validator_detail_v41.hpp"
+#line 9386 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 9 )
 		goto tr614;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -9435,34 +9395,34 @@ tr610:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st477;
 tr613:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st477;
 st477:
 	if ( ++p == pe )
 		goto _test_eof477;
 case 477:
-#line 9452 "inc/vcf/validator_detail_v41.hpp"
+#line 9412 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 110 )
 		goto tr655;
 	goto tr606;
 tr655:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st478;
 st478:
 	if ( ++p == pe )
 		goto _test_eof478;
 case 478:
-#line 9466 "inc/vcf/validator_detail_v41.hpp"
+#line 9426 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 102 )
 		goto tr656;
 	goto tr606;
@@ -9473,20 +9433,20 @@ tr608:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st479;
 tr656:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st479;
 st479:
 	if ( ++p == pe )
 		goto _test_eof479;
 case 479:
-#line 9490 "inc/vcf/validator_detail_v41.hpp"
+#line 9450 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 9 )
 		goto tr614;
 	goto tr606;
@@ -9497,28 +9457,28 @@ tr611:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st480;
 st480:
 	if ( ++p == pe )
 		goto _test_eof480;
 case 480:
-#line 9508 "inc/vcf/validator_detail_v41.hpp"
+#line 9468 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 97 )
 		goto tr657;
 	goto tr606;
 tr657:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st481;
 st481:
 	if ( ++p == pe )
 		goto _test_eof481;
 case 481:
-#line 9522 "inc/vcf/validator_detail_v41.hpp"
+#line 9482 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 78 )
 		goto tr656;
 	goto tr606;
@@ -9532,7 +9492,7 @@ st482:
 	if ( ++p == pe )
 		goto _test_eof482;
 case 482:
-#line 9536 "inc/vcf/validator_detail_v41.hpp"
+#line 9496 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 42: goto tr598;
 		case 46: goto tr658;
@@ -9558,20 +9518,20 @@ tr658:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st483;
 tr682:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st483;
 st483:
 	if ( ++p == pe )
 		goto _test_eof483;
 case 483:
-#line 9575 "inc/vcf/validator_detail_v41.hpp"
+#line 9535 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 65: goto tr659;
 		case 67: goto tr659;
@@ -9588,14 +9548,14 @@ case 483:
 tr659:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st484;
 st484:
 	if ( ++p == pe )
 		goto _test_eof484;
 case 484:
-#line 9599 "inc/vcf/validator_detail_v41.hpp"
+#line 9559 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr604;
 		case 44: goto tr605;
@@ -9618,20 +9578,20 @@ tr600:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st485;
 tr660:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st485;
 st485:
 	if ( ++p == pe )
 		goto _test_eof485;
 case 485:
-#line 9635 "inc/vcf/validator_detail_v41.hpp"
+#line 9595 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 61 )
 		goto tr660;
 	if ( (*p) < 63 ) {
@@ -9664,14 +9624,14 @@ case 485:
 tr661:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st486;
 st486:
 	if ( ++p == pe )
 		goto _test_eof486;
 case 486:
-#line 9675 "inc/vcf/validator_detail_v41.hpp"
+#line 9635 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 62 )
 		goto tr662;
 	if ( (*p) < 45 ) {
@@ -9690,20 +9650,20 @@ tr601:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st487;
 tr663:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st487;
 st487:
 	if ( ++p == pe )
 		goto _test_eof487;
 case 487:
-#line 9707 "inc/vcf/validator_detail_v41.hpp"
+#line 9667 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr604;
 		case 44: goto tr605;
@@ -9725,14 +9685,14 @@ case 487:
 tr664:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st488;
 st488:
 	if ( ++p == pe )
 		goto _test_eof488;
 case 488:
-#line 9736 "inc/vcf/validator_detail_v41.hpp"
+#line 9696 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 60 )
 		goto tr667;
 	if ( (*p) < 65 ) {
@@ -9747,14 +9707,14 @@ case 488:
 tr666:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st489;
 st489:
 	if ( ++p == pe )
 		goto _test_eof489;
 case 489:
-#line 9758 "inc/vcf/validator_detail_v41.hpp"
+#line 9718 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 58: goto tr668;
 		case 61: goto tr666;
@@ -9771,28 +9731,28 @@ case 489:
 tr668:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st490;
 st490:
 	if ( ++p == pe )
 		goto _test_eof490;
 case 490:
-#line 9782 "inc/vcf/validator_detail_v41.hpp"
+#line 9742 "inc/vcf/validator_detail_v41.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr669;
 	goto tr597;
 tr669:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st491;
 st491:
 	if ( ++p == pe )
 		goto _test_eof491;
 case 491:
-#line 9796 "inc/vcf/validator_detail_v41.hpp"
+#line 9756 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 91 )
 		goto tr662;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -9801,14 +9761,14 @@ case 491:
 tr667:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st492;
 st492:
 	if ( ++p == pe )
 		goto _test_eof492;
 case 492:
-#line 9812 "inc/vcf/validator_detail_v41.hpp"
+#line 9772 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr670;
@@ -9821,14 +9781,14 @@ case 492:
 tr670:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st493;
 st493:
 	if ( ++p == pe )
 		goto _test_eof493;
 case 493:
-#line 9832 "inc/vcf/validator_detail_v41.hpp"
+#line 9792 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 59: goto tr670;
 		case 62: goto tr671;
@@ -9845,28 +9805,28 @@ case 493:
 tr671:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st494;
 st494:
 	if ( ++p == pe )
 		goto _test_eof494;
 case 494:
-#line 9856 "inc/vcf/validator_detail_v41.hpp"
+#line 9816 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 58 )
 		goto tr668;
 	goto tr597;
 tr665:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st495;
 st495:
 	if ( ++p == pe )
 		goto _test_eof495;
 case 495:
-#line 9870 "inc/vcf/validator_detail_v41.hpp"
+#line 9830 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 60 )
 		goto tr673;
 	if ( (*p) < 65 ) {
@@ -9881,14 +9841,14 @@ case 495:
 tr672:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st496;
 st496:
 	if ( ++p == pe )
 		goto _test_eof496;
 case 496:
-#line 9892 "inc/vcf/validator_detail_v41.hpp"
+#line 9852 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 58: goto tr674;
 		case 61: goto tr672;
@@ -9905,28 +9865,28 @@ case 496:
 tr674:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st497;
 st497:
 	if ( ++p == pe )
 		goto _test_eof497;
 case 497:
-#line 9916 "inc/vcf/validator_detail_v41.hpp"
+#line 9876 "inc/vcf/validator_detail_v41.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr675;
 	goto tr597;
 tr675:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st498;
 st498:
 	if ( ++p == pe )
 		goto _test_eof498;
 case 498:
-#line 9930 "inc/vcf/validator_detail_v41.hpp"
+#line 9890 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 93 )
 		goto tr662;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -9935,14 +9895,14 @@ case 498:
 tr673:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st499;
 st499:
 	if ( ++p == pe )
 		goto _test_eof499;
 case 499:
-#line 9946 "inc/vcf/validator_detail_v41.hpp"
+#line 9906 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr676;
@@ -9955,14 +9915,14 @@ case 499:
 tr676:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st500;
 st500:
 	if ( ++p == pe )
 		goto _test_eof500;
 case 500:
-#line 9966 "inc/vcf/validator_detail_v41.hpp"
+#line 9926 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 59: goto tr676;
 		case 62: goto tr677;
@@ -9979,14 +9939,14 @@ case 500:
 tr677:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st501;
 st501:
 	if ( ++p == pe )
 		goto _test_eof501;
 case 501:
-#line 9990 "inc/vcf/validator_detail_v41.hpp"
+#line 9950 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 58 )
 		goto tr674;
 	goto tr597;
@@ -9997,14 +9957,14 @@ tr602:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st502;
 st502:
 	if ( ++p == pe )
 		goto _test_eof502;
 case 502:
-#line 10008 "inc/vcf/validator_detail_v41.hpp"
+#line 9968 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 60 )
 		goto tr679;
 	if ( (*p) < 65 ) {
@@ -10019,14 +9979,14 @@ case 502:
 tr678:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st503;
 st503:
 	if ( ++p == pe )
 		goto _test_eof503;
 case 503:
-#line 10030 "inc/vcf/validator_detail_v41.hpp"
+#line 9990 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 58: goto tr680;
 		case 61: goto tr678;
@@ -10043,28 +10003,28 @@ case 503:
 tr680:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st504;
 st504:
 	if ( ++p == pe )
 		goto _test_eof504;
 case 504:
-#line 10054 "inc/vcf/validator_detail_v41.hpp"
+#line 10014 "inc/vcf/validator_detail_v41.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr681;
 	goto tr597;
 tr681:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st505;
 st505:
 	if ( ++p == pe )
 		goto _test_eof505;
 case 505:
-#line 10068 "inc/vcf/validator_detail_v41.hpp"
+#line 10028 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 91 )
 		goto tr682;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -10073,14 +10033,14 @@ case 505:
 tr679:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st506;
 st506:
 	if ( ++p == pe )
 		goto _test_eof506;
 case 506:
-#line 10084 "inc/vcf/validator_detail_v41.hpp"
+#line 10044 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr683;
@@ -10093,14 +10053,14 @@ case 506:
 tr683:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st507;
 st507:
 	if ( ++p == pe )
 		goto _test_eof507;
 case 507:
-#line 10104 "inc/vcf/validator_detail_v41.hpp"
+#line 10064 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 59: goto tr683;
 		case 62: goto tr684;
@@ -10117,14 +10077,14 @@ case 507:
 tr684:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st508;
 st508:
 	if ( ++p == pe )
 		goto _test_eof508;
 case 508:
-#line 10128 "inc/vcf/validator_detail_v41.hpp"
+#line 10088 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 58 )
 		goto tr680;
 	goto tr597;
@@ -10135,14 +10095,14 @@ tr603:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st509;
 st509:
 	if ( ++p == pe )
 		goto _test_eof509;
 case 509:
-#line 10146 "inc/vcf/validator_detail_v41.hpp"
+#line 10106 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 60 )
 		goto tr686;
 	if ( (*p) < 65 ) {
@@ -10157,14 +10117,14 @@ case 509:
 tr685:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st510;
 st510:
 	if ( ++p == pe )
 		goto _test_eof510;
 case 510:
-#line 10168 "inc/vcf/validator_detail_v41.hpp"
+#line 10128 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 58: goto tr687;
 		case 61: goto tr685;
@@ -10181,28 +10141,28 @@ case 510:
 tr687:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st511;
 st511:
 	if ( ++p == pe )
 		goto _test_eof511;
 case 511:
-#line 10192 "inc/vcf/validator_detail_v41.hpp"
+#line 10152 "inc/vcf/validator_detail_v41.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr688;
 	goto tr597;
 tr688:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st512;
 st512:
 	if ( ++p == pe )
 		goto _test_eof512;
 case 512:
-#line 10206 "inc/vcf/validator_detail_v41.hpp"
+#line 10166 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 93 )
 		goto tr682;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -10211,14 +10171,14 @@ case 512:
 tr686:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st513;
 st513:
 	if ( ++p == pe )
 		goto _test_eof513;
 case 513:
-#line 10222 "inc/vcf/validator_detail_v41.hpp"
+#line 10182 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr689;
@@ -10231,14 +10191,14 @@ case 513:
 tr689:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st514;
 st514:
 	if ( ++p == pe )
 		goto _test_eof514;
 case 514:
-#line 10242 "inc/vcf/validator_detail_v41.hpp"
+#line 10202 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 59: goto tr689;
 		case 62: goto tr690;
@@ -10255,14 +10215,14 @@ case 514:
 tr690:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st515;
 st515:
 	if ( ++p == pe )
 		goto _test_eof515;
 case 515:
-#line 10266 "inc/vcf/validator_detail_v41.hpp"
+#line 10226 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 58 )
 		goto tr687;
 	goto tr597;
@@ -10273,14 +10233,14 @@ tr599:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st516;
 st516:
 	if ( ++p == pe )
 		goto _test_eof516;
 case 516:
-#line 10284 "inc/vcf/validator_detail_v41.hpp"
+#line 10244 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 9: goto tr604;
 		case 65: goto tr659;
@@ -10296,7 +10256,7 @@ case 516:
 	}
 	goto tr597;
 tr565:
-#line 208 "src/vcf/vcf.ragel"
+#line 207 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
@@ -10305,18 +10265,14 @@ tr565:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st517;
 tr577:
-#line 204 "src/vcf/vcf.ragel"
+#line 203 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 208 "src/vcf/vcf.ragel"
+#line 207 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
@@ -10325,28 +10281,24 @@ tr577:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st517;
 st517:
 	if ( ++p == pe )
 		goto _test_eof517;
 case 517:
-#line 10339 "inc/vcf/validator_detail_v41.hpp"
+#line 10291 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 10 )
 		goto st521;
 	goto tr566;
 tr23:
-#line 99 "src/vcf/vcf.ragel"
+#line 98 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_fileformat(*this);
         } catch (Error *error) {
           ErrorPolicy::handle_error(*this, error);
-          p--; {goto st519;}
+          {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
         }
     }
 #line 43 "src/vcf/vcf.ragel"
@@ -10354,17 +10306,13 @@ tr23:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st518;
 st518:
 	if ( ++p == pe )
 		goto _test_eof518;
 case 518:
-#line 10368 "inc/vcf/validator_detail_v41.hpp"
+#line 10316 "inc/vcf/validator_detail_v41.hpp"
 	if ( (*p) == 10 )
 		goto st22;
 	goto tr0;
@@ -10374,17 +10322,13 @@ tr695:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st519;
 st519:
 	if ( ++p == pe )
 		goto _test_eof519;
 case 519:
-#line 10388 "inc/vcf/validator_detail_v41.hpp"
+#line 10332 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr694;
 		case 13: goto tr695;
@@ -10396,19 +10340,15 @@ tr694:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
-#line 227 "src/vcf/vcf_v41.ragel"
+#line 239 "src/vcf/vcf_v41.ragel"
 	{ {goto st28;} }
 	goto st532;
 st532:
 	if ( ++p == pe )
 		goto _test_eof532;
 case 532:
-#line 10412 "inc/vcf/validator_detail_v41.hpp"
+#line 10352 "inc/vcf/validator_detail_v41.hpp"
 	goto st0;
 tr698:
 #line 43 "src/vcf/vcf.ragel"
@@ -10416,17 +10356,13 @@ tr698:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st520;
 st520:
 	if ( ++p == pe )
 		goto _test_eof520;
 case 520:
-#line 10430 "inc/vcf/validator_detail_v41.hpp"
+#line 10366 "inc/vcf/validator_detail_v41.hpp"
 	switch( (*p) ) {
 		case 10: goto tr697;
 		case 13: goto tr698;
@@ -10438,19 +10374,15 @@ tr697:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
-#line 228 "src/vcf/vcf_v41.ragel"
-	{ {goto st525;} }
+#line 240 "src/vcf/vcf_v41.ragel"
+	{ ++n_records; {goto st525;} }
 	goto st533;
 st533:
 	if ( ++p == pe )
 		goto _test_eof533;
 case 533:
-#line 10454 "inc/vcf/validator_detail_v41.hpp"
+#line 10386 "inc/vcf/validator_detail_v41.hpp"
 	goto st0;
 	}
 	_test_eof2: cs = 2; goto _test_eof; 
@@ -11004,10 +10936,10 @@ case 533:
 	case 12: 
 	case 13: 
 	case 518: 
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 25: 
@@ -11058,14 +10990,14 @@ case 533:
 	case 71: 
 	case 72: 
 	case 73: 
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 521: 
-#line 70 "src/vcf/vcf.ragel"
+#line 69 "src/vcf/vcf.ragel"
 	{
         try {
           OptionalPolicy::optional_check_meta_section(*this);
@@ -11084,7 +11016,7 @@ case 533:
 	case 437: 
 	case 438: 
 	case 517: 
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -11095,14 +11027,14 @@ case 533:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 462: 
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 74: 
@@ -11126,15 +11058,15 @@ case 533:
 	case 95: 
 	case 96: 
 	case 100: 
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 303: 
@@ -11145,15 +11077,15 @@ case 533:
 	case 308: 
 	case 309: 
 	case 310: 
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 330: 
@@ -11185,15 +11117,15 @@ case 533:
 	case 358: 
 	case 359: 
 	case 360: 
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 105: 
@@ -11219,15 +11151,15 @@ case 533:
 	case 128: 
 	case 129: 
 	case 133: 
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 137: 
@@ -11265,15 +11197,15 @@ case 533:
 	case 176: 
 	case 177: 
 	case 181: 
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 186: 
@@ -11310,15 +11242,15 @@ case 533:
 	case 224: 
 	case 225: 
 	case 229: 
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 234: 
@@ -11331,15 +11263,15 @@ case 533:
 	case 241: 
 	case 242: 
 	case 249: 
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 361: 
@@ -11353,15 +11285,15 @@ case 533:
 	case 369: 
 	case 370: 
 	case 371: 
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 250: 
@@ -11375,15 +11307,15 @@ case 533:
 	case 258: 
 	case 259: 
 	case 299: 
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 393: 
@@ -11423,7 +11355,7 @@ case 533:
 	case 427: 
 	case 428: 
 	case 429: 
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -11435,9 +11367,9 @@ case 533:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -11448,61 +11380,61 @@ case 533:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 440: 
 	case 459: 
 	case 460: 
 	case 461: 
-#line 396 "src/vcf/vcf.ragel"
+#line 401 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 441: 
 	case 442: 
-#line 402 "src/vcf/vcf.ragel"
+#line 407 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 443: 
 	case 444: 
-#line 408 "src/vcf/vcf.ragel"
+#line 413 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 445: 
 	case 446: 
-#line 414 "src/vcf/vcf.ragel"
+#line 419 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 447: 
@@ -11542,15 +11474,15 @@ case 533:
 	case 514: 
 	case 515: 
 	case 516: 
-#line 420 "src/vcf/vcf.ragel"
+#line 425 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 449: 
@@ -11566,15 +11498,15 @@ case 533:
 	case 479: 
 	case 480: 
 	case 481: 
-#line 426 "src/vcf/vcf.ragel"
+#line 431 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 452: 
@@ -11582,29 +11514,29 @@ case 533:
 	case 454: 
 	case 470: 
 	case 471: 
-#line 432 "src/vcf/vcf.ragel"
+#line 437 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 463: 
-#line 454 "src/vcf/vcf.ragel"
+#line 459 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
         ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 14: 
@@ -11619,12 +11551,12 @@ case 533:
 	{
         ErrorPolicy::handle_error(*this,
                 new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.1'"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 456: 
@@ -11632,12 +11564,12 @@ case 533:
 #line 50 "src/vcf/vcf_v41.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 523: 
@@ -11652,16 +11584,22 @@ case 533:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 217 "src/vcf/vcf.ragel"
 	{
+        ++n_records;
         try {
             // Handle all columns and build record
             ParsePolicy::handle_body_line(*this);
 
+            // A record with errors is not kept, but all of them are reported
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
+
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
                 for(auto &error_ptr : duplicated_errors) {
@@ -11684,12 +11622,12 @@ case 533:
 	break;
 	case 23: 
 	case 28: 
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -11701,9 +11639,9 @@ case 533:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -11714,80 +11652,80 @@ case 533:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 81: 
 	case 82: 
 	case 83: 
-#line 252 "src/vcf/vcf.ragel"
+#line 257 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
             "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 104: 
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 163: 
 	case 164: 
-#line 293 "src/vcf/vcf.ragel"
+#line 298 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 211: 
 	case 212: 
-#line 293 "src/vcf/vcf.ragel"
+#line 298 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 263: 
@@ -11799,20 +11737,20 @@ case 533:
 	case 269: 
 	case 270: 
 	case 271: 
-#line 352 "src/vcf/vcf.ragel"
+#line 357 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 273: 
@@ -11824,95 +11762,95 @@ case 533:
 	case 279: 
 	case 280: 
 	case 281: 
-#line 357 "src/vcf/vcf.ragel"
+#line 362 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 340: 
 	case 341: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 114: 
 	case 115: 
 	case 116: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 146: 
 	case 147: 
 	case 148: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 194: 
 	case 195: 
 	case 196: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 243: 
@@ -11921,38 +11859,38 @@ case 533:
 	case 246: 
 	case 247: 
 	case 248: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 260: 
 	case 261: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 97: 
@@ -11961,20 +11899,20 @@ case 533:
 	case 101: 
 	case 102: 
 	case 103: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 130: 
@@ -11983,20 +11921,20 @@ case 533:
 	case 134: 
 	case 135: 
 	case 136: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 178: 
@@ -12005,20 +11943,20 @@ case 533:
 	case 182: 
 	case 183: 
 	case 184: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 226: 
@@ -12027,20 +11965,20 @@ case 533:
 	case 230: 
 	case 231: 
 	case 232: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 283: 
@@ -12062,20 +12000,20 @@ case 533:
 	case 300: 
 	case 301: 
 	case 302: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 311: 
@@ -12097,20 +12035,20 @@ case 533:
 	case 327: 
 	case 328: 
 	case 329: 
-#line 373 "src/vcf/vcf.ragel"
+#line 378 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 372: 
@@ -12134,20 +12072,20 @@ case 533:
 	case 390: 
 	case 391: 
 	case 392: 
-#line 373 "src/vcf/vcf.ragel"
+#line 378 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 455: 
@@ -12156,58 +12094,58 @@ case 533:
 	case 466: 
 	case 467: 
 	case 468: 
-#line 443 "src/vcf/vcf.ragel"
+#line 448 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 443 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 469: 
-#line 448 "src/vcf/vcf.ragel"
+#line 453 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 443 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 458: 
-#line 461 "src/vcf/vcf.ragel"
+#line 466 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
         ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "GT"});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 459 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
         ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 156: 
@@ -12216,17 +12154,17 @@ case 533:
 #line 36 "src/vcf/vcf_v41.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, G or dot"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 204: 
@@ -12235,31 +12173,31 @@ case 533:
 #line 42 "src/vcf/vcf_v41.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, G or dot"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 22: 
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -12271,9 +12209,9 @@ case 533:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -12284,136 +12222,141 @@ case 533:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st520;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st520;}
     }
 	break;
 	case 272: 
-#line 352 "src/vcf/vcf.ragel"
+#line 357 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 357 "src/vcf/vcf.ragel"
+#line 362 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 282: 
-#line 357 "src/vcf/vcf.ragel"
+#line 362 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 262: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 352 "src/vcf/vcf.ragel"
+#line 357 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
 	case 24: 
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st519;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st519;}
     }
 	break;
-#line 12409 "inc/vcf/validator_detail_v41.hpp"
+#line 12347 "inc/vcf/validator_detail_v41.hpp"
 	}
 	}
 
 	_out: {}
 	}
 
-#line 257 "src/vcf/vcf_v41.ragel"
+#line 275 "src/vcf/vcf_v41.ragel"
+
+      ParsePolicy::handle_buffer_end(*this, pe);
 
+      if (cs == vcf_v41_error) {
+          ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "Records are not allowed after an empty line"});
+      }
     }
    
   }
@@ -17,7 +17,7 @@
  */
 
 
-#line 233 "src/vcf/vcf_v42.ragel"
+#line 245 "src/vcf/vcf_v42.ragel"
 
 
 namespace
@@ -35,7 +35,7 @@ static const int vcf_v42_en_meta_section_skip = 591;
 static const int vcf_v42_en_body_section_skip = 592;
 
 
-#line 239 "src/vcf/vcf_v42.ragel"
+#line 251 "src/vcf/vcf_v42.ragel"
 
 }
 
@@ -54,15 +54,21 @@ namespace ebi
 	cs = vcf_v42_start;
 	}
 
-#line 253 "src/vcf/vcf_v42.ragel"
+#line 265 "src/vcf/vcf_v42.ragel"
 
     }
 
     template <typename Configuration>
     void ParserImpl_v42<Configuration>::parse_buffer(char const * p, char const * pe, char const * eof)
     {
+      if (cs == vcf_v42_error) {
+          // The state machine stopped at an error it can't recover from, so nothing else can be read
+          return;
+      }
+      ParsePolicy::handle_buffer_begin(*this, p);
+      structural_index.build(p, pe);
       
-#line 66 "inc/vcf/validator_detail_v42.hpp"
+#line 72 "inc/vcf/validator_detail_v42.hpp"
 	{
 	if ( p == pe )
 		goto _test_eof;
@@ -73,10 +79,10 @@ case 1:
 		goto st2;
 	goto tr0;
 tr0:
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr14:
@@ -84,26 +90,26 @@ tr14:
 	{
         ErrorPolicy::handle_error(*this,
                 new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.2'"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr24:
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -115,9 +121,9 @@ tr24:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -128,16 +134,16 @@ tr24:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr26:
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -149,9 +155,9 @@ tr26:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -162,795 +168,795 @@ tr26:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr29:
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr39:
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr125:
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr133:
-#line 252 "src/vcf/vcf.ragel"
+#line 257 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
             "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr152:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr161:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr175:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr187:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr193:
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr196:
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr206:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr225:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr247:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr259:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr265:
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr275:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr288:
 #line 36 "src/vcf/vcf_v42.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, R, G or dot"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr297:
-#line 293 "src/vcf/vcf.ragel"
+#line 298 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr314:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr336:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr348:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr355:
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr364:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr377:
 #line 42 "src/vcf/vcf_v42.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, R, G or dot"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr386:
-#line 293 "src/vcf/vcf.ragel"
+#line 298 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr403:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr425:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr437:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr444:
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr454:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr466:
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr477:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr482:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 352 "src/vcf/vcf.ragel"
+#line 357 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr484:
-#line 352 "src/vcf/vcf.ragel"
+#line 357 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr494:
-#line 352 "src/vcf/vcf.ragel"
+#line 357 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 357 "src/vcf/vcf.ragel"
+#line 362 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr497:
-#line 357 "src/vcf/vcf.ragel"
+#line 362 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr507:
-#line 357 "src/vcf/vcf.ragel"
+#line 362 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr510:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr533:
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr542:
-#line 373 "src/vcf/vcf.ragel"
+#line 378 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr563:
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr574:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr612:
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr624:
-#line 373 "src/vcf/vcf.ragel"
+#line 378 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	goto st0;
 tr647:
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -962,9 +968,9 @@ tr647:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -975,11 +981,11 @@ tr647:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr687:
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -990,183 +996,183 @@ tr687:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr702:
-#line 396 "src/vcf/vcf.ragel"
+#line 401 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr705:
-#line 402 "src/vcf/vcf.ragel"
+#line 407 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr709:
-#line 408 "src/vcf/vcf.ragel"
+#line 413 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr714:
-#line 414 "src/vcf/vcf.ragel"
+#line 419 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr718:
-#line 420 "src/vcf/vcf.ragel"
+#line 425 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr727:
-#line 426 "src/vcf/vcf.ragel"
+#line 431 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr738:
-#line 432 "src/vcf/vcf.ragel"
+#line 437 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr746:
-#line 443 "src/vcf/vcf.ragel"
+#line 448 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 443 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr750:
 #line 50 "src/vcf/vcf_v42.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr755:
-#line 461 "src/vcf/vcf.ragel"
+#line 466 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
         ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "GT"});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 459 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
         ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr763:
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr765:
-#line 454 "src/vcf/vcf.ragel"
+#line 459 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
         ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr771:
-#line 448 "src/vcf/vcf.ragel"
+#line 453 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 443 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr820:
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -1177,32 +1183,32 @@ tr820:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 396 "src/vcf/vcf.ragel"
+#line 401 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
 tr827:
-#line 438 "src/vcf/vcf.ragel"
+#line 443 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	goto st0;
-#line 1206 "inc/vcf/validator_detail_v42.hpp"
+#line 1212 "inc/vcf/validator_detail_v42.hpp"
 st0:
 cs = 0;
 	goto _out;
@@ -1304,111 +1310,111 @@ tr15:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st15;
 st15:
 	if ( ++p == pe )
 		goto _test_eof15;
 case 15:
-#line 1315 "inc/vcf/validator_detail_v42.hpp"
+#line 1321 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 67 )
 		goto tr16;
 	goto tr14;
 tr16:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st16;
 st16:
 	if ( ++p == pe )
 		goto _test_eof16;
 case 16:
-#line 1329 "inc/vcf/validator_detail_v42.hpp"
+#line 1335 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 70 )
 		goto tr17;
 	goto tr14;
 tr17:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st17;
 st17:
 	if ( ++p == pe )
 		goto _test_eof17;
 case 17:
-#line 1343 "inc/vcf/validator_detail_v42.hpp"
+#line 1349 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 118 )
 		goto tr18;
 	goto tr14;
 tr18:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st18;
 st18:
 	if ( ++p == pe )
 		goto _test_eof18;
 case 18:
-#line 1357 "inc/vcf/validator_detail_v42.hpp"
+#line 1363 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 52 )
 		goto tr19;
 	goto tr14;
 tr19:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st19;
 st19:
 	if ( ++p == pe )
 		goto _test_eof19;
 case 19:
-#line 1371 "inc/vcf/validator_detail_v42.hpp"
+#line 1377 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 46 )
 		goto tr20;
 	goto tr14;
 tr20:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st20;
 st20:
 	if ( ++p == pe )
 		goto _test_eof20;
 case 20:
-#line 1385 "inc/vcf/validator_detail_v42.hpp"
+#line 1391 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 50 )
 		goto tr21;
 	goto tr14;
 tr21:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st21;
 st21:
 	if ( ++p == pe )
 		goto _test_eof21;
 case 21:
-#line 1399 "inc/vcf/validator_detail_v42.hpp"
+#line 1405 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr22;
 		case 13: goto tr23;
 	}
 	goto tr14;
 tr22:
-#line 99 "src/vcf/vcf.ragel"
+#line 98 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_fileformat(*this);
         } catch (Error *error) {
           ErrorPolicy::handle_error(*this, error);
-          p--; {goto st591;}
+          {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
         }
     }
 #line 43 "src/vcf/vcf.ragel"
@@ -1416,17 +1422,13 @@ tr22:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st22;
 st22:
 	if ( ++p == pe )
 		goto _test_eof22;
 case 22:
-#line 1430 "inc/vcf/validator_detail_v42.hpp"
+#line 1432 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 35 )
 		goto st23;
 	goto tr24;
@@ -1466,27 +1468,27 @@ tr30:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st25;
 tr40:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st25;
 st25:
 	if ( ++p == pe )
 		goto _test_eof25;
 case 25:
-#line 1483 "inc/vcf/validator_detail_v42.hpp"
+#line 1485 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 61 )
 		goto tr41;
 	if ( 32 <= (*p) && (*p) <= 126 )
 		goto tr40;
 	goto tr39;
 tr41:
-#line 188 "src/vcf/vcf.ragel"
+#line 187 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this);
     }
@@ -1495,7 +1497,7 @@ st26:
 	if ( ++p == pe )
 		goto _test_eof26;
 case 26:
-#line 1499 "inc/vcf/validator_detail_v42.hpp"
+#line 1501 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto st30;
 		case 60: goto st35;
@@ -1510,20 +1512,20 @@ tr42:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st27;
 tr47:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st27;
 st27:
 	if ( ++p == pe )
 		goto _test_eof27;
 case 27:
-#line 1527 "inc/vcf/validator_detail_v42.hpp"
+#line 1529 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr45;
 		case 13: goto tr46;
@@ -1536,7 +1538,7 @@ tr45:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1549,14 +1551,10 @@ tr45:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st28;
 tr55:
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1569,17 +1567,13 @@ tr55:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st28;
 st28:
 	if ( ++p == pe )
 		goto _test_eof28;
 case 28:
-#line 1583 "inc/vcf/validator_detail_v42.hpp"
+#line 1577 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 35 )
 		goto st23;
 	goto tr26;
@@ -1588,7 +1582,7 @@ tr46:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1601,14 +1595,10 @@ tr46:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st29;
 tr56:
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1621,17 +1611,13 @@ tr56:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st29;
 st29:
 	if ( ++p == pe )
 		goto _test_eof29;
 case 29:
-#line 1635 "inc/vcf/validator_detail_v42.hpp"
+#line 1621 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 10 )
 		goto st28;
 	goto tr39;
@@ -1653,20 +1639,20 @@ tr49:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st31;
 tr52:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st31;
 st31:
 	if ( ++p == pe )
 		goto _test_eof31;
 case 31:
-#line 1670 "inc/vcf/validator_detail_v42.hpp"
+#line 1656 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr53;
 		case 92: goto tr54;
@@ -1694,7 +1680,7 @@ st32:
 	if ( ++p == pe )
 		goto _test_eof32;
 case 32:
-#line 1698 "inc/vcf/validator_detail_v42.hpp"
+#line 1684 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -1707,20 +1693,20 @@ tr51:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st33;
 tr54:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st33;
 st33:
 	if ( ++p == pe )
 		goto _test_eof33;
 case 33:
-#line 1724 "inc/vcf/validator_detail_v42.hpp"
+#line 1710 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr57;
 		case 92: goto tr54;
@@ -1731,7 +1717,7 @@ case 33:
 tr57:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1742,7 +1728,7 @@ st34:
 	if ( ++p == pe )
 		goto _test_eof34;
 case 34:
-#line 1746 "inc/vcf/validator_detail_v42.hpp"
+#line 1732 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -1790,20 +1776,20 @@ tr61:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st37;
 tr64:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st37;
 st37:
 	if ( ++p == pe )
 		goto _test_eof37;
 case 37:
-#line 1807 "inc/vcf/validator_detail_v42.hpp"
+#line 1793 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr65;
 		case 92: goto tr66;
@@ -1831,7 +1817,7 @@ st38:
 	if ( ++p == pe )
 		goto _test_eof38;
 case 38:
-#line 1835 "inc/vcf/validator_detail_v42.hpp"
+#line 1821 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 62 )
 		goto st32;
 	goto tr39;
@@ -1842,20 +1828,20 @@ tr63:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st39;
 tr66:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st39;
 st39:
 	if ( ++p == pe )
 		goto _test_eof39;
 case 39:
-#line 1859 "inc/vcf/validator_detail_v42.hpp"
+#line 1845 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr68;
 		case 92: goto tr66;
@@ -1866,7 +1852,7 @@ case 39:
 tr68:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1877,7 +1863,7 @@ st40:
 	if ( ++p == pe )
 		goto _test_eof40;
 case 40:
-#line 1881 "inc/vcf/validator_detail_v42.hpp"
+#line 1867 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr65;
 		case 62: goto tr69;
@@ -1889,14 +1875,14 @@ case 40:
 tr69:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st41;
 st41:
 	if ( ++p == pe )
 		goto _test_eof41;
 case 41:
-#line 1900 "inc/vcf/validator_detail_v42.hpp"
+#line 1886 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -1916,7 +1902,7 @@ st42:
 	if ( ++p == pe )
 		goto _test_eof42;
 case 42:
-#line 1920 "inc/vcf/validator_detail_v42.hpp"
+#line 1906 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto st42;
 	if ( (*p) < 48 ) {
@@ -1938,20 +1924,20 @@ tr60:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st43;
 tr71:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st43;
 st43:
 	if ( ++p == pe )
 		goto _test_eof43;
 case 43:
-#line 1955 "inc/vcf/validator_detail_v42.hpp"
+#line 1941 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr72;
 		case 95: goto tr71;
@@ -1969,7 +1955,7 @@ case 43:
 		goto tr71;
 	goto tr39;
 tr72:
-#line 192 "src/vcf/vcf.ragel"
+#line 191 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -1978,7 +1964,7 @@ st44:
 	if ( ++p == pe )
 		goto _test_eof44;
 case 44:
-#line 1982 "inc/vcf/validator_detail_v42.hpp"
+#line 1968 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 34 )
 		goto st63;
 	if ( (*p) < 45 ) {
@@ -1997,20 +1983,20 @@ tr73:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st45;
 tr75:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st45;
 st45:
 	if ( ++p == pe )
 		goto _test_eof45;
 case 45:
-#line 2014 "inc/vcf/validator_detail_v42.hpp"
+#line 2000 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 44: goto tr76;
 		case 62: goto tr53;
@@ -2031,7 +2017,7 @@ st46:
 	if ( ++p == pe )
 		goto _test_eof46;
 case 46:
-#line 2035 "inc/vcf/validator_detail_v42.hpp"
+#line 2021 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto tr77;
 	if ( (*p) < 48 ) {
@@ -2056,7 +2042,7 @@ st47:
 	if ( ++p == pe )
 		goto _test_eof47;
 case 47:
-#line 2060 "inc/vcf/validator_detail_v42.hpp"
+#line 2046 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto st47;
 	if ( (*p) < 48 ) {
@@ -2078,20 +2064,20 @@ tr78:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st48;
 tr80:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st48;
 st48:
 	if ( ++p == pe )
 		goto _test_eof48;
 case 48:
-#line 2095 "inc/vcf/validator_detail_v42.hpp"
+#line 2081 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr81;
 		case 95: goto tr80;
@@ -2109,7 +2095,7 @@ case 48:
 		goto tr80;
 	goto tr39;
 tr81:
-#line 192 "src/vcf/vcf.ragel"
+#line 191 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -2118,7 +2104,7 @@ st49:
 	if ( ++p == pe )
 		goto _test_eof49;
 case 49:
-#line 2122 "inc/vcf/validator_detail_v42.hpp"
+#line 2108 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 34 )
 		goto st50;
 	if ( (*p) < 45 ) {
@@ -2148,20 +2134,20 @@ tr83:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st51;
 tr86:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st51;
 st51:
 	if ( ++p == pe )
 		goto _test_eof51;
 case 51:
-#line 2165 "inc/vcf/validator_detail_v42.hpp"
+#line 2151 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 92: goto tr88;
@@ -2189,7 +2175,7 @@ st52:
 	if ( ++p == pe )
 		goto _test_eof52;
 case 52:
-#line 2193 "inc/vcf/validator_detail_v42.hpp"
+#line 2179 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 44: goto st46;
 		case 62: goto st32;
@@ -2202,20 +2188,20 @@ tr85:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st53;
 tr88:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st53;
 st53:
 	if ( ++p == pe )
 		goto _test_eof53;
 case 53:
-#line 2219 "inc/vcf/validator_detail_v42.hpp"
+#line 2205 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr90;
 		case 92: goto tr88;
@@ -2226,7 +2212,7 @@ case 53:
 tr90:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2237,7 +2223,7 @@ st54:
 	if ( ++p == pe )
 		goto _test_eof54;
 case 54:
-#line 2241 "inc/vcf/validator_detail_v42.hpp"
+#line 2227 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 44: goto tr91;
@@ -2254,19 +2240,19 @@ tr105:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st55;
 tr91:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st55;
 tr102:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2277,7 +2263,7 @@ st55:
 	if ( ++p == pe )
 		goto _test_eof55;
 case 55:
-#line 2281 "inc/vcf/validator_detail_v42.hpp"
+#line 2267 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr86;
@@ -2315,20 +2301,20 @@ tr93:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st56;
 tr95:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st56;
 st56:
 	if ( ++p == pe )
 		goto _test_eof56;
 case 56:
-#line 2332 "inc/vcf/validator_detail_v42.hpp"
+#line 2318 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr86;
@@ -2366,20 +2352,20 @@ tr94:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st57;
 tr96:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st57;
 st57:
 	if ( ++p == pe )
 		goto _test_eof57;
 case 57:
-#line 2383 "inc/vcf/validator_detail_v42.hpp"
+#line 2369 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr86;
@@ -2409,20 +2395,20 @@ case 57:
 		goto tr96;
 	goto tr39;
 tr97:
-#line 192 "src/vcf/vcf.ragel"
+#line 191 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st58;
 st58:
 	if ( ++p == pe )
 		goto _test_eof58;
 case 58:
-#line 2426 "inc/vcf/validator_detail_v42.hpp"
+#line 2412 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr99;
 		case 44: goto tr86;
@@ -2435,13 +2421,13 @@ case 58:
 tr101:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st59;
 tr98:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2452,7 +2438,7 @@ st59:
 	if ( ++p == pe )
 		goto _test_eof59;
 case 59:
-#line 2456 "inc/vcf/validator_detail_v42.hpp"
+#line 2442 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 44: goto tr102;
@@ -2469,19 +2455,19 @@ tr106:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st60;
 tr92:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st60;
 tr103:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2492,7 +2478,7 @@ st60:
 	if ( ++p == pe )
 		goto _test_eof60;
 case 60:
-#line 2496 "inc/vcf/validator_detail_v42.hpp"
+#line 2482 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -2505,13 +2491,13 @@ case 60:
 tr104:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st61;
 tr100:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2522,7 +2508,7 @@ st61:
 	if ( ++p == pe )
 		goto _test_eof61;
 case 61:
-#line 2526 "inc/vcf/validator_detail_v42.hpp"
+#line 2512 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr90;
 		case 44: goto tr102;
@@ -2542,7 +2528,7 @@ st62:
 	if ( ++p == pe )
 		goto _test_eof62;
 case 62:
-#line 2546 "inc/vcf/validator_detail_v42.hpp"
+#line 2532 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr84;
 		case 44: goto tr105;
@@ -2570,20 +2556,20 @@ tr107:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st64;
 tr109:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st64;
 st64:
 	if ( ++p == pe )
 		goto _test_eof64;
 case 64:
-#line 2587 "inc/vcf/validator_detail_v42.hpp"
+#line 2573 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 92: goto tr110;
@@ -2598,20 +2584,20 @@ tr108:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st65;
 tr110:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st65;
 st65:
 	if ( ++p == pe )
 		goto _test_eof65;
 case 65:
-#line 2615 "inc/vcf/validator_detail_v42.hpp"
+#line 2601 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr111;
 		case 92: goto tr110;
@@ -2622,7 +2608,7 @@ case 65:
 tr111:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2633,7 +2619,7 @@ st66:
 	if ( ++p == pe )
 		goto _test_eof66;
 case 66:
-#line 2637 "inc/vcf/validator_detail_v42.hpp"
+#line 2623 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 44: goto tr112;
@@ -2646,13 +2632,13 @@ case 66:
 tr112:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st67;
 tr122:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2663,7 +2649,7 @@ st67:
 	if ( ++p == pe )
 		goto _test_eof67;
 case 67:
-#line 2667 "inc/vcf/validator_detail_v42.hpp"
+#line 2653 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr109;
@@ -2697,13 +2683,13 @@ case 67:
 tr116:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st68;
 tr114:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2714,7 +2700,7 @@ st68:
 	if ( ++p == pe )
 		goto _test_eof68;
 case 68:
-#line 2718 "inc/vcf/validator_detail_v42.hpp"
+#line 2704 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr109;
@@ -2748,13 +2734,13 @@ case 68:
 tr117:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st69;
 tr115:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2765,7 +2751,7 @@ st69:
 	if ( ++p == pe )
 		goto _test_eof69;
 case 69:
-#line 2769 "inc/vcf/validator_detail_v42.hpp"
+#line 2755 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 47: goto tr109;
@@ -2797,9 +2783,9 @@ case 69:
 tr118:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
-#line 192 "src/vcf/vcf.ragel"
+#line 191 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -2808,7 +2794,7 @@ st70:
 	if ( ++p == pe )
 		goto _test_eof70;
 case 70:
-#line 2812 "inc/vcf/validator_detail_v42.hpp"
+#line 2798 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr99;
 		case 44: goto tr109;
@@ -2821,13 +2807,13 @@ case 70:
 tr121:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st71;
 tr119:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2838,7 +2824,7 @@ st71:
 	if ( ++p == pe )
 		goto _test_eof71;
 case 71:
-#line 2842 "inc/vcf/validator_detail_v42.hpp"
+#line 2828 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr87;
 		case 44: goto tr122;
@@ -2851,13 +2837,13 @@ case 71:
 tr113:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st72;
 tr123:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2868,7 +2854,7 @@ st72:
 	if ( ++p == pe )
 		goto _test_eof72;
 case 72:
-#line 2872 "inc/vcf/validator_detail_v42.hpp"
+#line 2858 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -2881,13 +2867,13 @@ case 72:
 tr124:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st73;
 tr120:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2898,7 +2884,7 @@ st73:
 	if ( ++p == pe )
 		goto _test_eof73;
 case 73:
-#line 2902 "inc/vcf/validator_detail_v42.hpp"
+#line 2888 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr111;
 		case 44: goto tr122;
@@ -2915,14 +2901,14 @@ tr31:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st74;
 st74:
 	if ( ++p == pe )
 		goto _test_eof74;
 case 74:
-#line 2926 "inc/vcf/validator_detail_v42.hpp"
+#line 2912 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 76: goto tr126;
@@ -2933,14 +2919,14 @@ case 74:
 tr126:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st75;
 st75:
 	if ( ++p == pe )
 		goto _test_eof75;
 case 75:
-#line 2944 "inc/vcf/validator_detail_v42.hpp"
+#line 2930 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 84: goto st76;
@@ -2958,7 +2944,7 @@ case 76:
 		goto tr40;
 	goto tr125;
 tr128:
-#line 108 "src/vcf/vcf.ragel"
+#line 107 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "ALT");
     }
@@ -2967,7 +2953,7 @@ st77:
 	if ( ++p == pe )
 		goto _test_eof77;
 case 77:
-#line 2971 "inc/vcf/validator_detail_v42.hpp"
+#line 2957 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 60 )
 		goto st78;
 	goto tr125;
@@ -3026,7 +3012,7 @@ case 81:
 		goto tr134;
 	goto tr133;
 tr134:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -3039,7 +3025,7 @@ st82:
 	if ( ++p == pe )
 		goto _test_eof82;
 case 82:
-#line 3043 "inc/vcf/validator_detail_v42.hpp"
+#line 3029 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 61 )
 		goto st82;
 	if ( (*p) < 63 ) {
@@ -3072,11 +3058,11 @@ case 82:
 tr137:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st83;
 tr135:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -3086,14 +3072,14 @@ tr135:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st83;
 st83:
 	if ( ++p == pe )
 		goto _test_eof83;
 case 83:
-#line 3097 "inc/vcf/validator_detail_v42.hpp"
+#line 3083 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 44: goto tr138;
 		case 61: goto tr137;
@@ -3114,7 +3100,7 @@ st84:
 	if ( ++p == pe )
 		goto _test_eof84;
 case 84:
-#line 3118 "inc/vcf/validator_detail_v42.hpp"
+#line 3104 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 68 )
 		goto st85;
 	goto tr125;
@@ -3203,7 +3189,7 @@ case 96:
 		goto tr151;
 	goto tr125;
 tr151:
-#line 156 "src/vcf/vcf.ragel"
+#line 155 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -3212,7 +3198,7 @@ st97:
 	if ( ++p == pe )
 		goto _test_eof97;
 case 97:
-#line 3216 "inc/vcf/validator_detail_v42.hpp"
+#line 3202 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr154;
 		case 92: goto tr155;
@@ -3227,20 +3213,20 @@ tr153:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st98;
 tr156:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st98;
 st98:
 	if ( ++p == pe )
 		goto _test_eof98;
 case 98:
-#line 3244 "inc/vcf/validator_detail_v42.hpp"
+#line 3230 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 92: goto tr158;
@@ -3268,7 +3254,7 @@ st99:
 	if ( ++p == pe )
 		goto _test_eof99;
 case 99:
-#line 3272 "inc/vcf/validator_detail_v42.hpp"
+#line 3258 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 44: goto st100;
 		case 62: goto st114;
@@ -3302,7 +3288,7 @@ st101:
 	if ( ++p == pe )
 		goto _test_eof101;
 case 101:
-#line 3306 "inc/vcf/validator_detail_v42.hpp"
+#line 3292 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto st101;
 	if ( (*p) < 48 ) {
@@ -3324,20 +3310,20 @@ tr163:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st102;
 tr165:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st102;
 st102:
 	if ( ++p == pe )
 		goto _test_eof102;
 case 102:
-#line 3341 "inc/vcf/validator_detail_v42.hpp"
+#line 3327 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr166;
 		case 95: goto tr165;
@@ -3364,7 +3350,7 @@ st103:
 	if ( ++p == pe )
 		goto _test_eof103;
 case 103:
-#line 3368 "inc/vcf/validator_detail_v42.hpp"
+#line 3354 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 34 )
 		goto st104;
 	goto tr125;
@@ -3386,20 +3372,20 @@ tr168:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st105;
 tr170:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st105;
 st105:
 	if ( ++p == pe )
 		goto _test_eof105;
 case 105:
-#line 3403 "inc/vcf/validator_detail_v42.hpp"
+#line 3389 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 92: goto tr171;
@@ -3414,20 +3400,20 @@ tr169:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st106;
 tr171:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st106;
 st106:
 	if ( ++p == pe )
 		goto _test_eof106;
 case 106:
-#line 3431 "inc/vcf/validator_detail_v42.hpp"
+#line 3417 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr172;
 		case 92: goto tr171;
@@ -3438,7 +3424,7 @@ case 106:
 tr172:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3449,7 +3435,7 @@ st107:
 	if ( ++p == pe )
 		goto _test_eof107;
 case 107:
-#line 3453 "inc/vcf/validator_detail_v42.hpp"
+#line 3439 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 44: goto tr173;
@@ -3466,20 +3452,20 @@ tr182:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st108;
 tr173:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st108;
 st108:
 	if ( ++p == pe )
 		goto _test_eof108;
 case 108:
-#line 3483 "inc/vcf/validator_detail_v42.hpp"
+#line 3469 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 47: goto tr170;
@@ -3517,20 +3503,20 @@ tr176:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st109;
 tr178:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st109;
 st109:
 	if ( ++p == pe )
 		goto _test_eof109;
 case 109:
-#line 3534 "inc/vcf/validator_detail_v42.hpp"
+#line 3520 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 47: goto tr170;
@@ -3568,20 +3554,20 @@ tr177:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st110;
 tr179:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st110;
 st110:
 	if ( ++p == pe )
 		goto _test_eof110;
 case 110:
-#line 3585 "inc/vcf/validator_detail_v42.hpp"
+#line 3571 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 47: goto tr170;
@@ -3617,14 +3603,14 @@ tr180:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st111;
 st111:
 	if ( ++p == pe )
 		goto _test_eof111;
 case 111:
-#line 3628 "inc/vcf/validator_detail_v42.hpp"
+#line 3614 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr181;
 		case 92: goto tr171;
@@ -3642,7 +3628,7 @@ st112:
 	if ( ++p == pe )
 		goto _test_eof112;
 case 112:
-#line 3646 "inc/vcf/validator_detail_v42.hpp"
+#line 3632 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr154;
 		case 44: goto tr182;
@@ -3659,20 +3645,20 @@ tr183:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st113;
 tr174:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st113;
 st113:
 	if ( ++p == pe )
 		goto _test_eof113;
 case 113:
-#line 3676 "inc/vcf/validator_detail_v42.hpp"
+#line 3662 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -3698,20 +3684,20 @@ tr155:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st115;
 tr158:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st115;
 st115:
 	if ( ++p == pe )
 		goto _test_eof115;
 case 115:
-#line 3715 "inc/vcf/validator_detail_v42.hpp"
+#line 3701 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr184;
 		case 92: goto tr158;
@@ -3722,7 +3708,7 @@ case 115:
 tr184:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3733,7 +3719,7 @@ st116:
 	if ( ++p == pe )
 		goto _test_eof116;
 case 116:
-#line 3737 "inc/vcf/validator_detail_v42.hpp"
+#line 3723 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 44: goto tr185;
@@ -3746,14 +3732,14 @@ case 116:
 tr185:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st117;
 st117:
 	if ( ++p == pe )
 		goto _test_eof117;
 case 117:
-#line 3757 "inc/vcf/validator_detail_v42.hpp"
+#line 3743 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 47: goto tr156;
@@ -3787,13 +3773,13 @@ case 117:
 tr190:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st118;
 tr188:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -3804,7 +3790,7 @@ st118:
 	if ( ++p == pe )
 		goto _test_eof118;
 case 118:
-#line 3808 "inc/vcf/validator_detail_v42.hpp"
+#line 3794 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 47: goto tr156;
@@ -3838,13 +3824,13 @@ case 118:
 tr191:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st119;
 tr189:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -3855,7 +3841,7 @@ st119:
 	if ( ++p == pe )
 		goto _test_eof119;
 case 119:
-#line 3859 "inc/vcf/validator_detail_v42.hpp"
+#line 3845 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr157;
 		case 47: goto tr156;
@@ -3887,7 +3873,7 @@ case 119:
 tr192:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3898,7 +3884,7 @@ st120:
 	if ( ++p == pe )
 		goto _test_eof120;
 case 120:
-#line 3902 "inc/vcf/validator_detail_v42.hpp"
+#line 3888 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr181;
 		case 92: goto tr158;
@@ -3909,14 +3895,14 @@ case 120:
 tr186:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st121;
 st121:
 	if ( ++p == pe )
 		goto _test_eof121;
 case 121:
-#line 3920 "inc/vcf/validator_detail_v42.hpp"
+#line 3906 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -3933,14 +3919,14 @@ tr32:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st122;
 st122:
 	if ( ++p == pe )
 		goto _test_eof122;
 case 122:
-#line 3944 "inc/vcf/validator_detail_v42.hpp"
+#line 3930 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 73: goto tr194;
@@ -3952,14 +3938,14 @@ case 122:
 tr194:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st123;
 st123:
 	if ( ++p == pe )
 		goto _test_eof123;
 case 123:
-#line 3963 "inc/vcf/validator_detail_v42.hpp"
+#line 3949 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 76: goto tr197;
@@ -3970,14 +3956,14 @@ case 123:
 tr197:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st124;
 st124:
 	if ( ++p == pe )
 		goto _test_eof124;
 case 124:
-#line 3981 "inc/vcf/validator_detail_v42.hpp"
+#line 3967 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 84: goto tr198;
@@ -3988,14 +3974,14 @@ case 124:
 tr198:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st125;
 st125:
 	if ( ++p == pe )
 		goto _test_eof125;
 case 125:
-#line 3999 "inc/vcf/validator_detail_v42.hpp"
+#line 3985 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto tr199;
@@ -4006,14 +3992,14 @@ case 125:
 tr199:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st126;
 st126:
 	if ( ++p == pe )
 		goto _test_eof126;
 case 126:
-#line 4017 "inc/vcf/validator_detail_v42.hpp"
+#line 4003 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 82: goto st127;
@@ -4031,7 +4017,7 @@ case 127:
 		goto tr40;
 	goto tr196;
 tr201:
-#line 120 "src/vcf/vcf.ragel"
+#line 119 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "FILTER");
     }
@@ -4040,7 +4026,7 @@ st128:
 	if ( ++p == pe )
 		goto _test_eof128;
 case 128:
-#line 4044 "inc/vcf/validator_detail_v42.hpp"
+#line 4030 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 60 )
 		goto st129;
 	goto tr196;
@@ -4084,7 +4070,7 @@ case 132:
 		goto tr208;
 	goto tr206;
 tr207:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -4097,7 +4083,7 @@ st133:
 	if ( ++p == pe )
 		goto _test_eof133;
 case 133:
-#line 4101 "inc/vcf/validator_detail_v42.hpp"
+#line 4087 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto st133;
 	if ( (*p) < 48 ) {
@@ -4115,11 +4101,11 @@ case 133:
 tr210:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st134;
 tr208:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -4129,14 +4115,14 @@ tr208:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st134;
 st134:
 	if ( ++p == pe )
 		goto _test_eof134;
 case 134:
-#line 4140 "inc/vcf/validator_detail_v42.hpp"
+#line 4126 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 44: goto tr211;
 		case 95: goto tr210;
@@ -4163,7 +4149,7 @@ st135:
 	if ( ++p == pe )
 		goto _test_eof135;
 case 135:
-#line 4167 "inc/vcf/validator_detail_v42.hpp"
+#line 4153 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 68 )
 		goto st136;
 	goto tr196;
@@ -4252,7 +4238,7 @@ case 147:
 		goto tr224;
 	goto tr196;
 tr224:
-#line 156 "src/vcf/vcf.ragel"
+#line 155 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -4261,7 +4247,7 @@ st148:
 	if ( ++p == pe )
 		goto _test_eof148;
 case 148:
-#line 4265 "inc/vcf/validator_detail_v42.hpp"
+#line 4251 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr227;
 		case 92: goto tr228;
@@ -4276,20 +4262,20 @@ tr226:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st149;
 tr229:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st149;
 st149:
 	if ( ++p == pe )
 		goto _test_eof149;
 case 149:
-#line 4293 "inc/vcf/validator_detail_v42.hpp"
+#line 4279 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 92: goto tr231;
@@ -4317,7 +4303,7 @@ st150:
 	if ( ++p == pe )
 		goto _test_eof150;
 case 150:
-#line 4321 "inc/vcf/validator_detail_v42.hpp"
+#line 4307 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 44: goto st151;
 		case 62: goto st165;
@@ -4351,7 +4337,7 @@ st152:
 	if ( ++p == pe )
 		goto _test_eof152;
 case 152:
-#line 4355 "inc/vcf/validator_detail_v42.hpp"
+#line 4341 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto st152;
 	if ( (*p) < 48 ) {
@@ -4373,20 +4359,20 @@ tr235:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st153;
 tr237:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st153;
 st153:
 	if ( ++p == pe )
 		goto _test_eof153;
 case 153:
-#line 4390 "inc/vcf/validator_detail_v42.hpp"
+#line 4376 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr238;
 		case 95: goto tr237;
@@ -4413,7 +4399,7 @@ st154:
 	if ( ++p == pe )
 		goto _test_eof154;
 case 154:
-#line 4417 "inc/vcf/validator_detail_v42.hpp"
+#line 4403 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 34 )
 		goto st155;
 	goto tr196;
@@ -4435,20 +4421,20 @@ tr240:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st156;
 tr242:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st156;
 st156:
 	if ( ++p == pe )
 		goto _test_eof156;
 case 156:
-#line 4452 "inc/vcf/validator_detail_v42.hpp"
+#line 4438 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 92: goto tr243;
@@ -4463,20 +4449,20 @@ tr241:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st157;
 tr243:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st157;
 st157:
 	if ( ++p == pe )
 		goto _test_eof157;
 case 157:
-#line 4480 "inc/vcf/validator_detail_v42.hpp"
+#line 4466 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr244;
 		case 92: goto tr243;
@@ -4487,7 +4473,7 @@ case 157:
 tr244:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4498,7 +4484,7 @@ st158:
 	if ( ++p == pe )
 		goto _test_eof158;
 case 158:
-#line 4502 "inc/vcf/validator_detail_v42.hpp"
+#line 4488 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 44: goto tr245;
@@ -4515,20 +4501,20 @@ tr254:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st159;
 tr245:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st159;
 st159:
 	if ( ++p == pe )
 		goto _test_eof159;
 case 159:
-#line 4532 "inc/vcf/validator_detail_v42.hpp"
+#line 4518 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 47: goto tr242;
@@ -4566,20 +4552,20 @@ tr248:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st160;
 tr250:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st160;
 st160:
 	if ( ++p == pe )
 		goto _test_eof160;
 case 160:
-#line 4583 "inc/vcf/validator_detail_v42.hpp"
+#line 4569 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 47: goto tr242;
@@ -4617,20 +4603,20 @@ tr249:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st161;
 tr251:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st161;
 st161:
 	if ( ++p == pe )
 		goto _test_eof161;
 case 161:
-#line 4634 "inc/vcf/validator_detail_v42.hpp"
+#line 4620 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 47: goto tr242;
@@ -4666,14 +4652,14 @@ tr252:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st162;
 st162:
 	if ( ++p == pe )
 		goto _test_eof162;
 case 162:
-#line 4677 "inc/vcf/validator_detail_v42.hpp"
+#line 4663 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr253;
 		case 92: goto tr243;
@@ -4691,7 +4677,7 @@ st163:
 	if ( ++p == pe )
 		goto _test_eof163;
 case 163:
-#line 4695 "inc/vcf/validator_detail_v42.hpp"
+#line 4681 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr227;
 		case 44: goto tr254;
@@ -4708,20 +4694,20 @@ tr255:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st164;
 tr246:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st164;
 st164:
 	if ( ++p == pe )
 		goto _test_eof164;
 case 164:
-#line 4725 "inc/vcf/validator_detail_v42.hpp"
+#line 4711 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -4747,20 +4733,20 @@ tr228:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st166;
 tr231:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st166;
 st166:
 	if ( ++p == pe )
 		goto _test_eof166;
 case 166:
-#line 4764 "inc/vcf/validator_detail_v42.hpp"
+#line 4750 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr256;
 		case 92: goto tr231;
@@ -4771,7 +4757,7 @@ case 166:
 tr256:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4782,7 +4768,7 @@ st167:
 	if ( ++p == pe )
 		goto _test_eof167;
 case 167:
-#line 4786 "inc/vcf/validator_detail_v42.hpp"
+#line 4772 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 44: goto tr257;
@@ -4795,14 +4781,14 @@ case 167:
 tr257:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st168;
 st168:
 	if ( ++p == pe )
 		goto _test_eof168;
 case 168:
-#line 4806 "inc/vcf/validator_detail_v42.hpp"
+#line 4792 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 47: goto tr229;
@@ -4836,13 +4822,13 @@ case 168:
 tr262:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st169;
 tr260:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -4853,7 +4839,7 @@ st169:
 	if ( ++p == pe )
 		goto _test_eof169;
 case 169:
-#line 4857 "inc/vcf/validator_detail_v42.hpp"
+#line 4843 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 47: goto tr229;
@@ -4887,13 +4873,13 @@ case 169:
 tr263:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st170;
 tr261:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -4904,7 +4890,7 @@ st170:
 	if ( ++p == pe )
 		goto _test_eof170;
 case 170:
-#line 4908 "inc/vcf/validator_detail_v42.hpp"
+#line 4894 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr230;
 		case 47: goto tr229;
@@ -4936,7 +4922,7 @@ case 170:
 tr264:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4947,7 +4933,7 @@ st171:
 	if ( ++p == pe )
 		goto _test_eof171;
 case 171:
-#line 4951 "inc/vcf/validator_detail_v42.hpp"
+#line 4937 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr253;
 		case 92: goto tr231;
@@ -4958,14 +4944,14 @@ case 171:
 tr258:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st172;
 st172:
 	if ( ++p == pe )
 		goto _test_eof172;
 case 172:
-#line 4969 "inc/vcf/validator_detail_v42.hpp"
+#line 4955 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -4978,14 +4964,14 @@ case 172:
 tr195:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st173;
 st173:
 	if ( ++p == pe )
 		goto _test_eof173;
 case 173:
-#line 4989 "inc/vcf/validator_detail_v42.hpp"
+#line 4975 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 82: goto tr266;
@@ -4996,14 +4982,14 @@ case 173:
 tr266:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st174;
 st174:
 	if ( ++p == pe )
 		goto _test_eof174;
 case 174:
-#line 5007 "inc/vcf/validator_detail_v42.hpp"
+#line 4993 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 77: goto tr267;
@@ -5014,14 +5000,14 @@ case 174:
 tr267:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st175;
 st175:
 	if ( ++p == pe )
 		goto _test_eof175;
 case 175:
-#line 5025 "inc/vcf/validator_detail_v42.hpp"
+#line 5011 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 65: goto tr268;
@@ -5032,14 +5018,14 @@ case 175:
 tr268:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st176;
 st176:
 	if ( ++p == pe )
 		goto _test_eof176;
 case 176:
-#line 5043 "inc/vcf/validator_detail_v42.hpp"
+#line 5029 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 84: goto st177;
@@ -5057,7 +5043,7 @@ case 177:
 		goto tr40;
 	goto tr265;
 tr270:
-#line 124 "src/vcf/vcf.ragel"
+#line 123 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "FORMAT");
     }
@@ -5066,7 +5052,7 @@ st178:
 	if ( ++p == pe )
 		goto _test_eof178;
 case 178:
-#line 5070 "inc/vcf/validator_detail_v42.hpp"
+#line 5056 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 60 )
 		goto st179;
 	goto tr265;
@@ -5110,7 +5096,7 @@ case 182:
 		goto tr277;
 	goto tr275;
 tr276:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -5123,7 +5109,7 @@ st183:
 	if ( ++p == pe )
 		goto _test_eof183;
 case 183:
-#line 5127 "inc/vcf/validator_detail_v42.hpp"
+#line 5113 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto st183;
 	if ( (*p) < 48 ) {
@@ -5141,11 +5127,11 @@ case 183:
 tr279:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st184;
 tr277:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -5155,14 +5141,14 @@ tr277:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st184;
 st184:
 	if ( ++p == pe )
 		goto _test_eof184;
 case 184:
-#line 5166 "inc/vcf/validator_detail_v42.hpp"
+#line 5152 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 44: goto tr280;
 		case 95: goto tr279;
@@ -5189,7 +5175,7 @@ st185:
 	if ( ++p == pe )
 		goto _test_eof185;
 case 185:
-#line 5193 "inc/vcf/validator_detail_v42.hpp"
+#line 5179 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 78 )
 		goto st186;
 	goto tr265;
@@ -5249,7 +5235,7 @@ case 192:
 		goto tr290;
 	goto tr288;
 tr289:
-#line 148 "src/vcf/vcf.ragel"
+#line 147 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
@@ -5259,14 +5245,14 @@ tr289:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st193;
 st193:
 	if ( ++p == pe )
 		goto _test_eof193;
 case 193:
-#line 5270 "inc/vcf/validator_detail_v42.hpp"
+#line 5256 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 44 )
 		goto tr291;
 	goto tr288;
@@ -5280,7 +5266,7 @@ st194:
 	if ( ++p == pe )
 		goto _test_eof194;
 case 194:
-#line 5284 "inc/vcf/validator_detail_v42.hpp"
+#line 5270 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 84 )
 		goto st195;
 	goto tr265;
@@ -5325,11 +5311,11 @@ case 199:
 tr300:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st200;
 tr298:
-#line 152 "src/vcf/vcf.ragel"
+#line 151 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Type");
     }
@@ -5339,14 +5325,14 @@ tr298:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st200;
 st200:
 	if ( ++p == pe )
 		goto _test_eof200;
 case 200:
-#line 5350 "inc/vcf/validator_detail_v42.hpp"
+#line 5336 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 44 )
 		goto tr299;
 	if ( (*p) > 90 ) {
@@ -5365,7 +5351,7 @@ st201:
 	if ( ++p == pe )
 		goto _test_eof201;
 case 201:
-#line 5369 "inc/vcf/validator_detail_v42.hpp"
+#line 5355 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 68 )
 		goto st202;
 	goto tr265;
@@ -5454,7 +5440,7 @@ case 213:
 		goto tr313;
 	goto tr265;
 tr313:
-#line 156 "src/vcf/vcf.ragel"
+#line 155 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -5463,7 +5449,7 @@ st214:
 	if ( ++p == pe )
 		goto _test_eof214;
 case 214:
-#line 5467 "inc/vcf/validator_detail_v42.hpp"
+#line 5453 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr316;
 		case 92: goto tr317;
@@ -5478,20 +5464,20 @@ tr315:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st215;
 tr318:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st215;
 st215:
 	if ( ++p == pe )
 		goto _test_eof215;
 case 215:
-#line 5495 "inc/vcf/validator_detail_v42.hpp"
+#line 5481 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 92: goto tr320;
@@ -5519,7 +5505,7 @@ st216:
 	if ( ++p == pe )
 		goto _test_eof216;
 case 216:
-#line 5523 "inc/vcf/validator_detail_v42.hpp"
+#line 5509 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 44: goto st217;
 		case 62: goto st231;
@@ -5553,7 +5539,7 @@ st218:
 	if ( ++p == pe )
 		goto _test_eof218;
 case 218:
-#line 5557 "inc/vcf/validator_detail_v42.hpp"
+#line 5543 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto st218;
 	if ( (*p) < 48 ) {
@@ -5575,20 +5561,20 @@ tr324:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st219;
 tr326:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st219;
 st219:
 	if ( ++p == pe )
 		goto _test_eof219;
 case 219:
-#line 5592 "inc/vcf/validator_detail_v42.hpp"
+#line 5578 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr327;
 		case 95: goto tr326;
@@ -5615,7 +5601,7 @@ st220:
 	if ( ++p == pe )
 		goto _test_eof220;
 case 220:
-#line 5619 "inc/vcf/validator_detail_v42.hpp"
+#line 5605 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 34 )
 		goto st221;
 	goto tr265;
@@ -5637,20 +5623,20 @@ tr329:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st222;
 tr331:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st222;
 st222:
 	if ( ++p == pe )
 		goto _test_eof222;
 case 222:
-#line 5654 "inc/vcf/validator_detail_v42.hpp"
+#line 5640 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 92: goto tr332;
@@ -5665,20 +5651,20 @@ tr330:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st223;
 tr332:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st223;
 st223:
 	if ( ++p == pe )
 		goto _test_eof223;
 case 223:
-#line 5682 "inc/vcf/validator_detail_v42.hpp"
+#line 5668 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr333;
 		case 92: goto tr332;
@@ -5689,7 +5675,7 @@ case 223:
 tr333:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -5700,7 +5686,7 @@ st224:
 	if ( ++p == pe )
 		goto _test_eof224;
 case 224:
-#line 5704 "inc/vcf/validator_detail_v42.hpp"
+#line 5690 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 44: goto tr334;
@@ -5717,20 +5703,20 @@ tr343:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st225;
 tr334:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st225;
 st225:
 	if ( ++p == pe )
 		goto _test_eof225;
 case 225:
-#line 5734 "inc/vcf/validator_detail_v42.hpp"
+#line 5720 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 47: goto tr331;
@@ -5768,20 +5754,20 @@ tr337:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st226;
 tr339:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st226;
 st226:
 	if ( ++p == pe )
 		goto _test_eof226;
 case 226:
-#line 5785 "inc/vcf/validator_detail_v42.hpp"
+#line 5771 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 47: goto tr331;
@@ -5819,20 +5805,20 @@ tr338:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st227;
 tr340:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st227;
 st227:
 	if ( ++p == pe )
 		goto _test_eof227;
 case 227:
-#line 5836 "inc/vcf/validator_detail_v42.hpp"
+#line 5822 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 47: goto tr331;
@@ -5868,14 +5854,14 @@ tr341:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st228;
 st228:
 	if ( ++p == pe )
 		goto _test_eof228;
 case 228:
-#line 5879 "inc/vcf/validator_detail_v42.hpp"
+#line 5865 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr342;
 		case 92: goto tr332;
@@ -5893,7 +5879,7 @@ st229:
 	if ( ++p == pe )
 		goto _test_eof229;
 case 229:
-#line 5897 "inc/vcf/validator_detail_v42.hpp"
+#line 5883 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr316;
 		case 44: goto tr343;
@@ -5910,20 +5896,20 @@ tr344:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st230;
 tr335:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st230;
 st230:
 	if ( ++p == pe )
 		goto _test_eof230;
 case 230:
-#line 5927 "inc/vcf/validator_detail_v42.hpp"
+#line 5913 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -5949,20 +5935,20 @@ tr317:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st232;
 tr320:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st232;
 st232:
 	if ( ++p == pe )
 		goto _test_eof232;
 case 232:
-#line 5966 "inc/vcf/validator_detail_v42.hpp"
+#line 5952 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr345;
 		case 92: goto tr320;
@@ -5973,7 +5959,7 @@ case 232:
 tr345:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -5984,7 +5970,7 @@ st233:
 	if ( ++p == pe )
 		goto _test_eof233;
 case 233:
-#line 5988 "inc/vcf/validator_detail_v42.hpp"
+#line 5974 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 44: goto tr346;
@@ -5997,14 +5983,14 @@ case 233:
 tr346:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st234;
 st234:
 	if ( ++p == pe )
 		goto _test_eof234;
 case 234:
-#line 6008 "inc/vcf/validator_detail_v42.hpp"
+#line 5994 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 47: goto tr318;
@@ -6038,13 +6024,13 @@ case 234:
 tr351:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st235;
 tr349:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -6055,7 +6041,7 @@ st235:
 	if ( ++p == pe )
 		goto _test_eof235;
 case 235:
-#line 6059 "inc/vcf/validator_detail_v42.hpp"
+#line 6045 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 47: goto tr318;
@@ -6089,13 +6075,13 @@ case 235:
 tr352:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st236;
 tr350:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -6106,7 +6092,7 @@ st236:
 	if ( ++p == pe )
 		goto _test_eof236;
 case 236:
-#line 6110 "inc/vcf/validator_detail_v42.hpp"
+#line 6096 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr319;
 		case 47: goto tr318;
@@ -6138,7 +6124,7 @@ case 236:
 tr353:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6149,7 +6135,7 @@ st237:
 	if ( ++p == pe )
 		goto _test_eof237;
 case 237:
-#line 6153 "inc/vcf/validator_detail_v42.hpp"
+#line 6139 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr342;
 		case 92: goto tr320;
@@ -6160,14 +6146,14 @@ case 237:
 tr347:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st238;
 st238:
 	if ( ++p == pe )
 		goto _test_eof238;
 case 238:
-#line 6171 "inc/vcf/validator_detail_v42.hpp"
+#line 6157 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -6180,11 +6166,11 @@ case 238:
 tr354:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st239;
 tr290:
-#line 148 "src/vcf/vcf.ragel"
+#line 147 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
@@ -6194,14 +6180,14 @@ tr290:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st239;
 st239:
 	if ( ++p == pe )
 		goto _test_eof239;
 case 239:
-#line 6205 "inc/vcf/validator_detail_v42.hpp"
+#line 6191 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 44 )
 		goto tr291;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -6214,14 +6200,14 @@ tr33:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st240;
 st240:
 	if ( ++p == pe )
 		goto _test_eof240;
 case 240:
-#line 6225 "inc/vcf/validator_detail_v42.hpp"
+#line 6211 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 78: goto tr356;
@@ -6232,14 +6218,14 @@ case 240:
 tr356:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st241;
 st241:
 	if ( ++p == pe )
 		goto _test_eof241;
 case 241:
-#line 6243 "inc/vcf/validator_detail_v42.hpp"
+#line 6229 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 70: goto tr357;
@@ -6250,14 +6236,14 @@ case 241:
 tr357:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st242;
 st242:
 	if ( ++p == pe )
 		goto _test_eof242;
 case 242:
-#line 6261 "inc/vcf/validator_detail_v42.hpp"
+#line 6247 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 79: goto st243;
@@ -6275,7 +6261,7 @@ case 243:
 		goto tr40;
 	goto tr355;
 tr359:
-#line 128 "src/vcf/vcf.ragel"
+#line 127 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "INFO");
     }
@@ -6284,7 +6270,7 @@ st244:
 	if ( ++p == pe )
 		goto _test_eof244;
 case 244:
-#line 6288 "inc/vcf/validator_detail_v42.hpp"
+#line 6274 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 60 )
 		goto st245;
 	goto tr355;
@@ -6328,7 +6314,7 @@ case 248:
 		goto tr366;
 	goto tr364;
 tr365:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -6341,7 +6327,7 @@ st249:
 	if ( ++p == pe )
 		goto _test_eof249;
 case 249:
-#line 6345 "inc/vcf/validator_detail_v42.hpp"
+#line 6331 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto st249;
 	if ( (*p) < 48 ) {
@@ -6359,11 +6345,11 @@ case 249:
 tr368:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st250;
 tr366:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -6373,14 +6359,14 @@ tr366:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st250;
 st250:
 	if ( ++p == pe )
 		goto _test_eof250;
 case 250:
-#line 6384 "inc/vcf/validator_detail_v42.hpp"
+#line 6370 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 44: goto tr369;
 		case 95: goto tr368;
@@ -6407,7 +6393,7 @@ st251:
 	if ( ++p == pe )
 		goto _test_eof251;
 case 251:
-#line 6411 "inc/vcf/validator_detail_v42.hpp"
+#line 6397 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 78 )
 		goto st252;
 	goto tr355;
@@ -6467,7 +6453,7 @@ case 258:
 		goto tr379;
 	goto tr377;
 tr378:
-#line 148 "src/vcf/vcf.ragel"
+#line 147 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
@@ -6477,14 +6463,14 @@ tr378:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st259;
 st259:
 	if ( ++p == pe )
 		goto _test_eof259;
 case 259:
-#line 6488 "inc/vcf/validator_detail_v42.hpp"
+#line 6474 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 44 )
 		goto tr380;
 	goto tr377;
@@ -6498,7 +6484,7 @@ st260:
 	if ( ++p == pe )
 		goto _test_eof260;
 case 260:
-#line 6502 "inc/vcf/validator_detail_v42.hpp"
+#line 6488 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 84 )
 		goto st261;
 	goto tr355;
@@ -6543,11 +6529,11 @@ case 265:
 tr389:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st266;
 tr387:
-#line 152 "src/vcf/vcf.ragel"
+#line 151 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Type");
     }
@@ -6557,14 +6543,14 @@ tr387:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st266;
 st266:
 	if ( ++p == pe )
 		goto _test_eof266;
 case 266:
-#line 6568 "inc/vcf/validator_detail_v42.hpp"
+#line 6554 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 44 )
 		goto tr388;
 	if ( (*p) > 90 ) {
@@ -6583,7 +6569,7 @@ st267:
 	if ( ++p == pe )
 		goto _test_eof267;
 case 267:
-#line 6587 "inc/vcf/validator_detail_v42.hpp"
+#line 6573 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 68 )
 		goto st268;
 	goto tr355;
@@ -6672,7 +6658,7 @@ case 279:
 		goto tr402;
 	goto tr355;
 tr402:
-#line 156 "src/vcf/vcf.ragel"
+#line 155 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -6681,7 +6667,7 @@ st280:
 	if ( ++p == pe )
 		goto _test_eof280;
 case 280:
-#line 6685 "inc/vcf/validator_detail_v42.hpp"
+#line 6671 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr405;
 		case 92: goto tr406;
@@ -6696,20 +6682,20 @@ tr404:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st281;
 tr407:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st281;
 st281:
 	if ( ++p == pe )
 		goto _test_eof281;
 case 281:
-#line 6713 "inc/vcf/validator_detail_v42.hpp"
+#line 6699 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 92: goto tr409;
@@ -6737,7 +6723,7 @@ st282:
 	if ( ++p == pe )
 		goto _test_eof282;
 case 282:
-#line 6741 "inc/vcf/validator_detail_v42.hpp"
+#line 6727 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 44: goto st283;
 		case 62: goto st297;
@@ -6771,7 +6757,7 @@ st284:
 	if ( ++p == pe )
 		goto _test_eof284;
 case 284:
-#line 6775 "inc/vcf/validator_detail_v42.hpp"
+#line 6761 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto st284;
 	if ( (*p) < 48 ) {
@@ -6793,20 +6779,20 @@ tr413:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st285;
 tr415:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st285;
 st285:
 	if ( ++p == pe )
 		goto _test_eof285;
 case 285:
-#line 6810 "inc/vcf/validator_detail_v42.hpp"
+#line 6796 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr416;
 		case 95: goto tr415;
@@ -6833,7 +6819,7 @@ st286:
 	if ( ++p == pe )
 		goto _test_eof286;
 case 286:
-#line 6837 "inc/vcf/validator_detail_v42.hpp"
+#line 6823 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 34 )
 		goto st287;
 	goto tr355;
@@ -6855,20 +6841,20 @@ tr418:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st288;
 tr420:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st288;
 st288:
 	if ( ++p == pe )
 		goto _test_eof288;
 case 288:
-#line 6872 "inc/vcf/validator_detail_v42.hpp"
+#line 6858 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 92: goto tr421;
@@ -6883,20 +6869,20 @@ tr419:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st289;
 tr421:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st289;
 st289:
 	if ( ++p == pe )
 		goto _test_eof289;
 case 289:
-#line 6900 "inc/vcf/validator_detail_v42.hpp"
+#line 6886 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr422;
 		case 92: goto tr421;
@@ -6907,7 +6893,7 @@ case 289:
 tr422:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6918,7 +6904,7 @@ st290:
 	if ( ++p == pe )
 		goto _test_eof290;
 case 290:
-#line 6922 "inc/vcf/validator_detail_v42.hpp"
+#line 6908 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 44: goto tr423;
@@ -6935,20 +6921,20 @@ tr432:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st291;
 tr423:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st291;
 st291:
 	if ( ++p == pe )
 		goto _test_eof291;
 case 291:
-#line 6952 "inc/vcf/validator_detail_v42.hpp"
+#line 6938 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 47: goto tr420;
@@ -6986,20 +6972,20 @@ tr426:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st292;
 tr428:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st292;
 st292:
 	if ( ++p == pe )
 		goto _test_eof292;
 case 292:
-#line 7003 "inc/vcf/validator_detail_v42.hpp"
+#line 6989 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 47: goto tr420;
@@ -7037,20 +7023,20 @@ tr427:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st293;
 tr429:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st293;
 st293:
 	if ( ++p == pe )
 		goto _test_eof293;
 case 293:
-#line 7054 "inc/vcf/validator_detail_v42.hpp"
+#line 7040 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 47: goto tr420;
@@ -7086,14 +7072,14 @@ tr430:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st294;
 st294:
 	if ( ++p == pe )
 		goto _test_eof294;
 case 294:
-#line 7097 "inc/vcf/validator_detail_v42.hpp"
+#line 7083 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr431;
 		case 92: goto tr421;
@@ -7111,7 +7097,7 @@ st295:
 	if ( ++p == pe )
 		goto _test_eof295;
 case 295:
-#line 7115 "inc/vcf/validator_detail_v42.hpp"
+#line 7101 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr405;
 		case 44: goto tr432;
@@ -7128,20 +7114,20 @@ tr433:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st296;
 tr424:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st296;
 st296:
 	if ( ++p == pe )
 		goto _test_eof296;
 case 296:
-#line 7145 "inc/vcf/validator_detail_v42.hpp"
+#line 7131 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -7167,20 +7153,20 @@ tr406:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st298;
 tr409:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st298;
 st298:
 	if ( ++p == pe )
 		goto _test_eof298;
 case 298:
-#line 7184 "inc/vcf/validator_detail_v42.hpp"
+#line 7170 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr434;
 		case 92: goto tr409;
@@ -7191,7 +7177,7 @@ case 298:
 tr434:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -7202,7 +7188,7 @@ st299:
 	if ( ++p == pe )
 		goto _test_eof299;
 case 299:
-#line 7206 "inc/vcf/validator_detail_v42.hpp"
+#line 7192 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 44: goto tr435;
@@ -7215,14 +7201,14 @@ case 299:
 tr435:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st300;
 st300:
 	if ( ++p == pe )
 		goto _test_eof300;
 case 300:
-#line 7226 "inc/vcf/validator_detail_v42.hpp"
+#line 7212 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 47: goto tr407;
@@ -7256,13 +7242,13 @@ case 300:
 tr440:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st301;
 tr438:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -7273,7 +7259,7 @@ st301:
 	if ( ++p == pe )
 		goto _test_eof301;
 case 301:
-#line 7277 "inc/vcf/validator_detail_v42.hpp"
+#line 7263 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 47: goto tr407;
@@ -7307,13 +7293,13 @@ case 301:
 tr441:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st302;
 tr439:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -7324,7 +7310,7 @@ st302:
 	if ( ++p == pe )
 		goto _test_eof302;
 case 302:
-#line 7328 "inc/vcf/validator_detail_v42.hpp"
+#line 7314 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr408;
 		case 47: goto tr407;
@@ -7356,7 +7342,7 @@ case 302:
 tr442:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -7367,7 +7353,7 @@ st303:
 	if ( ++p == pe )
 		goto _test_eof303;
 case 303:
-#line 7371 "inc/vcf/validator_detail_v42.hpp"
+#line 7357 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr431;
 		case 92: goto tr409;
@@ -7378,14 +7364,14 @@ case 303:
 tr436:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st304;
 st304:
 	if ( ++p == pe )
 		goto _test_eof304;
 case 304:
-#line 7389 "inc/vcf/validator_detail_v42.hpp"
+#line 7375 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -7398,11 +7384,11 @@ case 304:
 tr443:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st305;
 tr379:
-#line 148 "src/vcf/vcf.ragel"
+#line 147 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
@@ -7412,14 +7398,14 @@ tr379:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st305;
 st305:
 	if ( ++p == pe )
 		goto _test_eof305;
 case 305:
-#line 7423 "inc/vcf/validator_detail_v42.hpp"
+#line 7409 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 44 )
 		goto tr380;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -7432,14 +7418,14 @@ tr34:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st306;
 st306:
 	if ( ++p == pe )
 		goto _test_eof306;
 case 306:
-#line 7443 "inc/vcf/validator_detail_v42.hpp"
+#line 7429 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto tr445;
@@ -7450,14 +7436,14 @@ case 306:
 tr445:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st307;
 st307:
 	if ( ++p == pe )
 		goto _test_eof307;
 case 307:
-#line 7461 "inc/vcf/validator_detail_v42.hpp"
+#line 7447 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 68: goto tr446;
@@ -7468,14 +7454,14 @@ case 307:
 tr446:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st308;
 st308:
 	if ( ++p == pe )
 		goto _test_eof308;
 case 308:
-#line 7479 "inc/vcf/validator_detail_v42.hpp"
+#line 7465 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 73: goto tr447;
@@ -7486,14 +7472,14 @@ case 308:
 tr447:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st309;
 st309:
 	if ( ++p == pe )
 		goto _test_eof309;
 case 309:
-#line 7497 "inc/vcf/validator_detail_v42.hpp"
+#line 7483 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 71: goto tr448;
@@ -7504,14 +7490,14 @@ case 309:
 tr448:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st310;
 st310:
 	if ( ++p == pe )
 		goto _test_eof310;
 case 310:
-#line 7515 "inc/vcf/validator_detail_v42.hpp"
+#line 7501 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 82: goto tr449;
@@ -7522,14 +7508,14 @@ case 310:
 tr449:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st311;
 st311:
 	if ( ++p == pe )
 		goto _test_eof311;
 case 311:
-#line 7533 "inc/vcf/validator_detail_v42.hpp"
+#line 7519 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto tr450;
@@ -7540,14 +7526,14 @@ case 311:
 tr450:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st312;
 st312:
 	if ( ++p == pe )
 		goto _test_eof312;
 case 312:
-#line 7551 "inc/vcf/validator_detail_v42.hpp"
+#line 7537 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto st313;
@@ -7565,7 +7551,7 @@ case 313:
 		goto tr40;
 	goto tr444;
 tr452:
-#line 132 "src/vcf/vcf.ragel"
+#line 131 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "PEDIGREE");
     }
@@ -7574,7 +7560,7 @@ st314:
 	if ( ++p == pe )
 		goto _test_eof314;
 case 314:
-#line 7578 "inc/vcf/validator_detail_v42.hpp"
+#line 7564 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 60 )
 		goto st315;
 	goto tr444;
@@ -7588,7 +7574,7 @@ st315:
 	if ( ++p == pe )
 		goto _test_eof315;
 case 315:
-#line 7592 "inc/vcf/validator_detail_v42.hpp"
+#line 7578 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto tr455;
 	if ( (*p) < 48 ) {
@@ -7613,7 +7599,7 @@ st316:
 	if ( ++p == pe )
 		goto _test_eof316;
 case 316:
-#line 7617 "inc/vcf/validator_detail_v42.hpp"
+#line 7603 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto st316;
 	if ( (*p) < 48 ) {
@@ -7635,20 +7621,20 @@ tr456:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st317;
 tr458:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st317;
 st317:
 	if ( ++p == pe )
 		goto _test_eof317;
 case 317:
-#line 7652 "inc/vcf/validator_detail_v42.hpp"
+#line 7638 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr459;
 		case 95: goto tr458;
@@ -7675,7 +7661,7 @@ st318:
 	if ( ++p == pe )
 		goto _test_eof318;
 case 318:
-#line 7679 "inc/vcf/validator_detail_v42.hpp"
+#line 7665 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto tr460;
 	if ( (*p) < 48 ) {
@@ -7700,7 +7686,7 @@ st319:
 	if ( ++p == pe )
 		goto _test_eof319;
 case 319:
-#line 7704 "inc/vcf/validator_detail_v42.hpp"
+#line 7690 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto st319;
 	if ( (*p) < 48 ) {
@@ -7722,20 +7708,20 @@ tr461:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st320;
 tr463:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st320;
 st320:
 	if ( ++p == pe )
 		goto _test_eof320;
 case 320:
-#line 7739 "inc/vcf/validator_detail_v42.hpp"
+#line 7725 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 44: goto tr464;
 		case 62: goto tr465;
@@ -7763,7 +7749,7 @@ st321:
 	if ( ++p == pe )
 		goto _test_eof321;
 case 321:
-#line 7767 "inc/vcf/validator_detail_v42.hpp"
+#line 7753 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -7776,14 +7762,14 @@ tr35:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st322;
 st322:
 	if ( ++p == pe )
 		goto _test_eof322;
 case 322:
-#line 7787 "inc/vcf/validator_detail_v42.hpp"
+#line 7773 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 65: goto tr467;
@@ -7794,14 +7780,14 @@ case 322:
 tr467:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st323;
 st323:
 	if ( ++p == pe )
 		goto _test_eof323;
 case 323:
-#line 7805 "inc/vcf/validator_detail_v42.hpp"
+#line 7791 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 77: goto tr468;
@@ -7812,14 +7798,14 @@ case 323:
 tr468:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st324;
 st324:
 	if ( ++p == pe )
 		goto _test_eof324;
 case 324:
-#line 7823 "inc/vcf/validator_detail_v42.hpp"
+#line 7809 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 80: goto tr469;
@@ -7830,14 +7816,14 @@ case 324:
 tr469:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st325;
 st325:
 	if ( ++p == pe )
 		goto _test_eof325;
 case 325:
-#line 7841 "inc/vcf/validator_detail_v42.hpp"
+#line 7827 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 76: goto tr470;
@@ -7848,14 +7834,14 @@ case 325:
 tr470:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st326;
 st326:
 	if ( ++p == pe )
 		goto _test_eof326;
 case 326:
-#line 7859 "inc/vcf/validator_detail_v42.hpp"
+#line 7845 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 69: goto st327;
@@ -7873,7 +7859,7 @@ case 327:
 		goto tr40;
 	goto tr466;
 tr472:
-#line 140 "src/vcf/vcf.ragel"
+#line 139 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "SAMPLE");
     }
@@ -7882,7 +7868,7 @@ st328:
 	if ( ++p == pe )
 		goto _test_eof328;
 case 328:
-#line 7886 "inc/vcf/validator_detail_v42.hpp"
+#line 7872 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 60 )
 		goto st329;
 	goto tr466;
@@ -7926,7 +7912,7 @@ case 332:
 		goto tr479;
 	goto tr477;
 tr478:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -7939,7 +7925,7 @@ st333:
 	if ( ++p == pe )
 		goto _test_eof333;
 case 333:
-#line 7943 "inc/vcf/validator_detail_v42.hpp"
+#line 7929 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto st333;
 	if ( (*p) < 48 ) {
@@ -7957,11 +7943,11 @@ case 333:
 tr481:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st334;
 tr479:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -7971,14 +7957,14 @@ tr479:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st334;
 st334:
 	if ( ++p == pe )
 		goto _test_eof334;
 case 334:
-#line 7982 "inc/vcf/validator_detail_v42.hpp"
+#line 7968 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 44: goto tr483;
 		case 95: goto tr481;
@@ -8005,7 +7991,7 @@ st335:
 	if ( ++p == pe )
 		goto _test_eof335;
 case 335:
-#line 8009 "inc/vcf/validator_detail_v42.hpp"
+#line 7995 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 71 )
 		goto st336;
 	goto tr484;
@@ -8077,11 +8063,11 @@ case 343:
 tr495:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st344;
 tr493:
-#line 160 "src/vcf/vcf.ragel"
+#line 159 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Genomes");
     }
@@ -8091,14 +8077,14 @@ tr493:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st344;
 st344:
 	if ( ++p == pe )
 		goto _test_eof344;
 case 344:
-#line 8102 "inc/vcf/validator_detail_v42.hpp"
+#line 8088 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 44 )
 		goto tr496;
 	if ( (*p) < 35 ) {
@@ -8120,7 +8106,7 @@ st345:
 	if ( ++p == pe )
 		goto _test_eof345;
 case 345:
-#line 8124 "inc/vcf/validator_detail_v42.hpp"
+#line 8110 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 77 )
 		goto st346;
 	goto tr497;
@@ -8192,11 +8178,11 @@ case 353:
 tr508:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st354;
 tr506:
-#line 164 "src/vcf/vcf.ragel"
+#line 163 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Mixture");
     }
@@ -8206,14 +8192,14 @@ tr506:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st354;
 st354:
 	if ( ++p == pe )
 		goto _test_eof354;
 case 354:
-#line 8217 "inc/vcf/validator_detail_v42.hpp"
+#line 8203 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 44 )
 		goto tr509;
 	if ( (*p) < 35 ) {
@@ -8235,7 +8221,7 @@ st355:
 	if ( ++p == pe )
 		goto _test_eof355;
 case 355:
-#line 8239 "inc/vcf/validator_detail_v42.hpp"
+#line 8225 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 68 )
 		goto st356;
 	goto tr510;
@@ -8324,7 +8310,7 @@ case 367:
 		goto tr523;
 	goto tr510;
 tr523:
-#line 156 "src/vcf/vcf.ragel"
+#line 155 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -8333,7 +8319,7 @@ st368:
 	if ( ++p == pe )
 		goto _test_eof368;
 case 368:
-#line 8337 "inc/vcf/validator_detail_v42.hpp"
+#line 8323 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr525;
 		case 92: goto tr526;
@@ -8348,20 +8334,20 @@ tr524:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st369;
 tr527:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st369;
 st369:
 	if ( ++p == pe )
 		goto _test_eof369;
 case 369:
-#line 8365 "inc/vcf/validator_detail_v42.hpp"
+#line 8351 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr528;
 		case 92: goto tr529;
@@ -8389,7 +8375,7 @@ st370:
 	if ( ++p == pe )
 		goto _test_eof370;
 case 370:
-#line 8393 "inc/vcf/validator_detail_v42.hpp"
+#line 8379 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 62 )
 		goto st371;
 	goto tr510;
@@ -8409,20 +8395,20 @@ tr526:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st372;
 tr529:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st372;
 st372:
 	if ( ++p == pe )
 		goto _test_eof372;
 case 372:
-#line 8426 "inc/vcf/validator_detail_v42.hpp"
+#line 8412 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr531;
 		case 92: goto tr529;
@@ -8433,7 +8419,7 @@ case 372:
 tr531:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -8444,7 +8430,7 @@ st373:
 	if ( ++p == pe )
 		goto _test_eof373;
 case 373:
-#line 8448 "inc/vcf/validator_detail_v42.hpp"
+#line 8434 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr528;
 		case 62: goto tr532;
@@ -8456,14 +8442,14 @@ case 373:
 tr532:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st374;
 st374:
 	if ( ++p == pe )
 		goto _test_eof374;
 case 374:
-#line 8467 "inc/vcf/validator_detail_v42.hpp"
+#line 8453 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -8480,14 +8466,14 @@ tr36:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st375;
 st375:
 	if ( ++p == pe )
 		goto _test_eof375;
 case 375:
-#line 8491 "inc/vcf/validator_detail_v42.hpp"
+#line 8477 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 115: goto tr534;
@@ -8498,14 +8484,14 @@ case 375:
 tr534:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st376;
 st376:
 	if ( ++p == pe )
 		goto _test_eof376;
 case 376:
-#line 8509 "inc/vcf/validator_detail_v42.hpp"
+#line 8495 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 115: goto tr535;
@@ -8516,14 +8502,14 @@ case 376:
 tr535:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st377;
 st377:
 	if ( ++p == pe )
 		goto _test_eof377;
 case 377:
-#line 8527 "inc/vcf/validator_detail_v42.hpp"
+#line 8513 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 101: goto tr536;
@@ -8534,14 +8520,14 @@ case 377:
 tr536:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st378;
 st378:
 	if ( ++p == pe )
 		goto _test_eof378;
 case 378:
-#line 8545 "inc/vcf/validator_detail_v42.hpp"
+#line 8531 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 109: goto tr537;
@@ -8552,14 +8538,14 @@ case 378:
 tr537:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st379;
 st379:
 	if ( ++p == pe )
 		goto _test_eof379;
 case 379:
-#line 8563 "inc/vcf/validator_detail_v42.hpp"
+#line 8549 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 98: goto tr538;
@@ -8570,14 +8556,14 @@ case 379:
 tr538:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st380;
 st380:
 	if ( ++p == pe )
 		goto _test_eof380;
 case 380:
-#line 8581 "inc/vcf/validator_detail_v42.hpp"
+#line 8567 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 108: goto tr539;
@@ -8588,14 +8574,14 @@ case 380:
 tr539:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st381;
 st381:
 	if ( ++p == pe )
 		goto _test_eof381;
 case 381:
-#line 8599 "inc/vcf/validator_detail_v42.hpp"
+#line 8585 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 121: goto st382;
@@ -8613,7 +8599,7 @@ case 382:
 		goto tr40;
 	goto tr533;
 tr541:
-#line 112 "src/vcf/vcf.ragel"
+#line 111 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "assembly");
     }
@@ -8622,7 +8608,7 @@ st383:
 	if ( ++p == pe )
 		goto _test_eof383;
 case 383:
-#line 8626 "inc/vcf/validator_detail_v42.hpp"
+#line 8612 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) > 90 ) {
 		if ( 97 <= (*p) && (*p) <= 122 )
 			goto tr543;
@@ -8639,7 +8625,7 @@ st384:
 	if ( ++p == pe )
 		goto _test_eof384;
 case 384:
-#line 8643 "inc/vcf/validator_detail_v42.hpp"
+#line 8629 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr542;
 		case 13: goto tr545;
@@ -8655,17 +8641,13 @@ tr545:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st385;
 st385:
 	if ( ++p == pe )
 		goto _test_eof385;
 case 385:
-#line 8669 "inc/vcf/validator_detail_v42.hpp"
+#line 8651 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr542;
 		case 13: goto tr545;
@@ -8753,7 +8735,7 @@ case 394:
 tr550:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st395;
 tr559:
@@ -8762,20 +8744,16 @@ tr559:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -8788,7 +8766,7 @@ st395:
 	if ( ++p == pe )
 		goto _test_eof395;
 case 395:
-#line 8792 "inc/vcf/validator_detail_v42.hpp"
+#line 8770 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr45;
 		case 13: goto tr559;
@@ -8849,14 +8827,14 @@ tr37:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st402;
 st402:
 	if ( ++p == pe )
 		goto _test_eof402;
 case 402:
-#line 8860 "inc/vcf/validator_detail_v42.hpp"
+#line 8838 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 111: goto tr564;
@@ -8867,14 +8845,14 @@ case 402:
 tr564:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st403;
 st403:
 	if ( ++p == pe )
 		goto _test_eof403;
 case 403:
-#line 8878 "inc/vcf/validator_detail_v42.hpp"
+#line 8856 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 110: goto tr565;
@@ -8885,14 +8863,14 @@ case 403:
 tr565:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st404;
 st404:
 	if ( ++p == pe )
 		goto _test_eof404;
 case 404:
-#line 8896 "inc/vcf/validator_detail_v42.hpp"
+#line 8874 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 116: goto tr566;
@@ -8903,14 +8881,14 @@ case 404:
 tr566:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st405;
 st405:
 	if ( ++p == pe )
 		goto _test_eof405;
 case 405:
-#line 8914 "inc/vcf/validator_detail_v42.hpp"
+#line 8892 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 105: goto tr567;
@@ -8921,14 +8899,14 @@ case 405:
 tr567:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st406;
 st406:
 	if ( ++p == pe )
 		goto _test_eof406;
 case 406:
-#line 8932 "inc/vcf/validator_detail_v42.hpp"
+#line 8910 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 103: goto st407;
@@ -8946,7 +8924,7 @@ case 407:
 		goto tr40;
 	goto tr563;
 tr569:
-#line 116 "src/vcf/vcf.ragel"
+#line 115 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "contig");
     }
@@ -8955,7 +8933,7 @@ st408:
 	if ( ++p == pe )
 		goto _test_eof408;
 case 408:
-#line 8959 "inc/vcf/validator_detail_v42.hpp"
+#line 8937 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 60 )
 		goto st409;
 	goto tr563;
@@ -8996,11 +8974,11 @@ case 412:
 tr576:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st413;
 tr575:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -9010,14 +8988,14 @@ tr575:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st413;
 st413:
 	if ( ++p == pe )
 		goto _test_eof413;
 case 413:
-#line 9021 "inc/vcf/validator_detail_v42.hpp"
+#line 8999 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 44: goto tr577;
 		case 59: goto tr576;
@@ -9039,7 +9017,7 @@ st414:
 	if ( ++p == pe )
 		goto _test_eof414;
 case 414:
-#line 9043 "inc/vcf/validator_detail_v42.hpp"
+#line 9021 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto tr579;
 	if ( (*p) < 48 ) {
@@ -9064,7 +9042,7 @@ st415:
 	if ( ++p == pe )
 		goto _test_eof415;
 case 415:
-#line 9068 "inc/vcf/validator_detail_v42.hpp"
+#line 9046 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 95 )
 		goto st415;
 	if ( (*p) < 48 ) {
@@ -9086,20 +9064,20 @@ tr580:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st416;
 tr582:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st416;
 st416:
 	if ( ++p == pe )
 		goto _test_eof416;
 case 416:
-#line 9103 "inc/vcf/validator_detail_v42.hpp"
+#line 9081 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr583;
 		case 95: goto tr582;
@@ -9126,7 +9104,7 @@ st417:
 	if ( ++p == pe )
 		goto _test_eof417;
 case 417:
-#line 9130 "inc/vcf/validator_detail_v42.hpp"
+#line 9108 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 34 )
 		goto st420;
 	if ( (*p) < 45 ) {
@@ -9145,20 +9123,20 @@ tr584:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st418;
 tr586:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st418;
 st418:
 	if ( ++p == pe )
 		goto _test_eof418;
 case 418:
-#line 9162 "inc/vcf/validator_detail_v42.hpp"
+#line 9140 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 44: goto tr577;
 		case 62: goto tr578;
@@ -9179,7 +9157,7 @@ st419:
 	if ( ++p == pe )
 		goto _test_eof419;
 case 419:
-#line 9183 "inc/vcf/validator_detail_v42.hpp"
+#line 9161 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -9203,20 +9181,20 @@ tr587:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st421;
 tr590:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st421;
 st421:
 	if ( ++p == pe )
 		goto _test_eof421;
 case 421:
-#line 9220 "inc/vcf/validator_detail_v42.hpp"
+#line 9198 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr591;
 		case 92: goto tr592;
@@ -9244,7 +9222,7 @@ st422:
 	if ( ++p == pe )
 		goto _test_eof422;
 case 422:
-#line 9248 "inc/vcf/validator_detail_v42.hpp"
+#line 9226 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 44: goto st414;
 		case 62: goto st419;
@@ -9257,20 +9235,20 @@ tr589:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st423;
 tr592:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st423;
 st423:
 	if ( ++p == pe )
 		goto _test_eof423;
 case 423:
-#line 9274 "inc/vcf/validator_detail_v42.hpp"
+#line 9252 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr595;
 		case 92: goto tr592;
@@ -9281,7 +9259,7 @@ case 423:
 tr595:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -9292,7 +9270,7 @@ st424:
 	if ( ++p == pe )
 		goto _test_eof424;
 case 424:
-#line 9296 "inc/vcf/validator_detail_v42.hpp"
+#line 9274 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr591;
 		case 44: goto tr596;
@@ -9309,19 +9287,19 @@ tr610:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st425;
 tr596:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st425;
 tr607:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -9332,7 +9310,7 @@ st425:
 	if ( ++p == pe )
 		goto _test_eof425;
 case 425:
-#line 9336 "inc/vcf/validator_detail_v42.hpp"
+#line 9314 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr591;
 		case 47: goto tr590;
@@ -9370,20 +9348,20 @@ tr598:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st426;
 tr600:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st426;
 st426:
 	if ( ++p == pe )
 		goto _test_eof426;
 case 426:
-#line 9387 "inc/vcf/validator_detail_v42.hpp"
+#line 9365 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr591;
 		case 47: goto tr590;
@@ -9421,20 +9399,20 @@ tr599:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st427;
 tr601:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st427;
 st427:
 	if ( ++p == pe )
 		goto _test_eof427;
 case 427:
-#line 9438 "inc/vcf/validator_detail_v42.hpp"
+#line 9416 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr591;
 		case 47: goto tr590;
@@ -9470,14 +9448,14 @@ tr602:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st428;
 st428:
 	if ( ++p == pe )
 		goto _test_eof428;
 case 428:
-#line 9481 "inc/vcf/validator_detail_v42.hpp"
+#line 9459 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr604;
 		case 44: goto tr590;
@@ -9490,13 +9468,13 @@ case 428:
 tr606:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st429;
 tr603:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -9507,7 +9485,7 @@ st429:
 	if ( ++p == pe )
 		goto _test_eof429;
 case 429:
-#line 9511 "inc/vcf/validator_detail_v42.hpp"
+#line 9489 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr591;
 		case 44: goto tr607;
@@ -9524,19 +9502,19 @@ tr611:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st430;
 tr597:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st430;
 tr608:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -9547,7 +9525,7 @@ st430:
 	if ( ++p == pe )
 		goto _test_eof430;
 case 430:
-#line 9551 "inc/vcf/validator_detail_v42.hpp"
+#line 9529 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr56;
@@ -9560,13 +9538,13 @@ case 430:
 tr609:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st431;
 tr605:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -9577,7 +9555,7 @@ st431:
 	if ( ++p == pe )
 		goto _test_eof431;
 case 431:
-#line 9581 "inc/vcf/validator_detail_v42.hpp"
+#line 9559 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr595;
 		case 44: goto tr607;
@@ -9597,7 +9575,7 @@ st432:
 	if ( ++p == pe )
 		goto _test_eof432;
 case 432:
-#line 9601 "inc/vcf/validator_detail_v42.hpp"
+#line 9579 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 34: goto tr588;
 		case 44: goto tr610;
@@ -9614,14 +9592,14 @@ tr38:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st433;
 st433:
 	if ( ++p == pe )
 		goto _test_eof433;
 case 433:
-#line 9625 "inc/vcf/validator_detail_v42.hpp"
+#line 9603 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 101: goto tr613;
@@ -9632,14 +9610,14 @@ case 433:
 tr613:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st434;
 st434:
 	if ( ++p == pe )
 		goto _test_eof434;
 case 434:
-#line 9643 "inc/vcf/validator_detail_v42.hpp"
+#line 9621 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 100: goto tr614;
@@ -9650,14 +9628,14 @@ case 434:
 tr614:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st435;
 st435:
 	if ( ++p == pe )
 		goto _test_eof435;
 case 435:
-#line 9661 "inc/vcf/validator_detail_v42.hpp"
+#line 9639 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 105: goto tr615;
@@ -9668,14 +9646,14 @@ case 435:
 tr615:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st436;
 st436:
 	if ( ++p == pe )
 		goto _test_eof436;
 case 436:
-#line 9679 "inc/vcf/validator_detail_v42.hpp"
+#line 9657 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 103: goto tr616;
@@ -9686,14 +9664,14 @@ case 436:
 tr616:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st437;
 st437:
 	if ( ++p == pe )
 		goto _test_eof437;
 case 437:
-#line 9697 "inc/vcf/validator_detail_v42.hpp"
+#line 9675 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 114: goto tr617;
@@ -9704,14 +9682,14 @@ case 437:
 tr617:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st438;
 st438:
 	if ( ++p == pe )
 		goto _test_eof438;
 case 438:
-#line 9715 "inc/vcf/validator_detail_v42.hpp"
+#line 9693 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 101: goto tr618;
@@ -9722,14 +9700,14 @@ case 438:
 tr618:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st439;
 st439:
 	if ( ++p == pe )
 		goto _test_eof439;
 case 439:
-#line 9733 "inc/vcf/validator_detail_v42.hpp"
+#line 9711 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 101: goto tr619;
@@ -9740,14 +9718,14 @@ case 439:
 tr619:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st440;
 st440:
 	if ( ++p == pe )
 		goto _test_eof440;
 case 440:
-#line 9751 "inc/vcf/validator_detail_v42.hpp"
+#line 9729 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 68: goto tr620;
@@ -9758,14 +9736,14 @@ case 440:
 tr620:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st441;
 st441:
 	if ( ++p == pe )
 		goto _test_eof441;
 case 441:
-#line 9769 "inc/vcf/validator_detail_v42.hpp"
+#line 9747 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 61: goto tr41;
 		case 66: goto st442;
@@ -9783,7 +9761,7 @@ case 442:
 		goto tr40;
 	goto tr612;
 tr622:
-#line 136 "src/vcf/vcf.ragel"
+#line 135 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "pedigreeDB");
     }
@@ -9792,7 +9770,7 @@ st443:
 	if ( ++p == pe )
 		goto _test_eof443;
 case 443:
-#line 9796 "inc/vcf/validator_detail_v42.hpp"
+#line 9774 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 60 )
 		goto st444;
 	goto tr612;
@@ -9816,7 +9794,7 @@ st445:
 	if ( ++p == pe )
 		goto _test_eof445;
 case 445:
-#line 9820 "inc/vcf/validator_detail_v42.hpp"
+#line 9798 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr624;
 		case 13: goto tr627;
@@ -9832,17 +9810,13 @@ tr627:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st446;
 st446:
 	if ( ++p == pe )
 		goto _test_eof446;
 case 446:
-#line 9846 "inc/vcf/validator_detail_v42.hpp"
+#line 9820 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr624;
 		case 13: goto tr627;
@@ -9930,7 +9904,7 @@ case 455:
 tr632:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st456;
 tr641:
@@ -9939,21 +9913,17 @@ tr641:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st456;
 st456:
 	if ( ++p == pe )
 		goto _test_eof456;
 case 456:
-#line 9957 "inc/vcf/validator_detail_v42.hpp"
+#line 9927 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr624;
 		case 13: goto tr641;
@@ -9963,7 +9933,7 @@ case 456:
 tr642:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -9974,7 +9944,7 @@ st457:
 	if ( ++p == pe )
 		goto _test_eof457;
 case 457:
-#line 9978 "inc/vcf/validator_detail_v42.hpp"
+#line 9948 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr55;
 		case 13: goto tr643;
@@ -9987,16 +9957,12 @@ tr643:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -10009,7 +9975,7 @@ st458:
 	if ( ++p == pe )
 		goto _test_eof458;
 case 458:
-#line 10013 "inc/vcf/validator_detail_v42.hpp"
+#line 9979 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto st28;
 		case 13: goto tr641;
@@ -10100,7 +10066,7 @@ case 469:
 		goto tr652;
 	goto tr647;
 tr652:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10109,7 +10075,7 @@ st470:
 	if ( ++p == pe )
 		goto _test_eof470;
 case 470:
-#line 10113 "inc/vcf/validator_detail_v42.hpp"
+#line 10079 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 80 )
 		goto st471;
 	goto tr647;
@@ -10135,7 +10101,7 @@ case 473:
 		goto tr656;
 	goto tr647;
 tr656:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10144,7 +10110,7 @@ st474:
 	if ( ++p == pe )
 		goto _test_eof474;
 case 474:
-#line 10148 "inc/vcf/validator_detail_v42.hpp"
+#line 10114 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 73 )
 		goto st475;
 	goto tr647;
@@ -10163,7 +10129,7 @@ case 476:
 		goto tr659;
 	goto tr647;
 tr659:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10172,7 +10138,7 @@ st477:
 	if ( ++p == pe )
 		goto _test_eof477;
 case 477:
-#line 10176 "inc/vcf/validator_detail_v42.hpp"
+#line 10142 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 82 )
 		goto st478;
 	goto tr647;
@@ -10198,7 +10164,7 @@ case 480:
 		goto tr663;
 	goto tr647;
 tr663:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10207,7 +10173,7 @@ st481:
 	if ( ++p == pe )
 		goto _test_eof481;
 case 481:
-#line 10211 "inc/vcf/validator_detail_v42.hpp"
+#line 10177 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 65 )
 		goto st482;
 	goto tr647;
@@ -10233,7 +10199,7 @@ case 484:
 		goto tr667;
 	goto tr647;
 tr667:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10242,7 +10208,7 @@ st485:
 	if ( ++p == pe )
 		goto _test_eof485;
 case 485:
-#line 10246 "inc/vcf/validator_detail_v42.hpp"
+#line 10212 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 81 )
 		goto st486;
 	goto tr647;
@@ -10275,7 +10241,7 @@ case 489:
 		goto tr672;
 	goto tr647;
 tr672:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10284,7 +10250,7 @@ st490:
 	if ( ++p == pe )
 		goto _test_eof490;
 case 490:
-#line 10288 "inc/vcf/validator_detail_v42.hpp"
+#line 10254 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 70 )
 		goto st491;
 	goto tr647;
@@ -10331,7 +10297,7 @@ case 496:
 		goto tr679;
 	goto tr647;
 tr679:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10340,7 +10306,7 @@ st497:
 	if ( ++p == pe )
 		goto _test_eof497;
 case 497:
-#line 10344 "inc/vcf/validator_detail_v42.hpp"
+#line 10310 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 73 )
 		goto st498;
 	goto tr647;
@@ -10376,7 +10342,7 @@ case 501:
 	}
 	goto tr647;
 tr684:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10385,7 +10351,7 @@ st502:
 	if ( ++p == pe )
 		goto _test_eof502;
 case 502:
-#line 10389 "inc/vcf/validator_detail_v42.hpp"
+#line 10355 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 70 )
 		goto st503;
 	goto tr687;
@@ -10432,17 +10398,17 @@ case 508:
 		goto tr694;
 	goto tr687;
 tr694:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
 	goto st509;
 tr696:
-#line 204 "src/vcf/vcf.ragel"
+#line 203 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10451,7 +10417,7 @@ st509:
 	if ( ++p == pe )
 		goto _test_eof509;
 case 509:
-#line 10455 "inc/vcf/validator_detail_v42.hpp"
+#line 10421 "inc/vcf/validator_detail_v42.hpp"
 	if ( 32 <= (*p) && (*p) <= 126 )
 		goto tr695;
 	goto tr687;
@@ -10462,20 +10428,20 @@ tr695:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st510;
 tr699:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st510;
 st510:
 	if ( ++p == pe )
 		goto _test_eof510;
 case 510:
-#line 10479 "inc/vcf/validator_detail_v42.hpp"
+#line 10445 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr696;
 		case 10: goto tr697;
@@ -10485,7 +10451,7 @@ case 510:
 		goto tr699;
 	goto tr687;
 tr685:
-#line 208 "src/vcf/vcf.ragel"
+#line 207 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
@@ -10494,18 +10460,14 @@ tr685:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st593;
 tr697:
-#line 204 "src/vcf/vcf.ragel"
+#line 203 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 208 "src/vcf/vcf.ragel"
+#line 207 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
@@ -10514,17 +10476,13 @@ tr697:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st593;
 st593:
 	if ( ++p == pe )
 		goto _test_eof593;
 case 593:
-#line 10528 "inc/vcf/validator_detail_v42.hpp"
+#line 10486 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr821;
 		case 13: goto tr822;
@@ -10545,14 +10503,10 @@ tr825:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st594;
 tr821:
-#line 70 "src/vcf/vcf.ragel"
+#line 69 "src/vcf/vcf.ragel"
 	{
         try {
           OptionalPolicy::optional_check_meta_section(*this);
@@ -10565,17 +10519,13 @@ tr821:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st594;
 st594:
 	if ( ++p == pe )
 		goto _test_eof594;
 case 594:
-#line 10579 "inc/vcf/validator_detail_v42.hpp"
+#line 10529 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr825;
 		case 13: goto tr826;
@@ -10587,14 +10537,10 @@ tr826:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st511;
 tr822:
-#line 70 "src/vcf/vcf.ragel"
+#line 69 "src/vcf/vcf.ragel"
 	{
         try {
           OptionalPolicy::optional_check_meta_section(*this);
@@ -10607,17 +10553,13 @@ tr822:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st511;
 st511:
 	if ( ++p == pe )
 		goto _test_eof511;
 case 511:
-#line 10621 "inc/vcf/validator_detail_v42.hpp"
+#line 10563 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 10 )
 		goto st594;
 	goto st0;
@@ -10628,17 +10570,17 @@ tr832:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st512;
 tr704:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st512;
 tr823:
-#line 70 "src/vcf/vcf.ragel"
+#line 69 "src/vcf/vcf.ragel"
 	{
         try {
           OptionalPolicy::optional_check_meta_section(*this);
@@ -10652,14 +10594,14 @@ tr823:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st512;
 st512:
 	if ( ++p == pe )
 		goto _test_eof512;
 case 512:
-#line 10663 "inc/vcf/validator_detail_v42.hpp"
+#line 10605 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr703;
 		case 59: goto tr704;
@@ -10679,21 +10621,21 @@ tr703:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
 	goto st513;
 tr762:
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10702,7 +10644,7 @@ st513:
 	if ( ++p == pe )
 		goto _test_eof513;
 case 513:
-#line 10706 "inc/vcf/validator_detail_v42.hpp"
+#line 10648 "inc/vcf/validator_detail_v42.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr706;
 	goto tr705;
@@ -10713,20 +10655,20 @@ tr706:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st514;
 tr708:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st514;
 st514:
 	if ( ++p == pe )
 		goto _test_eof514;
 case 514:
-#line 10730 "inc/vcf/validator_detail_v42.hpp"
+#line 10672 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 9 )
 		goto tr707;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -10743,11 +10685,11 @@ tr707:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10756,7 +10698,7 @@ st515:
 	if ( ++p == pe )
 		goto _test_eof515;
 case 515:
-#line 10760 "inc/vcf/validator_detail_v42.hpp"
+#line 10702 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) > 58 ) {
 		if ( 60 <= (*p) && (*p) <= 126 )
 			goto tr710;
@@ -10770,20 +10712,20 @@ tr710:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st516;
 tr712:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st516;
 st516:
 	if ( ++p == pe )
 		goto _test_eof516;
 case 516:
-#line 10787 "inc/vcf/validator_detail_v42.hpp"
+#line 10729 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr711;
 		case 59: goto tr713;
@@ -10796,11 +10738,11 @@ tr711:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10809,7 +10751,7 @@ st517:
 	if ( ++p == pe )
 		goto _test_eof517;
 case 517:
-#line 10813 "inc/vcf/validator_detail_v42.hpp"
+#line 10755 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 65: goto tr715;
 		case 67: goto tr715;
@@ -10830,20 +10772,20 @@ tr715:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st518;
 tr717:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st518;
 st518:
 	if ( ++p == pe )
 		goto _test_eof518;
 case 518:
-#line 10847 "inc/vcf/validator_detail_v42.hpp"
+#line 10789 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr716;
 		case 65: goto tr717;
@@ -10863,11 +10805,11 @@ tr716:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10876,7 +10818,7 @@ st519:
 	if ( ++p == pe )
 		goto _test_eof519;
 case 519:
-#line 10880 "inc/vcf/validator_detail_v42.hpp"
+#line 10822 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 42: goto tr719;
 		case 46: goto tr720;
@@ -10902,20 +10844,20 @@ tr719:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st520;
 tr783:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st520;
 st520:
 	if ( ++p == pe )
 		goto _test_eof520;
 case 520:
-#line 10919 "inc/vcf/validator_detail_v42.hpp"
+#line 10861 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr725;
 		case 44: goto tr726;
@@ -10926,11 +10868,11 @@ tr725:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -10939,7 +10881,7 @@ st521:
 	if ( ++p == pe )
 		goto _test_eof521;
 case 521:
-#line 10943 "inc/vcf/validator_detail_v42.hpp"
+#line 10885 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 43: goto tr728;
 		case 45: goto tr728;
@@ -10957,14 +10899,14 @@ tr728:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st522;
 st522:
 	if ( ++p == pe )
 		goto _test_eof522;
 case 522:
-#line 10968 "inc/vcf/validator_detail_v42.hpp"
+#line 10910 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 73 )
 		goto tr734;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -10977,20 +10919,20 @@ tr730:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st523;
 tr733:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st523;
 st523:
 	if ( ++p == pe )
 		goto _test_eof523;
 case 523:
-#line 10994 "inc/vcf/validator_detail_v42.hpp"
+#line 10936 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr735;
 		case 46: goto tr736;
@@ -11005,11 +10947,11 @@ tr735:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11018,7 +10960,7 @@ st524:
 	if ( ++p == pe )
 		goto _test_eof524;
 case 524:
-#line 11022 "inc/vcf/validator_detail_v42.hpp"
+#line 10964 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 46: goto tr740;
 		case 58: goto tr739;
@@ -11054,7 +10996,7 @@ st525:
 	if ( ++p == pe )
 		goto _test_eof525;
 case 525:
-#line 11058 "inc/vcf/validator_detail_v42.hpp"
+#line 11000 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 58 )
 		goto st525;
 	if ( (*p) < 65 ) {
@@ -11085,20 +11027,20 @@ tr741:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st526;
 tr743:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st526;
 st526:
 	if ( ++p == pe )
 		goto _test_eof526;
 case 526:
-#line 11102 "inc/vcf/validator_detail_v42.hpp"
+#line 11044 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr744;
 		case 59: goto tr745;
@@ -11111,11 +11053,11 @@ tr744:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11124,7 +11066,7 @@ st527:
 	if ( ++p == pe )
 		goto _test_eof527;
 case 527:
-#line 11128 "inc/vcf/validator_detail_v42.hpp"
+#line 11070 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 46: goto tr747;
 		case 49: goto tr748;
@@ -11143,14 +11085,14 @@ tr747:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st595;
 st595:
 	if ( ++p == pe )
 		goto _test_eof595;
 case 595:
-#line 11154 "inc/vcf/validator_detail_v42.hpp"
+#line 11096 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr828;
 		case 10: goto tr829;
@@ -11168,11 +11110,11 @@ tr828:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11181,7 +11123,7 @@ st528:
 	if ( ++p == pe )
 		goto _test_eof528;
 case 528:
-#line 11185 "inc/vcf/validator_detail_v42.hpp"
+#line 11127 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr751;
@@ -11198,20 +11140,20 @@ tr751:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st529;
 tr753:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st529;
 st529:
 	if ( ++p == pe )
 		goto _test_eof529;
 case 529:
-#line 11215 "inc/vcf/validator_detail_v42.hpp"
+#line 11157 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr752;
 		case 58: goto tr754;
@@ -11230,11 +11172,11 @@ tr752:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11243,7 +11185,7 @@ st530:
 	if ( ++p == pe )
 		goto _test_eof530;
 case 530:
-#line 11247 "inc/vcf/validator_detail_v42.hpp"
+#line 11189 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 46 )
 		goto tr757;
 	if ( (*p) < 48 ) {
@@ -11262,20 +11204,27 @@ tr756:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st596;
 tr766:
+#line 478 "src/vcf/vcf.ragel"
+	{
+        {p = ((ParsePolicy::handle_long_value(*this, structural_index, p,
+                ebi::util::StructuralIndex::colon | ebi::util::StructuralIndex::tab |
+                ebi::util::StructuralIndex::newline | ebi::util::StructuralIndex::space |
+                ebi::util::StructuralIndex::control)))-1;}
+    }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st596;
 st596:
 	if ( ++p == pe )
 		goto _test_eof596;
 case 596:
-#line 11279 "inc/vcf/validator_detail_v42.hpp"
+#line 11228 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr752;
 		case 10: goto tr829;
@@ -11290,16 +11239,22 @@ tr829:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 217 "src/vcf/vcf.ragel"
 	{
+        ++n_records;
         try {
             // Handle all columns and build record
             ParsePolicy::handle_body_line(*this);
 
+            // A record with errors is not kept, but all of them are reported
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
+
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
                 for(auto &error_ptr : duplicated_errors) {
@@ -11324,17 +11279,13 @@ tr829:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st597;
 st597:
 	if ( ++p == pe )
 		goto _test_eof597;
 case 597:
-#line 11338 "inc/vcf/validator_detail_v42.hpp"
+#line 11289 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr825;
 		case 13: goto tr826;
@@ -11350,7 +11301,7 @@ case 597:
 		goto tr832;
 	goto tr702;
 tr824:
-#line 70 "src/vcf/vcf.ragel"
+#line 69 "src/vcf/vcf.ragel"
 	{
         try {
           OptionalPolicy::optional_check_meta_section(*this);
@@ -11363,7 +11314,7 @@ st531:
 	if ( ++p == pe )
 		goto _test_eof531;
 case 531:
-#line 11367 "inc/vcf/validator_detail_v42.hpp"
+#line 11318 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr759;
@@ -11380,20 +11331,20 @@ tr759:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st532;
 tr760:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st532;
 st532:
 	if ( ++p == pe )
 		goto _test_eof532;
 case 532:
-#line 11397 "inc/vcf/validator_detail_v42.hpp"
+#line 11348 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 59: goto tr760;
 		case 62: goto tr761;
@@ -11417,7 +11368,7 @@ st533:
 	if ( ++p == pe )
 		goto _test_eof533;
 case 533:
-#line 11421 "inc/vcf/validator_detail_v42.hpp"
+#line 11372 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 9 )
 		goto tr762;
 	goto tr702;
@@ -11426,16 +11377,22 @@ tr830:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 217 "src/vcf/vcf.ragel"
 	{
+        ++n_records;
         try {
             // Handle all columns and build record
             ParsePolicy::handle_body_line(*this);
 
+            // A record with errors is not kept, but all of them are reported
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
+
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
                 for(auto &error_ptr : duplicated_errors) {
@@ -11460,31 +11417,27 @@ tr830:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st534;
 st534:
 	if ( ++p == pe )
 		goto _test_eof534;
 case 534:
-#line 11474 "inc/vcf/validator_detail_v42.hpp"
+#line 11427 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 10 )
 		goto st597;
 	goto tr763;
 tr831:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st535;
 st535:
 	if ( ++p == pe )
 		goto _test_eof535;
 case 535:
-#line 11488 "inc/vcf/validator_detail_v42.hpp"
+#line 11441 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) > 57 ) {
 		if ( 59 <= (*p) && (*p) <= 126 )
 			goto tr766;
@@ -11498,20 +11451,20 @@ tr757:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st598;
 tr835:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st598;
 st598:
 	if ( ++p == pe )
 		goto _test_eof598;
 case 598:
-#line 11515 "inc/vcf/validator_detail_v42.hpp"
+#line 11468 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr752;
 		case 10: goto tr829;
@@ -11526,14 +11479,14 @@ case 598:
 tr834:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st599;
 st599:
 	if ( ++p == pe )
 		goto _test_eof599;
 case 599:
-#line 11537 "inc/vcf/validator_detail_v42.hpp"
+#line 11490 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr752;
 		case 10: goto tr829;
@@ -11557,20 +11510,20 @@ tr758:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st600;
 tr836:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st600;
 st600:
 	if ( ++p == pe )
 		goto _test_eof600;
 case 600:
-#line 11574 "inc/vcf/validator_detail_v42.hpp"
+#line 11527 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr752;
 		case 10: goto tr829;
@@ -11595,70 +11548,70 @@ tr748:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st536;
 st536:
 	if ( ++p == pe )
 		goto _test_eof536;
 case 536:
-#line 11606 "inc/vcf/validator_detail_v42.hpp"
+#line 11559 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 48 )
 		goto tr767;
 	goto tr746;
 tr767:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st537;
 st537:
 	if ( ++p == pe )
 		goto _test_eof537;
 case 537:
-#line 11620 "inc/vcf/validator_detail_v42.hpp"
+#line 11573 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 48 )
 		goto tr768;
 	goto tr746;
 tr768:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st538;
 st538:
 	if ( ++p == pe )
 		goto _test_eof538;
 case 538:
-#line 11634 "inc/vcf/validator_detail_v42.hpp"
+#line 11587 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 48 )
 		goto tr769;
 	goto tr746;
 tr769:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st539;
 st539:
 	if ( ++p == pe )
 		goto _test_eof539;
 case 539:
-#line 11648 "inc/vcf/validator_detail_v42.hpp"
+#line 11601 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 71 )
 		goto tr770;
 	goto tr746;
 tr770:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st601;
 st601:
 	if ( ++p == pe )
 		goto _test_eof601;
 case 601:
-#line 11662 "inc/vcf/validator_detail_v42.hpp"
+#line 11615 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr828;
 		case 10: goto tr829;
@@ -11677,7 +11630,7 @@ st540:
 	if ( ++p == pe )
 		goto _test_eof540;
 case 540:
-#line 11681 "inc/vcf/validator_detail_v42.hpp"
+#line 11634 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 49: goto tr748;
 		case 95: goto tr749;
@@ -11695,20 +11648,20 @@ tr749:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st602;
 tr839:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st602;
 st602:
 	if ( ++p == pe )
 		goto _test_eof602;
 case 602:
-#line 11712 "inc/vcf/validator_detail_v42.hpp"
+#line 11665 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr828;
 		case 10: goto tr829;
@@ -11730,14 +11683,14 @@ case 602:
 tr838:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st541;
 st541:
 	if ( ++p == pe )
 		goto _test_eof541;
 case 541:
-#line 11741 "inc/vcf/validator_detail_v42.hpp"
+#line 11694 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) > 58 ) {
 		if ( 60 <= (*p) && (*p) <= 126 )
 			goto tr772;
@@ -11745,16 +11698,23 @@ case 541:
 		goto tr772;
 	goto tr771;
 tr772:
+#line 60 "src/vcf/vcf_v42.ragel"
+	{
+        {p = ((ParsePolicy::handle_long_value(*this, structural_index, p,
+                ebi::util::StructuralIndex::semicolon | ebi::util::StructuralIndex::tab |
+                ebi::util::StructuralIndex::newline | ebi::util::StructuralIndex::space |
+                ebi::util::StructuralIndex::control)))-1;}
+    }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st603;
 st603:
 	if ( ++p == pe )
 		goto _test_eof603;
 case 603:
-#line 11758 "inc/vcf/validator_detail_v42.hpp"
+#line 11718 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr828;
 		case 10: goto tr829;
@@ -11774,7 +11734,7 @@ st542:
 	if ( ++p == pe )
 		goto _test_eof542;
 case 542:
-#line 11778 "inc/vcf/validator_detail_v42.hpp"
+#line 11738 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 58 )
 		goto tr739;
 	if ( (*p) < 65 ) {
@@ -11805,14 +11765,14 @@ tr740:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st543;
 st543:
 	if ( ++p == pe )
 		goto _test_eof543;
 case 543:
-#line 11816 "inc/vcf/validator_detail_v42.hpp"
+#line 11776 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr744;
 		case 58: goto st525;
@@ -11841,28 +11801,28 @@ case 543:
 tr736:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st544;
 st544:
 	if ( ++p == pe )
 		goto _test_eof544;
 case 544:
-#line 11852 "inc/vcf/validator_detail_v42.hpp"
+#line 11812 "inc/vcf/validator_detail_v42.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr773;
 	goto tr727;
 tr773:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st545;
 st545:
 	if ( ++p == pe )
 		goto _test_eof545;
 case 545:
-#line 11866 "inc/vcf/validator_detail_v42.hpp"
+#line 11826 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr735;
 		case 69: goto tr737;
@@ -11874,14 +11834,14 @@ case 545:
 tr737:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st546;
 st546:
 	if ( ++p == pe )
 		goto _test_eof546;
 case 546:
-#line 11885 "inc/vcf/validator_detail_v42.hpp"
+#line 11845 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 43: goto tr774;
 		case 45: goto tr774;
@@ -11892,28 +11852,28 @@ case 546:
 tr774:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st547;
 st547:
 	if ( ++p == pe )
 		goto _test_eof547;
 case 547:
-#line 11903 "inc/vcf/validator_detail_v42.hpp"
+#line 11863 "inc/vcf/validator_detail_v42.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr775;
 	goto tr727;
 tr775:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st548;
 st548:
 	if ( ++p == pe )
 		goto _test_eof548;
 case 548:
-#line 11917 "inc/vcf/validator_detail_v42.hpp"
+#line 11877 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 9 )
 		goto tr735;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -11926,34 +11886,34 @@ tr731:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st549;
 tr734:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st549;
 st549:
 	if ( ++p == pe )
 		goto _test_eof549;
 case 549:
-#line 11943 "inc/vcf/validator_detail_v42.hpp"
+#line 11903 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 110 )
 		goto tr776;
 	goto tr727;
 tr776:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st550;
 st550:
 	if ( ++p == pe )
 		goto _test_eof550;
 case 550:
-#line 11957 "inc/vcf/validator_detail_v42.hpp"
+#line 11917 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 102 )
 		goto tr777;
 	goto tr727;
@@ -11964,20 +11924,20 @@ tr729:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st551;
 tr777:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st551;
 st551:
 	if ( ++p == pe )
 		goto _test_eof551;
 case 551:
-#line 11981 "inc/vcf/validator_detail_v42.hpp"
+#line 11941 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 9 )
 		goto tr735;
 	goto tr727;
@@ -11988,28 +11948,28 @@ tr732:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st552;
 st552:
 	if ( ++p == pe )
 		goto _test_eof552;
 case 552:
-#line 11999 "inc/vcf/validator_detail_v42.hpp"
+#line 11959 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 97 )
 		goto tr778;
 	goto tr727;
 tr778:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st553;
 st553:
 	if ( ++p == pe )
 		goto _test_eof553;
 case 553:
-#line 12013 "inc/vcf/validator_detail_v42.hpp"
+#line 11973 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 78 )
 		goto tr777;
 	goto tr727;
@@ -12023,7 +11983,7 @@ st554:
 	if ( ++p == pe )
 		goto _test_eof554;
 case 554:
-#line 12027 "inc/vcf/validator_detail_v42.hpp"
+#line 11987 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 42: goto tr719;
 		case 46: goto tr779;
@@ -12049,20 +12009,20 @@ tr779:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st555;
 tr803:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st555;
 st555:
 	if ( ++p == pe )
 		goto _test_eof555;
 case 555:
-#line 12066 "inc/vcf/validator_detail_v42.hpp"
+#line 12026 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 65: goto tr780;
 		case 67: goto tr780;
@@ -12079,14 +12039,14 @@ case 555:
 tr780:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st556;
 st556:
 	if ( ++p == pe )
 		goto _test_eof556;
 case 556:
-#line 12090 "inc/vcf/validator_detail_v42.hpp"
+#line 12050 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr725;
 		case 44: goto tr726;
@@ -12109,20 +12069,20 @@ tr721:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st557;
 tr781:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st557;
 st557:
 	if ( ++p == pe )
 		goto _test_eof557;
 case 557:
-#line 12126 "inc/vcf/validator_detail_v42.hpp"
+#line 12086 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 61 )
 		goto tr781;
 	if ( (*p) < 63 ) {
@@ -12155,14 +12115,14 @@ case 557:
 tr782:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st558;
 st558:
 	if ( ++p == pe )
 		goto _test_eof558;
 case 558:
-#line 12166 "inc/vcf/validator_detail_v42.hpp"
+#line 12126 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 62 )
 		goto tr783;
 	if ( (*p) < 45 ) {
@@ -12181,20 +12141,20 @@ tr722:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st559;
 tr784:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st559;
 st559:
 	if ( ++p == pe )
 		goto _test_eof559;
 case 559:
-#line 12198 "inc/vcf/validator_detail_v42.hpp"
+#line 12158 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr725;
 		case 44: goto tr726;
@@ -12216,14 +12176,14 @@ case 559:
 tr785:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st560;
 st560:
 	if ( ++p == pe )
 		goto _test_eof560;
 case 560:
-#line 12227 "inc/vcf/validator_detail_v42.hpp"
+#line 12187 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 60 )
 		goto tr788;
 	if ( (*p) < 65 ) {
@@ -12238,14 +12198,14 @@ case 560:
 tr787:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st561;
 st561:
 	if ( ++p == pe )
 		goto _test_eof561;
 case 561:
-#line 12249 "inc/vcf/validator_detail_v42.hpp"
+#line 12209 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 58: goto tr789;
 		case 61: goto tr787;
@@ -12262,28 +12222,28 @@ case 561:
 tr789:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st562;
 st562:
 	if ( ++p == pe )
 		goto _test_eof562;
 case 562:
-#line 12273 "inc/vcf/validator_detail_v42.hpp"
+#line 12233 "inc/vcf/validator_detail_v42.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr790;
 	goto tr718;
 tr790:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st563;
 st563:
 	if ( ++p == pe )
 		goto _test_eof563;
 case 563:
-#line 12287 "inc/vcf/validator_detail_v42.hpp"
+#line 12247 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 91 )
 		goto tr783;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -12292,14 +12252,14 @@ case 563:
 tr788:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st564;
 st564:
 	if ( ++p == pe )
 		goto _test_eof564;
 case 564:
-#line 12303 "inc/vcf/validator_detail_v42.hpp"
+#line 12263 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr791;
@@ -12312,14 +12272,14 @@ case 564:
 tr791:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st565;
 st565:
 	if ( ++p == pe )
 		goto _test_eof565;
 case 565:
-#line 12323 "inc/vcf/validator_detail_v42.hpp"
+#line 12283 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 59: goto tr791;
 		case 62: goto tr792;
@@ -12336,28 +12296,28 @@ case 565:
 tr792:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st566;
 st566:
 	if ( ++p == pe )
 		goto _test_eof566;
 case 566:
-#line 12347 "inc/vcf/validator_detail_v42.hpp"
+#line 12307 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 58 )
 		goto tr789;
 	goto tr718;
 tr786:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st567;
 st567:
 	if ( ++p == pe )
 		goto _test_eof567;
 case 567:
-#line 12361 "inc/vcf/validator_detail_v42.hpp"
+#line 12321 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 60 )
 		goto tr794;
 	if ( (*p) < 65 ) {
@@ -12372,14 +12332,14 @@ case 567:
 tr793:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st568;
 st568:
 	if ( ++p == pe )
 		goto _test_eof568;
 case 568:
-#line 12383 "inc/vcf/validator_detail_v42.hpp"
+#line 12343 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 58: goto tr795;
 		case 61: goto tr793;
@@ -12396,28 +12356,28 @@ case 568:
 tr795:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st569;
 st569:
 	if ( ++p == pe )
 		goto _test_eof569;
 case 569:
-#line 12407 "inc/vcf/validator_detail_v42.hpp"
+#line 12367 "inc/vcf/validator_detail_v42.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr796;
 	goto tr718;
 tr796:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st570;
 st570:
 	if ( ++p == pe )
 		goto _test_eof570;
 case 570:
-#line 12421 "inc/vcf/validator_detail_v42.hpp"
+#line 12381 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 93 )
 		goto tr783;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -12426,14 +12386,14 @@ case 570:
 tr794:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st571;
 st571:
 	if ( ++p == pe )
 		goto _test_eof571;
 case 571:
-#line 12437 "inc/vcf/validator_detail_v42.hpp"
+#line 12397 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr797;
@@ -12446,14 +12406,14 @@ case 571:
 tr797:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st572;
 st572:
 	if ( ++p == pe )
 		goto _test_eof572;
 case 572:
-#line 12457 "inc/vcf/validator_detail_v42.hpp"
+#line 12417 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 59: goto tr797;
 		case 62: goto tr798;
@@ -12470,14 +12430,14 @@ case 572:
 tr798:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st573;
 st573:
 	if ( ++p == pe )
 		goto _test_eof573;
 case 573:
-#line 12481 "inc/vcf/validator_detail_v42.hpp"
+#line 12441 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 58 )
 		goto tr795;
 	goto tr718;
@@ -12488,14 +12448,14 @@ tr723:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st574;
 st574:
 	if ( ++p == pe )
 		goto _test_eof574;
 case 574:
-#line 12499 "inc/vcf/validator_detail_v42.hpp"
+#line 12459 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 60 )
 		goto tr800;
 	if ( (*p) < 65 ) {
@@ -12510,14 +12470,14 @@ case 574:
 tr799:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st575;
 st575:
 	if ( ++p == pe )
 		goto _test_eof575;
 case 575:
-#line 12521 "inc/vcf/validator_detail_v42.hpp"
+#line 12481 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 58: goto tr801;
 		case 61: goto tr799;
@@ -12534,28 +12494,28 @@ case 575:
 tr801:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st576;
 st576:
 	if ( ++p == pe )
 		goto _test_eof576;
 case 576:
-#line 12545 "inc/vcf/validator_detail_v42.hpp"
+#line 12505 "inc/vcf/validator_detail_v42.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr802;
 	goto tr718;
 tr802:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st577;
 st577:
 	if ( ++p == pe )
 		goto _test_eof577;
 case 577:
-#line 12559 "inc/vcf/validator_detail_v42.hpp"
+#line 12519 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 91 )
 		goto tr803;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -12564,14 +12524,14 @@ case 577:
 tr800:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st578;
 st578:
 	if ( ++p == pe )
 		goto _test_eof578;
 case 578:
-#line 12575 "inc/vcf/validator_detail_v42.hpp"
+#line 12535 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr804;
@@ -12584,14 +12544,14 @@ case 578:
 tr804:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st579;
 st579:
 	if ( ++p == pe )
 		goto _test_eof579;
 case 579:
-#line 12595 "inc/vcf/validator_detail_v42.hpp"
+#line 12555 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 59: goto tr804;
 		case 62: goto tr805;
@@ -12608,14 +12568,14 @@ case 579:
 tr805:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st580;
 st580:
 	if ( ++p == pe )
 		goto _test_eof580;
 case 580:
-#line 12619 "inc/vcf/validator_detail_v42.hpp"
+#line 12579 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 58 )
 		goto tr801;
 	goto tr718;
@@ -12626,14 +12586,14 @@ tr724:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st581;
 st581:
 	if ( ++p == pe )
 		goto _test_eof581;
 case 581:
-#line 12637 "inc/vcf/validator_detail_v42.hpp"
+#line 12597 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 60 )
 		goto tr807;
 	if ( (*p) < 65 ) {
@@ -12648,14 +12608,14 @@ case 581:
 tr806:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st582;
 st582:
 	if ( ++p == pe )
 		goto _test_eof582;
 case 582:
-#line 12659 "inc/vcf/validator_detail_v42.hpp"
+#line 12619 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 58: goto tr808;
 		case 61: goto tr806;
@@ -12672,28 +12632,28 @@ case 582:
 tr808:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st583;
 st583:
 	if ( ++p == pe )
 		goto _test_eof583;
 case 583:
-#line 12683 "inc/vcf/validator_detail_v42.hpp"
+#line 12643 "inc/vcf/validator_detail_v42.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr809;
 	goto tr718;
 tr809:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st584;
 st584:
 	if ( ++p == pe )
 		goto _test_eof584;
 case 584:
-#line 12697 "inc/vcf/validator_detail_v42.hpp"
+#line 12657 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 93 )
 		goto tr803;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -12702,14 +12662,14 @@ case 584:
 tr807:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st585;
 st585:
 	if ( ++p == pe )
 		goto _test_eof585;
 case 585:
-#line 12713 "inc/vcf/validator_detail_v42.hpp"
+#line 12673 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) < 65 ) {
 		if ( 48 <= (*p) && (*p) <= 57 )
 			goto tr810;
@@ -12722,14 +12682,14 @@ case 585:
 tr810:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st586;
 st586:
 	if ( ++p == pe )
 		goto _test_eof586;
 case 586:
-#line 12733 "inc/vcf/validator_detail_v42.hpp"
+#line 12693 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 59: goto tr810;
 		case 62: goto tr811;
@@ -12746,14 +12706,14 @@ case 586:
 tr811:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st587;
 st587:
 	if ( ++p == pe )
 		goto _test_eof587;
 case 587:
-#line 12757 "inc/vcf/validator_detail_v42.hpp"
+#line 12717 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 58 )
 		goto tr808;
 	goto tr718;
@@ -12764,14 +12724,14 @@ tr720:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st588;
 st588:
 	if ( ++p == pe )
 		goto _test_eof588;
 case 588:
-#line 12775 "inc/vcf/validator_detail_v42.hpp"
+#line 12735 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 9: goto tr725;
 		case 65: goto tr780;
@@ -12787,7 +12747,7 @@ case 588:
 	}
 	goto tr718;
 tr686:
-#line 208 "src/vcf/vcf.ragel"
+#line 207 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
@@ -12796,18 +12756,14 @@ tr686:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st589;
 tr698:
-#line 204 "src/vcf/vcf.ragel"
+#line 203 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 208 "src/vcf/vcf.ragel"
+#line 207 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
@@ -12816,28 +12772,24 @@ tr698:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st589;
 st589:
 	if ( ++p == pe )
 		goto _test_eof589;
 case 589:
-#line 12830 "inc/vcf/validator_detail_v42.hpp"
+#line 12782 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 10 )
 		goto st593;
 	goto tr687;
 tr23:
-#line 99 "src/vcf/vcf.ragel"
+#line 98 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_fileformat(*this);
         } catch (Error *error) {
           ErrorPolicy::handle_error(*this, error);
-          p--; {goto st591;}
+          {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
         }
     }
 #line 43 "src/vcf/vcf.ragel"
@@ -12845,17 +12797,13 @@ tr23:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st590;
 st590:
 	if ( ++p == pe )
 		goto _test_eof590;
 case 590:
-#line 12859 "inc/vcf/validator_detail_v42.hpp"
+#line 12807 "inc/vcf/validator_detail_v42.hpp"
 	if ( (*p) == 10 )
 		goto st22;
 	goto tr0;
@@ -12865,17 +12813,13 @@ tr816:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st591;
 st591:
 	if ( ++p == pe )
 		goto _test_eof591;
 case 591:
-#line 12879 "inc/vcf/validator_detail_v42.hpp"
+#line 12823 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr815;
 		case 13: goto tr816;
@@ -12887,19 +12831,15 @@ tr815:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
-#line 231 "src/vcf/vcf_v42.ragel"
+#line 243 "src/vcf/vcf_v42.ragel"
 	{ {goto st28;} }
 	goto st604;
 st604:
 	if ( ++p == pe )
 		goto _test_eof604;
 case 604:
-#line 12903 "inc/vcf/validator_detail_v42.hpp"
+#line 12843 "inc/vcf/validator_detail_v42.hpp"
 	goto st0;
 tr819:
 #line 43 "src/vcf/vcf.ragel"
@@ -12907,17 +12847,13 @@ tr819:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st592;
 st592:
 	if ( ++p == pe )
 		goto _test_eof592;
 case 592:
-#line 12921 "inc/vcf/validator_detail_v42.hpp"
+#line 12857 "inc/vcf/validator_detail_v42.hpp"
 	switch( (*p) ) {
 		case 10: goto tr818;
 		case 13: goto tr819;
@@ -12929,19 +12865,15 @@ tr818:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
-#line 232 "src/vcf/vcf_v42.ragel"
-	{ {goto st597;} }
+#line 244 "src/vcf/vcf_v42.ragel"
+	{ ++n_records; {goto st597;} }
 	goto st605;
 st605:
 	if ( ++p == pe )
 		goto _test_eof605;
 case 605:
-#line 12945 "inc/vcf/validator_detail_v42.hpp"
+#line 12877 "inc/vcf/validator_detail_v42.hpp"
 	goto st0;
 	}
 	_test_eof2: cs = 2; goto _test_eof; 
@@ -13567,10 +13499,10 @@ case 605:
 	case 12: 
 	case 13: 
 	case 590: 
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 25: 
@@ -13621,14 +13553,14 @@ case 605:
 	case 71: 
 	case 72: 
 	case 73: 
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 593: 
-#line 70 "src/vcf/vcf.ragel"
+#line 69 "src/vcf/vcf.ragel"
 	{
         try {
           OptionalPolicy::optional_check_meta_section(*this);
@@ -13647,7 +13579,7 @@ case 605:
 	case 509: 
 	case 510: 
 	case 589: 
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -13658,14 +13590,14 @@ case 605:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 534: 
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 74: 
@@ -13690,15 +13622,15 @@ case 605:
 	case 96: 
 	case 103: 
 	case 114: 
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 375: 
@@ -13709,15 +13641,15 @@ case 605:
 	case 380: 
 	case 381: 
 	case 382: 
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 402: 
@@ -13749,15 +13681,15 @@ case 605:
 	case 430: 
 	case 431: 
 	case 432: 
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 123: 
@@ -13784,15 +13716,15 @@ case 605:
 	case 147: 
 	case 154: 
 	case 165: 
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 173: 
@@ -13831,15 +13763,15 @@ case 605:
 	case 213: 
 	case 220: 
 	case 231: 
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 240: 
@@ -13877,15 +13809,15 @@ case 605:
 	case 279: 
 	case 286: 
 	case 297: 
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 306: 
@@ -13898,15 +13830,15 @@ case 605:
 	case 313: 
 	case 314: 
 	case 321: 
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 433: 
@@ -13920,15 +13852,15 @@ case 605:
 	case 441: 
 	case 442: 
 	case 443: 
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 322: 
@@ -13942,15 +13874,15 @@ case 605:
 	case 330: 
 	case 331: 
 	case 371: 
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 465: 
@@ -13990,7 +13922,7 @@ case 605:
 	case 499: 
 	case 500: 
 	case 501: 
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -14002,9 +13934,9 @@ case 605:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -14015,61 +13947,61 @@ case 605:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 512: 
 	case 531: 
 	case 532: 
 	case 533: 
-#line 396 "src/vcf/vcf.ragel"
+#line 401 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 513: 
 	case 514: 
-#line 402 "src/vcf/vcf.ragel"
+#line 407 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 515: 
 	case 516: 
-#line 408 "src/vcf/vcf.ragel"
+#line 413 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 517: 
 	case 518: 
-#line 414 "src/vcf/vcf.ragel"
+#line 419 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 519: 
@@ -14109,15 +14041,15 @@ case 605:
 	case 586: 
 	case 587: 
 	case 588: 
-#line 420 "src/vcf/vcf.ragel"
+#line 425 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 521: 
@@ -14133,15 +14065,15 @@ case 605:
 	case 551: 
 	case 552: 
 	case 553: 
-#line 426 "src/vcf/vcf.ragel"
+#line 431 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 524: 
@@ -14149,29 +14081,29 @@ case 605:
 	case 526: 
 	case 542: 
 	case 543: 
-#line 432 "src/vcf/vcf.ragel"
+#line 437 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 535: 
-#line 454 "src/vcf/vcf.ragel"
+#line 459 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
         ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 14: 
@@ -14186,12 +14118,12 @@ case 605:
 	{
         ErrorPolicy::handle_error(*this,
                 new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.2'"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 528: 
@@ -14199,12 +14131,12 @@ case 605:
 #line 50 "src/vcf/vcf_v42.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 595: 
@@ -14219,16 +14151,22 @@ case 605:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 217 "src/vcf/vcf.ragel"
 	{
+        ++n_records;
         try {
             // Handle all columns and build record
             ParsePolicy::handle_body_line(*this);
 
+            // A record with errors is not kept, but all of them are reported
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
+
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
                 for(auto &error_ptr : duplicated_errors) {
@@ -14251,12 +14189,12 @@ case 605:
 	break;
 	case 23: 
 	case 28: 
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -14268,9 +14206,9 @@ case 605:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -14281,80 +14219,80 @@ case 605:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 81: 
 	case 82: 
 	case 83: 
-#line 252 "src/vcf/vcf.ragel"
+#line 257 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
             "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 122: 
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 199: 
 	case 200: 
-#line 293 "src/vcf/vcf.ragel"
+#line 298 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 265: 
 	case 266: 
-#line 293 "src/vcf/vcf.ragel"
+#line 298 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 335: 
@@ -14366,20 +14304,20 @@ case 605:
 	case 341: 
 	case 342: 
 	case 343: 
-#line 352 "src/vcf/vcf.ragel"
+#line 357 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 345: 
@@ -14391,57 +14329,57 @@ case 605:
 	case 351: 
 	case 352: 
 	case 353: 
-#line 357 "src/vcf/vcf.ragel"
+#line 362 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 100: 
 	case 101: 
 	case 102: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 412: 
 	case 413: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 132: 
@@ -14450,20 +14388,20 @@ case 605:
 	case 151: 
 	case 152: 
 	case 153: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 182: 
@@ -14472,20 +14410,20 @@ case 605:
 	case 217: 
 	case 218: 
 	case 219: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 248: 
@@ -14494,20 +14432,20 @@ case 605:
 	case 283: 
 	case 284: 
 	case 285: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 315: 
@@ -14516,38 +14454,38 @@ case 605:
 	case 318: 
 	case 319: 
 	case 320: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 332: 
 	case 333: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 97: 
@@ -14564,20 +14502,20 @@ case 605:
 	case 116: 
 	case 120: 
 	case 121: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 148: 
@@ -14594,20 +14532,20 @@ case 605:
 	case 167: 
 	case 171: 
 	case 172: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 214: 
@@ -14624,20 +14562,20 @@ case 605:
 	case 233: 
 	case 237: 
 	case 238: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 280: 
@@ -14654,20 +14592,20 @@ case 605:
 	case 299: 
 	case 303: 
 	case 304: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 355: 
@@ -14689,20 +14627,20 @@ case 605:
 	case 372: 
 	case 373: 
 	case 374: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 383: 
@@ -14724,20 +14662,20 @@ case 605:
 	case 399: 
 	case 400: 
 	case 401: 
-#line 373 "src/vcf/vcf.ragel"
+#line 378 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 444: 
@@ -14761,20 +14699,20 @@ case 605:
 	case 462: 
 	case 463: 
 	case 464: 
-#line 373 "src/vcf/vcf.ragel"
+#line 378 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 527: 
@@ -14783,58 +14721,58 @@ case 605:
 	case 538: 
 	case 539: 
 	case 540: 
-#line 443 "src/vcf/vcf.ragel"
+#line 448 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 443 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 541: 
-#line 448 "src/vcf/vcf.ragel"
+#line 453 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 443 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 530: 
-#line 461 "src/vcf/vcf.ragel"
+#line 466 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
         ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "GT"});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 459 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
         ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 192: 
@@ -14843,17 +14781,17 @@ case 605:
 #line 36 "src/vcf/vcf_v42.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, R, G or dot"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 258: 
@@ -14862,31 +14800,31 @@ case 605:
 #line 42 "src/vcf/vcf_v42.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, R, G or dot"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 22: 
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -14898,9 +14836,9 @@ case 605:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -14911,328 +14849,333 @@ case 605:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st592;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st592;}
     }
 	break;
 	case 344: 
-#line 352 "src/vcf/vcf.ragel"
+#line 357 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 357 "src/vcf/vcf.ragel"
+#line 362 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 354: 
-#line 357 "src/vcf/vcf.ragel"
+#line 362 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Mixture is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 334: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 352 "src/vcf/vcf.ragel"
+#line 357 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "SAMPLE metadata Genomes is not a valid string (maybe it contains quotes?)"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 108: 
 	case 109: 
 	case 110: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 159: 
 	case 160: 
 	case 161: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 225: 
 	case 226: 
 	case 227: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 291: 
 	case 292: 
 	case 293: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 117: 
 	case 118: 
 	case 119: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 168: 
 	case 169: 
 	case 170: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 234: 
 	case 235: 
 	case 236: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 300: 
 	case 301: 
 	case 302: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
 	case 24: 
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st591;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st591;}
     }
 	break;
-#line 15228 "inc/vcf/validator_detail_v42.hpp"
+#line 15166 "inc/vcf/validator_detail_v42.hpp"
 	}
 	}
 
 	_out: {}
 	}
 
-#line 261 "src/vcf/vcf_v42.ragel"
+#line 279 "src/vcf/vcf_v42.ragel"
+
+      ParsePolicy::handle_buffer_end(*this, pe);
 
+      if (cs == vcf_v42_error) {
+          ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "Records are not allowed after an empty line"});
+      }
     }
    
   }
@@ -17,7 +17,7 @@
  */
 
 
-#line 259 "src/vcf/vcf_v43.ragel"
+#line 270 "src/vcf/vcf_v43.ragel"
 
 
 namespace
@@ -35,7 +35,7 @@ static const int vcf_v43_en_meta_section_skip = 657;
 static const int vcf_v43_en_body_section_skip = 658;
 
 
-#line 265 "src/vcf/vcf_v43.ragel"
+#line 276 "src/vcf/vcf_v43.ragel"
 
 }
 
@@ -54,15 +54,21 @@ namespace ebi
 	cs = vcf_v43_start;
 	}
 
-#line 279 "src/vcf/vcf_v43.ragel"
+#line 290 "src/vcf/vcf_v43.ragel"
 
     }
 
     template <typename Configuration>
     void ParserImpl_v43<Configuration>::parse_buffer(char const * p, char const * pe, char const * eof)
     {
+      if (cs == vcf_v43_error) {
+          // The state machine stopped at an error it can't recover from, so nothing else can be read
+          return;
+      }
+      ParsePolicy::handle_buffer_begin(*this, p);
+      structural_index.build(p, pe);
       
-#line 66 "inc/vcf/validator_detail_v43.hpp"
+#line 72 "inc/vcf/validator_detail_v43.hpp"
 	{
 	if ( p == pe )
 		goto _test_eof;
@@ -73,10 +79,10 @@ case 1:
 		goto st2;
 	goto tr0;
 tr0:
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr14:
@@ -84,26 +90,26 @@ tr14:
 	{
         ErrorPolicy::handle_error(*this,
                 new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.3'"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr24:
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -115,9 +121,9 @@ tr24:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -128,16 +134,16 @@ tr24:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr26:
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -149,9 +155,9 @@ tr26:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -162,814 +168,814 @@ tr26:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr29:
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 331 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr40:
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr126:
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr134:
-#line 252 "src/vcf/vcf.ragel"
+#line 257 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
             "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr153:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr162:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr176:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr188:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr194:
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr197:
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr207:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr226:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr248:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr260:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr266:
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr276:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr289:
 #line 36 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, R, G or dot"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr298:
-#line 293 "src/vcf/vcf.ragel"
+#line 298 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr315:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr337:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr349:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr356:
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr365:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr378:
 #line 42 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, R, G or dot"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr387:
-#line 293 "src/vcf/vcf.ragel"
+#line 298 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr404:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr426:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr438:
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr445:
-#line 326 "src/vcf/vcf.ragel"
+#line 331 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr454:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 331 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr467:
-#line 331 "src/vcf/vcf.ragel"
+#line 336 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Number is not a dot"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 331 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr475:
-#line 336 "src/vcf/vcf.ragel"
+#line 341 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Type is not String"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 331 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr492:
-#line 341 "src/vcf/vcf.ragel"
+#line 346 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Values is not a square-bracket delimited list of values"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 331 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr498:
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr511:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr517:
-#line 314 "src/vcf/vcf.ragel"
+#line 319 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata sequence of Name_N is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr527:
-#line 309 "src/vcf/vcf.ragel"
+#line 314 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata Father or Mother is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr564:
-#line 304 "src/vcf/vcf.ragel"
+#line 309 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata Original is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr569:
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr580:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr620:
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr629:
-#line 373 "src/vcf/vcf.ragel"
+#line 378 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr650:
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr661:
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr699:
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr711:
-#line 373 "src/vcf/vcf.ragel"
+#line 378 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	goto st0;
 tr734:
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -981,9 +987,9 @@ tr734:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -994,11 +1000,11 @@ tr734:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr774:
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -1009,183 +1015,183 @@ tr774:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr789:
-#line 396 "src/vcf/vcf.ragel"
+#line 401 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr792:
-#line 402 "src/vcf/vcf.ragel"
+#line 407 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr796:
-#line 408 "src/vcf/vcf.ragel"
+#line 413 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr801:
-#line 414 "src/vcf/vcf.ragel"
+#line 419 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr805:
-#line 420 "src/vcf/vcf.ragel"
+#line 425 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr814:
-#line 426 "src/vcf/vcf.ragel"
+#line 431 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr825:
-#line 432 "src/vcf/vcf.ragel"
+#line 437 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr833:
-#line 443 "src/vcf/vcf.ragel"
+#line 448 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 443 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr837:
 #line 50 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines, "Format does not start with a letter/underscore followed by alphanumeric/underscore/dot characters"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr842:
-#line 461 "src/vcf/vcf.ragel"
+#line 466 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
         ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "GT"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 459 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
         ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr850:
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr852:
-#line 454 "src/vcf/vcf.ragel"
+#line 459 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
         ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr858:
-#line 448 "src/vcf/vcf.ragel"
+#line 453 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 443 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr907:
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -1196,32 +1202,32 @@ tr907:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 396 "src/vcf/vcf.ragel"
+#line 401 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
 tr914:
-#line 438 "src/vcf/vcf.ragel"
+#line 443 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	goto st0;
-#line 1225 "inc/vcf/validator_detail_v43.hpp"
+#line 1231 "inc/vcf/validator_detail_v43.hpp"
 st0:
 cs = 0;
 	goto _out;
@@ -1323,111 +1329,111 @@ tr15:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st15;
 st15:
 	if ( ++p == pe )
 		goto _test_eof15;
 case 15:
-#line 1334 "inc/vcf/validator_detail_v43.hpp"
+#line 1340 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 67 )
 		goto tr16;
 	goto tr14;
 tr16:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st16;
 st16:
 	if ( ++p == pe )
 		goto _test_eof16;
 case 16:
-#line 1348 "inc/vcf/validator_detail_v43.hpp"
+#line 1354 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 70 )
 		goto tr17;
 	goto tr14;
 tr17:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st17;
 st17:
 	if ( ++p == pe )
 		goto _test_eof17;
 case 17:
-#line 1362 "inc/vcf/validator_detail_v43.hpp"
+#line 1368 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 118 )
 		goto tr18;
 	goto tr14;
 tr18:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st18;
 st18:
 	if ( ++p == pe )
 		goto _test_eof18;
 case 18:
-#line 1376 "inc/vcf/validator_detail_v43.hpp"
+#line 1382 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 52 )
 		goto tr19;
 	goto tr14;
 tr19:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st19;
 st19:
 	if ( ++p == pe )
 		goto _test_eof19;
 case 19:
-#line 1390 "inc/vcf/validator_detail_v43.hpp"
+#line 1396 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 46 )
 		goto tr20;
 	goto tr14;
 tr20:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st20;
 st20:
 	if ( ++p == pe )
 		goto _test_eof20;
 case 20:
-#line 1404 "inc/vcf/validator_detail_v43.hpp"
+#line 1410 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 51 )
 		goto tr21;
 	goto tr14;
 tr21:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st21;
 st21:
 	if ( ++p == pe )
 		goto _test_eof21;
 case 21:
-#line 1418 "inc/vcf/validator_detail_v43.hpp"
+#line 1424 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr22;
 		case 13: goto tr23;
 	}
 	goto tr14;
 tr22:
-#line 99 "src/vcf/vcf.ragel"
+#line 98 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_fileformat(*this);
         } catch (Error *error) {
           ErrorPolicy::handle_error(*this, error);
-          p--; {goto st657;}
+          {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
         }
     }
 #line 43 "src/vcf/vcf.ragel"
@@ -1435,17 +1441,13 @@ tr22:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st22;
 st22:
 	if ( ++p == pe )
 		goto _test_eof22;
 case 22:
-#line 1449 "inc/vcf/validator_detail_v43.hpp"
+#line 1451 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 35 )
 		goto st23;
 	goto tr24;
@@ -1486,27 +1488,27 @@ tr30:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st25;
 tr41:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st25;
 st25:
 	if ( ++p == pe )
 		goto _test_eof25;
 case 25:
-#line 1503 "inc/vcf/validator_detail_v43.hpp"
+#line 1505 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 61 )
 		goto tr42;
 	if ( 32 <= (*p) && (*p) <= 126 )
 		goto tr41;
 	goto tr40;
 tr42:
-#line 188 "src/vcf/vcf.ragel"
+#line 187 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this);
     }
@@ -1515,7 +1517,7 @@ st26:
 	if ( ++p == pe )
 		goto _test_eof26;
 case 26:
-#line 1519 "inc/vcf/validator_detail_v43.hpp"
+#line 1521 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto st30;
 		case 60: goto st35;
@@ -1530,20 +1532,20 @@ tr43:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st27;
 tr48:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st27;
 st27:
 	if ( ++p == pe )
 		goto _test_eof27;
 case 27:
-#line 1547 "inc/vcf/validator_detail_v43.hpp"
+#line 1549 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr46;
 		case 13: goto tr47;
@@ -1556,7 +1558,7 @@ tr46:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1569,14 +1571,10 @@ tr46:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st28;
 tr56:
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1589,17 +1587,13 @@ tr56:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st28;
 st28:
 	if ( ++p == pe )
 		goto _test_eof28;
 case 28:
-#line 1603 "inc/vcf/validator_detail_v43.hpp"
+#line 1597 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 35 )
 		goto st23;
 	goto tr26;
@@ -1608,7 +1602,7 @@ tr47:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1621,14 +1615,10 @@ tr47:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st29;
 tr57:
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -1641,17 +1631,13 @@ tr57:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st29;
 st29:
 	if ( ++p == pe )
 		goto _test_eof29;
 case 29:
-#line 1655 "inc/vcf/validator_detail_v43.hpp"
+#line 1641 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 10 )
 		goto st28;
 	goto tr40;
@@ -1673,20 +1659,20 @@ tr50:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st31;
 tr53:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st31;
 st31:
 	if ( ++p == pe )
 		goto _test_eof31;
 case 31:
-#line 1690 "inc/vcf/validator_detail_v43.hpp"
+#line 1676 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr54;
 		case 92: goto tr55;
@@ -1714,7 +1700,7 @@ st32:
 	if ( ++p == pe )
 		goto _test_eof32;
 case 32:
-#line 1718 "inc/vcf/validator_detail_v43.hpp"
+#line 1704 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -1727,20 +1713,20 @@ tr52:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st33;
 tr55:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st33;
 st33:
 	if ( ++p == pe )
 		goto _test_eof33;
 case 33:
-#line 1744 "inc/vcf/validator_detail_v43.hpp"
+#line 1730 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr58;
 		case 92: goto tr55;
@@ -1751,7 +1737,7 @@ case 33:
 tr58:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1762,7 +1748,7 @@ st34:
 	if ( ++p == pe )
 		goto _test_eof34;
 case 34:
-#line 1766 "inc/vcf/validator_detail_v43.hpp"
+#line 1752 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -1810,20 +1796,20 @@ tr62:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st37;
 tr65:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st37;
 st37:
 	if ( ++p == pe )
 		goto _test_eof37;
 case 37:
-#line 1827 "inc/vcf/validator_detail_v43.hpp"
+#line 1813 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr66;
 		case 92: goto tr67;
@@ -1851,7 +1837,7 @@ st38:
 	if ( ++p == pe )
 		goto _test_eof38;
 case 38:
-#line 1855 "inc/vcf/validator_detail_v43.hpp"
+#line 1841 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 62 )
 		goto st32;
 	goto tr40;
@@ -1862,20 +1848,20 @@ tr64:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st39;
 tr67:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st39;
 st39:
 	if ( ++p == pe )
 		goto _test_eof39;
 case 39:
-#line 1879 "inc/vcf/validator_detail_v43.hpp"
+#line 1865 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr69;
 		case 92: goto tr67;
@@ -1886,7 +1872,7 @@ case 39:
 tr69:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -1897,7 +1883,7 @@ st40:
 	if ( ++p == pe )
 		goto _test_eof40;
 case 40:
-#line 1901 "inc/vcf/validator_detail_v43.hpp"
+#line 1887 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr66;
 		case 62: goto tr70;
@@ -1909,14 +1895,14 @@ case 40:
 tr70:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st41;
 st41:
 	if ( ++p == pe )
 		goto _test_eof41;
 case 41:
-#line 1920 "inc/vcf/validator_detail_v43.hpp"
+#line 1906 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -1936,7 +1922,7 @@ st42:
 	if ( ++p == pe )
 		goto _test_eof42;
 case 42:
-#line 1940 "inc/vcf/validator_detail_v43.hpp"
+#line 1926 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st42;
 	if ( (*p) < 48 ) {
@@ -1958,20 +1944,20 @@ tr61:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st43;
 tr72:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st43;
 st43:
 	if ( ++p == pe )
 		goto _test_eof43;
 case 43:
-#line 1975 "inc/vcf/validator_detail_v43.hpp"
+#line 1961 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr73;
 		case 95: goto tr72;
@@ -1989,7 +1975,7 @@ case 43:
 		goto tr72;
 	goto tr40;
 tr73:
-#line 192 "src/vcf/vcf.ragel"
+#line 191 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -1998,7 +1984,7 @@ st44:
 	if ( ++p == pe )
 		goto _test_eof44;
 case 44:
-#line 2002 "inc/vcf/validator_detail_v43.hpp"
+#line 1988 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 34 )
 		goto st63;
 	if ( (*p) < 45 ) {
@@ -2017,20 +2003,20 @@ tr74:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st45;
 tr76:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st45;
 st45:
 	if ( ++p == pe )
 		goto _test_eof45;
 case 45:
-#line 2034 "inc/vcf/validator_detail_v43.hpp"
+#line 2020 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto tr77;
 		case 62: goto tr54;
@@ -2051,7 +2037,7 @@ st46:
 	if ( ++p == pe )
 		goto _test_eof46;
 case 46:
-#line 2055 "inc/vcf/validator_detail_v43.hpp"
+#line 2041 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto tr78;
 	if ( (*p) < 48 ) {
@@ -2076,7 +2062,7 @@ st47:
 	if ( ++p == pe )
 		goto _test_eof47;
 case 47:
-#line 2080 "inc/vcf/validator_detail_v43.hpp"
+#line 2066 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st47;
 	if ( (*p) < 48 ) {
@@ -2098,20 +2084,20 @@ tr79:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st48;
 tr81:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st48;
 st48:
 	if ( ++p == pe )
 		goto _test_eof48;
 case 48:
-#line 2115 "inc/vcf/validator_detail_v43.hpp"
+#line 2101 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr82;
 		case 95: goto tr81;
@@ -2129,7 +2115,7 @@ case 48:
 		goto tr81;
 	goto tr40;
 tr82:
-#line 192 "src/vcf/vcf.ragel"
+#line 191 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -2138,7 +2124,7 @@ st49:
 	if ( ++p == pe )
 		goto _test_eof49;
 case 49:
-#line 2142 "inc/vcf/validator_detail_v43.hpp"
+#line 2128 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 34 )
 		goto st50;
 	if ( (*p) < 45 ) {
@@ -2168,20 +2154,20 @@ tr84:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st51;
 tr87:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st51;
 st51:
 	if ( ++p == pe )
 		goto _test_eof51;
 case 51:
-#line 2185 "inc/vcf/validator_detail_v43.hpp"
+#line 2171 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 92: goto tr89;
@@ -2209,7 +2195,7 @@ st52:
 	if ( ++p == pe )
 		goto _test_eof52;
 case 52:
-#line 2213 "inc/vcf/validator_detail_v43.hpp"
+#line 2199 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto st46;
 		case 62: goto st32;
@@ -2222,20 +2208,20 @@ tr86:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st53;
 tr89:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st53;
 st53:
 	if ( ++p == pe )
 		goto _test_eof53;
 case 53:
-#line 2239 "inc/vcf/validator_detail_v43.hpp"
+#line 2225 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr91;
 		case 92: goto tr89;
@@ -2246,7 +2232,7 @@ case 53:
 tr91:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2257,7 +2243,7 @@ st54:
 	if ( ++p == pe )
 		goto _test_eof54;
 case 54:
-#line 2261 "inc/vcf/validator_detail_v43.hpp"
+#line 2247 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 44: goto tr92;
@@ -2274,19 +2260,19 @@ tr106:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st55;
 tr92:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st55;
 tr103:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2297,7 +2283,7 @@ st55:
 	if ( ++p == pe )
 		goto _test_eof55;
 case 55:
-#line 2301 "inc/vcf/validator_detail_v43.hpp"
+#line 2287 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 47: goto tr87;
@@ -2335,20 +2321,20 @@ tr94:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st56;
 tr96:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st56;
 st56:
 	if ( ++p == pe )
 		goto _test_eof56;
 case 56:
-#line 2352 "inc/vcf/validator_detail_v43.hpp"
+#line 2338 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 47: goto tr87;
@@ -2386,20 +2372,20 @@ tr95:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st57;
 tr97:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st57;
 st57:
 	if ( ++p == pe )
 		goto _test_eof57;
 case 57:
-#line 2403 "inc/vcf/validator_detail_v43.hpp"
+#line 2389 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 47: goto tr87;
@@ -2429,20 +2415,20 @@ case 57:
 		goto tr97;
 	goto tr40;
 tr98:
-#line 192 "src/vcf/vcf.ragel"
+#line 191 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st58;
 st58:
 	if ( ++p == pe )
 		goto _test_eof58;
 case 58:
-#line 2446 "inc/vcf/validator_detail_v43.hpp"
+#line 2432 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr100;
 		case 44: goto tr87;
@@ -2455,13 +2441,13 @@ case 58:
 tr102:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st59;
 tr99:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2472,7 +2458,7 @@ st59:
 	if ( ++p == pe )
 		goto _test_eof59;
 case 59:
-#line 2476 "inc/vcf/validator_detail_v43.hpp"
+#line 2462 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 44: goto tr103;
@@ -2489,19 +2475,19 @@ tr107:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st60;
 tr93:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st60;
 tr104:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2512,7 +2498,7 @@ st60:
 	if ( ++p == pe )
 		goto _test_eof60;
 case 60:
-#line 2516 "inc/vcf/validator_detail_v43.hpp"
+#line 2502 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -2525,13 +2511,13 @@ case 60:
 tr105:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st61;
 tr101:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2542,7 +2528,7 @@ st61:
 	if ( ++p == pe )
 		goto _test_eof61;
 case 61:
-#line 2546 "inc/vcf/validator_detail_v43.hpp"
+#line 2532 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr91;
 		case 44: goto tr103;
@@ -2562,7 +2548,7 @@ st62:
 	if ( ++p == pe )
 		goto _test_eof62;
 case 62:
-#line 2566 "inc/vcf/validator_detail_v43.hpp"
+#line 2552 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr85;
 		case 44: goto tr106;
@@ -2590,20 +2576,20 @@ tr108:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st64;
 tr110:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st64;
 st64:
 	if ( ++p == pe )
 		goto _test_eof64;
 case 64:
-#line 2607 "inc/vcf/validator_detail_v43.hpp"
+#line 2593 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 92: goto tr111;
@@ -2618,20 +2604,20 @@ tr109:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st65;
 tr111:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st65;
 st65:
 	if ( ++p == pe )
 		goto _test_eof65;
 case 65:
-#line 2635 "inc/vcf/validator_detail_v43.hpp"
+#line 2621 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr112;
 		case 92: goto tr111;
@@ -2642,7 +2628,7 @@ case 65:
 tr112:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2653,7 +2639,7 @@ st66:
 	if ( ++p == pe )
 		goto _test_eof66;
 case 66:
-#line 2657 "inc/vcf/validator_detail_v43.hpp"
+#line 2643 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 44: goto tr113;
@@ -2666,13 +2652,13 @@ case 66:
 tr113:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st67;
 tr123:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2683,7 +2669,7 @@ st67:
 	if ( ++p == pe )
 		goto _test_eof67;
 case 67:
-#line 2687 "inc/vcf/validator_detail_v43.hpp"
+#line 2673 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 47: goto tr110;
@@ -2717,13 +2703,13 @@ case 67:
 tr117:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st68;
 tr115:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2734,7 +2720,7 @@ st68:
 	if ( ++p == pe )
 		goto _test_eof68;
 case 68:
-#line 2738 "inc/vcf/validator_detail_v43.hpp"
+#line 2724 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 47: goto tr110;
@@ -2768,13 +2754,13 @@ case 68:
 tr118:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st69;
 tr116:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2785,7 +2771,7 @@ st69:
 	if ( ++p == pe )
 		goto _test_eof69;
 case 69:
-#line 2789 "inc/vcf/validator_detail_v43.hpp"
+#line 2775 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 47: goto tr110;
@@ -2817,9 +2803,9 @@ case 69:
 tr119:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
-#line 192 "src/vcf/vcf.ragel"
+#line 191 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
@@ -2828,7 +2814,7 @@ st70:
 	if ( ++p == pe )
 		goto _test_eof70;
 case 70:
-#line 2832 "inc/vcf/validator_detail_v43.hpp"
+#line 2818 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr100;
 		case 44: goto tr110;
@@ -2841,13 +2827,13 @@ case 70:
 tr122:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st71;
 tr120:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2858,7 +2844,7 @@ st71:
 	if ( ++p == pe )
 		goto _test_eof71;
 case 71:
-#line 2862 "inc/vcf/validator_detail_v43.hpp"
+#line 2848 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr88;
 		case 44: goto tr123;
@@ -2871,13 +2857,13 @@ case 71:
 tr114:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st72;
 tr124:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -2888,7 +2874,7 @@ st72:
 	if ( ++p == pe )
 		goto _test_eof72;
 case 72:
-#line 2892 "inc/vcf/validator_detail_v43.hpp"
+#line 2878 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -2901,13 +2887,13 @@ case 72:
 tr125:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st73;
 tr121:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -2918,7 +2904,7 @@ st73:
 	if ( ++p == pe )
 		goto _test_eof73;
 case 73:
-#line 2922 "inc/vcf/validator_detail_v43.hpp"
+#line 2908 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr112;
 		case 44: goto tr123;
@@ -2935,14 +2921,14 @@ tr31:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st74;
 st74:
 	if ( ++p == pe )
 		goto _test_eof74;
 case 74:
-#line 2946 "inc/vcf/validator_detail_v43.hpp"
+#line 2932 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 76: goto tr127;
@@ -2953,14 +2939,14 @@ case 74:
 tr127:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st75;
 st75:
 	if ( ++p == pe )
 		goto _test_eof75;
 case 75:
-#line 2964 "inc/vcf/validator_detail_v43.hpp"
+#line 2950 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 84: goto st76;
@@ -2978,7 +2964,7 @@ case 76:
 		goto tr41;
 	goto tr126;
 tr129:
-#line 108 "src/vcf/vcf.ragel"
+#line 107 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "ALT");
     }
@@ -2987,7 +2973,7 @@ st77:
 	if ( ++p == pe )
 		goto _test_eof77;
 case 77:
-#line 2991 "inc/vcf/validator_detail_v43.hpp"
+#line 2977 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 60 )
 		goto st78;
 	goto tr126;
@@ -3046,7 +3032,7 @@ case 81:
 		goto tr135;
 	goto tr134;
 tr135:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -3059,7 +3045,7 @@ st82:
 	if ( ++p == pe )
 		goto _test_eof82;
 case 82:
-#line 3063 "inc/vcf/validator_detail_v43.hpp"
+#line 3049 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 61 )
 		goto st82;
 	if ( (*p) < 63 ) {
@@ -3092,11 +3078,11 @@ case 82:
 tr138:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st83;
 tr136:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -3106,14 +3092,14 @@ tr136:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st83;
 st83:
 	if ( ++p == pe )
 		goto _test_eof83;
 case 83:
-#line 3117 "inc/vcf/validator_detail_v43.hpp"
+#line 3103 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto tr139;
 		case 61: goto tr138;
@@ -3134,7 +3120,7 @@ st84:
 	if ( ++p == pe )
 		goto _test_eof84;
 case 84:
-#line 3138 "inc/vcf/validator_detail_v43.hpp"
+#line 3124 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 68 )
 		goto st85;
 	goto tr126;
@@ -3223,7 +3209,7 @@ case 96:
 		goto tr152;
 	goto tr126;
 tr152:
-#line 156 "src/vcf/vcf.ragel"
+#line 155 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -3232,7 +3218,7 @@ st97:
 	if ( ++p == pe )
 		goto _test_eof97;
 case 97:
-#line 3236 "inc/vcf/validator_detail_v43.hpp"
+#line 3222 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr155;
 		case 92: goto tr156;
@@ -3247,20 +3233,20 @@ tr154:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st98;
 tr157:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st98;
 st98:
 	if ( ++p == pe )
 		goto _test_eof98;
 case 98:
-#line 3264 "inc/vcf/validator_detail_v43.hpp"
+#line 3250 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 92: goto tr159;
@@ -3288,7 +3274,7 @@ st99:
 	if ( ++p == pe )
 		goto _test_eof99;
 case 99:
-#line 3292 "inc/vcf/validator_detail_v43.hpp"
+#line 3278 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto st100;
 		case 62: goto st114;
@@ -3322,7 +3308,7 @@ st101:
 	if ( ++p == pe )
 		goto _test_eof101;
 case 101:
-#line 3326 "inc/vcf/validator_detail_v43.hpp"
+#line 3312 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st101;
 	if ( (*p) < 48 ) {
@@ -3344,20 +3330,20 @@ tr164:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st102;
 tr166:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st102;
 st102:
 	if ( ++p == pe )
 		goto _test_eof102;
 case 102:
-#line 3361 "inc/vcf/validator_detail_v43.hpp"
+#line 3347 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr167;
 		case 95: goto tr166;
@@ -3384,7 +3370,7 @@ st103:
 	if ( ++p == pe )
 		goto _test_eof103;
 case 103:
-#line 3388 "inc/vcf/validator_detail_v43.hpp"
+#line 3374 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 34 )
 		goto st104;
 	goto tr126;
@@ -3406,20 +3392,20 @@ tr169:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st105;
 tr171:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st105;
 st105:
 	if ( ++p == pe )
 		goto _test_eof105;
 case 105:
-#line 3423 "inc/vcf/validator_detail_v43.hpp"
+#line 3409 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 92: goto tr172;
@@ -3434,20 +3420,20 @@ tr170:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st106;
 tr172:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st106;
 st106:
 	if ( ++p == pe )
 		goto _test_eof106;
 case 106:
-#line 3451 "inc/vcf/validator_detail_v43.hpp"
+#line 3437 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr173;
 		case 92: goto tr172;
@@ -3458,7 +3444,7 @@ case 106:
 tr173:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3469,7 +3455,7 @@ st107:
 	if ( ++p == pe )
 		goto _test_eof107;
 case 107:
-#line 3473 "inc/vcf/validator_detail_v43.hpp"
+#line 3459 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 44: goto tr174;
@@ -3486,20 +3472,20 @@ tr183:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st108;
 tr174:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st108;
 st108:
 	if ( ++p == pe )
 		goto _test_eof108;
 case 108:
-#line 3503 "inc/vcf/validator_detail_v43.hpp"
+#line 3489 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 47: goto tr171;
@@ -3537,20 +3523,20 @@ tr177:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st109;
 tr179:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st109;
 st109:
 	if ( ++p == pe )
 		goto _test_eof109;
 case 109:
-#line 3554 "inc/vcf/validator_detail_v43.hpp"
+#line 3540 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 47: goto tr171;
@@ -3588,20 +3574,20 @@ tr178:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st110;
 tr180:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st110;
 st110:
 	if ( ++p == pe )
 		goto _test_eof110;
 case 110:
-#line 3605 "inc/vcf/validator_detail_v43.hpp"
+#line 3591 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 47: goto tr171;
@@ -3637,14 +3623,14 @@ tr181:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st111;
 st111:
 	if ( ++p == pe )
 		goto _test_eof111;
 case 111:
-#line 3648 "inc/vcf/validator_detail_v43.hpp"
+#line 3634 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr182;
 		case 92: goto tr172;
@@ -3662,7 +3648,7 @@ st112:
 	if ( ++p == pe )
 		goto _test_eof112;
 case 112:
-#line 3666 "inc/vcf/validator_detail_v43.hpp"
+#line 3652 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr155;
 		case 44: goto tr183;
@@ -3679,20 +3665,20 @@ tr184:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st113;
 tr175:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st113;
 st113:
 	if ( ++p == pe )
 		goto _test_eof113;
 case 113:
-#line 3696 "inc/vcf/validator_detail_v43.hpp"
+#line 3682 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -3718,20 +3704,20 @@ tr156:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st115;
 tr159:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st115;
 st115:
 	if ( ++p == pe )
 		goto _test_eof115;
 case 115:
-#line 3735 "inc/vcf/validator_detail_v43.hpp"
+#line 3721 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr185;
 		case 92: goto tr159;
@@ -3742,7 +3728,7 @@ case 115:
 tr185:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3753,7 +3739,7 @@ st116:
 	if ( ++p == pe )
 		goto _test_eof116;
 case 116:
-#line 3757 "inc/vcf/validator_detail_v43.hpp"
+#line 3743 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 44: goto tr186;
@@ -3766,14 +3752,14 @@ case 116:
 tr186:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st117;
 st117:
 	if ( ++p == pe )
 		goto _test_eof117;
 case 117:
-#line 3777 "inc/vcf/validator_detail_v43.hpp"
+#line 3763 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 47: goto tr157;
@@ -3807,13 +3793,13 @@ case 117:
 tr191:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st118;
 tr189:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -3824,7 +3810,7 @@ st118:
 	if ( ++p == pe )
 		goto _test_eof118;
 case 118:
-#line 3828 "inc/vcf/validator_detail_v43.hpp"
+#line 3814 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 47: goto tr157;
@@ -3858,13 +3844,13 @@ case 118:
 tr192:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st119;
 tr190:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -3875,7 +3861,7 @@ st119:
 	if ( ++p == pe )
 		goto _test_eof119;
 case 119:
-#line 3879 "inc/vcf/validator_detail_v43.hpp"
+#line 3865 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr158;
 		case 47: goto tr157;
@@ -3907,7 +3893,7 @@ case 119:
 tr193:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -3918,7 +3904,7 @@ st120:
 	if ( ++p == pe )
 		goto _test_eof120;
 case 120:
-#line 3922 "inc/vcf/validator_detail_v43.hpp"
+#line 3908 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr182;
 		case 92: goto tr159;
@@ -3929,14 +3915,14 @@ case 120:
 tr187:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st121;
 st121:
 	if ( ++p == pe )
 		goto _test_eof121;
 case 121:
-#line 3940 "inc/vcf/validator_detail_v43.hpp"
+#line 3926 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -3953,14 +3939,14 @@ tr32:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st122;
 st122:
 	if ( ++p == pe )
 		goto _test_eof122;
 case 122:
-#line 3964 "inc/vcf/validator_detail_v43.hpp"
+#line 3950 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 73: goto tr195;
@@ -3972,14 +3958,14 @@ case 122:
 tr195:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st123;
 st123:
 	if ( ++p == pe )
 		goto _test_eof123;
 case 123:
-#line 3983 "inc/vcf/validator_detail_v43.hpp"
+#line 3969 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 76: goto tr198;
@@ -3990,14 +3976,14 @@ case 123:
 tr198:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st124;
 st124:
 	if ( ++p == pe )
 		goto _test_eof124;
 case 124:
-#line 4001 "inc/vcf/validator_detail_v43.hpp"
+#line 3987 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 84: goto tr199;
@@ -4008,14 +3994,14 @@ case 124:
 tr199:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st125;
 st125:
 	if ( ++p == pe )
 		goto _test_eof125;
 case 125:
-#line 4019 "inc/vcf/validator_detail_v43.hpp"
+#line 4005 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 69: goto tr200;
@@ -4026,14 +4012,14 @@ case 125:
 tr200:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st126;
 st126:
 	if ( ++p == pe )
 		goto _test_eof126;
 case 126:
-#line 4037 "inc/vcf/validator_detail_v43.hpp"
+#line 4023 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 82: goto st127;
@@ -4051,7 +4037,7 @@ case 127:
 		goto tr41;
 	goto tr197;
 tr202:
-#line 120 "src/vcf/vcf.ragel"
+#line 119 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "FILTER");
     }
@@ -4060,7 +4046,7 @@ st128:
 	if ( ++p == pe )
 		goto _test_eof128;
 case 128:
-#line 4064 "inc/vcf/validator_detail_v43.hpp"
+#line 4050 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 60 )
 		goto st129;
 	goto tr197;
@@ -4104,7 +4090,7 @@ case 132:
 		goto tr209;
 	goto tr207;
 tr208:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -4117,7 +4103,7 @@ st133:
 	if ( ++p == pe )
 		goto _test_eof133;
 case 133:
-#line 4121 "inc/vcf/validator_detail_v43.hpp"
+#line 4107 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st133;
 	if ( (*p) < 48 ) {
@@ -4135,11 +4121,11 @@ case 133:
 tr211:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st134;
 tr209:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -4149,14 +4135,14 @@ tr209:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st134;
 st134:
 	if ( ++p == pe )
 		goto _test_eof134;
 case 134:
-#line 4160 "inc/vcf/validator_detail_v43.hpp"
+#line 4146 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto tr212;
 		case 95: goto tr211;
@@ -4183,7 +4169,7 @@ st135:
 	if ( ++p == pe )
 		goto _test_eof135;
 case 135:
-#line 4187 "inc/vcf/validator_detail_v43.hpp"
+#line 4173 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 68 )
 		goto st136;
 	goto tr197;
@@ -4272,7 +4258,7 @@ case 147:
 		goto tr225;
 	goto tr197;
 tr225:
-#line 156 "src/vcf/vcf.ragel"
+#line 155 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -4281,7 +4267,7 @@ st148:
 	if ( ++p == pe )
 		goto _test_eof148;
 case 148:
-#line 4285 "inc/vcf/validator_detail_v43.hpp"
+#line 4271 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr228;
 		case 92: goto tr229;
@@ -4296,20 +4282,20 @@ tr227:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st149;
 tr230:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st149;
 st149:
 	if ( ++p == pe )
 		goto _test_eof149;
 case 149:
-#line 4313 "inc/vcf/validator_detail_v43.hpp"
+#line 4299 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 92: goto tr232;
@@ -4337,7 +4323,7 @@ st150:
 	if ( ++p == pe )
 		goto _test_eof150;
 case 150:
-#line 4341 "inc/vcf/validator_detail_v43.hpp"
+#line 4327 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto st151;
 		case 62: goto st165;
@@ -4371,7 +4357,7 @@ st152:
 	if ( ++p == pe )
 		goto _test_eof152;
 case 152:
-#line 4375 "inc/vcf/validator_detail_v43.hpp"
+#line 4361 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st152;
 	if ( (*p) < 48 ) {
@@ -4393,20 +4379,20 @@ tr236:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st153;
 tr238:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st153;
 st153:
 	if ( ++p == pe )
 		goto _test_eof153;
 case 153:
-#line 4410 "inc/vcf/validator_detail_v43.hpp"
+#line 4396 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr239;
 		case 95: goto tr238;
@@ -4433,7 +4419,7 @@ st154:
 	if ( ++p == pe )
 		goto _test_eof154;
 case 154:
-#line 4437 "inc/vcf/validator_detail_v43.hpp"
+#line 4423 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 34 )
 		goto st155;
 	goto tr197;
@@ -4455,20 +4441,20 @@ tr241:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st156;
 tr243:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st156;
 st156:
 	if ( ++p == pe )
 		goto _test_eof156;
 case 156:
-#line 4472 "inc/vcf/validator_detail_v43.hpp"
+#line 4458 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 92: goto tr244;
@@ -4483,20 +4469,20 @@ tr242:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st157;
 tr244:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st157;
 st157:
 	if ( ++p == pe )
 		goto _test_eof157;
 case 157:
-#line 4500 "inc/vcf/validator_detail_v43.hpp"
+#line 4486 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr245;
 		case 92: goto tr244;
@@ -4507,7 +4493,7 @@ case 157:
 tr245:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4518,7 +4504,7 @@ st158:
 	if ( ++p == pe )
 		goto _test_eof158;
 case 158:
-#line 4522 "inc/vcf/validator_detail_v43.hpp"
+#line 4508 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 44: goto tr246;
@@ -4535,20 +4521,20 @@ tr255:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st159;
 tr246:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st159;
 st159:
 	if ( ++p == pe )
 		goto _test_eof159;
 case 159:
-#line 4552 "inc/vcf/validator_detail_v43.hpp"
+#line 4538 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 47: goto tr243;
@@ -4586,20 +4572,20 @@ tr249:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st160;
 tr251:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st160;
 st160:
 	if ( ++p == pe )
 		goto _test_eof160;
 case 160:
-#line 4603 "inc/vcf/validator_detail_v43.hpp"
+#line 4589 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 47: goto tr243;
@@ -4637,20 +4623,20 @@ tr250:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st161;
 tr252:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st161;
 st161:
 	if ( ++p == pe )
 		goto _test_eof161;
 case 161:
-#line 4654 "inc/vcf/validator_detail_v43.hpp"
+#line 4640 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 47: goto tr243;
@@ -4686,14 +4672,14 @@ tr253:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st162;
 st162:
 	if ( ++p == pe )
 		goto _test_eof162;
 case 162:
-#line 4697 "inc/vcf/validator_detail_v43.hpp"
+#line 4683 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr254;
 		case 92: goto tr244;
@@ -4711,7 +4697,7 @@ st163:
 	if ( ++p == pe )
 		goto _test_eof163;
 case 163:
-#line 4715 "inc/vcf/validator_detail_v43.hpp"
+#line 4701 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr228;
 		case 44: goto tr255;
@@ -4728,20 +4714,20 @@ tr256:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st164;
 tr247:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st164;
 st164:
 	if ( ++p == pe )
 		goto _test_eof164;
 case 164:
-#line 4745 "inc/vcf/validator_detail_v43.hpp"
+#line 4731 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -4767,20 +4753,20 @@ tr229:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st166;
 tr232:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st166;
 st166:
 	if ( ++p == pe )
 		goto _test_eof166;
 case 166:
-#line 4784 "inc/vcf/validator_detail_v43.hpp"
+#line 4770 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr257;
 		case 92: goto tr232;
@@ -4791,7 +4777,7 @@ case 166:
 tr257:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4802,7 +4788,7 @@ st167:
 	if ( ++p == pe )
 		goto _test_eof167;
 case 167:
-#line 4806 "inc/vcf/validator_detail_v43.hpp"
+#line 4792 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 44: goto tr258;
@@ -4815,14 +4801,14 @@ case 167:
 tr258:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st168;
 st168:
 	if ( ++p == pe )
 		goto _test_eof168;
 case 168:
-#line 4826 "inc/vcf/validator_detail_v43.hpp"
+#line 4812 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 47: goto tr230;
@@ -4856,13 +4842,13 @@ case 168:
 tr263:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st169;
 tr261:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -4873,7 +4859,7 @@ st169:
 	if ( ++p == pe )
 		goto _test_eof169;
 case 169:
-#line 4877 "inc/vcf/validator_detail_v43.hpp"
+#line 4863 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 47: goto tr230;
@@ -4907,13 +4893,13 @@ case 169:
 tr264:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st170;
 tr262:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -4924,7 +4910,7 @@ st170:
 	if ( ++p == pe )
 		goto _test_eof170;
 case 170:
-#line 4928 "inc/vcf/validator_detail_v43.hpp"
+#line 4914 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr231;
 		case 47: goto tr230;
@@ -4956,7 +4942,7 @@ case 170:
 tr265:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -4967,7 +4953,7 @@ st171:
 	if ( ++p == pe )
 		goto _test_eof171;
 case 171:
-#line 4971 "inc/vcf/validator_detail_v43.hpp"
+#line 4957 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr254;
 		case 92: goto tr232;
@@ -4978,14 +4964,14 @@ case 171:
 tr259:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st172;
 st172:
 	if ( ++p == pe )
 		goto _test_eof172;
 case 172:
-#line 4989 "inc/vcf/validator_detail_v43.hpp"
+#line 4975 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -4998,14 +4984,14 @@ case 172:
 tr196:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st173;
 st173:
 	if ( ++p == pe )
 		goto _test_eof173;
 case 173:
-#line 5009 "inc/vcf/validator_detail_v43.hpp"
+#line 4995 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 82: goto tr267;
@@ -5016,14 +5002,14 @@ case 173:
 tr267:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st174;
 st174:
 	if ( ++p == pe )
 		goto _test_eof174;
 case 174:
-#line 5027 "inc/vcf/validator_detail_v43.hpp"
+#line 5013 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 77: goto tr268;
@@ -5034,14 +5020,14 @@ case 174:
 tr268:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st175;
 st175:
 	if ( ++p == pe )
 		goto _test_eof175;
 case 175:
-#line 5045 "inc/vcf/validator_detail_v43.hpp"
+#line 5031 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 65: goto tr269;
@@ -5052,14 +5038,14 @@ case 175:
 tr269:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st176;
 st176:
 	if ( ++p == pe )
 		goto _test_eof176;
 case 176:
-#line 5063 "inc/vcf/validator_detail_v43.hpp"
+#line 5049 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 84: goto st177;
@@ -5077,7 +5063,7 @@ case 177:
 		goto tr41;
 	goto tr266;
 tr271:
-#line 124 "src/vcf/vcf.ragel"
+#line 123 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "FORMAT");
     }
@@ -5086,7 +5072,7 @@ st178:
 	if ( ++p == pe )
 		goto _test_eof178;
 case 178:
-#line 5090 "inc/vcf/validator_detail_v43.hpp"
+#line 5076 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 60 )
 		goto st179;
 	goto tr266;
@@ -5130,7 +5116,7 @@ case 182:
 		goto tr278;
 	goto tr276;
 tr277:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -5143,7 +5129,7 @@ st183:
 	if ( ++p == pe )
 		goto _test_eof183;
 case 183:
-#line 5147 "inc/vcf/validator_detail_v43.hpp"
+#line 5133 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st183;
 	if ( (*p) < 48 ) {
@@ -5161,11 +5147,11 @@ case 183:
 tr280:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st184;
 tr278:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -5175,14 +5161,14 @@ tr278:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st184;
 st184:
 	if ( ++p == pe )
 		goto _test_eof184;
 case 184:
-#line 5186 "inc/vcf/validator_detail_v43.hpp"
+#line 5172 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto tr281;
 		case 95: goto tr280;
@@ -5209,7 +5195,7 @@ st185:
 	if ( ++p == pe )
 		goto _test_eof185;
 case 185:
-#line 5213 "inc/vcf/validator_detail_v43.hpp"
+#line 5199 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 78 )
 		goto st186;
 	goto tr266;
@@ -5269,7 +5255,7 @@ case 192:
 		goto tr291;
 	goto tr289;
 tr290:
-#line 148 "src/vcf/vcf.ragel"
+#line 147 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
@@ -5279,14 +5265,14 @@ tr290:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st193;
 st193:
 	if ( ++p == pe )
 		goto _test_eof193;
 case 193:
-#line 5290 "inc/vcf/validator_detail_v43.hpp"
+#line 5276 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 44 )
 		goto tr292;
 	goto tr289;
@@ -5300,7 +5286,7 @@ st194:
 	if ( ++p == pe )
 		goto _test_eof194;
 case 194:
-#line 5304 "inc/vcf/validator_detail_v43.hpp"
+#line 5290 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 84 )
 		goto st195;
 	goto tr266;
@@ -5345,11 +5331,11 @@ case 199:
 tr301:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st200;
 tr299:
-#line 152 "src/vcf/vcf.ragel"
+#line 151 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Type");
     }
@@ -5359,14 +5345,14 @@ tr299:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st200;
 st200:
 	if ( ++p == pe )
 		goto _test_eof200;
 case 200:
-#line 5370 "inc/vcf/validator_detail_v43.hpp"
+#line 5356 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 44 )
 		goto tr300;
 	if ( (*p) > 90 ) {
@@ -5385,7 +5371,7 @@ st201:
 	if ( ++p == pe )
 		goto _test_eof201;
 case 201:
-#line 5389 "inc/vcf/validator_detail_v43.hpp"
+#line 5375 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 68 )
 		goto st202;
 	goto tr266;
@@ -5474,7 +5460,7 @@ case 213:
 		goto tr314;
 	goto tr266;
 tr314:
-#line 156 "src/vcf/vcf.ragel"
+#line 155 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -5483,7 +5469,7 @@ st214:
 	if ( ++p == pe )
 		goto _test_eof214;
 case 214:
-#line 5487 "inc/vcf/validator_detail_v43.hpp"
+#line 5473 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr317;
 		case 92: goto tr318;
@@ -5498,20 +5484,20 @@ tr316:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st215;
 tr319:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st215;
 st215:
 	if ( ++p == pe )
 		goto _test_eof215;
 case 215:
-#line 5515 "inc/vcf/validator_detail_v43.hpp"
+#line 5501 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 92: goto tr321;
@@ -5539,7 +5525,7 @@ st216:
 	if ( ++p == pe )
 		goto _test_eof216;
 case 216:
-#line 5543 "inc/vcf/validator_detail_v43.hpp"
+#line 5529 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto st217;
 		case 62: goto st231;
@@ -5573,7 +5559,7 @@ st218:
 	if ( ++p == pe )
 		goto _test_eof218;
 case 218:
-#line 5577 "inc/vcf/validator_detail_v43.hpp"
+#line 5563 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st218;
 	if ( (*p) < 48 ) {
@@ -5595,20 +5581,20 @@ tr325:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st219;
 tr327:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st219;
 st219:
 	if ( ++p == pe )
 		goto _test_eof219;
 case 219:
-#line 5612 "inc/vcf/validator_detail_v43.hpp"
+#line 5598 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr328;
 		case 95: goto tr327;
@@ -5635,7 +5621,7 @@ st220:
 	if ( ++p == pe )
 		goto _test_eof220;
 case 220:
-#line 5639 "inc/vcf/validator_detail_v43.hpp"
+#line 5625 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 34 )
 		goto st221;
 	goto tr266;
@@ -5657,20 +5643,20 @@ tr330:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st222;
 tr332:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st222;
 st222:
 	if ( ++p == pe )
 		goto _test_eof222;
 case 222:
-#line 5674 "inc/vcf/validator_detail_v43.hpp"
+#line 5660 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 92: goto tr333;
@@ -5685,20 +5671,20 @@ tr331:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st223;
 tr333:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st223;
 st223:
 	if ( ++p == pe )
 		goto _test_eof223;
 case 223:
-#line 5702 "inc/vcf/validator_detail_v43.hpp"
+#line 5688 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr334;
 		case 92: goto tr333;
@@ -5709,7 +5695,7 @@ case 223:
 tr334:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -5720,7 +5706,7 @@ st224:
 	if ( ++p == pe )
 		goto _test_eof224;
 case 224:
-#line 5724 "inc/vcf/validator_detail_v43.hpp"
+#line 5710 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 44: goto tr335;
@@ -5737,20 +5723,20 @@ tr344:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st225;
 tr335:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st225;
 st225:
 	if ( ++p == pe )
 		goto _test_eof225;
 case 225:
-#line 5754 "inc/vcf/validator_detail_v43.hpp"
+#line 5740 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 47: goto tr332;
@@ -5788,20 +5774,20 @@ tr338:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st226;
 tr340:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st226;
 st226:
 	if ( ++p == pe )
 		goto _test_eof226;
 case 226:
-#line 5805 "inc/vcf/validator_detail_v43.hpp"
+#line 5791 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 47: goto tr332;
@@ -5839,20 +5825,20 @@ tr339:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st227;
 tr341:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st227;
 st227:
 	if ( ++p == pe )
 		goto _test_eof227;
 case 227:
-#line 5856 "inc/vcf/validator_detail_v43.hpp"
+#line 5842 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 47: goto tr332;
@@ -5888,14 +5874,14 @@ tr342:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st228;
 st228:
 	if ( ++p == pe )
 		goto _test_eof228;
 case 228:
-#line 5899 "inc/vcf/validator_detail_v43.hpp"
+#line 5885 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr343;
 		case 92: goto tr333;
@@ -5913,7 +5899,7 @@ st229:
 	if ( ++p == pe )
 		goto _test_eof229;
 case 229:
-#line 5917 "inc/vcf/validator_detail_v43.hpp"
+#line 5903 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr317;
 		case 44: goto tr344;
@@ -5930,20 +5916,20 @@ tr345:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st230;
 tr336:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st230;
 st230:
 	if ( ++p == pe )
 		goto _test_eof230;
 case 230:
-#line 5947 "inc/vcf/validator_detail_v43.hpp"
+#line 5933 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -5969,20 +5955,20 @@ tr318:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st232;
 tr321:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st232;
 st232:
 	if ( ++p == pe )
 		goto _test_eof232;
 case 232:
-#line 5986 "inc/vcf/validator_detail_v43.hpp"
+#line 5972 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr346;
 		case 92: goto tr321;
@@ -5993,7 +5979,7 @@ case 232:
 tr346:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6004,7 +5990,7 @@ st233:
 	if ( ++p == pe )
 		goto _test_eof233;
 case 233:
-#line 6008 "inc/vcf/validator_detail_v43.hpp"
+#line 5994 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 44: goto tr347;
@@ -6017,14 +6003,14 @@ case 233:
 tr347:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st234;
 st234:
 	if ( ++p == pe )
 		goto _test_eof234;
 case 234:
-#line 6028 "inc/vcf/validator_detail_v43.hpp"
+#line 6014 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 47: goto tr319;
@@ -6058,13 +6044,13 @@ case 234:
 tr352:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st235;
 tr350:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -6075,7 +6061,7 @@ st235:
 	if ( ++p == pe )
 		goto _test_eof235;
 case 235:
-#line 6079 "inc/vcf/validator_detail_v43.hpp"
+#line 6065 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 47: goto tr319;
@@ -6109,13 +6095,13 @@ case 235:
 tr353:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st236;
 tr351:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -6126,7 +6112,7 @@ st236:
 	if ( ++p == pe )
 		goto _test_eof236;
 case 236:
-#line 6130 "inc/vcf/validator_detail_v43.hpp"
+#line 6116 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr320;
 		case 47: goto tr319;
@@ -6158,7 +6144,7 @@ case 236:
 tr354:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6169,7 +6155,7 @@ st237:
 	if ( ++p == pe )
 		goto _test_eof237;
 case 237:
-#line 6173 "inc/vcf/validator_detail_v43.hpp"
+#line 6159 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr343;
 		case 92: goto tr321;
@@ -6180,14 +6166,14 @@ case 237:
 tr348:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st238;
 st238:
 	if ( ++p == pe )
 		goto _test_eof238;
 case 238:
-#line 6191 "inc/vcf/validator_detail_v43.hpp"
+#line 6177 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -6200,11 +6186,11 @@ case 238:
 tr355:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st239;
 tr291:
-#line 148 "src/vcf/vcf.ragel"
+#line 147 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
@@ -6214,14 +6200,14 @@ tr291:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st239;
 st239:
 	if ( ++p == pe )
 		goto _test_eof239;
 case 239:
-#line 6225 "inc/vcf/validator_detail_v43.hpp"
+#line 6211 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 44 )
 		goto tr292;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -6234,14 +6220,14 @@ tr33:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st240;
 st240:
 	if ( ++p == pe )
 		goto _test_eof240;
 case 240:
-#line 6245 "inc/vcf/validator_detail_v43.hpp"
+#line 6231 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 78: goto tr357;
@@ -6252,14 +6238,14 @@ case 240:
 tr357:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st241;
 st241:
 	if ( ++p == pe )
 		goto _test_eof241;
 case 241:
-#line 6263 "inc/vcf/validator_detail_v43.hpp"
+#line 6249 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 70: goto tr358;
@@ -6270,14 +6256,14 @@ case 241:
 tr358:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st242;
 st242:
 	if ( ++p == pe )
 		goto _test_eof242;
 case 242:
-#line 6281 "inc/vcf/validator_detail_v43.hpp"
+#line 6267 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 79: goto st243;
@@ -6295,7 +6281,7 @@ case 243:
 		goto tr41;
 	goto tr356;
 tr360:
-#line 128 "src/vcf/vcf.ragel"
+#line 127 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "INFO");
     }
@@ -6304,7 +6290,7 @@ st244:
 	if ( ++p == pe )
 		goto _test_eof244;
 case 244:
-#line 6308 "inc/vcf/validator_detail_v43.hpp"
+#line 6294 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 60 )
 		goto st245;
 	goto tr356;
@@ -6348,7 +6334,7 @@ case 248:
 		goto tr367;
 	goto tr365;
 tr366:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -6361,7 +6347,7 @@ st249:
 	if ( ++p == pe )
 		goto _test_eof249;
 case 249:
-#line 6365 "inc/vcf/validator_detail_v43.hpp"
+#line 6351 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st249;
 	if ( (*p) < 48 ) {
@@ -6379,11 +6365,11 @@ case 249:
 tr369:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st250;
 tr367:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -6393,14 +6379,14 @@ tr367:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st250;
 st250:
 	if ( ++p == pe )
 		goto _test_eof250;
 case 250:
-#line 6404 "inc/vcf/validator_detail_v43.hpp"
+#line 6390 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto tr370;
 		case 95: goto tr369;
@@ -6427,7 +6413,7 @@ st251:
 	if ( ++p == pe )
 		goto _test_eof251;
 case 251:
-#line 6431 "inc/vcf/validator_detail_v43.hpp"
+#line 6417 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 78 )
 		goto st252;
 	goto tr356;
@@ -6487,7 +6473,7 @@ case 258:
 		goto tr380;
 	goto tr378;
 tr379:
-#line 148 "src/vcf/vcf.ragel"
+#line 147 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
@@ -6497,14 +6483,14 @@ tr379:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st259;
 st259:
 	if ( ++p == pe )
 		goto _test_eof259;
 case 259:
-#line 6508 "inc/vcf/validator_detail_v43.hpp"
+#line 6494 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 44 )
 		goto tr381;
 	goto tr378;
@@ -6518,7 +6504,7 @@ st260:
 	if ( ++p == pe )
 		goto _test_eof260;
 case 260:
-#line 6522 "inc/vcf/validator_detail_v43.hpp"
+#line 6508 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 84 )
 		goto st261;
 	goto tr356;
@@ -6563,11 +6549,11 @@ case 265:
 tr390:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st266;
 tr388:
-#line 152 "src/vcf/vcf.ragel"
+#line 151 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Type");
     }
@@ -6577,14 +6563,14 @@ tr388:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st266;
 st266:
 	if ( ++p == pe )
 		goto _test_eof266;
 case 266:
-#line 6588 "inc/vcf/validator_detail_v43.hpp"
+#line 6574 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 44 )
 		goto tr389;
 	if ( (*p) > 90 ) {
@@ -6603,7 +6589,7 @@ st267:
 	if ( ++p == pe )
 		goto _test_eof267;
 case 267:
-#line 6607 "inc/vcf/validator_detail_v43.hpp"
+#line 6593 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 68 )
 		goto st268;
 	goto tr356;
@@ -6692,7 +6678,7 @@ case 279:
 		goto tr403;
 	goto tr356;
 tr403:
-#line 156 "src/vcf/vcf.ragel"
+#line 155 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Description");
     }
@@ -6701,7 +6687,7 @@ st280:
 	if ( ++p == pe )
 		goto _test_eof280;
 case 280:
-#line 6705 "inc/vcf/validator_detail_v43.hpp"
+#line 6691 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr406;
 		case 92: goto tr407;
@@ -6716,20 +6702,20 @@ tr405:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st281;
 tr408:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st281;
 st281:
 	if ( ++p == pe )
 		goto _test_eof281;
 case 281:
-#line 6733 "inc/vcf/validator_detail_v43.hpp"
+#line 6719 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 92: goto tr410;
@@ -6757,7 +6743,7 @@ st282:
 	if ( ++p == pe )
 		goto _test_eof282;
 case 282:
-#line 6761 "inc/vcf/validator_detail_v43.hpp"
+#line 6747 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto st283;
 		case 62: goto st297;
@@ -6791,7 +6777,7 @@ st284:
 	if ( ++p == pe )
 		goto _test_eof284;
 case 284:
-#line 6795 "inc/vcf/validator_detail_v43.hpp"
+#line 6781 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st284;
 	if ( (*p) < 48 ) {
@@ -6813,20 +6799,20 @@ tr414:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st285;
 tr416:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st285;
 st285:
 	if ( ++p == pe )
 		goto _test_eof285;
 case 285:
-#line 6830 "inc/vcf/validator_detail_v43.hpp"
+#line 6816 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr417;
 		case 95: goto tr416;
@@ -6853,7 +6839,7 @@ st286:
 	if ( ++p == pe )
 		goto _test_eof286;
 case 286:
-#line 6857 "inc/vcf/validator_detail_v43.hpp"
+#line 6843 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 34 )
 		goto st287;
 	goto tr356;
@@ -6875,20 +6861,20 @@ tr419:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st288;
 tr421:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st288;
 st288:
 	if ( ++p == pe )
 		goto _test_eof288;
 case 288:
-#line 6892 "inc/vcf/validator_detail_v43.hpp"
+#line 6878 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 92: goto tr422;
@@ -6903,20 +6889,20 @@ tr420:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st289;
 tr422:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st289;
 st289:
 	if ( ++p == pe )
 		goto _test_eof289;
 case 289:
-#line 6920 "inc/vcf/validator_detail_v43.hpp"
+#line 6906 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr423;
 		case 92: goto tr422;
@@ -6927,7 +6913,7 @@ case 289:
 tr423:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -6938,7 +6924,7 @@ st290:
 	if ( ++p == pe )
 		goto _test_eof290;
 case 290:
-#line 6942 "inc/vcf/validator_detail_v43.hpp"
+#line 6928 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 44: goto tr424;
@@ -6955,20 +6941,20 @@ tr433:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st291;
 tr424:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st291;
 st291:
 	if ( ++p == pe )
 		goto _test_eof291;
 case 291:
-#line 6972 "inc/vcf/validator_detail_v43.hpp"
+#line 6958 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 47: goto tr421;
@@ -7006,20 +6992,20 @@ tr427:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st292;
 tr429:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st292;
 st292:
 	if ( ++p == pe )
 		goto _test_eof292;
 case 292:
-#line 7023 "inc/vcf/validator_detail_v43.hpp"
+#line 7009 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 47: goto tr421;
@@ -7057,20 +7043,20 @@ tr428:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st293;
 tr430:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st293;
 st293:
 	if ( ++p == pe )
 		goto _test_eof293;
 case 293:
-#line 7074 "inc/vcf/validator_detail_v43.hpp"
+#line 7060 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 47: goto tr421;
@@ -7106,14 +7092,14 @@ tr431:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st294;
 st294:
 	if ( ++p == pe )
 		goto _test_eof294;
 case 294:
-#line 7117 "inc/vcf/validator_detail_v43.hpp"
+#line 7103 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr432;
 		case 92: goto tr422;
@@ -7131,7 +7117,7 @@ st295:
 	if ( ++p == pe )
 		goto _test_eof295;
 case 295:
-#line 7135 "inc/vcf/validator_detail_v43.hpp"
+#line 7121 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr406;
 		case 44: goto tr433;
@@ -7148,20 +7134,20 @@ tr434:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st296;
 tr425:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st296;
 st296:
 	if ( ++p == pe )
 		goto _test_eof296;
 case 296:
-#line 7165 "inc/vcf/validator_detail_v43.hpp"
+#line 7151 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -7187,20 +7173,20 @@ tr407:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st298;
 tr410:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st298;
 st298:
 	if ( ++p == pe )
 		goto _test_eof298;
 case 298:
-#line 7204 "inc/vcf/validator_detail_v43.hpp"
+#line 7190 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr435;
 		case 92: goto tr410;
@@ -7211,7 +7197,7 @@ case 298:
 tr435:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -7222,7 +7208,7 @@ st299:
 	if ( ++p == pe )
 		goto _test_eof299;
 case 299:
-#line 7226 "inc/vcf/validator_detail_v43.hpp"
+#line 7212 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 44: goto tr436;
@@ -7235,14 +7221,14 @@ case 299:
 tr436:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st300;
 st300:
 	if ( ++p == pe )
 		goto _test_eof300;
 case 300:
-#line 7246 "inc/vcf/validator_detail_v43.hpp"
+#line 7232 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 47: goto tr408;
@@ -7276,13 +7262,13 @@ case 300:
 tr441:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st301;
 tr439:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -7293,7 +7279,7 @@ st301:
 	if ( ++p == pe )
 		goto _test_eof301;
 case 301:
-#line 7297 "inc/vcf/validator_detail_v43.hpp"
+#line 7283 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 47: goto tr408;
@@ -7327,13 +7313,13 @@ case 301:
 tr442:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st302;
 tr440:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -7344,7 +7330,7 @@ st302:
 	if ( ++p == pe )
 		goto _test_eof302;
 case 302:
-#line 7348 "inc/vcf/validator_detail_v43.hpp"
+#line 7334 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr409;
 		case 47: goto tr408;
@@ -7376,7 +7362,7 @@ case 302:
 tr443:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -7387,7 +7373,7 @@ st303:
 	if ( ++p == pe )
 		goto _test_eof303;
 case 303:
-#line 7391 "inc/vcf/validator_detail_v43.hpp"
+#line 7377 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr432;
 		case 92: goto tr410;
@@ -7398,14 +7384,14 @@ case 303:
 tr437:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st304;
 st304:
 	if ( ++p == pe )
 		goto _test_eof304;
 case 304:
-#line 7409 "inc/vcf/validator_detail_v43.hpp"
+#line 7395 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -7418,11 +7404,11 @@ case 304:
 tr444:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st305;
 tr380:
-#line 148 "src/vcf/vcf.ragel"
+#line 147 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
@@ -7432,14 +7418,14 @@ tr380:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st305;
 st305:
 	if ( ++p == pe )
 		goto _test_eof305;
 case 305:
-#line 7443 "inc/vcf/validator_detail_v43.hpp"
+#line 7429 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 44 )
 		goto tr381;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -7452,14 +7438,14 @@ tr34:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st306;
 st306:
 	if ( ++p == pe )
 		goto _test_eof306;
 case 306:
-#line 7463 "inc/vcf/validator_detail_v43.hpp"
+#line 7449 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 69: goto tr446;
@@ -7470,14 +7456,14 @@ case 306:
 tr446:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st307;
 st307:
 	if ( ++p == pe )
 		goto _test_eof307;
 case 307:
-#line 7481 "inc/vcf/validator_detail_v43.hpp"
+#line 7467 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 84: goto tr447;
@@ -7488,14 +7474,14 @@ case 307:
 tr447:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st308;
 st308:
 	if ( ++p == pe )
 		goto _test_eof308;
 case 308:
-#line 7499 "inc/vcf/validator_detail_v43.hpp"
+#line 7485 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 65: goto st309;
@@ -7513,7 +7499,7 @@ case 309:
 		goto tr41;
 	goto tr445;
 tr449:
-#line 168 "src/vcf/vcf.ragel"
+#line 167 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "META");
     }
@@ -7522,7 +7508,7 @@ st310:
 	if ( ++p == pe )
 		goto _test_eof310;
 case 310:
-#line 7526 "inc/vcf/validator_detail_v43.hpp"
+#line 7512 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 60 )
 		goto st311;
 	goto tr445;
@@ -7566,7 +7552,7 @@ case 314:
 		goto tr456;
 	goto tr454;
 tr455:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -7579,7 +7565,7 @@ st315:
 	if ( ++p == pe )
 		goto _test_eof315;
 case 315:
-#line 7583 "inc/vcf/validator_detail_v43.hpp"
+#line 7569 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st315;
 	if ( (*p) < 48 ) {
@@ -7597,11 +7583,11 @@ case 315:
 tr458:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st316;
 tr456:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -7611,14 +7597,14 @@ tr456:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st316;
 st316:
 	if ( ++p == pe )
 		goto _test_eof316;
 case 316:
-#line 7622 "inc/vcf/validator_detail_v43.hpp"
+#line 7608 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto tr459;
 		case 95: goto tr458;
@@ -7645,7 +7631,7 @@ st317:
 	if ( ++p == pe )
 		goto _test_eof317;
 case 317:
-#line 7649 "inc/vcf/validator_detail_v43.hpp"
+#line 7635 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 78 )
 		goto st318;
 	goto tr445;
@@ -7699,7 +7685,7 @@ case 324:
 		goto tr468;
 	goto tr467;
 tr468:
-#line 148 "src/vcf/vcf.ragel"
+#line 147 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Number");
     }
@@ -7708,7 +7694,7 @@ st325:
 	if ( ++p == pe )
 		goto _test_eof325;
 case 325:
-#line 7712 "inc/vcf/validator_detail_v43.hpp"
+#line 7698 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 44 )
 		goto st326;
 	goto tr467;
@@ -7755,7 +7741,7 @@ case 331:
 		goto tr476;
 	goto tr475;
 tr476:
-#line 152 "src/vcf/vcf.ragel"
+#line 151 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Type");
     }
@@ -7764,7 +7750,7 @@ st332:
 	if ( ++p == pe )
 		goto _test_eof332;
 case 332:
-#line 7768 "inc/vcf/validator_detail_v43.hpp"
+#line 7754 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 116 )
 		goto st333;
 	goto tr475;
@@ -7860,7 +7846,7 @@ case 345:
 		goto tr490;
 	goto tr445;
 tr490:
-#line 172 "src/vcf/vcf.ragel"
+#line 171 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Values");
     }
@@ -7869,7 +7855,7 @@ st346:
 	if ( ++p == pe )
 		goto _test_eof346;
 case 346:
-#line 7873 "inc/vcf/validator_detail_v43.hpp"
+#line 7859 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 61 )
 		goto tr491;
 	if ( (*p) < 45 ) {
@@ -7888,20 +7874,20 @@ tr491:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st347;
 tr493:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st347;
 st347:
 	if ( ++p == pe )
 		goto _test_eof347;
 case 347:
-#line 7905 "inc/vcf/validator_detail_v43.hpp"
+#line 7891 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto tr494;
 		case 61: goto tr493;
@@ -7916,14 +7902,14 @@ case 347:
 tr494:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st348;
 st348:
 	if ( ++p == pe )
 		goto _test_eof348;
 case 348:
-#line 7927 "inc/vcf/validator_detail_v43.hpp"
+#line 7913 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 32: goto tr496;
 		case 61: goto tr493;
@@ -7943,14 +7929,14 @@ case 348:
 tr496:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st349;
 st349:
 	if ( ++p == pe )
 		goto _test_eof349;
 case 349:
-#line 7954 "inc/vcf/validator_detail_v43.hpp"
+#line 7940 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 61 )
 		goto tr493;
 	if ( (*p) < 45 ) {
@@ -7965,7 +7951,7 @@ case 349:
 tr495:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -7976,7 +7962,7 @@ st350:
 	if ( ++p == pe )
 		goto _test_eof350;
 case 350:
-#line 7980 "inc/vcf/validator_detail_v43.hpp"
+#line 7966 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto tr494;
 		case 62: goto st351;
@@ -8004,14 +7990,14 @@ tr35:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st352;
 st352:
 	if ( ++p == pe )
 		goto _test_eof352;
 case 352:
-#line 8015 "inc/vcf/validator_detail_v43.hpp"
+#line 8001 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 69: goto tr499;
@@ -8022,14 +8008,14 @@ case 352:
 tr499:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st353;
 st353:
 	if ( ++p == pe )
 		goto _test_eof353;
 case 353:
-#line 8033 "inc/vcf/validator_detail_v43.hpp"
+#line 8019 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 68: goto tr500;
@@ -8040,14 +8026,14 @@ case 353:
 tr500:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st354;
 st354:
 	if ( ++p == pe )
 		goto _test_eof354;
 case 354:
-#line 8051 "inc/vcf/validator_detail_v43.hpp"
+#line 8037 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 73: goto tr501;
@@ -8058,14 +8044,14 @@ case 354:
 tr501:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st355;
 st355:
 	if ( ++p == pe )
 		goto _test_eof355;
 case 355:
-#line 8069 "inc/vcf/validator_detail_v43.hpp"
+#line 8055 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 71: goto tr502;
@@ -8076,14 +8062,14 @@ case 355:
 tr502:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st356;
 st356:
 	if ( ++p == pe )
 		goto _test_eof356;
 case 356:
-#line 8087 "inc/vcf/validator_detail_v43.hpp"
+#line 8073 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 82: goto tr503;
@@ -8094,14 +8080,14 @@ case 356:
 tr503:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st357;
 st357:
 	if ( ++p == pe )
 		goto _test_eof357;
 case 357:
-#line 8105 "inc/vcf/validator_detail_v43.hpp"
+#line 8091 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 69: goto tr504;
@@ -8112,14 +8098,14 @@ case 357:
 tr504:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st358;
 st358:
 	if ( ++p == pe )
 		goto _test_eof358;
 case 358:
-#line 8123 "inc/vcf/validator_detail_v43.hpp"
+#line 8109 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 69: goto st359;
@@ -8137,7 +8123,7 @@ case 359:
 		goto tr41;
 	goto tr498;
 tr506:
-#line 132 "src/vcf/vcf.ragel"
+#line 131 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "PEDIGREE");
     }
@@ -8146,7 +8132,7 @@ st360:
 	if ( ++p == pe )
 		goto _test_eof360;
 case 360:
-#line 8150 "inc/vcf/validator_detail_v43.hpp"
+#line 8136 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 60 )
 		goto st361;
 	goto tr498;
@@ -8190,7 +8176,7 @@ case 364:
 		goto tr513;
 	goto tr511;
 tr512:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -8203,7 +8189,7 @@ st365:
 	if ( ++p == pe )
 		goto _test_eof365;
 case 365:
-#line 8207 "inc/vcf/validator_detail_v43.hpp"
+#line 8193 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st365;
 	if ( (*p) < 48 ) {
@@ -8221,11 +8207,11 @@ case 365:
 tr515:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st366;
 tr513:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -8235,14 +8221,14 @@ tr513:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st366;
 st366:
 	if ( ++p == pe )
 		goto _test_eof366;
 case 366:
-#line 8246 "inc/vcf/validator_detail_v43.hpp"
+#line 8232 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto tr516;
 		case 95: goto tr515;
@@ -8269,7 +8255,7 @@ st367:
 	if ( ++p == pe )
 		goto _test_eof367;
 case 367:
-#line 8273 "inc/vcf/validator_detail_v43.hpp"
+#line 8259 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 70: goto st368;
 		case 78: goto tr519;
@@ -8337,7 +8323,7 @@ case 374:
 		goto tr529;
 	goto tr527;
 tr528:
-#line 180 "src/vcf/vcf.ragel"
+#line 179 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Father");
     }
@@ -8350,7 +8336,7 @@ st375:
 	if ( ++p == pe )
 		goto _test_eof375;
 case 375:
-#line 8354 "inc/vcf/validator_detail_v43.hpp"
+#line 8340 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st375;
 	if ( (*p) < 48 ) {
@@ -8368,11 +8354,11 @@ case 375:
 tr531:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st376;
 tr529:
-#line 180 "src/vcf/vcf.ragel"
+#line 179 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Father");
     }
@@ -8382,14 +8368,14 @@ tr529:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st376;
 st376:
 	if ( ++p == pe )
 		goto _test_eof376;
 case 376:
-#line 8393 "inc/vcf/validator_detail_v43.hpp"
+#line 8379 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto tr532;
 		case 95: goto tr531;
@@ -8416,7 +8402,7 @@ st377:
 	if ( ++p == pe )
 		goto _test_eof377;
 case 377:
-#line 8420 "inc/vcf/validator_detail_v43.hpp"
+#line 8406 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 77 )
 		goto st378;
 	goto tr498;
@@ -8481,7 +8467,7 @@ case 384:
 		goto tr541;
 	goto tr527;
 tr540:
-#line 184 "src/vcf/vcf.ragel"
+#line 183 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Mother");
     }
@@ -8494,7 +8480,7 @@ st385:
 	if ( ++p == pe )
 		goto _test_eof385;
 case 385:
-#line 8498 "inc/vcf/validator_detail_v43.hpp"
+#line 8484 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st385;
 	if ( (*p) < 48 ) {
@@ -8512,11 +8498,11 @@ case 385:
 tr543:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st386;
 tr541:
-#line 184 "src/vcf/vcf.ragel"
+#line 183 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Mother");
     }
@@ -8526,14 +8512,14 @@ tr541:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st386;
 st386:
 	if ( ++p == pe )
 		goto _test_eof386;
 case 386:
-#line 8537 "inc/vcf/validator_detail_v43.hpp"
+#line 8523 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 62: goto tr544;
 		case 95: goto tr543;
@@ -8560,7 +8546,7 @@ st387:
 	if ( ++p == pe )
 		goto _test_eof387;
 case 387:
-#line 8564 "inc/vcf/validator_detail_v43.hpp"
+#line 8550 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -8573,84 +8559,84 @@ tr519:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st388;
 st388:
 	if ( ++p == pe )
 		goto _test_eof388;
 case 388:
-#line 8584 "inc/vcf/validator_detail_v43.hpp"
+#line 8570 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 97 )
 		goto tr545;
 	goto tr517;
 tr545:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st389;
 st389:
 	if ( ++p == pe )
 		goto _test_eof389;
 case 389:
-#line 8598 "inc/vcf/validator_detail_v43.hpp"
+#line 8584 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 109 )
 		goto tr546;
 	goto tr517;
 tr546:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st390;
 st390:
 	if ( ++p == pe )
 		goto _test_eof390;
 case 390:
-#line 8612 "inc/vcf/validator_detail_v43.hpp"
+#line 8598 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 101 )
 		goto tr547;
 	goto tr517;
 tr547:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st391;
 st391:
 	if ( ++p == pe )
 		goto _test_eof391;
 case 391:
-#line 8626 "inc/vcf/validator_detail_v43.hpp"
+#line 8612 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto tr548;
 	goto tr517;
 tr548:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st392;
 st392:
 	if ( ++p == pe )
 		goto _test_eof392;
 case 392:
-#line 8640 "inc/vcf/validator_detail_v43.hpp"
+#line 8626 "inc/vcf/validator_detail_v43.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr549;
 	goto tr517;
 tr549:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st393;
 st393:
 	if ( ++p == pe )
 		goto _test_eof393;
 case 393:
-#line 8654 "inc/vcf/validator_detail_v43.hpp"
+#line 8640 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 61 )
 		goto tr550;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -8666,7 +8652,7 @@ st394:
 	if ( ++p == pe )
 		goto _test_eof394;
 case 394:
-#line 8670 "inc/vcf/validator_detail_v43.hpp"
+#line 8656 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto tr551;
 	if ( (*p) < 48 ) {
@@ -8691,7 +8677,7 @@ st395:
 	if ( ++p == pe )
 		goto _test_eof395;
 case 395:
-#line 8695 "inc/vcf/validator_detail_v43.hpp"
+#line 8681 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st395;
 	if ( (*p) < 48 ) {
@@ -8713,20 +8699,20 @@ tr552:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st396;
 tr554:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st396;
 st396:
 	if ( ++p == pe )
 		goto _test_eof396;
 case 396:
-#line 8730 "inc/vcf/validator_detail_v43.hpp"
+#line 8716 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto tr555;
 		case 62: goto tr544;
@@ -8754,7 +8740,7 @@ st397:
 	if ( ++p == pe )
 		goto _test_eof397;
 case 397:
-#line 8758 "inc/vcf/validator_detail_v43.hpp"
+#line 8744 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 78 )
 		goto tr519;
 	goto tr517;
@@ -8833,7 +8819,7 @@ case 406:
 		goto tr566;
 	goto tr564;
 tr565:
-#line 176 "src/vcf/vcf.ragel"
+#line 175 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Original");
     }
@@ -8846,7 +8832,7 @@ st407:
 	if ( ++p == pe )
 		goto _test_eof407;
 case 407:
-#line 8850 "inc/vcf/validator_detail_v43.hpp"
+#line 8836 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st407;
 	if ( (*p) < 48 ) {
@@ -8864,11 +8850,11 @@ case 407:
 tr568:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st408;
 tr566:
-#line 176 "src/vcf/vcf.ragel"
+#line 175 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "Original");
     }
@@ -8878,14 +8864,14 @@ tr566:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st408;
 st408:
 	if ( ++p == pe )
 		goto _test_eof408;
 case 408:
-#line 8889 "inc/vcf/validator_detail_v43.hpp"
+#line 8875 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 62: goto tr544;
 		case 95: goto tr568;
@@ -8909,14 +8895,14 @@ tr36:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st409;
 st409:
 	if ( ++p == pe )
 		goto _test_eof409;
 case 409:
-#line 8920 "inc/vcf/validator_detail_v43.hpp"
+#line 8906 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 65: goto tr570;
@@ -8927,14 +8913,14 @@ case 409:
 tr570:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st410;
 st410:
 	if ( ++p == pe )
 		goto _test_eof410;
 case 410:
-#line 8938 "inc/vcf/validator_detail_v43.hpp"
+#line 8924 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 77: goto tr571;
@@ -8945,14 +8931,14 @@ case 410:
 tr571:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st411;
 st411:
 	if ( ++p == pe )
 		goto _test_eof411;
 case 411:
-#line 8956 "inc/vcf/validator_detail_v43.hpp"
+#line 8942 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 80: goto tr572;
@@ -8963,14 +8949,14 @@ case 411:
 tr572:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st412;
 st412:
 	if ( ++p == pe )
 		goto _test_eof412;
 case 412:
-#line 8974 "inc/vcf/validator_detail_v43.hpp"
+#line 8960 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 76: goto tr573;
@@ -8981,14 +8967,14 @@ case 412:
 tr573:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st413;
 st413:
 	if ( ++p == pe )
 		goto _test_eof413;
 case 413:
-#line 8992 "inc/vcf/validator_detail_v43.hpp"
+#line 8978 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 69: goto st414;
@@ -9006,7 +8992,7 @@ case 414:
 		goto tr41;
 	goto tr569;
 tr575:
-#line 140 "src/vcf/vcf.ragel"
+#line 139 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "SAMPLE");
     }
@@ -9015,7 +9001,7 @@ st415:
 	if ( ++p == pe )
 		goto _test_eof415;
 case 415:
-#line 9019 "inc/vcf/validator_detail_v43.hpp"
+#line 9005 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 60 )
 		goto st416;
 	goto tr569;
@@ -9059,7 +9045,7 @@ case 419:
 		goto tr582;
 	goto tr580;
 tr581:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -9072,7 +9058,7 @@ st420:
 	if ( ++p == pe )
 		goto _test_eof420;
 case 420:
-#line 9076 "inc/vcf/validator_detail_v43.hpp"
+#line 9062 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st420;
 	if ( (*p) < 48 ) {
@@ -9090,11 +9076,11 @@ case 420:
 tr584:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st421;
 tr582:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -9104,14 +9090,14 @@ tr582:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st421;
 st421:
 	if ( ++p == pe )
 		goto _test_eof421;
 case 421:
-#line 9115 "inc/vcf/validator_detail_v43.hpp"
+#line 9101 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto tr585;
 		case 62: goto tr586;
@@ -9139,7 +9125,7 @@ st422:
 	if ( ++p == pe )
 		goto _test_eof422;
 case 422:
-#line 9143 "inc/vcf/validator_detail_v43.hpp"
+#line 9129 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto tr587;
 	if ( (*p) < 48 ) {
@@ -9164,7 +9150,7 @@ st423:
 	if ( ++p == pe )
 		goto _test_eof423;
 case 423:
-#line 9168 "inc/vcf/validator_detail_v43.hpp"
+#line 9154 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st423;
 	if ( (*p) < 48 ) {
@@ -9186,20 +9172,20 @@ tr588:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st424;
 tr590:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st424;
 st424:
 	if ( ++p == pe )
 		goto _test_eof424;
 case 424:
-#line 9203 "inc/vcf/validator_detail_v43.hpp"
+#line 9189 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr591;
 		case 95: goto tr590;
@@ -9226,7 +9212,7 @@ st425:
 	if ( ++p == pe )
 		goto _test_eof425;
 case 425:
-#line 9230 "inc/vcf/validator_detail_v43.hpp"
+#line 9216 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 34 )
 		goto st428;
 	if ( (*p) < 45 ) {
@@ -9245,20 +9231,20 @@ tr592:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st426;
 tr594:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st426;
 st426:
 	if ( ++p == pe )
 		goto _test_eof426;
 case 426:
-#line 9262 "inc/vcf/validator_detail_v43.hpp"
+#line 9248 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto tr585;
 		case 62: goto tr586;
@@ -9279,7 +9265,7 @@ st427:
 	if ( ++p == pe )
 		goto _test_eof427;
 case 427:
-#line 9283 "inc/vcf/validator_detail_v43.hpp"
+#line 9269 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -9303,20 +9289,20 @@ tr595:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st429;
 tr598:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st429;
 st429:
 	if ( ++p == pe )
 		goto _test_eof429;
 case 429:
-#line 9320 "inc/vcf/validator_detail_v43.hpp"
+#line 9306 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr599;
 		case 92: goto tr600;
@@ -9344,7 +9330,7 @@ st430:
 	if ( ++p == pe )
 		goto _test_eof430;
 case 430:
-#line 9348 "inc/vcf/validator_detail_v43.hpp"
+#line 9334 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto st422;
 		case 62: goto st427;
@@ -9357,20 +9343,20 @@ tr597:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st431;
 tr600:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st431;
 st431:
 	if ( ++p == pe )
 		goto _test_eof431;
 case 431:
-#line 9374 "inc/vcf/validator_detail_v43.hpp"
+#line 9360 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr603;
 		case 92: goto tr600;
@@ -9381,7 +9367,7 @@ case 431:
 tr603:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -9392,7 +9378,7 @@ st432:
 	if ( ++p == pe )
 		goto _test_eof432;
 case 432:
-#line 9396 "inc/vcf/validator_detail_v43.hpp"
+#line 9382 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr599;
 		case 44: goto tr604;
@@ -9409,19 +9395,19 @@ tr618:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st433;
 tr604:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st433;
 tr615:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -9432,7 +9418,7 @@ st433:
 	if ( ++p == pe )
 		goto _test_eof433;
 case 433:
-#line 9436 "inc/vcf/validator_detail_v43.hpp"
+#line 9422 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr599;
 		case 47: goto tr598;
@@ -9470,20 +9456,20 @@ tr606:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st434;
 tr608:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st434;
 st434:
 	if ( ++p == pe )
 		goto _test_eof434;
 case 434:
-#line 9487 "inc/vcf/validator_detail_v43.hpp"
+#line 9473 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr599;
 		case 47: goto tr598;
@@ -9521,20 +9507,20 @@ tr607:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st435;
 tr609:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st435;
 st435:
 	if ( ++p == pe )
 		goto _test_eof435;
 case 435:
-#line 9538 "inc/vcf/validator_detail_v43.hpp"
+#line 9524 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr599;
 		case 47: goto tr598;
@@ -9570,14 +9556,14 @@ tr610:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st436;
 st436:
 	if ( ++p == pe )
 		goto _test_eof436;
 case 436:
-#line 9581 "inc/vcf/validator_detail_v43.hpp"
+#line 9567 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr612;
 		case 44: goto tr598;
@@ -9590,13 +9576,13 @@ case 436:
 tr614:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st437;
 tr611:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -9607,7 +9593,7 @@ st437:
 	if ( ++p == pe )
 		goto _test_eof437;
 case 437:
-#line 9611 "inc/vcf/validator_detail_v43.hpp"
+#line 9597 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr599;
 		case 44: goto tr615;
@@ -9624,19 +9610,19 @@ tr619:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st438;
 tr605:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st438;
 tr616:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -9647,7 +9633,7 @@ st438:
 	if ( ++p == pe )
 		goto _test_eof438;
 case 438:
-#line 9651 "inc/vcf/validator_detail_v43.hpp"
+#line 9637 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -9660,13 +9646,13 @@ case 438:
 tr617:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st439;
 tr613:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -9677,7 +9663,7 @@ st439:
 	if ( ++p == pe )
 		goto _test_eof439;
 case 439:
-#line 9681 "inc/vcf/validator_detail_v43.hpp"
+#line 9667 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr603;
 		case 44: goto tr615;
@@ -9697,7 +9683,7 @@ st440:
 	if ( ++p == pe )
 		goto _test_eof440;
 case 440:
-#line 9701 "inc/vcf/validator_detail_v43.hpp"
+#line 9687 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr596;
 		case 44: goto tr618;
@@ -9714,14 +9700,14 @@ tr37:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st441;
 st441:
 	if ( ++p == pe )
 		goto _test_eof441;
 case 441:
-#line 9725 "inc/vcf/validator_detail_v43.hpp"
+#line 9711 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 115: goto tr621;
@@ -9732,14 +9718,14 @@ case 441:
 tr621:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st442;
 st442:
 	if ( ++p == pe )
 		goto _test_eof442;
 case 442:
-#line 9743 "inc/vcf/validator_detail_v43.hpp"
+#line 9729 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 115: goto tr622;
@@ -9750,14 +9736,14 @@ case 442:
 tr622:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st443;
 st443:
 	if ( ++p == pe )
 		goto _test_eof443;
 case 443:
-#line 9761 "inc/vcf/validator_detail_v43.hpp"
+#line 9747 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 101: goto tr623;
@@ -9768,14 +9754,14 @@ case 443:
 tr623:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st444;
 st444:
 	if ( ++p == pe )
 		goto _test_eof444;
 case 444:
-#line 9779 "inc/vcf/validator_detail_v43.hpp"
+#line 9765 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 109: goto tr624;
@@ -9786,14 +9772,14 @@ case 444:
 tr624:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st445;
 st445:
 	if ( ++p == pe )
 		goto _test_eof445;
 case 445:
-#line 9797 "inc/vcf/validator_detail_v43.hpp"
+#line 9783 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 98: goto tr625;
@@ -9804,14 +9790,14 @@ case 445:
 tr625:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st446;
 st446:
 	if ( ++p == pe )
 		goto _test_eof446;
 case 446:
-#line 9815 "inc/vcf/validator_detail_v43.hpp"
+#line 9801 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 108: goto tr626;
@@ -9822,14 +9808,14 @@ case 446:
 tr626:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st447;
 st447:
 	if ( ++p == pe )
 		goto _test_eof447;
 case 447:
-#line 9833 "inc/vcf/validator_detail_v43.hpp"
+#line 9819 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 121: goto st448;
@@ -9847,7 +9833,7 @@ case 448:
 		goto tr41;
 	goto tr620;
 tr628:
-#line 112 "src/vcf/vcf.ragel"
+#line 111 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "assembly");
     }
@@ -9856,7 +9842,7 @@ st449:
 	if ( ++p == pe )
 		goto _test_eof449;
 case 449:
-#line 9860 "inc/vcf/validator_detail_v43.hpp"
+#line 9846 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) > 90 ) {
 		if ( 97 <= (*p) && (*p) <= 122 )
 			goto tr630;
@@ -9873,7 +9859,7 @@ st450:
 	if ( ++p == pe )
 		goto _test_eof450;
 case 450:
-#line 9877 "inc/vcf/validator_detail_v43.hpp"
+#line 9863 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr629;
 		case 13: goto tr632;
@@ -9889,17 +9875,13 @@ tr632:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st451;
 st451:
 	if ( ++p == pe )
 		goto _test_eof451;
 case 451:
-#line 9903 "inc/vcf/validator_detail_v43.hpp"
+#line 9885 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr629;
 		case 13: goto tr632;
@@ -9987,7 +9969,7 @@ case 460:
 tr637:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st461;
 tr646:
@@ -9996,20 +9978,16 @@ tr646:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -10022,7 +10000,7 @@ st461:
 	if ( ++p == pe )
 		goto _test_eof461;
 case 461:
-#line 10026 "inc/vcf/validator_detail_v43.hpp"
+#line 10004 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr46;
 		case 13: goto tr646;
@@ -10083,14 +10061,14 @@ tr38:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st468;
 st468:
 	if ( ++p == pe )
 		goto _test_eof468;
 case 468:
-#line 10094 "inc/vcf/validator_detail_v43.hpp"
+#line 10072 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 111: goto tr651;
@@ -10101,14 +10079,14 @@ case 468:
 tr651:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st469;
 st469:
 	if ( ++p == pe )
 		goto _test_eof469;
 case 469:
-#line 10112 "inc/vcf/validator_detail_v43.hpp"
+#line 10090 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 110: goto tr652;
@@ -10119,14 +10097,14 @@ case 469:
 tr652:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st470;
 st470:
 	if ( ++p == pe )
 		goto _test_eof470;
 case 470:
-#line 10130 "inc/vcf/validator_detail_v43.hpp"
+#line 10108 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 116: goto tr653;
@@ -10137,14 +10115,14 @@ case 470:
 tr653:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st471;
 st471:
 	if ( ++p == pe )
 		goto _test_eof471;
 case 471:
-#line 10148 "inc/vcf/validator_detail_v43.hpp"
+#line 10126 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 105: goto tr654;
@@ -10155,14 +10133,14 @@ case 471:
 tr654:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st472;
 st472:
 	if ( ++p == pe )
 		goto _test_eof472;
 case 472:
-#line 10166 "inc/vcf/validator_detail_v43.hpp"
+#line 10144 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 103: goto st473;
@@ -10180,7 +10158,7 @@ case 473:
 		goto tr41;
 	goto tr650;
 tr656:
-#line 116 "src/vcf/vcf.ragel"
+#line 115 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "contig");
     }
@@ -10189,7 +10167,7 @@ st474:
 	if ( ++p == pe )
 		goto _test_eof474;
 case 474:
-#line 10193 "inc/vcf/validator_detail_v43.hpp"
+#line 10171 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 60 )
 		goto st475;
 	goto tr650;
@@ -10241,11 +10219,11 @@ case 478:
 tr663:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st479;
 tr662:
-#line 144 "src/vcf/vcf.ragel"
+#line 143 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this, "ID");
     }
@@ -10255,14 +10233,14 @@ tr662:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st479;
 st479:
 	if ( ++p == pe )
 		goto _test_eof479;
 case 479:
-#line 10266 "inc/vcf/validator_detail_v43.hpp"
+#line 10244 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto tr664;
 		case 59: goto tr663;
@@ -10291,7 +10269,7 @@ st480:
 	if ( ++p == pe )
 		goto _test_eof480;
 case 480:
-#line 10295 "inc/vcf/validator_detail_v43.hpp"
+#line 10273 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto tr666;
 	if ( (*p) < 48 ) {
@@ -10316,7 +10294,7 @@ st481:
 	if ( ++p == pe )
 		goto _test_eof481;
 case 481:
-#line 10320 "inc/vcf/validator_detail_v43.hpp"
+#line 10298 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto st481;
 	if ( (*p) < 48 ) {
@@ -10338,20 +10316,20 @@ tr667:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st482;
 tr669:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st482;
 st482:
 	if ( ++p == pe )
 		goto _test_eof482;
 case 482:
-#line 10355 "inc/vcf/validator_detail_v43.hpp"
+#line 10333 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr670;
 		case 95: goto tr669;
@@ -10378,7 +10356,7 @@ st483:
 	if ( ++p == pe )
 		goto _test_eof483;
 case 483:
-#line 10382 "inc/vcf/validator_detail_v43.hpp"
+#line 10360 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 34 )
 		goto st486;
 	if ( (*p) < 45 ) {
@@ -10397,20 +10375,20 @@ tr671:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st484;
 tr673:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st484;
 st484:
 	if ( ++p == pe )
 		goto _test_eof484;
 case 484:
-#line 10414 "inc/vcf/validator_detail_v43.hpp"
+#line 10392 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto tr664;
 		case 62: goto tr665;
@@ -10431,7 +10409,7 @@ st485:
 	if ( ++p == pe )
 		goto _test_eof485;
 case 485:
-#line 10435 "inc/vcf/validator_detail_v43.hpp"
+#line 10413 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -10455,20 +10433,20 @@ tr674:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st487;
 tr677:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st487;
 st487:
 	if ( ++p == pe )
 		goto _test_eof487;
 case 487:
-#line 10472 "inc/vcf/validator_detail_v43.hpp"
+#line 10450 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr678;
 		case 92: goto tr679;
@@ -10496,7 +10474,7 @@ st488:
 	if ( ++p == pe )
 		goto _test_eof488;
 case 488:
-#line 10500 "inc/vcf/validator_detail_v43.hpp"
+#line 10478 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 44: goto st480;
 		case 62: goto st485;
@@ -10509,20 +10487,20 @@ tr676:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st489;
 tr679:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st489;
 st489:
 	if ( ++p == pe )
 		goto _test_eof489;
 case 489:
-#line 10526 "inc/vcf/validator_detail_v43.hpp"
+#line 10504 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr682;
 		case 92: goto tr679;
@@ -10533,7 +10511,7 @@ case 489:
 tr682:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -10544,7 +10522,7 @@ st490:
 	if ( ++p == pe )
 		goto _test_eof490;
 case 490:
-#line 10548 "inc/vcf/validator_detail_v43.hpp"
+#line 10526 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr678;
 		case 44: goto tr683;
@@ -10561,19 +10539,19 @@ tr697:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st491;
 tr683:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st491;
 tr694:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -10584,7 +10562,7 @@ st491:
 	if ( ++p == pe )
 		goto _test_eof491;
 case 491:
-#line 10588 "inc/vcf/validator_detail_v43.hpp"
+#line 10566 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr678;
 		case 47: goto tr677;
@@ -10622,20 +10600,20 @@ tr685:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st492;
 tr687:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st492;
 st492:
 	if ( ++p == pe )
 		goto _test_eof492;
 case 492:
-#line 10639 "inc/vcf/validator_detail_v43.hpp"
+#line 10617 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr678;
 		case 47: goto tr677;
@@ -10673,20 +10651,20 @@ tr686:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st493;
 tr688:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st493;
 st493:
 	if ( ++p == pe )
 		goto _test_eof493;
 case 493:
-#line 10690 "inc/vcf/validator_detail_v43.hpp"
+#line 10668 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr678;
 		case 47: goto tr677;
@@ -10722,14 +10700,14 @@ tr689:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st494;
 st494:
 	if ( ++p == pe )
 		goto _test_eof494;
 case 494:
-#line 10733 "inc/vcf/validator_detail_v43.hpp"
+#line 10711 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr691;
 		case 44: goto tr677;
@@ -10742,13 +10720,13 @@ case 494:
 tr693:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st495;
 tr690:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -10759,7 +10737,7 @@ st495:
 	if ( ++p == pe )
 		goto _test_eof495;
 case 495:
-#line 10763 "inc/vcf/validator_detail_v43.hpp"
+#line 10741 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr678;
 		case 44: goto tr694;
@@ -10776,19 +10754,19 @@ tr698:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st496;
 tr684:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st496;
 tr695:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -10799,7 +10777,7 @@ st496:
 	if ( ++p == pe )
 		goto _test_eof496;
 case 496:
-#line 10803 "inc/vcf/validator_detail_v43.hpp"
+#line 10781 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr57;
@@ -10812,13 +10790,13 @@ case 496:
 tr696:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st497;
 tr692:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 31 "src/vcf/vcf.ragel"
 	{
@@ -10829,7 +10807,7 @@ st497:
 	if ( ++p == pe )
 		goto _test_eof497;
 case 497:
-#line 10833 "inc/vcf/validator_detail_v43.hpp"
+#line 10811 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr682;
 		case 44: goto tr694;
@@ -10849,7 +10827,7 @@ st498:
 	if ( ++p == pe )
 		goto _test_eof498;
 case 498:
-#line 10853 "inc/vcf/validator_detail_v43.hpp"
+#line 10831 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 34: goto tr675;
 		case 44: goto tr697;
@@ -10866,14 +10844,14 @@ tr39:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st499;
 st499:
 	if ( ++p == pe )
 		goto _test_eof499;
 case 499:
-#line 10877 "inc/vcf/validator_detail_v43.hpp"
+#line 10855 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 101: goto tr700;
@@ -10884,14 +10862,14 @@ case 499:
 tr700:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st500;
 st500:
 	if ( ++p == pe )
 		goto _test_eof500;
 case 500:
-#line 10895 "inc/vcf/validator_detail_v43.hpp"
+#line 10873 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 100: goto tr701;
@@ -10902,14 +10880,14 @@ case 500:
 tr701:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st501;
 st501:
 	if ( ++p == pe )
 		goto _test_eof501;
 case 501:
-#line 10913 "inc/vcf/validator_detail_v43.hpp"
+#line 10891 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 105: goto tr702;
@@ -10920,14 +10898,14 @@ case 501:
 tr702:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st502;
 st502:
 	if ( ++p == pe )
 		goto _test_eof502;
 case 502:
-#line 10931 "inc/vcf/validator_detail_v43.hpp"
+#line 10909 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 103: goto tr703;
@@ -10938,14 +10916,14 @@ case 502:
 tr703:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st503;
 st503:
 	if ( ++p == pe )
 		goto _test_eof503;
 case 503:
-#line 10949 "inc/vcf/validator_detail_v43.hpp"
+#line 10927 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 114: goto tr704;
@@ -10956,14 +10934,14 @@ case 503:
 tr704:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st504;
 st504:
 	if ( ++p == pe )
 		goto _test_eof504;
 case 504:
-#line 10967 "inc/vcf/validator_detail_v43.hpp"
+#line 10945 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 101: goto tr705;
@@ -10974,14 +10952,14 @@ case 504:
 tr705:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st505;
 st505:
 	if ( ++p == pe )
 		goto _test_eof505;
 case 505:
-#line 10985 "inc/vcf/validator_detail_v43.hpp"
+#line 10963 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 101: goto tr706;
@@ -10992,14 +10970,14 @@ case 505:
 tr706:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st506;
 st506:
 	if ( ++p == pe )
 		goto _test_eof506;
 case 506:
-#line 11003 "inc/vcf/validator_detail_v43.hpp"
+#line 10981 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 68: goto tr707;
@@ -11010,14 +10988,14 @@ case 506:
 tr707:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st507;
 st507:
 	if ( ++p == pe )
 		goto _test_eof507;
 case 507:
-#line 11021 "inc/vcf/validator_detail_v43.hpp"
+#line 10999 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 61: goto tr42;
 		case 66: goto st508;
@@ -11035,7 +11013,7 @@ case 508:
 		goto tr41;
 	goto tr699;
 tr709:
-#line 136 "src/vcf/vcf.ragel"
+#line 135 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_meta_typeid(*this, "pedigreeDB");
     }
@@ -11044,7 +11022,7 @@ st509:
 	if ( ++p == pe )
 		goto _test_eof509;
 case 509:
-#line 11048 "inc/vcf/validator_detail_v43.hpp"
+#line 11026 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 60 )
 		goto st510;
 	goto tr699;
@@ -11068,7 +11046,7 @@ st511:
 	if ( ++p == pe )
 		goto _test_eof511;
 case 511:
-#line 11072 "inc/vcf/validator_detail_v43.hpp"
+#line 11050 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr711;
 		case 13: goto tr714;
@@ -11084,17 +11062,13 @@ tr714:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st512;
 st512:
 	if ( ++p == pe )
 		goto _test_eof512;
 case 512:
-#line 11098 "inc/vcf/validator_detail_v43.hpp"
+#line 11072 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr711;
 		case 13: goto tr714;
@@ -11182,7 +11156,7 @@ case 521:
 tr719:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st522;
 tr728:
@@ -11191,21 +11165,17 @@ tr728:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st522;
 st522:
 	if ( ++p == pe )
 		goto _test_eof522;
 case 522:
-#line 11209 "inc/vcf/validator_detail_v43.hpp"
+#line 11179 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr711;
 		case 13: goto tr728;
@@ -11215,7 +11185,7 @@ case 522:
 tr729:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
@@ -11226,7 +11196,7 @@ st523:
 	if ( ++p == pe )
 		goto _test_eof523;
 case 523:
-#line 11230 "inc/vcf/validator_detail_v43.hpp"
+#line 11200 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr56;
 		case 13: goto tr730;
@@ -11239,16 +11209,12 @@ tr730:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
-#line 196 "src/vcf/vcf.ragel"
+#line 195 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_meta_line(*this);
@@ -11261,7 +11227,7 @@ st524:
 	if ( ++p == pe )
 		goto _test_eof524;
 case 524:
-#line 11265 "inc/vcf/validator_detail_v43.hpp"
+#line 11231 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto st28;
 		case 13: goto tr728;
@@ -11352,7 +11318,7 @@ case 535:
 		goto tr739;
 	goto tr734;
 tr739:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11361,7 +11327,7 @@ st536:
 	if ( ++p == pe )
 		goto _test_eof536;
 case 536:
-#line 11365 "inc/vcf/validator_detail_v43.hpp"
+#line 11331 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 80 )
 		goto st537;
 	goto tr734;
@@ -11387,7 +11353,7 @@ case 539:
 		goto tr743;
 	goto tr734;
 tr743:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11396,7 +11362,7 @@ st540:
 	if ( ++p == pe )
 		goto _test_eof540;
 case 540:
-#line 11400 "inc/vcf/validator_detail_v43.hpp"
+#line 11366 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 73 )
 		goto st541;
 	goto tr734;
@@ -11415,7 +11381,7 @@ case 542:
 		goto tr746;
 	goto tr734;
 tr746:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11424,7 +11390,7 @@ st543:
 	if ( ++p == pe )
 		goto _test_eof543;
 case 543:
-#line 11428 "inc/vcf/validator_detail_v43.hpp"
+#line 11394 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 82 )
 		goto st544;
 	goto tr734;
@@ -11450,7 +11416,7 @@ case 546:
 		goto tr750;
 	goto tr734;
 tr750:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11459,7 +11425,7 @@ st547:
 	if ( ++p == pe )
 		goto _test_eof547;
 case 547:
-#line 11463 "inc/vcf/validator_detail_v43.hpp"
+#line 11429 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 65 )
 		goto st548;
 	goto tr734;
@@ -11485,7 +11451,7 @@ case 550:
 		goto tr754;
 	goto tr734;
 tr754:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11494,7 +11460,7 @@ st551:
 	if ( ++p == pe )
 		goto _test_eof551;
 case 551:
-#line 11498 "inc/vcf/validator_detail_v43.hpp"
+#line 11464 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 81 )
 		goto st552;
 	goto tr734;
@@ -11527,7 +11493,7 @@ case 555:
 		goto tr759;
 	goto tr734;
 tr759:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11536,7 +11502,7 @@ st556:
 	if ( ++p == pe )
 		goto _test_eof556;
 case 556:
-#line 11540 "inc/vcf/validator_detail_v43.hpp"
+#line 11506 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 70 )
 		goto st557;
 	goto tr734;
@@ -11583,7 +11549,7 @@ case 562:
 		goto tr766;
 	goto tr734;
 tr766:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11592,7 +11558,7 @@ st563:
 	if ( ++p == pe )
 		goto _test_eof563;
 case 563:
-#line 11596 "inc/vcf/validator_detail_v43.hpp"
+#line 11562 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 73 )
 		goto st564;
 	goto tr734;
@@ -11628,7 +11594,7 @@ case 567:
 	}
 	goto tr734;
 tr771:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11637,7 +11603,7 @@ st568:
 	if ( ++p == pe )
 		goto _test_eof568;
 case 568:
-#line 11641 "inc/vcf/validator_detail_v43.hpp"
+#line 11607 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 70 )
 		goto st569;
 	goto tr774;
@@ -11684,17 +11650,17 @@ case 574:
 		goto tr781;
 	goto tr774;
 tr781:
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
 	goto st575;
 tr783:
-#line 204 "src/vcf/vcf.ragel"
+#line 203 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11703,7 +11669,7 @@ st575:
 	if ( ++p == pe )
 		goto _test_eof575;
 case 575:
-#line 11707 "inc/vcf/validator_detail_v43.hpp"
+#line 11673 "inc/vcf/validator_detail_v43.hpp"
 	if ( 32 <= (*p) && (*p) <= 126 )
 		goto tr782;
 	goto tr774;
@@ -11714,20 +11680,20 @@ tr782:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st576;
 tr786:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st576;
 st576:
 	if ( ++p == pe )
 		goto _test_eof576;
 case 576:
-#line 11731 "inc/vcf/validator_detail_v43.hpp"
+#line 11697 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr783;
 		case 10: goto tr784;
@@ -11737,7 +11703,7 @@ case 576:
 		goto tr786;
 	goto tr774;
 tr772:
-#line 208 "src/vcf/vcf.ragel"
+#line 207 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
@@ -11746,18 +11712,14 @@ tr772:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st659;
 tr784:
-#line 204 "src/vcf/vcf.ragel"
+#line 203 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 208 "src/vcf/vcf.ragel"
+#line 207 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
@@ -11766,17 +11728,13 @@ tr784:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st659;
 st659:
 	if ( ++p == pe )
 		goto _test_eof659;
 case 659:
-#line 11780 "inc/vcf/validator_detail_v43.hpp"
+#line 11738 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr908;
 		case 13: goto tr909;
@@ -11806,14 +11764,10 @@ tr912:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st660;
 tr908:
-#line 70 "src/vcf/vcf.ragel"
+#line 69 "src/vcf/vcf.ragel"
 	{
         try {
           OptionalPolicy::optional_check_meta_section(*this);
@@ -11826,17 +11780,13 @@ tr908:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st660;
 st660:
 	if ( ++p == pe )
 		goto _test_eof660;
 case 660:
-#line 11840 "inc/vcf/validator_detail_v43.hpp"
+#line 11790 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr912;
 		case 13: goto tr913;
@@ -11848,14 +11798,10 @@ tr913:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st577;
 tr909:
-#line 70 "src/vcf/vcf.ragel"
+#line 69 "src/vcf/vcf.ragel"
 	{
         try {
           OptionalPolicy::optional_check_meta_section(*this);
@@ -11868,17 +11814,13 @@ tr909:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st577;
 st577:
 	if ( ++p == pe )
 		goto _test_eof577;
 case 577:
-#line 11882 "inc/vcf/validator_detail_v43.hpp"
+#line 11824 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 10 )
 		goto st660;
 	goto st0;
@@ -11889,17 +11831,17 @@ tr919:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st578;
 tr791:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st578;
 tr910:
-#line 70 "src/vcf/vcf.ragel"
+#line 69 "src/vcf/vcf.ragel"
 	{
         try {
           OptionalPolicy::optional_check_meta_section(*this);
@@ -11913,14 +11855,14 @@ tr910:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st578;
 st578:
 	if ( ++p == pe )
 		goto _test_eof578;
 case 578:
-#line 11924 "inc/vcf/validator_detail_v43.hpp"
+#line 11866 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr790;
 		case 43: goto tr791;
@@ -11944,21 +11886,21 @@ tr790:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
 	goto st579;
 tr849:
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -11967,7 +11909,7 @@ st579:
 	if ( ++p == pe )
 		goto _test_eof579;
 case 579:
-#line 11971 "inc/vcf/validator_detail_v43.hpp"
+#line 11913 "inc/vcf/validator_detail_v43.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr793;
 	goto tr792;
@@ -11978,20 +11920,20 @@ tr793:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st580;
 tr795:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st580;
 st580:
 	if ( ++p == pe )
 		goto _test_eof580;
 case 580:
-#line 11995 "inc/vcf/validator_detail_v43.hpp"
+#line 11937 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 9 )
 		goto tr794;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -12008,11 +11950,11 @@ tr794:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -12021,7 +11963,7 @@ st581:
 	if ( ++p == pe )
 		goto _test_eof581;
 case 581:
-#line 12025 "inc/vcf/validator_detail_v43.hpp"
+#line 11967 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) > 58 ) {
 		if ( 60 <= (*p) && (*p) <= 126 )
 			goto tr797;
@@ -12035,20 +11977,20 @@ tr797:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st582;
 tr799:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st582;
 st582:
 	if ( ++p == pe )
 		goto _test_eof582;
 case 582:
-#line 12052 "inc/vcf/validator_detail_v43.hpp"
+#line 11994 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr798;
 		case 59: goto tr800;
@@ -12061,11 +12003,11 @@ tr798:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -12074,7 +12016,7 @@ st583:
 	if ( ++p == pe )
 		goto _test_eof583;
 case 583:
-#line 12078 "inc/vcf/validator_detail_v43.hpp"
+#line 12020 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 65: goto tr802;
 		case 67: goto tr802;
@@ -12095,20 +12037,20 @@ tr802:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st584;
 tr804:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st584;
 st584:
 	if ( ++p == pe )
 		goto _test_eof584;
 case 584:
-#line 12112 "inc/vcf/validator_detail_v43.hpp"
+#line 12054 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr803;
 		case 65: goto tr804;
@@ -12128,11 +12070,11 @@ tr803:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -12141,7 +12083,7 @@ st585:
 	if ( ++p == pe )
 		goto _test_eof585;
 case 585:
-#line 12145 "inc/vcf/validator_detail_v43.hpp"
+#line 12087 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 42: goto tr806;
 		case 46: goto tr807;
@@ -12167,20 +12109,20 @@ tr806:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st586;
 tr870:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st586;
 st586:
 	if ( ++p == pe )
 		goto _test_eof586;
 case 586:
-#line 12184 "inc/vcf/validator_detail_v43.hpp"
+#line 12126 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr812;
 		case 44: goto tr813;
@@ -12191,11 +12133,11 @@ tr812:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -12204,7 +12146,7 @@ st587:
 	if ( ++p == pe )
 		goto _test_eof587;
 case 587:
-#line 12208 "inc/vcf/validator_detail_v43.hpp"
+#line 12150 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr815;
 		case 45: goto tr815;
@@ -12222,14 +12164,14 @@ tr815:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st588;
 st588:
 	if ( ++p == pe )
 		goto _test_eof588;
 case 588:
-#line 12233 "inc/vcf/validator_detail_v43.hpp"
+#line 12175 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 73 )
 		goto tr821;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -12242,20 +12184,20 @@ tr817:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st589;
 tr820:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st589;
 st589:
 	if ( ++p == pe )
 		goto _test_eof589;
 case 589:
-#line 12259 "inc/vcf/validator_detail_v43.hpp"
+#line 12201 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr822;
 		case 46: goto tr823;
@@ -12270,11 +12212,11 @@ tr822:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -12283,7 +12225,7 @@ st590:
 	if ( ++p == pe )
 		goto _test_eof590;
 case 590:
-#line 12287 "inc/vcf/validator_detail_v43.hpp"
+#line 12229 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 46: goto tr827;
 		case 58: goto tr826;
@@ -12319,7 +12261,7 @@ st591:
 	if ( ++p == pe )
 		goto _test_eof591;
 case 591:
-#line 12323 "inc/vcf/validator_detail_v43.hpp"
+#line 12265 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 58 )
 		goto st591;
 	if ( (*p) < 65 ) {
@@ -12350,20 +12292,20 @@ tr828:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st592;
 tr830:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st592;
 st592:
 	if ( ++p == pe )
 		goto _test_eof592;
 case 592:
-#line 12367 "inc/vcf/validator_detail_v43.hpp"
+#line 12309 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr831;
 		case 59: goto tr832;
@@ -12376,11 +12318,11 @@ tr831:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -12389,7 +12331,7 @@ st593:
 	if ( ++p == pe )
 		goto _test_eof593;
 case 593:
-#line 12393 "inc/vcf/validator_detail_v43.hpp"
+#line 12335 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 46: goto tr834;
 		case 49: goto tr835;
@@ -12408,14 +12350,14 @@ tr834:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st661;
 st661:
 	if ( ++p == pe )
 		goto _test_eof661;
 case 661:
-#line 12419 "inc/vcf/validator_detail_v43.hpp"
+#line 12361 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr915;
 		case 10: goto tr916;
@@ -12433,11 +12375,11 @@ tr915:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -12446,7 +12388,7 @@ st594:
 	if ( ++p == pe )
 		goto _test_eof594;
 case 594:
-#line 12450 "inc/vcf/validator_detail_v43.hpp"
+#line 12392 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 95 )
 		goto tr838;
 	if ( (*p) > 90 ) {
@@ -12462,20 +12404,20 @@ tr838:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st595;
 tr840:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st595;
 st595:
 	if ( ++p == pe )
 		goto _test_eof595;
 case 595:
-#line 12479 "inc/vcf/validator_detail_v43.hpp"
+#line 12421 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr839;
 		case 37: goto tr840;
@@ -12497,11 +12439,11 @@ tr839:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 53 "src/vcf/vcf.ragel"
+#line 49 "src/vcf/vcf.ragel"
 	{
         ++n_columns;
     }
@@ -12510,7 +12452,7 @@ st596:
 	if ( ++p == pe )
 		goto _test_eof596;
 case 596:
-#line 12514 "inc/vcf/validator_detail_v43.hpp"
+#line 12456 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 46 )
 		goto tr844;
 	if ( (*p) < 48 ) {
@@ -12529,20 +12471,27 @@ tr843:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st662;
 tr853:
+#line 478 "src/vcf/vcf.ragel"
+	{
+        {p = ((ParsePolicy::handle_long_value(*this, structural_index, p,
+                ebi::util::StructuralIndex::colon | ebi::util::StructuralIndex::tab |
+                ebi::util::StructuralIndex::newline | ebi::util::StructuralIndex::space |
+                ebi::util::StructuralIndex::control)))-1;}
+    }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st662;
 st662:
 	if ( ++p == pe )
 		goto _test_eof662;
 case 662:
-#line 12546 "inc/vcf/validator_detail_v43.hpp"
+#line 12495 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr839;
 		case 10: goto tr916;
@@ -12557,16 +12506,22 @@ tr916:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 217 "src/vcf/vcf.ragel"
 	{
+        ++n_records;
         try {
             // Handle all columns and build record
             ParsePolicy::handle_body_line(*this);
 
+            // A record with errors is not kept, but all of them are reported
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
+
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
                 for(auto &error_ptr : duplicated_errors) {
@@ -12591,17 +12546,13 @@ tr916:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st663;
 st663:
 	if ( ++p == pe )
 		goto _test_eof663;
 case 663:
-#line 12605 "inc/vcf/validator_detail_v43.hpp"
+#line 12556 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr912;
 		case 13: goto tr913;
@@ -12626,7 +12577,7 @@ case 663:
 		goto tr919;
 	goto tr789;
 tr911:
-#line 70 "src/vcf/vcf.ragel"
+#line 69 "src/vcf/vcf.ragel"
 	{
         try {
           OptionalPolicy::optional_check_meta_section(*this);
@@ -12639,7 +12590,7 @@ st597:
 	if ( ++p == pe )
 		goto _test_eof597;
 case 597:
-#line 12643 "inc/vcf/validator_detail_v43.hpp"
+#line 12594 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr846;
 		case 59: goto tr846;
@@ -12667,20 +12618,20 @@ tr846:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st598;
 tr847:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st598;
 st598:
 	if ( ++p == pe )
 		goto _test_eof598;
 case 598:
-#line 12684 "inc/vcf/validator_detail_v43.hpp"
+#line 12635 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr847;
 		case 59: goto tr847;
@@ -12709,7 +12660,7 @@ st599:
 	if ( ++p == pe )
 		goto _test_eof599;
 case 599:
-#line 12713 "inc/vcf/validator_detail_v43.hpp"
+#line 12664 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 9 )
 		goto tr849;
 	goto tr789;
@@ -12718,16 +12669,22 @@ tr917:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 217 "src/vcf/vcf.ragel"
 	{
+        ++n_records;
         try {
             // Handle all columns and build record
             ParsePolicy::handle_body_line(*this);
 
+            // A record with errors is not kept, but all of them are reported
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
+
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
                 for(auto &error_ptr : duplicated_errors) {
@@ -12752,31 +12709,27 @@ tr917:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st600;
 st600:
 	if ( ++p == pe )
 		goto _test_eof600;
 case 600:
-#line 12766 "inc/vcf/validator_detail_v43.hpp"
+#line 12719 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 10 )
 		goto st663;
 	goto tr850;
 tr918:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st601;
 st601:
 	if ( ++p == pe )
 		goto _test_eof601;
 case 601:
-#line 12780 "inc/vcf/validator_detail_v43.hpp"
+#line 12733 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) > 57 ) {
 		if ( 59 <= (*p) && (*p) <= 126 )
 			goto tr853;
@@ -12790,20 +12743,20 @@ tr844:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st664;
 tr922:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st664;
 st664:
 	if ( ++p == pe )
 		goto _test_eof664;
 case 664:
-#line 12807 "inc/vcf/validator_detail_v43.hpp"
+#line 12760 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr839;
 		case 10: goto tr916;
@@ -12818,14 +12771,14 @@ case 664:
 tr921:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st665;
 st665:
 	if ( ++p == pe )
 		goto _test_eof665;
 case 665:
-#line 12829 "inc/vcf/validator_detail_v43.hpp"
+#line 12782 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr839;
 		case 10: goto tr916;
@@ -12849,20 +12802,20 @@ tr845:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st666;
 tr923:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st666;
 st666:
 	if ( ++p == pe )
 		goto _test_eof666;
 case 666:
-#line 12866 "inc/vcf/validator_detail_v43.hpp"
+#line 12819 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr839;
 		case 10: goto tr916;
@@ -12887,70 +12840,70 @@ tr835:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st602;
 st602:
 	if ( ++p == pe )
 		goto _test_eof602;
 case 602:
-#line 12898 "inc/vcf/validator_detail_v43.hpp"
+#line 12851 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 48 )
 		goto tr854;
 	goto tr833;
 tr854:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st603;
 st603:
 	if ( ++p == pe )
 		goto _test_eof603;
 case 603:
-#line 12912 "inc/vcf/validator_detail_v43.hpp"
+#line 12865 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 48 )
 		goto tr855;
 	goto tr833;
 tr855:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st604;
 st604:
 	if ( ++p == pe )
 		goto _test_eof604;
 case 604:
-#line 12926 "inc/vcf/validator_detail_v43.hpp"
+#line 12879 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 48 )
 		goto tr856;
 	goto tr833;
 tr856:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st605;
 st605:
 	if ( ++p == pe )
 		goto _test_eof605;
 case 605:
-#line 12940 "inc/vcf/validator_detail_v43.hpp"
+#line 12893 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 71 )
 		goto tr857;
 	goto tr833;
 tr857:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st667;
 st667:
 	if ( ++p == pe )
 		goto _test_eof667;
 case 667:
-#line 12954 "inc/vcf/validator_detail_v43.hpp"
+#line 12907 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr915;
 		case 10: goto tr916;
@@ -12969,7 +12922,7 @@ st606:
 	if ( ++p == pe )
 		goto _test_eof606;
 case 606:
-#line 12973 "inc/vcf/validator_detail_v43.hpp"
+#line 12926 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 49: goto tr835;
 		case 95: goto tr836;
@@ -12987,20 +12940,20 @@ tr836:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st668;
 tr926:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st668;
 st668:
 	if ( ++p == pe )
 		goto _test_eof668;
 case 668:
-#line 13004 "inc/vcf/validator_detail_v43.hpp"
+#line 12957 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr915;
 		case 10: goto tr916;
@@ -13022,14 +12975,14 @@ case 668:
 tr925:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st607;
 st607:
 	if ( ++p == pe )
 		goto _test_eof607;
 case 607:
-#line 13033 "inc/vcf/validator_detail_v43.hpp"
+#line 12986 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) > 58 ) {
 		if ( 60 <= (*p) && (*p) <= 126 )
 			goto tr859;
@@ -13037,16 +12990,22 @@ case 607:
 		goto tr859;
 	goto tr858;
 tr859:
+#line 65 "src/vcf/vcf_v43.ragel"
+	{
+        {p = ((ParsePolicy::handle_long_value(*this, structural_index, p,
+                ebi::util::StructuralIndex::semicolon | ebi::util::StructuralIndex::tab |
+                ebi::util::StructuralIndex::newline | ebi::util::StructuralIndex::control)))-1;}
+    }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st669;
 st669:
 	if ( ++p == pe )
 		goto _test_eof669;
 case 669:
-#line 13050 "inc/vcf/validator_detail_v43.hpp"
+#line 13009 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr915;
 		case 10: goto tr916;
@@ -13066,7 +13025,7 @@ st608:
 	if ( ++p == pe )
 		goto _test_eof608;
 case 608:
-#line 13070 "inc/vcf/validator_detail_v43.hpp"
+#line 13029 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 58 )
 		goto tr826;
 	if ( (*p) < 65 ) {
@@ -13097,14 +13056,14 @@ tr827:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st609;
 st609:
 	if ( ++p == pe )
 		goto _test_eof609;
 case 609:
-#line 13108 "inc/vcf/validator_detail_v43.hpp"
+#line 13067 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr831;
 		case 58: goto st591;
@@ -13133,28 +13092,28 @@ case 609:
 tr823:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st610;
 st610:
 	if ( ++p == pe )
 		goto _test_eof610;
 case 610:
-#line 13144 "inc/vcf/validator_detail_v43.hpp"
+#line 13103 "inc/vcf/validator_detail_v43.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr860;
 	goto tr814;
 tr860:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st611;
 st611:
 	if ( ++p == pe )
 		goto _test_eof611;
 case 611:
-#line 13158 "inc/vcf/validator_detail_v43.hpp"
+#line 13117 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr822;
 		case 69: goto tr824;
@@ -13166,14 +13125,14 @@ case 611:
 tr824:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st612;
 st612:
 	if ( ++p == pe )
 		goto _test_eof612;
 case 612:
-#line 13177 "inc/vcf/validator_detail_v43.hpp"
+#line 13136 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr861;
 		case 45: goto tr861;
@@ -13184,28 +13143,28 @@ case 612:
 tr861:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st613;
 st613:
 	if ( ++p == pe )
 		goto _test_eof613;
 case 613:
-#line 13195 "inc/vcf/validator_detail_v43.hpp"
+#line 13154 "inc/vcf/validator_detail_v43.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr862;
 	goto tr814;
 tr862:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st614;
 st614:
 	if ( ++p == pe )
 		goto _test_eof614;
 case 614:
-#line 13209 "inc/vcf/validator_detail_v43.hpp"
+#line 13168 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 9 )
 		goto tr822;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -13218,34 +13177,34 @@ tr818:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st615;
 tr821:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st615;
 st615:
 	if ( ++p == pe )
 		goto _test_eof615;
 case 615:
-#line 13235 "inc/vcf/validator_detail_v43.hpp"
+#line 13194 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 110 )
 		goto tr863;
 	goto tr814;
 tr863:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st616;
 st616:
 	if ( ++p == pe )
 		goto _test_eof616;
 case 616:
-#line 13249 "inc/vcf/validator_detail_v43.hpp"
+#line 13208 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 102 )
 		goto tr864;
 	goto tr814;
@@ -13256,20 +13215,20 @@ tr816:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st617;
 tr864:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st617;
 st617:
 	if ( ++p == pe )
 		goto _test_eof617;
 case 617:
-#line 13273 "inc/vcf/validator_detail_v43.hpp"
+#line 13232 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 9 )
 		goto tr822;
 	goto tr814;
@@ -13280,28 +13239,28 @@ tr819:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st618;
 st618:
 	if ( ++p == pe )
 		goto _test_eof618;
 case 618:
-#line 13291 "inc/vcf/validator_detail_v43.hpp"
+#line 13250 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 97 )
 		goto tr865;
 	goto tr814;
 tr865:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st619;
 st619:
 	if ( ++p == pe )
 		goto _test_eof619;
 case 619:
-#line 13305 "inc/vcf/validator_detail_v43.hpp"
+#line 13264 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 78 )
 		goto tr864;
 	goto tr814;
@@ -13315,7 +13274,7 @@ st620:
 	if ( ++p == pe )
 		goto _test_eof620;
 case 620:
-#line 13319 "inc/vcf/validator_detail_v43.hpp"
+#line 13278 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 42: goto tr806;
 		case 46: goto tr866;
@@ -13341,20 +13300,20 @@ tr866:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st621;
 tr890:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st621;
 st621:
 	if ( ++p == pe )
 		goto _test_eof621;
 case 621:
-#line 13358 "inc/vcf/validator_detail_v43.hpp"
+#line 13317 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 65: goto tr867;
 		case 67: goto tr867;
@@ -13371,14 +13330,14 @@ case 621:
 tr867:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st622;
 st622:
 	if ( ++p == pe )
 		goto _test_eof622;
 case 622:
-#line 13382 "inc/vcf/validator_detail_v43.hpp"
+#line 13341 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr812;
 		case 44: goto tr813;
@@ -13401,20 +13360,20 @@ tr808:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st623;
 tr868:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st623;
 st623:
 	if ( ++p == pe )
 		goto _test_eof623;
 case 623:
-#line 13418 "inc/vcf/validator_detail_v43.hpp"
+#line 13377 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 61 )
 		goto tr868;
 	if ( (*p) < 63 ) {
@@ -13447,14 +13406,14 @@ case 623:
 tr869:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st624;
 st624:
 	if ( ++p == pe )
 		goto _test_eof624;
 case 624:
-#line 13458 "inc/vcf/validator_detail_v43.hpp"
+#line 13417 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 62 )
 		goto tr870;
 	if ( (*p) < 45 ) {
@@ -13473,20 +13432,20 @@ tr809:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st625;
 tr871:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st625;
 st625:
 	if ( ++p == pe )
 		goto _test_eof625;
 case 625:
-#line 13490 "inc/vcf/validator_detail_v43.hpp"
+#line 13449 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr812;
 		case 44: goto tr813;
@@ -13508,14 +13467,14 @@ case 625:
 tr872:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st626;
 st626:
 	if ( ++p == pe )
 		goto _test_eof626;
 case 626:
-#line 13519 "inc/vcf/validator_detail_v43.hpp"
+#line 13478 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr874;
 		case 59: goto tr874;
@@ -13540,14 +13499,14 @@ case 626:
 tr874:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st627;
 st627:
 	if ( ++p == pe )
 		goto _test_eof627;
 case 627:
-#line 13551 "inc/vcf/validator_detail_v43.hpp"
+#line 13510 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr874;
 		case 58: goto tr876;
@@ -13568,28 +13527,28 @@ case 627:
 tr876:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st628;
 st628:
 	if ( ++p == pe )
 		goto _test_eof628;
 case 628:
-#line 13579 "inc/vcf/validator_detail_v43.hpp"
+#line 13538 "inc/vcf/validator_detail_v43.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr877;
 	goto tr805;
 tr877:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st629;
 st629:
 	if ( ++p == pe )
 		goto _test_eof629;
 case 629:
-#line 13593 "inc/vcf/validator_detail_v43.hpp"
+#line 13552 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 91 )
 		goto tr870;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -13598,14 +13557,14 @@ case 629:
 tr875:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st630;
 st630:
 	if ( ++p == pe )
 		goto _test_eof630;
 case 630:
-#line 13609 "inc/vcf/validator_detail_v43.hpp"
+#line 13568 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr878;
 		case 59: goto tr878;
@@ -13629,14 +13588,14 @@ case 630:
 tr878:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st631;
 st631:
 	if ( ++p == pe )
 		goto _test_eof631;
 case 631:
-#line 13640 "inc/vcf/validator_detail_v43.hpp"
+#line 13599 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr878;
 		case 59: goto tr878;
@@ -13658,28 +13617,28 @@ case 631:
 tr879:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st632;
 st632:
 	if ( ++p == pe )
 		goto _test_eof632;
 case 632:
-#line 13669 "inc/vcf/validator_detail_v43.hpp"
+#line 13628 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 58 )
 		goto tr876;
 	goto tr805;
 tr873:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st633;
 st633:
 	if ( ++p == pe )
 		goto _test_eof633;
 case 633:
-#line 13683 "inc/vcf/validator_detail_v43.hpp"
+#line 13642 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr880;
 		case 59: goto tr880;
@@ -13704,14 +13663,14 @@ case 633:
 tr880:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st634;
 st634:
 	if ( ++p == pe )
 		goto _test_eof634;
 case 634:
-#line 13715 "inc/vcf/validator_detail_v43.hpp"
+#line 13674 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr880;
 		case 58: goto tr882;
@@ -13732,28 +13691,28 @@ case 634:
 tr882:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st635;
 st635:
 	if ( ++p == pe )
 		goto _test_eof635;
 case 635:
-#line 13743 "inc/vcf/validator_detail_v43.hpp"
+#line 13702 "inc/vcf/validator_detail_v43.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr883;
 	goto tr805;
 tr883:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st636;
 st636:
 	if ( ++p == pe )
 		goto _test_eof636;
 case 636:
-#line 13757 "inc/vcf/validator_detail_v43.hpp"
+#line 13716 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 93 )
 		goto tr870;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -13762,14 +13721,14 @@ case 636:
 tr881:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st637;
 st637:
 	if ( ++p == pe )
 		goto _test_eof637;
 case 637:
-#line 13773 "inc/vcf/validator_detail_v43.hpp"
+#line 13732 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr884;
 		case 59: goto tr884;
@@ -13793,14 +13752,14 @@ case 637:
 tr884:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st638;
 st638:
 	if ( ++p == pe )
 		goto _test_eof638;
 case 638:
-#line 13804 "inc/vcf/validator_detail_v43.hpp"
+#line 13763 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr884;
 		case 59: goto tr884;
@@ -13822,14 +13781,14 @@ case 638:
 tr885:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st639;
 st639:
 	if ( ++p == pe )
 		goto _test_eof639;
 case 639:
-#line 13833 "inc/vcf/validator_detail_v43.hpp"
+#line 13792 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 58 )
 		goto tr882;
 	goto tr805;
@@ -13840,14 +13799,14 @@ tr810:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st640;
 st640:
 	if ( ++p == pe )
 		goto _test_eof640;
 case 640:
-#line 13851 "inc/vcf/validator_detail_v43.hpp"
+#line 13810 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr886;
 		case 59: goto tr886;
@@ -13872,14 +13831,14 @@ case 640:
 tr886:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st641;
 st641:
 	if ( ++p == pe )
 		goto _test_eof641;
 case 641:
-#line 13883 "inc/vcf/validator_detail_v43.hpp"
+#line 13842 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr886;
 		case 58: goto tr888;
@@ -13900,28 +13859,28 @@ case 641:
 tr888:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st642;
 st642:
 	if ( ++p == pe )
 		goto _test_eof642;
 case 642:
-#line 13911 "inc/vcf/validator_detail_v43.hpp"
+#line 13870 "inc/vcf/validator_detail_v43.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr889;
 	goto tr805;
 tr889:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st643;
 st643:
 	if ( ++p == pe )
 		goto _test_eof643;
 case 643:
-#line 13925 "inc/vcf/validator_detail_v43.hpp"
+#line 13884 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 91 )
 		goto tr890;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -13930,14 +13889,14 @@ case 643:
 tr887:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st644;
 st644:
 	if ( ++p == pe )
 		goto _test_eof644;
 case 644:
-#line 13941 "inc/vcf/validator_detail_v43.hpp"
+#line 13900 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr891;
 		case 59: goto tr891;
@@ -13961,14 +13920,14 @@ case 644:
 tr891:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st645;
 st645:
 	if ( ++p == pe )
 		goto _test_eof645;
 case 645:
-#line 13972 "inc/vcf/validator_detail_v43.hpp"
+#line 13931 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr891;
 		case 59: goto tr891;
@@ -13990,14 +13949,14 @@ case 645:
 tr892:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st646;
 st646:
 	if ( ++p == pe )
 		goto _test_eof646;
 case 646:
-#line 14001 "inc/vcf/validator_detail_v43.hpp"
+#line 13960 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 58 )
 		goto tr888;
 	goto tr805;
@@ -14008,14 +13967,14 @@ tr811:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st647;
 st647:
 	if ( ++p == pe )
 		goto _test_eof647;
 case 647:
-#line 14019 "inc/vcf/validator_detail_v43.hpp"
+#line 13978 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr893;
 		case 59: goto tr893;
@@ -14040,14 +13999,14 @@ case 647:
 tr893:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st648;
 st648:
 	if ( ++p == pe )
 		goto _test_eof648;
 case 648:
-#line 14051 "inc/vcf/validator_detail_v43.hpp"
+#line 14010 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr893;
 		case 58: goto tr895;
@@ -14068,28 +14027,28 @@ case 648:
 tr895:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st649;
 st649:
 	if ( ++p == pe )
 		goto _test_eof649;
 case 649:
-#line 14079 "inc/vcf/validator_detail_v43.hpp"
+#line 14038 "inc/vcf/validator_detail_v43.hpp"
 	if ( 48 <= (*p) && (*p) <= 57 )
 		goto tr896;
 	goto tr805;
 tr896:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st650;
 st650:
 	if ( ++p == pe )
 		goto _test_eof650;
 case 650:
-#line 14093 "inc/vcf/validator_detail_v43.hpp"
+#line 14052 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 93 )
 		goto tr890;
 	if ( 48 <= (*p) && (*p) <= 57 )
@@ -14098,14 +14057,14 @@ case 650:
 tr894:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st651;
 st651:
 	if ( ++p == pe )
 		goto _test_eof651;
 case 651:
-#line 14109 "inc/vcf/validator_detail_v43.hpp"
+#line 14068 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr897;
 		case 59: goto tr897;
@@ -14129,14 +14088,14 @@ case 651:
 tr897:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st652;
 st652:
 	if ( ++p == pe )
 		goto _test_eof652;
 case 652:
-#line 14140 "inc/vcf/validator_detail_v43.hpp"
+#line 14099 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 43: goto tr897;
 		case 59: goto tr897;
@@ -14158,14 +14117,14 @@ case 652:
 tr898:
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st653;
 st653:
 	if ( ++p == pe )
 		goto _test_eof653;
 case 653:
-#line 14169 "inc/vcf/validator_detail_v43.hpp"
+#line 14128 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 58 )
 		goto tr895;
 	goto tr805;
@@ -14176,14 +14135,14 @@ tr807:
     }
 #line 35 "src/vcf/vcf.ragel"
 	{
-        ParsePolicy::handle_token_char(*this, *p);
+        ParsePolicy::handle_token_char(*this, p);
     }
 	goto st654;
 st654:
 	if ( ++p == pe )
 		goto _test_eof654;
 case 654:
-#line 14187 "inc/vcf/validator_detail_v43.hpp"
+#line 14146 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 9: goto tr812;
 		case 65: goto tr867;
@@ -14199,7 +14158,7 @@ case 654:
 	}
 	goto tr805;
 tr773:
-#line 208 "src/vcf/vcf.ragel"
+#line 207 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
@@ -14208,18 +14167,14 @@ tr773:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st655;
 tr785:
-#line 204 "src/vcf/vcf.ragel"
+#line 203 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_sample_name(*this);
     }
-#line 208 "src/vcf/vcf.ragel"
+#line 207 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_header_line(*this);
     }
@@ -14228,28 +14183,24 @@ tr785:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st655;
 st655:
 	if ( ++p == pe )
 		goto _test_eof655;
 case 655:
-#line 14242 "inc/vcf/validator_detail_v43.hpp"
+#line 14193 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 10 )
 		goto st659;
 	goto tr774;
 tr23:
-#line 99 "src/vcf/vcf.ragel"
+#line 98 "src/vcf/vcf.ragel"
 	{
         try {
           ParsePolicy::handle_fileformat(*this);
         } catch (Error *error) {
           ErrorPolicy::handle_error(*this, error);
-          p--; {goto st657;}
+          {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
         }
     }
 #line 43 "src/vcf/vcf.ragel"
@@ -14257,17 +14208,13 @@ tr23:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st656;
 st656:
 	if ( ++p == pe )
 		goto _test_eof656;
 case 656:
-#line 14271 "inc/vcf/validator_detail_v43.hpp"
+#line 14218 "inc/vcf/validator_detail_v43.hpp"
 	if ( (*p) == 10 )
 		goto st22;
 	goto tr0;
@@ -14277,17 +14224,13 @@ tr903:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st657;
 st657:
 	if ( ++p == pe )
 		goto _test_eof657;
 case 657:
-#line 14291 "inc/vcf/validator_detail_v43.hpp"
+#line 14234 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr902;
 		case 13: goto tr903;
@@ -14299,19 +14242,15 @@ tr902:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
-#line 257 "src/vcf/vcf_v43.ragel"
+#line 268 "src/vcf/vcf_v43.ragel"
 	{ {goto st28;} }
 	goto st670;
 st670:
 	if ( ++p == pe )
 		goto _test_eof670;
 case 670:
-#line 14315 "inc/vcf/validator_detail_v43.hpp"
+#line 14254 "inc/vcf/validator_detail_v43.hpp"
 	goto st0;
 tr906:
 #line 43 "src/vcf/vcf.ragel"
@@ -14319,17 +14258,13 @@ tr906:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
 	goto st658;
 st658:
 	if ( ++p == pe )
 		goto _test_eof658;
 case 658:
-#line 14333 "inc/vcf/validator_detail_v43.hpp"
+#line 14268 "inc/vcf/validator_detail_v43.hpp"
 	switch( (*p) ) {
 		case 10: goto tr905;
 		case 13: goto tr906;
@@ -14341,19 +14276,15 @@ tr905:
         ParsePolicy::handle_newline(*this);
         ++n_lines;
         n_columns = 1;
-
-        if (n_lines % 10000 == 0) {
-            std::cout << "Lines read: " << n_lines << std::endl;
-        }
     }
-#line 258 "src/vcf/vcf_v43.ragel"
-	{ {goto st663;} }
+#line 269 "src/vcf/vcf_v43.ragel"
+	{ ++n_records; {goto st663;} }
 	goto st671;
 st671:
 	if ( ++p == pe )
 		goto _test_eof671;
 case 671:
-#line 14357 "inc/vcf/validator_detail_v43.hpp"
+#line 14288 "inc/vcf/validator_detail_v43.hpp"
 	goto st0;
 	}
 	_test_eof2: cs = 2; goto _test_eof; 
@@ -15045,10 +14976,10 @@ case 671:
 	case 12: 
 	case 13: 
 	case 656: 
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 25: 
@@ -15099,14 +15030,14 @@ case 671:
 	case 71: 
 	case 72: 
 	case 73: 
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 659: 
-#line 70 "src/vcf/vcf.ragel"
+#line 69 "src/vcf/vcf.ragel"
 	{
         try {
           OptionalPolicy::optional_check_meta_section(*this);
@@ -15116,7 +15047,7 @@ case 671:
     }
 	break;
 	case 655: 
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -15127,14 +15058,14 @@ case 671:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 600: 
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 74: 
@@ -15159,15 +15090,15 @@ case 671:
 	case 96: 
 	case 103: 
 	case 114: 
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 441: 
@@ -15178,15 +15109,15 @@ case 671:
 	case 446: 
 	case 447: 
 	case 448: 
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 468: 
@@ -15218,15 +15149,15 @@ case 671:
 	case 496: 
 	case 497: 
 	case 498: 
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 123: 
@@ -15253,15 +15184,15 @@ case 671:
 	case 147: 
 	case 154: 
 	case 165: 
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 173: 
@@ -15300,15 +15231,15 @@ case 671:
 	case 213: 
 	case 220: 
 	case 231: 
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 240: 
@@ -15346,15 +15277,15 @@ case 671:
 	case 279: 
 	case 286: 
 	case 297: 
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 352: 
@@ -15391,15 +15322,15 @@ case 671:
 	case 403: 
 	case 404: 
 	case 405: 
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 499: 
@@ -15413,15 +15344,15 @@ case 671:
 	case 507: 
 	case 508: 
 	case 509: 
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 306: 
@@ -15456,15 +15387,15 @@ case 671:
 	case 348: 
 	case 349: 
 	case 351: 
-#line 326 "src/vcf/vcf.ragel"
+#line 331 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 409: 
@@ -15496,69 +15427,69 @@ case 671:
 	case 438: 
 	case 439: 
 	case 440: 
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 578: 
 	case 597: 
 	case 598: 
 	case 599: 
-#line 396 "src/vcf/vcf.ragel"
+#line 401 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ChromosomeBodyError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 579: 
 	case 580: 
-#line 402 "src/vcf/vcf.ragel"
+#line 407 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new PositionBodyError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 581: 
 	case 582: 
-#line 408 "src/vcf/vcf.ragel"
+#line 413 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new IdBodyError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 583: 
 	case 584: 
-#line 414 "src/vcf/vcf.ragel"
+#line 419 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new ReferenceAlleleBodyError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 585: 
@@ -15598,15 +15529,15 @@ case 671:
 	case 652: 
 	case 653: 
 	case 654: 
-#line 420 "src/vcf/vcf.ragel"
+#line 425 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new AlternateAllelesBodyError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 587: 
@@ -15622,15 +15553,15 @@ case 671:
 	case 617: 
 	case 618: 
 	case 619: 
-#line 426 "src/vcf/vcf.ragel"
+#line 431 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new QualityBodyError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 590: 
@@ -15638,15 +15569,15 @@ case 671:
 	case 592: 
 	case 608: 
 	case 609: 
-#line 432 "src/vcf/vcf.ragel"
+#line 437 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FilterBodyError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 14: 
@@ -15661,12 +15592,12 @@ case 671:
 	{
         ErrorPolicy::handle_error(*this,
                 new FileformatError{n_lines, "The fileformat declaration is not 'fileformat=VCFv4.3'"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 594: 
@@ -15674,12 +15605,12 @@ case 671:
 #line 50 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FormatBodyError{n_lines, "Format does not start with a letter/underscore followed by alphanumeric/underscore/dot characters"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 568: 
@@ -15694,9 +15625,9 @@ case 671:
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -15707,99 +15638,99 @@ case 671:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 81: 
 	case 82: 
 	case 83: 
-#line 252 "src/vcf/vcf.ragel"
+#line 257 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines,
             "ALT metadata ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 122: 
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 199: 
 	case 200: 
-#line 293 "src/vcf/vcf.ragel"
+#line 298 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 265: 
 	case 266: 
-#line 293 "src/vcf/vcf.ragel"
+#line 298 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Type is not Integer, Float, Flag, Character or String"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 406: 
 	case 407: 
 	case 408: 
-#line 304 "src/vcf/vcf.ragel"
+#line 309 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata Original is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 374: 
@@ -15808,20 +15739,20 @@ case 671:
 	case 384: 
 	case 385: 
 	case 386: 
-#line 309 "src/vcf/vcf.ragel"
+#line 314 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata Father or Mother is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 367: 
@@ -15835,38 +15766,38 @@ case 671:
 	case 395: 
 	case 396: 
 	case 397: 
-#line 314 "src/vcf/vcf.ragel"
+#line 319 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "PEDIGREE metadata sequence of Name_N is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 324: 
 	case 325: 
-#line 331 "src/vcf/vcf.ragel"
+#line 336 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Number is not a dot"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 331 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 331: 
@@ -15876,75 +15807,75 @@ case 671:
 	case 335: 
 	case 336: 
 	case 337: 
-#line 336 "src/vcf/vcf.ragel"
+#line 341 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Type is not String"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 331 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 347: 
 	case 350: 
-#line 341 "src/vcf/vcf.ragel"
+#line 346 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "META metadata Values is not a square-bracket delimited list of values"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 331 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 100: 
 	case 101: 
 	case 102: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 478: 
 	case 479: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 132: 
@@ -15953,20 +15884,20 @@ case 671:
 	case 151: 
 	case 152: 
 	case 153: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 182: 
@@ -15975,20 +15906,20 @@ case 671:
 	case 217: 
 	case 218: 
 	case 219: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 248: 
@@ -15997,77 +15928,77 @@ case 671:
 	case 283: 
 	case 284: 
 	case 285: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 364: 
 	case 365: 
 	case 366: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 314: 
 	case 315: 
 	case 316: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 331 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 419: 
 	case 420: 
 	case 421: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 97: 
@@ -16084,20 +16015,20 @@ case 671:
 	case 116: 
 	case 120: 
 	case 121: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 148: 
@@ -16114,20 +16045,20 @@ case 671:
 	case 167: 
 	case 171: 
 	case 172: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 214: 
@@ -16144,20 +16075,20 @@ case 671:
 	case 233: 
 	case 237: 
 	case 238: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 280: 
@@ -16174,20 +16105,20 @@ case 671:
 	case 299: 
 	case 303: 
 	case 304: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 449: 
@@ -16209,20 +16140,20 @@ case 671:
 	case 465: 
 	case 466: 
 	case 467: 
-#line 373 "src/vcf/vcf.ragel"
+#line 378 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 510: 
@@ -16246,20 +16177,20 @@ case 671:
 	case 528: 
 	case 529: 
 	case 530: 
-#line 373 "src/vcf/vcf.ragel"
+#line 378 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata URL is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 192: 
@@ -16268,17 +16199,17 @@ case 671:
 #line 36 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "FORMAT metadata Number is not a number, A, R, G or dot"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 258: 
@@ -16287,17 +16218,17 @@ case 671:
 #line 42 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "INFO metadata Number is not a number, A, R, G or dot"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 531: 
@@ -16340,9 +16271,9 @@ case 671:
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -16354,9 +16285,9 @@ case 671:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -16367,26 +16298,26 @@ case 671:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 601: 
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 459 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
         ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 661: 
@@ -16398,21 +16329,27 @@ case 671:
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 217 "src/vcf/vcf.ragel"
 	{
+        ++n_records;
         try {
             // Handle all columns and build record
             ParsePolicy::handle_body_line(*this);
 
+            // A record with errors is not kept, but all of them are reported
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
+
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
                 for(auto &error_ptr : duplicated_errors) {
@@ -16435,17 +16372,17 @@ case 671:
 	break;
 	case 23: 
 	case 28: 
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -16457,9 +16394,9 @@ case 671:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -16470,199 +16407,199 @@ case 671:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 108: 
 	case 109: 
 	case 110: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 159: 
 	case 160: 
 	case 161: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 225: 
 	case 226: 
 	case 227: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 291: 
 	case 292: 
 	case 293: 
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 117: 
 	case 118: 
 	case 119: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 168: 
 	case 169: 
 	case 170: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 234: 
 	case 235: 
 	case 236: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 300: 
 	case 301: 
 	case 302: 
-#line 368 "src/vcf/vcf.ragel"
+#line 373 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata description string is not valid"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 363 "src/vcf/vcf.ragel"
+#line 368 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Metadata ID contains a character different from alphanumeric, dot, underscore and dash"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
 	case 593: 
@@ -16671,47 +16608,47 @@ case 671:
 	case 604: 
 	case 605: 
 	case 606: 
-#line 443 "src/vcf/vcf.ragel"
+#line 448 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info key is not a sequence of alphanumeric and/or punctuation characters"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 443 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 607: 
-#line 448 "src/vcf/vcf.ragel"
+#line 453 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info field value is not a comma-separated list of valid strings (maybe it contains whitespaces?)"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 438 "src/vcf/vcf.ragel"
+#line 443 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new InfoBodyError{n_lines, "Info is not a single dot or a semicolon-separated list of key-value pairs"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 664: 
@@ -16720,22 +16657,28 @@ case 671:
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 #line 39 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_token_end(*this);
     }
-#line 214 "src/vcf/vcf.ragel"
+#line 213 "src/vcf/vcf.ragel"
 	{
         ParsePolicy::handle_column_end(*this, n_columns);
     }
-#line 218 "src/vcf/vcf.ragel"
+#line 217 "src/vcf/vcf.ragel"
 	{
+        ++n_records;
         try {
             // Handle all columns and build record
             ParsePolicy::handle_body_line(*this);
 
+            // A record with errors is not kept, but all of them are reported
+            for (auto &error_ptr : record_errors) {
+                ErrorPolicy::handle_error(*this, error_ptr.release());
+            }
+
             if (record != nullptr) {
                 auto duplicated_errors = previous_records.check_duplicates(*record);
                 for(auto &error_ptr : duplicated_errors) {
@@ -16760,45 +16703,45 @@ case 671:
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 461 "src/vcf/vcf.ragel"
+#line 466 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " does not start with a valid genotype";
         ErrorPolicy::handle_error(*this, new SamplesFieldBodyError{n_lines, message_stream.str(), "GT"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 454 "src/vcf/vcf.ragel"
+#line 459 "src/vcf/vcf.ragel"
 	{
         std::ostringstream message_stream;
         message_stream << "Sample #" << (n_columns - 9) << " is not a valid string";
         ErrorPolicy::handle_error(*this, new SamplesBodyError{n_lines, message_stream.str()});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 91 "src/vcf/vcf.ragel"
+#line 90 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 22: 
-#line 60 "src/vcf/vcf.ragel"
+#line 59 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new FileformatError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 #line 55 "src/vcf/vcf_v43.ragel"
 	{
         ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "There is no newline at the end of the file"});
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 379 "src/vcf/vcf.ragel"
+#line 384 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines,
             "The header line does not start with the mandatory columns: CHROM, POS, ID, REF, ALT, QUAL, FILTER and INFO"});
@@ -16810,9 +16753,9 @@ case 671:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
-#line 78 "src/vcf/vcf.ragel"
+#line 77 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new HeaderSectionError{n_lines});
         
@@ -16823,75 +16766,80 @@ case 671:
           ErrorPolicy::handle_warning(*this, warn);
         }
         
-        p--; {goto st658;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st658;}
     }
 	break;
 	case 24: 
-#line 247 "src/vcf/vcf.ragel"
+#line 252 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in ALT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 271 "src/vcf/vcf.ragel"
+#line 276 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FILTER metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 277 "src/vcf/vcf.ragel"
+#line 282 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in FORMAT metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 288 "src/vcf/vcf.ragel"
+#line 293 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in INFO metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 259 "src/vcf/vcf.ragel"
+#line 264 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in assembly metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 265 "src/vcf/vcf.ragel"
+#line 270 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in contig metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 326 "src/vcf/vcf.ragel"
+#line 331 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in META metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 347 "src/vcf/vcf.ragel"
+#line 352 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in SAMPLE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 299 "src/vcf/vcf.ragel"
+#line 304 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in PEDIGREE metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 320 "src/vcf/vcf.ragel"
+#line 325 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines, "Error in pedigreeDB metadata"});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
-#line 65 "src/vcf/vcf.ragel"
+#line 64 "src/vcf/vcf.ragel"
 	{
         ErrorPolicy::handle_error(*this, new MetaSectionError{n_lines});
-        p--; {goto st657;}
+        {p = ((ebi::util::find_line_break(p, pe)))-1;} {goto st657;}
     }
 	break;
-#line 16887 "inc/vcf/validator_detail_v43.hpp"
+#line 16830 "inc/vcf/validator_detail_v43.hpp"
 	}
 	}
 
 	_out: {}
 	}
 
-#line 287 "src/vcf/vcf_v43.ragel"
+#line 304 "src/vcf/vcf_v43.ragel"
+
+      ParsePolicy::handle_buffer_end(*this, pe);
 
+      if (cs == vcf_v43_error) {
+          ErrorPolicy::handle_error(*this, new BodySectionError{n_lines, "Records are not allowed after an empty line"});
+      }
     }
     
   }
@@ -0,0 +1,93 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <thread>
+
+#include "util/batch_scheduler.hpp"
+
+namespace ebi
+{
+  namespace util
+  {
+    BatchScheduler::BatchScheduler(size_t n_threads, size_t memory_budget)
+    : n_threads{std::max(n_threads, size_t{1})}, memory_budget{memory_budget},
+      next_job{0}, memory_in_use{0}, n_running{0}, error{}
+    {
+    }
+
+    void BatchScheduler::run(std::vector<Job> jobs, std::function<void(size_t)> const & process)
+    {
+        std::stable_sort(jobs.begin(), jobs.end(), [](Job const & a, Job const & b) { return a.size > b.size; });
+
+        next_job = 0;
+        memory_in_use = 0;
+        n_running = 0;
+        error = nullptr;
+
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < std::min(n_threads, jobs.size()); ++i) {
+            workers.emplace_back(&BatchScheduler::work, this, std::cref(jobs), std::cref(process));
+        }
+        work(jobs, process);
+        for (auto & worker : workers) {
+            worker.join();
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    void BatchScheduler::work(std::vector<Job> const & jobs, std::function<void(size_t)> const & process)
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        while (true) {
+            finished_job.wait(lock, [&]() {
+                return next_job == jobs.size() || can_start(jobs[next_job]);
+            });
+            if (next_job == jobs.size()) {
+                return;
+            }
+
+            Job const & job = jobs[next_job++];
+            memory_in_use += job.memory;
+            ++n_running;
+
+            lock.unlock();
+            std::exception_ptr job_error;
+            try {
+                process(job.index);
+            } catch (...) {
+                job_error = std::current_exception();
+            }
+            lock.lock();
+
+            memory_in_use -= job.memory;
+            --n_running;
+            if (job_error && !error) {
+                error = job_error;
+            }
+            finished_job.notify_all();
+        }
+    }
+
+    bool BatchScheduler::can_start(Job const & job) const
+    {
+        return memory_budget == 0 || n_running == 0 || memory_in_use + job.memory <= memory_budget;
+    }
+  }
+}
@@ -0,0 +1,577 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+
+#include <zlib.h>
+
+#include "util/compression.hpp"
+
+namespace ebi
+{
+  namespace util
+  {
+    namespace
+    {
+      unsigned char const gzip_magic_1 = 0x1f;
+      unsigned char const gzip_magic_2 = 0x8b;
+      unsigned char const gzip_flag_extra = 0x04;
+      size_t const gzip_header_size = 10;
+      size_t const gzip_trailer_size = 8;
+
+      size_t const bgzf_max_block_size = 64 * 1024;
+      size_t const bgzf_blocks_per_thread = 4;
+
+      uint32_t read_le32(char const * data)
+      {
+          auto bytes = reinterpret_cast<unsigned char const *>(data);
+          return uint32_t(bytes[0]) | (uint32_t(bytes[1]) << 8) | (uint32_t(bytes[2]) << 16)
+                  | (uint32_t(bytes[3]) << 24);
+      }
+
+      /**
+       * @return the BSIZE field (total block size minus 1) of a BGZF header, or 0 if not found
+       */
+      size_t read_bgzf_block_size(char const * data, size_t extra_length)
+      {
+          auto bytes = reinterpret_cast<unsigned char const *>(data);
+          size_t extra_end = gzip_header_size + 2 + extra_length;
+          for (size_t i = gzip_header_size + 2; i + 4 <= extra_end; ) {
+              size_t subfield_length = bytes[i + 2] | (bytes[i + 3] << 8);
+              if (bytes[i] == 'B' && bytes[i + 1] == 'C' && subfield_length == 2 && i + 6 <= extra_end) {
+                  return bytes[i + 4] | (bytes[i + 5] << 8);
+              }
+              i += 4 + subfield_length;
+          }
+          return 0;
+      }
+
+      /**
+       * Reads a whole BGZF block into `data`, which must have room for bgzf_max_block_size bytes
+       *
+       * @param read reads up to `size` bytes into its first argument, and returns the amount actually read
+       * @param offset position of the block in the compressed input, for error reporting
+       * @return size of the block, or 0 if the input has no more blocks
+       */
+      size_t read_bgzf_block(std::function<size_t(char *, size_t)> const & read, char * data, uint64_t offset)
+      {
+          size_t header_size = gzip_header_size + 2;
+          size_t read_size = read(data, header_size);
+          if (read_size == 0) {
+              return 0;
+          }
+          if (read_size < header_size) {
+              throw std::runtime_error{"The compressed input ended unexpectedly"};
+          }
+
+          auto bytes = reinterpret_cast<unsigned char const *>(data);
+          size_t extra_length = bytes[10] | (bytes[11] << 8);
+          if (bytes[0] != gzip_magic_1 || bytes[1] != gzip_magic_2 || bytes[3] != gzip_flag_extra
+                  || header_size + extra_length > bgzf_max_block_size) {
+              throw std::runtime_error{"The compressed input has an invalid BGZF block header at offset "
+                                       + std::to_string(offset)};
+          }
+          if (read(data + header_size, extra_length) < extra_length) {
+              throw std::runtime_error{"The compressed input ended unexpectedly"};
+          }
+
+          size_t block_size = read_bgzf_block_size(data, extra_length) + 1;
+          if (block_size < header_size + extra_length + gzip_trailer_size || block_size > bgzf_max_block_size) {
+              throw std::runtime_error{"The compressed input has an invalid BGZF block size at offset "
+                                       + std::to_string(offset)};
+          }
+          size_t remaining = block_size - header_size - extra_length;
+          if (read(data + header_size + extra_length, remaining) < remaining) {
+              throw std::runtime_error{"The compressed input ended unexpectedly"};
+          }
+
+          return block_size;
+      }
+
+      /**
+       * Inflates a BGZF block and checks its CRC32 and ISIZE
+       *
+       * @param stream raw deflate stream, reset before being used
+       * @return size of the inflated contents
+       */
+      size_t inflate_bgzf_block(char * data,
+                                size_t block_size,
+                                std::vector<char> & inflated,
+                                z_stream & stream,
+                                uint64_t offset)
+      {
+          size_t extra_length = static_cast<unsigned char>(data[10]) | (static_cast<unsigned char>(data[11]) << 8);
+          size_t header_size = gzip_header_size + 2 + extra_length;
+          char const * trailer = data + block_size - gzip_trailer_size;
+
+          inflateReset(&stream);
+          stream.next_in = reinterpret_cast<Bytef *>(data + header_size);
+          stream.avail_in = static_cast<uInt>(block_size - header_size - gzip_trailer_size);
+          stream.next_out = reinterpret_cast<Bytef *>(inflated.data());
+          stream.avail_out = static_cast<uInt>(inflated.size());
+
+          int status = inflate(&stream, Z_FINISH);
+          if (status != Z_STREAM_END) {
+              throw std::runtime_error{"The BGZF block at offset " + std::to_string(offset)
+                                       + " could not be decompressed: "
+                                       + (stream.msg != nullptr ? stream.msg : "unknown error")};
+          }
+          size_t inflated_size = inflated.size() - stream.avail_out;
+
+          if (inflated_size != read_le32(trailer + 4)) {
+              throw std::runtime_error{"The BGZF block at offset " + std::to_string(offset)
+                                       + " does not match its uncompressed size (ISIZE)"};
+          }
+          uLong checksum = crc32(crc32(0L, Z_NULL, 0), reinterpret_cast<Bytef const *>(inflated.data()),
+                                 static_cast<uInt>(inflated_size));
+          if (checksum != read_le32(trailer)) {
+              throw std::runtime_error{"The BGZF block at offset " + std::to_string(offset)
+                                       + " does not match its checksum (CRC32)"};
+          }
+          return inflated_size;
+      }
+    }
+
+    bool is_gzip(std::istream &input)
+    {
+        if (input.peek() != gzip_magic_1) {
+            return false;
+        }
+        input.get();
+        bool magic = input.peek() == gzip_magic_2;
+        input.unget();
+        return magic;
+    }
+
+    bool is_bgzf_header(char const * data, size_t size)
+    {
+        auto bytes = reinterpret_cast<unsigned char const *>(data);
+        if (size < gzip_header_size + 2 || bytes[0] != gzip_magic_1 || bytes[1] != gzip_magic_2
+                || (bytes[3] & gzip_flag_extra) == 0) {
+            return false;
+        }
+
+        // Look for the subfield SI1='B', SI2='C' among the extra fields
+        size_t extra_length = bytes[10] | (bytes[11] << 8);
+        size_t extra_end = std::min(size, gzip_header_size + 2 + extra_length);
+        for (size_t i = gzip_header_size + 2; i + 4 <= extra_end; ) {
+            size_t subfield_length = bytes[i + 2] | (bytes[i + 3] << 8);
+            if (bytes[i] == 'B' && bytes[i + 1] == 'C' && subfield_length == 2) {
+                return true;
+            }
+            i += 4 + subfield_length;
+        }
+        return false;
+    }
+
+    std::unique_ptr<std::streambuf> make_gzip_streambuf(std::istream &input, size_t n_threads, bool &bgzf)
+    {
+        // The first chunk is read here to know the file format before the decompression starts
+        std::vector<char> first_chunk(default_compressed_chunk_size);
+        input.read(first_chunk.data(), first_chunk.size());
+        first_chunk.resize(static_cast<size_t>(input.gcount()));
+
+        bgzf = is_bgzf_header(first_chunk.data(), first_chunk.size());
+        if (bgzf && n_threads > 1) {
+            return std::unique_ptr<std::streambuf>{new BgzfStreambuf{input, first_chunk, n_threads}};
+        }
+        return std::unique_ptr<std::streambuf>{new GzipStreambuf{input, first_chunk}};
+    }
+
+    GzipStreambuf::GzipStreambuf(std::istream &input, std::vector<char> const & first_chunk,
+                                 size_t buffer_size, size_t n_buffers)
+    : input(input), compressed(first_chunk), first_chunk_size{first_chunk.size()},
+      ring{n_buffers, buffer_size}, current{nullptr}, error{}
+    {
+        compressed.resize(std::max(compressed.size(), default_compressed_chunk_size));
+        inflater = std::thread{&GzipStreambuf::inflate_input, this};
+    }
+
+    GzipStreambuf::~GzipStreambuf()
+    {
+        ring.close();
+        inflater.join();
+    }
+
+    GzipStreambuf::int_type GzipStreambuf::underflow()
+    {
+        if (current != nullptr) {
+            ring.release(current);
+        }
+
+        current = ring.pop_full();
+        if (current == nullptr) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            return traits_type::eof();
+        }
+
+        setg(current->data.data(), current->data.data(), current->data.data() + current->size);
+        return traits_type::to_int_type(*gptr());
+    }
+
+    size_t GzipStreambuf::read_compressed()
+    {
+        input.read(compressed.data(), compressed.size());
+        return static_cast<size_t>(input.gcount());
+    }
+
+    void GzipStreambuf::inflate_input()
+    {
+        z_stream stream{};
+        // 16 added to the window bits means that only the gzip format is accepted
+        if (inflateInit2(&stream, 15 + 16) != Z_OK) {
+            error = std::make_exception_ptr(std::runtime_error{"Couldn't initialize the gzip decompression"});
+            ring.finish();
+            return;
+        }
+
+        try {
+            stream.next_in = reinterpret_cast<Bytef *>(compressed.data());
+            stream.avail_in = static_cast<uInt>(first_chunk_size);
+            bool member_open = true;
+            bool end_of_input = false;
+
+            while (!end_of_input) {
+                BufferRing::Buffer * buffer = ring.acquire_empty();
+                if (buffer == nullptr) {
+                    break;  // the reader is not interested in more data
+                }
+
+                stream.next_out = reinterpret_cast<Bytef *>(buffer->data.data());
+                stream.avail_out = static_cast<uInt>(buffer->data.size());
+
+                while (stream.avail_out > 0 && !end_of_input) {
+                    if (stream.avail_in == 0) {
+                        size_t read = read_compressed();
+                        if (read == 0) {
+                            if (member_open) {
+                                throw std::runtime_error{"The compressed input ended unexpectedly"};
+                            }
+                            end_of_input = true;
+                            break;
+                        }
+                        stream.next_in = reinterpret_cast<Bytef *>(compressed.data());
+                        stream.avail_in = static_cast<uInt>(read);
+                    }
+
+                    if (!member_open) {
+                        // Another gzip member may follow the previous one, anything else (e.g. zero padding) is ignored
+                        if (stream.avail_in == 1) {
+                            compressed[0] = static_cast<char>(*stream.next_in);
+                            input.read(compressed.data() + 1, compressed.size() - 1);
+                            stream.next_in = reinterpret_cast<Bytef *>(compressed.data());
+                            stream.avail_in = static_cast<uInt>(1 + input.gcount());
+                        }
+                        if (stream.avail_in < 2 || stream.next_in[0] != gzip_magic_1
+                                || stream.next_in[1] != gzip_magic_2) {
+                            end_of_input = true;
+                            break;
+                        }
+                        inflateReset(&stream);
+                        member_open = true;
+                    }
+
+                    int status = inflate(&stream, Z_NO_FLUSH);
+                    if (status == Z_STREAM_END) {
+                        member_open = false;
+                    } else if (status != Z_OK && status != Z_BUF_ERROR) {
+                        throw std::runtime_error{std::string{"The compressed input could not be decompressed: "}
+                                                 + (stream.msg != nullptr ? stream.msg : "unknown error")};
+                    }
+                }
+
+                buffer->size = buffer->data.size() - stream.avail_out;
+                if (buffer->size > 0) {
+                    ring.push_full(buffer);
+                } else {
+                    ring.release(buffer);
+                }
+            }
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        inflateEnd(&stream);
+        ring.finish();
+    }
+
+    BgzfStreambuf::BgzfStreambuf(std::istream &input, std::vector<char> const & first_chunk, size_t n_threads)
+    : input(input), first_chunk(first_chunk), first_chunk_position{0}, input_position{0},
+      blocks(n_threads * bgzf_blocks_per_thread), n_read{0}, n_consumed{0}, end_of_input{false}, closed{false}
+    {
+        for (auto & block : blocks) {
+            block.compressed.resize(bgzf_max_block_size);
+            block.inflated.resize(bgzf_max_block_size);
+            block.state = BlockState::empty;
+        }
+
+        reader = std::thread{&BgzfStreambuf::read_blocks, this};
+        for (size_t i = 0; i < n_threads; ++i) {
+            inflaters.emplace_back(&BgzfStreambuf::inflate_blocks, this);
+        }
+    }
+
+    BgzfStreambuf::~BgzfStreambuf()
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            closed = true;
+            changed.notify_all();
+        }
+        reader.join();
+        for (auto & inflater : inflaters) {
+            inflater.join();
+        }
+    }
+
+    BgzfStreambuf::int_type BgzfStreambuf::underflow()
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+
+        if (n_consumed > 0) {
+            // The block provided in the previous call has been completely read
+            blocks[(n_consumed - 1) % blocks.size()].state = BlockState::empty;
+            changed.notify_all();
+        }
+
+        while (true) {
+            Block & block = blocks[n_consumed % blocks.size()];
+            changed.wait(lock, [this, &block] {
+                return n_consumed < n_read ? block.state == BlockState::inflated : end_of_input;
+            });
+
+            if (n_consumed == n_read) {
+                setg(nullptr, nullptr, nullptr);
+                if (read_error) {
+                    std::rethrow_exception(read_error);
+                }
+                return traits_type::eof();
+            }
+
+            ++n_consumed;
+            if (block.error) {
+                std::rethrow_exception(block.error);
+            }
+            if (block.inflated_size > 0) {
+                setg(block.inflated.data(), block.inflated.data(), block.inflated.data() + block.inflated_size);
+                return traits_type::to_int_type(*gptr());
+            }
+
+            // Empty blocks, like the end-of-file marker, are skipped
+            block.state = BlockState::empty;
+            changed.notify_all();
+        }
+    }
+
+    size_t BgzfStreambuf::read_compressed(char * data, size_t size)
+    {
+        size_t from_first_chunk = std::min(size, first_chunk.size() - first_chunk_position);
+        std::copy_n(first_chunk.data() + first_chunk_position, from_first_chunk, data);
+        first_chunk_position += from_first_chunk;
+
+        size_t read = from_first_chunk;
+        if (read < size) {
+            input.read(data + read, size - read);
+            read += static_cast<size_t>(input.gcount());
+        }
+        input_position += read;
+        return read;
+    }
+
+    bool BgzfStreambuf::read_block(Block & block)
+    {
+        block.offset = input_position;
+        block.compressed_size = read_bgzf_block([this](char * data, size_t size) { return read_compressed(data, size); },
+                                                block.compressed.data(), block.offset);
+        return block.compressed_size != 0;
+    }
+
+    void BgzfStreambuf::read_blocks()
+    {
+        try {
+            while (true) {
+                Block * block;
+                {
+                    std::unique_lock<std::mutex> lock{mutex};
+                    block = &blocks[n_read % blocks.size()];
+                    changed.wait(lock, [this, block] { return closed || block->state == BlockState::empty; });
+                    if (closed) {
+                        return;
+                    }
+                }
+
+                // Only this thread accesses the block until it is queued to be inflated
+                if (!read_block(*block)) {
+                    break;
+                }
+
+                std::lock_guard<std::mutex> lock{mutex};
+                block->state = BlockState::compressed;
+                block->error = nullptr;
+                to_inflate.push_back(block);
+                ++n_read;
+                changed.notify_all();
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock{mutex};
+            read_error = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock{mutex};
+        end_of_input = true;
+        changed.notify_all();
+    }
+
+    void BgzfStreambuf::inflate_blocks()
+    {
+        z_stream stream{};
+        // Negative window bits mean a raw deflate stream: the gzip header and trailer are checked separately
+        bool initialized = inflateInit2(&stream, -15) == Z_OK;
+
+        while (true) {
+            Block * block;
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                changed.wait(lock, [this] { return closed || !to_inflate.empty(); });
+                if (closed) {
+                    break;
+                }
+                block = to_inflate.front();
+                to_inflate.pop_front();
+            }
+
+            try {
+                if (!initialized) {
+                    throw std::runtime_error{"Couldn't initialize the gzip decompression"};
+                }
+                inflate_block(*block, stream);
+            } catch (...) {
+                block->error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock{mutex};
+            block->state = BlockState::inflated;
+            changed.notify_all();
+        }
+
+        if (initialized) {
+            inflateEnd(&stream);
+        }
+    }
+
+    void BgzfStreambuf::inflate_block(Block & block, z_stream & stream)
+    {
+        block.inflated_size = inflate_bgzf_block(block.compressed.data(), block.compressed_size, block.inflated,
+                                                 stream, block.offset);
+    }
+
+    BgzfRangeStreambuf::BgzfRangeStreambuf(std::istream &input, std::vector<Range> const & ranges)
+    : input(input), ranges(ranges), current_range{0}, has_block{false}, input_position{bgzf_end_of_input},
+      compressed(bgzf_max_block_size), inflated(bgzf_max_block_size), block_offset{0}, block_size{0},
+      inflated_size{0}, stream{}
+    {
+        // Negative window bits mean a raw deflate stream: the gzip header and trailer are checked separately
+        if (inflateInit2(&stream, -15) != Z_OK) {
+            throw std::runtime_error{"Couldn't initialize the gzip decompression"};
+        }
+    }
+
+    BgzfRangeStreambuf::~BgzfRangeStreambuf()
+    {
+        inflateEnd(&stream);
+    }
+
+    uint64_t BgzfRangeStreambuf::tell() const
+    {
+        if (has_block && gptr() == eback() + inflated_size) {
+            // The end of a block is the same position as the beginning of the next one
+            return (block_offset + block_size) << 16;
+        }
+        return (block_offset << 16) | static_cast<uint64_t>(gptr() - eback());
+    }
+
+    uint64_t BgzfRangeStreambuf::block_end() const
+    {
+        return block_offset + block_size;
+    }
+
+    BgzfRangeStreambuf::int_type BgzfRangeStreambuf::underflow()
+    {
+        while (current_range < ranges.size()) {
+            Range const & range = ranges[current_range];
+            uint64_t end_block = range.end >> 16;
+            size_t begin_in_block = 0;
+
+            if (!has_block) {
+                has_block = range.begin < range.end && read_block(range.begin >> 16);
+                begin_in_block = range.begin & 0xffff;
+            } else if (block_offset < end_block) {
+                has_block = read_block(block_offset + block_size);
+            } else {
+                has_block = false;
+            }
+
+            if (!has_block) {
+                ++current_range;
+                continue;
+            }
+
+            size_t end_in_block = block_offset == end_block ? std::min<size_t>(range.end & 0xffff, inflated_size)
+                                                            : inflated_size;
+            if (begin_in_block < end_in_block) {
+                setg(inflated.data(), inflated.data() + begin_in_block, inflated.data() + end_in_block);
+                return traits_type::to_int_type(*gptr());
+            }
+        }
+
+        setg(nullptr, nullptr, nullptr);
+        return traits_type::eof();
+    }
+
+    bool BgzfRangeStreambuf::read_block(uint64_t offset)
+    {
+        if (offset != input_position) {
+            input.clear();
+            input.seekg(static_cast<std::streamoff>(offset));
+            if (!input) {
+                throw std::runtime_error{"The compressed input could not be read at offset " + std::to_string(offset)};
+            }
+            input_position = offset;
+        }
+
+        auto read = [this](char * data, size_t size) {
+            input.read(data, size);
+            size_t read_size = static_cast<size_t>(input.gcount());
+            input_position += read_size;
+            return read_size;
+        };
+        block_offset = offset;
+        block_size = read_bgzf_block(read, compressed.data(), offset);
+        if (block_size == 0) {
+            inflated_size = 0;
+            return false;
+        }
+        inflated_size = inflate_bgzf_block(compressed.data(), block_size, inflated, stream, offset);
+        return true;
+    }
+  }
+}
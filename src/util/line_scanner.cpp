@@ -0,0 +1,332 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include "util/line_scanner.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && defined(__SSE2__)
+#define UTIL_LINE_SCANNER_X86
+#include <immintrin.h>
+#endif
+
+namespace ebi
+{
+  namespace util
+  {
+    namespace
+    {
+      char const * find_line_break_scalar(char const * begin, char const * end)
+      {
+          return std::find_if(begin, end, [](char c) { return c == '\n' || c == '\r'; });
+      }
+
+      size_t count_newlines_scalar(char const * begin, char const * end)
+      {
+          return std::count(begin, end, '\n');
+      }
+
+      size_t const block_size = StructuralIndex::block_size;
+      size_t const n_kinds = StructuralIndex::n_kinds;
+
+      /**
+       * Returns the position of the character in StructuralIndex::Kind, or n_kinds if it is not indexed
+       */
+      size_t character_kind(unsigned char c)
+      {
+          switch (c) {
+              case '\n': return 0;
+              case '\t': return 1;
+              case ';':  return 2;
+              case ':':  return 3;
+              case ',':  return 4;
+              case '=':  return 5;
+              case ' ':  return 6;
+              default:   return (c < ' ' || c >= 0x7f) ? 7 : n_kinds;
+          }
+      }
+
+      void index_characters_scalar(char const * begin, char const * end, uint64_t * bitmaps)
+      {
+          for (; begin != end; bitmaps += n_kinds) {
+              std::fill(bitmaps, bitmaps + n_kinds, 0);
+              size_t length = std::min(static_cast<size_t>(end - begin), block_size);
+              for (size_t i = 0; i < length; ++i) {
+                  size_t kind = character_kind(begin[i]);
+                  if (kind < n_kinds) {
+                      bitmaps[kind] |= uint64_t{1} << i;
+                  }
+              }
+              begin += length;
+          }
+      }
+
+#ifdef UTIL_LINE_SCANNER_X86
+      char const * find_line_break_sse2(char const * begin, char const * end)
+      {
+          __m128i const newline = _mm_set1_epi8('\n');
+          __m128i const carriage_return = _mm_set1_epi8('\r');
+          for (; end - begin >= 16; begin += 16) {
+              __m128i block = _mm_loadu_si128(reinterpret_cast<__m128i const *>(begin));
+              int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, newline),
+                                                        _mm_cmpeq_epi8(block, carriage_return)));
+              if (mask != 0) {
+                  return begin + __builtin_ctz(mask);
+              }
+          }
+          return find_line_break_scalar(begin, end);
+      }
+
+      size_t count_newlines_sse2(char const * begin, char const * end)
+      {
+          __m128i const newline = _mm_set1_epi8('\n');
+          size_t count = 0;
+          for (; end - begin >= 16; begin += 16) {
+              __m128i block = _mm_loadu_si128(reinterpret_cast<__m128i const *>(begin));
+              count += __builtin_popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline)));
+          }
+          return count + count_newlines_scalar(begin, end);
+      }
+
+      __attribute__((target("avx2")))
+      char const * find_line_break_avx2(char const * begin, char const * end)
+      {
+          __m256i const newline = _mm256_set1_epi8('\n');
+          __m256i const carriage_return = _mm256_set1_epi8('\r');
+          for (; end - begin >= 32; begin += 32) {
+              __m256i block = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(begin));
+              unsigned mask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(block, newline),
+                                                                   _mm256_cmpeq_epi8(block, carriage_return)));
+              if (mask != 0) {
+                  return begin + __builtin_ctz(mask);
+              }
+          }
+          return find_line_break_sse2(begin, end);
+      }
+
+      __attribute__((target("avx2")))
+      size_t count_newlines_avx2(char const * begin, char const * end)
+      {
+          __m256i const newline = _mm256_set1_epi8('\n');
+          size_t count = 0;
+          for (; end - begin >= 32; begin += 32) {
+              __m256i block = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(begin));
+              count += __builtin_popcount(static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block,
+                                                                                                       newline))));
+          }
+          return count + count_newlines_sse2(begin, end);
+      }
+
+      /**
+       * Returns in `masks` a bit per character in `chars` for each kind
+       */
+      void classify_sse2(__m128i chars, uint64_t (&masks)[n_kinds])
+      {
+          __m128i is_newline = _mm_cmpeq_epi8(chars, _mm_set1_epi8('\n'));
+          __m128i is_tab = _mm_cmpeq_epi8(chars, _mm_set1_epi8('\t'));
+          // Characters outside ASCII are negative, so they are below ' ' too
+          __m128i is_control = _mm_or_si128(_mm_andnot_si128(_mm_or_si128(is_newline, is_tab),
+                                                             _mm_cmplt_epi8(chars, _mm_set1_epi8(' '))),
+                                            _mm_cmpeq_epi8(chars, _mm_set1_epi8(0x7f)));
+          __m128i const kinds[n_kinds] = {
+              is_newline,
+              is_tab,
+              _mm_cmpeq_epi8(chars, _mm_set1_epi8(';')),
+              _mm_cmpeq_epi8(chars, _mm_set1_epi8(':')),
+              _mm_cmpeq_epi8(chars, _mm_set1_epi8(',')),
+              _mm_cmpeq_epi8(chars, _mm_set1_epi8('=')),
+              _mm_cmpeq_epi8(chars, _mm_set1_epi8(' ')),
+              is_control,
+          };
+          for (size_t kind = 0; kind < n_kinds; ++kind) {
+              masks[kind] = static_cast<unsigned>(_mm_movemask_epi8(kinds[kind]));
+          }
+      }
+
+      void index_characters_sse2(char const * begin, char const * end, uint64_t * bitmaps)
+      {
+          for (; static_cast<size_t>(end - begin) >= block_size; begin += block_size, bitmaps += n_kinds) {
+              uint64_t masks[4][n_kinds];
+              for (int chunk = 0; chunk < 4; ++chunk) {
+                  classify_sse2(_mm_loadu_si128(reinterpret_cast<__m128i const *>(begin + 16 * chunk)), masks[chunk]);
+              }
+              for (size_t kind = 0; kind < n_kinds; ++kind) {
+                  bitmaps[kind] = masks[0][kind] | masks[1][kind] << 16 | masks[2][kind] << 32 | masks[3][kind] << 48;
+              }
+          }
+          index_characters_scalar(begin, end, bitmaps);
+      }
+
+      __attribute__((target("avx2")))
+      void classify_avx2(__m256i chars, uint64_t (&masks)[n_kinds])
+      {
+          __m256i is_newline = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\n'));
+          __m256i is_tab = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\t'));
+          // Characters outside ASCII are negative, so they are below ' ' too
+          __m256i is_control = _mm256_or_si256(_mm256_andnot_si256(_mm256_or_si256(is_newline, is_tab),
+                                                                   _mm256_cmpgt_epi8(_mm256_set1_epi8(' '), chars)),
+                                               _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(0x7f)));
+          __m256i const kinds[n_kinds] = {
+              is_newline,
+              is_tab,
+              _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(';')),
+              _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(':')),
+              _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(',')),
+              _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('=')),
+              _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(' ')),
+              is_control,
+          };
+          for (size_t kind = 0; kind < n_kinds; ++kind) {
+              masks[kind] = static_cast<unsigned>(_mm256_movemask_epi8(kinds[kind]));
+          }
+      }
+
+      __attribute__((target("avx2")))
+      void index_characters_avx2(char const * begin, char const * end, uint64_t * bitmaps)
+      {
+          for (; static_cast<size_t>(end - begin) >= block_size; begin += block_size, bitmaps += n_kinds) {
+              uint64_t masks[2][n_kinds];
+              for (int chunk = 0; chunk < 2; ++chunk) {
+                  classify_avx2(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(begin + 32 * chunk)),
+                                masks[chunk]);
+              }
+              for (size_t kind = 0; kind < n_kinds; ++kind) {
+                  bitmaps[kind] = masks[0][kind] | masks[1][kind] << 32;
+              }
+          }
+          index_characters_scalar(begin, end, bitmaps);
+      }
+#endif
+
+      /**
+       * Implementations chosen for the processor the program runs on
+       */
+      struct LineScanner
+      {
+          char const * (*find_line_break)(char const *, char const *);
+          size_t (*count_newlines)(char const *, char const *);
+          void (*index_characters)(char const *, char const *, uint64_t *);
+      };
+
+      LineScanner select_line_scanner()
+      {
+#ifdef UTIL_LINE_SCANNER_X86
+          __builtin_cpu_init();
+          if (__builtin_cpu_supports("avx2")) {
+              return {find_line_break_avx2, count_newlines_avx2, index_characters_avx2};
+          }
+          return {find_line_break_sse2, count_newlines_sse2, index_characters_sse2};
+#else
+          return {find_line_break_scalar, count_newlines_scalar, index_characters_scalar};
+#endif
+      }
+
+      /**
+       * Returns the position of the lowest bit set, which must exist
+       */
+      size_t first_bit(uint64_t bits)
+      {
+#ifdef __GNUC__
+          return __builtin_ctzll(bits);
+#else
+          size_t position = 0;
+          for (; (bits & 1) == 0; bits >>= 1) {
+              ++position;
+          }
+          return position;
+#endif
+      }
+
+      LineScanner const & line_scanner()
+      {
+          static LineScanner const scanner = select_line_scanner();
+          return scanner;
+      }
+    }
+
+    char const * find_line_break(char const * begin, char const * end)
+    {
+        return line_scanner().find_line_break(begin, end);
+    }
+
+    size_t count_newlines(char const * begin, char const * end)
+    {
+        return line_scanner().count_newlines(begin, end);
+    }
+
+    StructuralIndex::StructuralIndex()
+    : m_begin{nullptr}, m_end{nullptr}, m_short_run_end{nullptr}, m_indexed_begin{0}, m_indexed_end{0}, m_n_blocks{0}, m_capacity{0}
+    {
+    }
+
+    void StructuralIndex::build(char const * begin, char const * end)
+    {
+        m_begin = begin;
+        m_end = end;
+        m_short_run_end = nullptr;
+        m_indexed_begin = m_indexed_end = 0;
+        m_n_blocks = (end - begin + block_size - 1) / block_size;
+        if (m_capacity < m_n_blocks) {
+            // Not initialized, as no block is read before being indexed
+            m_bitmaps.reset(new uint64_t[m_n_blocks * n_kinds]);
+            m_capacity = m_n_blocks;
+        }
+    }
+
+    char const * StructuralIndex::find(char const * from, unsigned kinds)
+    {
+        if (from >= m_end) {
+            return m_end;
+        }
+
+        size_t offset = from - m_begin;
+        uint64_t first_bits = ~uint64_t{0} << (offset % block_size);
+        for (size_t block = offset / block_size; block < m_n_blocks; ++block) {
+            if (block < m_indexed_begin || block >= m_indexed_end) {
+                index_blocks(block);
+            }
+            uint64_t const * bitmaps = m_bitmaps.get() + block * n_kinds;
+            uint64_t found = 0;
+            for (size_t kind = 0; kind < n_kinds; ++kind) {
+                if (kinds & (1u << kind)) {
+                    found |= bitmaps[kind];
+                }
+            }
+            found &= first_bits;
+            if (found != 0) {
+                return m_begin + block * block_size + first_bit(found);
+            }
+            first_bits = ~uint64_t{0};
+        }
+        return m_end;
+    }
+
+    void StructuralIndex::index_blocks(size_t block)
+    {
+        // Some blocks are indexed in advance, because the following values will most likely need them
+        size_t const blocks_in_advance = 16;
+        size_t last = std::min(block + blocks_in_advance, m_n_blocks);
+        char const * end = last == m_n_blocks ? m_end : m_begin + last * block_size;
+        line_scanner().index_characters(m_begin + block * block_size, end, m_bitmaps.get() + block * n_kinds);
+
+        // The blocks indexed are kept contiguous, so anything before a gap is forgotten
+        if (block != m_indexed_end) {
+            m_indexed_begin = block;
+        }
+        m_indexed_end = last;
+    }
+  }
+}
@@ -0,0 +1,187 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cmath>
+#include <limits>
+
+#include "util/number_scanner.hpp"
+
+namespace ebi
+{
+  namespace util
+  {
+    namespace
+    {
+      bool is_digit(char c)
+      {
+          return c >= '0' && c <= '9';
+      }
+
+      /**
+       * Compares [begin, end) with a lowercase word, ignoring the case of the text
+       */
+      bool equals_ignore_case(char const * begin, char const * end, char const * word)
+      {
+          for (; begin != end && *word != '\0'; ++begin, ++word) {
+              if ((*begin | 0x20) != *word) {
+                  return false;
+              }
+          }
+          return begin == end && *word == '\0';
+      }
+
+      // Powers of ten that are exact in a double
+      double const exact_powers_of_ten[] = {
+              1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+              1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+      int const max_exact_power_of_ten = 22;
+      uint64_t const max_exact_mantissa = uint64_t{1} << 53;
+      int const max_significant_digits = 19;
+    }
+
+    NumberStatus scan_integer(char const * begin, char const * end, int64_t & value)
+    {
+        bool negative = false;
+        if (begin != end && (*begin == '-' || *begin == '+')) {
+            negative = *begin == '-';
+            ++begin;
+        }
+        if (begin == end) {
+            return NumberStatus::invalid;
+        }
+
+        // Accumulated as negative, which reaches one more value than positive
+        int64_t const limit = std::numeric_limits<int64_t>::min();
+        int64_t accumulated = 0;
+        bool overflow = false;
+        for (; begin != end; ++begin) {
+            if (!is_digit(*begin)) {
+                return NumberStatus::invalid;
+            }
+            int digit = *begin - '0';
+            if (accumulated < (limit + digit) / 10) {
+                overflow = true;
+            } else {
+                accumulated = accumulated * 10 - digit;
+            }
+        }
+
+        if (overflow || (!negative && accumulated == limit)) {
+            value = negative ? limit : std::numeric_limits<int64_t>::max();
+            return NumberStatus::out_of_range;
+        }
+        value = negative ? accumulated : -accumulated;
+        return NumberStatus::valid;
+    }
+
+    NumberStatus scan_float(char const * begin, char const * end, double & value)
+    {
+        bool negative = false;
+        if (begin != end && (*begin == '-' || *begin == '+')) {
+            negative = *begin == '-';
+            ++begin;
+        }
+
+        if (begin != end && !is_digit(*begin) && *begin != '.') {
+            if (equals_ignore_case(begin, end, "inf") || equals_ignore_case(begin, end, "infinity")) {
+                value = negative ? -HUGE_VAL : HUGE_VAL;
+                return NumberStatus::valid;
+            }
+            if (equals_ignore_case(begin, end, "nan")) {
+                value = std::numeric_limits<double>::quiet_NaN();
+                return NumberStatus::valid;
+            }
+            return NumberStatus::invalid;
+        }
+
+        // Only the first significant digits are kept, the rest just scale the mantissa
+        uint64_t mantissa = 0;
+        int n_significant = 0;
+        int exponent = 0;
+        size_t n_digits = 0;
+
+        for (; begin != end && is_digit(*begin); ++begin, ++n_digits) {
+            if (n_significant < max_significant_digits) {
+                mantissa = mantissa * 10 + (*begin - '0');
+                n_significant += mantissa != 0;
+            } else {
+                ++exponent;
+            }
+        }
+        if (begin != end && *begin == '.') {
+            ++begin;
+            for (; begin != end && is_digit(*begin); ++begin, ++n_digits) {
+                if (n_significant < max_significant_digits) {
+                    mantissa = mantissa * 10 + (*begin - '0');
+                    n_significant += mantissa != 0;
+                    --exponent;
+                }
+            }
+        }
+        if (n_digits == 0) {
+            return NumberStatus::invalid;
+        }
+
+        if (begin != end && (*begin == 'e' || *begin == 'E')) {
+            ++begin;
+            bool negative_exponent = false;
+            if (begin != end && (*begin == '-' || *begin == '+')) {
+                negative_exponent = *begin == '-';
+                ++begin;
+            }
+            if (begin == end) {
+                return NumberStatus::invalid;
+            }
+            int written_exponent = 0;
+            for (; begin != end; ++begin) {
+                if (!is_digit(*begin)) {
+                    return NumberStatus::invalid;
+                }
+                // Anything beyond this over- or underflows anyway
+                if (written_exponent < 100000) {
+                    written_exponent = written_exponent * 10 + (*begin - '0');
+                }
+            }
+            exponent += negative_exponent ? -written_exponent : written_exponent;
+        }
+        if (begin != end) {
+            return NumberStatus::invalid;
+        }
+
+        double magnitude;
+        if (mantissa == 0) {
+            magnitude = 0;
+        } else if (mantissa <= max_exact_mantissa && exponent >= -max_exact_power_of_ten
+                   && exponent <= max_exact_power_of_ten) {
+            // Both operands are exact, so the result is correctly rounded
+            magnitude = exponent < 0 ? mantissa / exact_powers_of_ten[-exponent]
+                                     : mantissa * exact_powers_of_ten[exponent];
+        } else {
+            long double scaled = mantissa;
+            scaled = exponent < 0 ? scaled / std::pow(10.0L, -exponent) : scaled * std::pow(10.0L, exponent);
+            magnitude = static_cast<double>(scaled);
+        }
+
+        value = negative ? -magnitude : magnitude;
+        if (std::isinf(magnitude)) {
+            return NumberStatus::out_of_range;
+        }
+        return NumberStatus::valid;
+    }
+  }
+}
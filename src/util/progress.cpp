@@ -0,0 +1,169 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <csignal>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "util/progress.hpp"
+
+namespace ebi
+{
+  namespace util
+  {
+    namespace
+    {
+      volatile std::sig_atomic_t report_requested = 0;
+
+      void request_report(int signal)
+      {
+          report_requested = 1;
+      }
+
+      /**
+       * Interval between checks of whether SIGUSR1 was received
+       */
+      std::chrono::milliseconds const poll_interval{100};
+    }
+
+    ProgressCounters & progress_counters()
+    {
+        static ProgressCounters counters;
+        return counters;
+    }
+
+    ProgressReporter::ProgressReporter(ProgressOptions const & options)
+    : options(options), start{std::chrono::steady_clock::now()}, last_report{start},
+      last_bytes{progress_counters().bytes.load(std::memory_order_relaxed)}, stopping{false}
+    {
+        report_requested = 0;
+        previous_handler = std::signal(SIGUSR1, request_report);
+        thread = std::thread{&ProgressReporter::run, this};
+    }
+
+    ProgressReporter::~ProgressReporter()
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            stopping = true;
+        }
+        stopped.notify_one();
+        thread.join();
+        std::signal(SIGUSR1, previous_handler == SIG_ERR ? SIG_DFL : previous_handler);
+
+        try {
+            report();
+        } catch (std::exception const & ex) {
+            std::cerr << ex.what() << std::endl;
+        }
+    }
+
+    void ProgressReporter::run()
+    {
+        auto next_report = std::chrono::steady_clock::now() + std::chrono::seconds{options.interval};
+        std::unique_lock<std::mutex> lock{mutex};
+        while (!stopped.wait_for(lock, poll_interval, [this]() { return stopping; })) {
+            auto now = std::chrono::steady_clock::now();
+            bool is_due = options.interval > 0 && now >= next_report;
+            if (!report_requested && !is_due) {
+                continue;
+            }
+            report_requested = 0;
+            next_report = now + std::chrono::seconds{options.interval};
+
+            lock.unlock();
+            try {
+                report();
+            } catch (std::exception const & ex) {
+                // The validation goes on without progress reports
+                std::cerr << ex.what() << std::endl;
+            }
+            lock.lock();
+        }
+    }
+
+    void ProgressReporter::report()
+    {
+        std::lock_guard<std::mutex> lock{report_mutex};
+        auto & counters = progress_counters();
+        uint64_t lines = counters.lines.load(std::memory_order_relaxed);
+        uint64_t bytes = counters.bytes.load(std::memory_order_relaxed);
+        uint64_t records = counters.records.load(std::memory_order_relaxed);
+        uint64_t errors = counters.errors.load(std::memory_order_relaxed);
+        uint64_t warnings = counters.warnings.load(std::memory_order_relaxed);
+
+        auto now = std::chrono::steady_clock::now();
+        double elapsed = std::chrono::duration<double>(now - start).count();
+        double since_last = std::chrono::duration<double>(now - last_report).count();
+        double rate = since_last > 0 ? (bytes - last_bytes) / since_last : 0;
+        last_report = now;
+        last_bytes = bytes;
+
+        // The ETA assumes the rest of the input is read at the average rate so far
+        bool has_eta = options.total_bytes > 0 && bytes > 0;
+        double eta = 0;
+        if (has_eta && options.total_bytes > bytes) {
+            eta = (options.total_bytes - bytes) / (bytes / elapsed);
+        }
+
+        std::ostringstream text;
+        text << std::fixed << std::setprecision(1);
+        if (options.path.empty()) {
+            text << "Progress: " << elapsed << " s, " << lines << " lines, " << records << " records, "
+                 << bytes / 1e6 << " MB read at " << rate / 1e6 << " MB/s, "
+                 << errors << " errors, " << warnings << " warnings";
+            if (has_eta) {
+                text << ", " << std::min(100.0, 100.0 * bytes / options.total_bytes) << "% done, ETA "
+                     << eta << " s";
+            }
+            std::cerr << text.str() << std::endl;
+            return;
+        }
+
+        text << "{\"elapsed_seconds\": " << elapsed
+             << ", \"lines\": " << lines
+             << ", \"records\": " << records
+             << ", \"bytes\": " << bytes
+             << ", \"bytes_per_second\": " << rate
+             << ", \"errors\": " << errors
+             << ", \"warnings\": " << warnings;
+        if (has_eta) {
+            text << ", \"total_bytes\": " << options.total_bytes << ", \"eta_seconds\": " << eta;
+        } else {
+            text << ", \"total_bytes\": null, \"eta_seconds\": null";
+        }
+        text << "}\n";
+
+        // Readers of the file never see it half written
+        std::string temporary = options.path + ".tmp";
+        {
+            std::ofstream file{temporary};
+            file << text.str();
+            if (!file) {
+                throw std::runtime_error{"Couldn't write the progress file " + temporary};
+            }
+        }
+        if (std::rename(temporary.c_str(), options.path.c_str()) != 0) {
+            throw std::runtime_error{"Couldn't write the progress file " + options.path};
+        }
+    }
+  }
+}
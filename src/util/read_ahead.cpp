@@ -0,0 +1,72 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/read_ahead.hpp"
+
+namespace ebi
+{
+  namespace util
+  {
+    ReadAheadStreambuf::ReadAheadStreambuf(std::istream &input, size_t buffer_size, size_t n_buffers)
+    : input(input), ring{n_buffers, buffer_size}, current{nullptr}, error{}
+    {
+        reader = std::thread{&ReadAheadStreambuf::read_input, this};
+    }
+
+    ReadAheadStreambuf::~ReadAheadStreambuf()
+    {
+        ring.close();
+        reader.join();
+    }
+
+    ReadAheadStreambuf::int_type ReadAheadStreambuf::underflow()
+    {
+        if (current != nullptr) {
+            ring.release(current);
+        }
+
+        current = ring.pop_full();
+        if (current == nullptr) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            return traits_type::eof();
+        }
+
+        setg(current->data.data(), current->data.data(), current->data.data() + current->size);
+        return traits_type::to_int_type(*gptr());
+    }
+
+    void ReadAheadStreambuf::read_input()
+    {
+        try {
+            while (BufferRing::Buffer * buffer = ring.acquire_empty()) {
+                input.read(buffer->data.data(), buffer->data.size());
+                buffer->size = static_cast<size_t>(input.gcount());
+                if (buffer->size == 0) {
+                    ring.release(buffer);
+                    break;
+                }
+                ring.push_full(buffer);
+            }
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        ring.finish();
+    }
+  }
+}
@@ -14,9 +14,11 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <stdexcept>
@@ -26,12 +28,21 @@
 #include <boost/program_options.hpp>
 #include <boost/filesystem/operations.hpp>
 
+#include "util/batch_scheduler.hpp"
+#include "util/compression.hpp"
+#include "util/mapped_file.hpp"
+#include "util/progress.hpp"
+#include "util/read_ahead.hpp"
+#include "util/stream_utils.hpp"
+#include "vcf/checkpoint.hpp"
 #include "vcf/file_structure.hpp"
 #include "vcf/validator.hpp"
 #include "vcf/ploidy.hpp"
 #include "vcf/report_writer.hpp"
 #include "vcf/odb_report.hpp"
+#include "vcf/sampling.hpp"
 #include "vcf/summary_report_writer.hpp"
+#include "vcf/tabix_index.hpp"
 
 namespace
 {
@@ -43,12 +54,25 @@ namespace
 
         description.add_options()
             ("help,h", "Display this help")
-            ("input,i", po::value<std::string>()->default_value("stdin"), "Path to the input VCF file, or stdin")
+            ("input,i", po::value<std::vector<std::string>>()->default_value({"stdin"}, "stdin")->composing(), "Path to the input VCF file, or stdin. Can be repeated to validate several files")
+            ("input-list,f", po::value<std::string>(), "Path to a file listing several input VCF files, one per line")
             ("level,l", po::value<std::string>()->default_value("warning"), "Validation level (error, warning, stop)")
             ("report,r", po::value<std::string>()->default_value("stdout"), "Comma separated values for types of reports (database, stdout)")
             ("outdir,o", po::value<std::string>()->default_value(""), "Directory for the output")
             ("ploidy,p", po::value<long>()->default_value(2), "Genome ploidy to expect through most or the whole VCF file (can be overwritten with --special-ploidy)")
             ("special-ploidy,s", po::value<std::string>(), "Ploidy expected in specific chromosomes/contigs, e.g Y=1,MyTriploidContig=3")
+            ("threads,t", po::value<long>()->default_value(1), "Amount of threads decompressing BGZF inputs and validating the body of the file")
+            ("region,R", po::value<std::vector<std::string>>()->composing(), "Only validate the records around a region, e.g. chr1:1-5000000, using the tabix or CSI index of a bgzipped input. Can be repeated")
+            ("sample-blocks", po::value<long>(), "Only validate the header and some windows of the body: the first, the last, and this amount of random ones")
+            ("sample-fraction", po::value<double>(), "Only validate the header and random windows of the body covering roughly this fraction of the file")
+            ("jobs,j", po::value<long>()->default_value(1), "Amount of input files validated at the same time, biggest first")
+            ("memory,m", po::value<long>()->default_value(1024), "Memory budget in MB for the input files validated at the same time (0 means no limit)")
+            ("checkpoint", po::value<std::string>(), "Periodically save the progress of the validation to this file, so it can be resumed with --resume. The body is validated by a single thread")
+            ("checkpoint-interval", po::value<long>()->default_value(ebi::vcf::default_checkpoint_interval), "Seconds between checkpoints")
+            ("resume", po::bool_switch(), "Resume the validation from the file given with --checkpoint")
+            ("progress", po::bool_switch(), "Periodically write the progress of the validation to stderr, and also whenever the process receives SIGUSR1")
+            ("progress-interval", po::value<long>()->default_value(ebi::util::default_progress_interval), "Seconds between progress reports, 0 to only report on SIGUSR1")
+            ("progress-file", po::value<std::string>(), "Write the progress reports to this JSON file instead of stderr (implies --progress)")
         ;
 
         return description;
@@ -74,6 +98,58 @@ namespace
             return 1;
         }
 
+        long threads = vm["threads"].as<long>();
+        if (threads <= 0) {
+            std::cout << "The amount of threads must be greater than 0" << std::endl;
+            return 1;
+        }
+
+        long jobs = vm["jobs"].as<long>();
+        if (jobs <= 0) {
+            std::cout << "The amount of jobs must be greater than 0" << std::endl;
+            return 1;
+        }
+
+        long memory = vm["memory"].as<long>();
+        if (memory < 0) {
+            std::cout << "The memory budget can't be negative" << std::endl;
+            return 1;
+        }
+
+        if (vm.count("sample-blocks") && vm["sample-blocks"].as<long>() < 0) {
+            std::cout << "The amount of sampled windows can't be negative" << std::endl;
+            return 1;
+        }
+        if (vm.count("sample-fraction")) {
+            double fraction = vm["sample-fraction"].as<double>();
+            if (fraction <= 0 || fraction > 1) {
+                std::cout << "The sampled fraction must be greater than 0 and at most 1" << std::endl;
+                return 1;
+            }
+        }
+        if ((vm.count("sample-blocks") || vm.count("sample-fraction")) && vm.count("region")) {
+            std::cout << "Regions and samples can't be validated at the same time" << std::endl;
+            return 1;
+        }
+
+        if (vm["checkpoint-interval"].as<long>() < 0) {
+            std::cout << "The interval between checkpoints can't be negative" << std::endl;
+            return 1;
+        }
+        if (vm["resume"].as<bool>() && !vm.count("checkpoint")) {
+            std::cout << "Please provide the checkpoint to resume from with --checkpoint" << std::endl;
+            return 1;
+        }
+        if (vm.count("checkpoint") && (vm.count("region") || vm.count("sample-blocks") || vm.count("sample-fraction"))) {
+            std::cout << "Checkpoints can only be written while validating whole files" << std::endl;
+            return 1;
+        }
+
+        if (vm["progress-interval"].as<long>() < 0) {
+            std::cout << "The interval between progress reports can't be negative" << std::endl;
+            return 1;
+        }
+
         return 0;
     }
 
@@ -144,7 +220,89 @@ namespace
         return ebi::vcf::Ploidy{unsigned_ploidy, special_ploidies};
     }
 
-    std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> get_outputs(std::string const &output_str, std::string const &input) {
+    std::vector<std::string> get_inputs(po::variables_map const & vm)
+    {
+        std::vector<std::string> inputs;
+        if (vm.count("input-list")) {
+            auto list_path = vm["input-list"].as<std::string>();
+            std::ifstream list{list_path};
+            if (!list) {
+                throw std::invalid_argument{"Couldn't open the list of input files " + list_path};
+            }
+            std::string line;
+            while (std::getline(list, line)) {
+                if (!line.empty() && line.back() == '\r') {
+                    line.pop_back();
+                }
+                if (!line.empty()) {
+                    inputs.push_back(line);
+                }
+            }
+            if (vm["input"].defaulted()) {
+                return inputs;
+            }
+        }
+
+        auto paths = vm["input"].as<std::vector<std::string>>();
+        inputs.insert(inputs.end(), paths.begin(), paths.end());
+        return inputs;
+    }
+
+    std::vector<ebi::vcf::Region> get_regions(po::variables_map const & vm)
+    {
+        std::vector<ebi::vcf::Region> regions;
+        if (vm.count("region")) {
+            for (auto & region : vm["region"].as<std::vector<std::string>>()) {
+                regions.push_back(ebi::vcf::parse_region(region));
+            }
+        }
+        return regions;
+    }
+
+    ebi::vcf::SamplingOptions get_sampling_options(po::variables_map const & vm)
+    {
+        ebi::vcf::SamplingOptions options{0, 0, ebi::vcf::default_sample_window_size, 0};
+        if (vm.count("sample-blocks")) {
+            options.n_windows = static_cast<size_t>(vm["sample-blocks"].as<long>());
+        }
+        if (vm.count("sample-fraction")) {
+            options.fraction = vm["sample-fraction"].as<double>();
+        }
+        return options;
+    }
+
+    ebi::vcf::CheckpointOptions get_checkpoint_options(po::variables_map const & vm)
+    {
+        ebi::vcf::CheckpointOptions options{"", static_cast<size_t>(vm["checkpoint-interval"].as<long>()),
+                                            vm["resume"].as<bool>()};
+        if (vm.count("checkpoint")) {
+            options.path = vm["checkpoint"].as<std::string>();
+        }
+        return options;
+    }
+
+    /**
+     * @param suffix timestamp of the validation, or "checkpoint" while a checkpointed validation is not finished
+     */
+    std::string get_db_filename(std::string const & input, std::string const & suffix)
+    {
+        return input + ".errors." + suffix + ".db";
+    }
+
+    std::string get_timestamp()
+    {
+        auto epoch = std::chrono::system_clock::now().time_since_epoch();
+        return std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(epoch).count());
+    }
+
+    /**
+     * @param resume whether the validation is resumed from a checkpoint, whose database report is written again
+     */
+    std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> get_outputs(std::string const &output_str,
+                                                                     std::string const &input,
+                                                                     std::ostream &stdout_report,
+                                                                     bool checkpoint,
+                                                                     bool resume) {
         std::vector<std::string> outs;
         ebi::util::string_split(output_str, ",", outs);
         size_t initial_size = outs.size();
@@ -160,16 +318,15 @@ namespace
 
         for (auto out : outs) {
             if (out == "database") {
-                auto epoch = std::chrono::system_clock::now().time_since_epoch();
-                auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(epoch).count();
-                std::string db_filename = input + ".errors." + std::to_string(timestamp) + ".db";
+                // A checkpointed validation writes to the same database when resumed
+                std::string db_filename = get_db_filename(input, checkpoint ? "checkpoint" : get_timestamp());
                 boost::filesystem::path db_file{db_filename};
-                if (boost::filesystem::exists(db_file)) {
+                if (boost::filesystem::exists(db_file) && !resume) {
                     throw std::runtime_error{"Report file already exists on " + db_filename + ", please delete it or rename it"};
                 }
                 outputs.emplace_back(new ebi::vcf::OdbReportRW(db_filename));
             } else if (out == "stdout") {
-                outputs.emplace_back(new ebi::vcf::SummaryReportWriter(std::cout));
+                outputs.emplace_back(new ebi::vcf::SummaryReportWriter(stdout_report));
             } else {
                 throw std::invalid_argument{"Please use only valid report types"};
             }
@@ -178,6 +335,285 @@ namespace
         return outputs;
     }
 
+    struct ValidationSettings
+    {
+        ebi::vcf::ValidationLevel level;
+        ebi::vcf::Ploidy ploidy;
+        std::string report;
+        std::string outdir;
+        size_t threads;
+        std::vector<ebi::vcf::Region> regions;
+        bool sample;
+        ebi::vcf::SamplingOptions sampling;
+        bool checkpoint;
+        ebi::vcf::CheckpointOptions checkpoints;
+        bool progress;
+    };
+
+    size_t get_input_size(std::string const & path)
+    {
+        if (path == "stdin") {
+            return 0;
+        }
+        boost::system::error_code error;
+        auto size = boost::filesystem::file_size(path, error);
+        return error ? 0 : static_cast<size_t>(size);
+    }
+
+    /**
+     * Size of the text that will be parsed from the inputs, or 0 if it is unknown because some of them are compressed
+     * or are not regular files
+     */
+    uint64_t get_text_size(std::vector<std::string> const & paths)
+    {
+        uint64_t total = 0;
+        for (auto & path : paths) {
+            size_t size = get_input_size(path);
+            std::ifstream input{path, std::ios::binary};
+            if (size == 0 || !input || ebi::util::is_gzip(input)) {
+                return 0;
+            }
+            total += size;
+        }
+        return total;
+    }
+
+    ebi::util::ProgressOptions get_progress_options(po::variables_map const & vm,
+                                                    std::vector<std::string> const & inputs)
+    {
+        ebi::util::ProgressOptions options{static_cast<size_t>(vm["progress-interval"].as<long>()), "", 0};
+        if (vm.count("progress-file")) {
+            options.path = vm["progress-file"].as<std::string>();
+        }
+        // Regions and samples only read parts of the inputs, so their size doesn't tell how long it will take
+        if (!vm.count("region") && !vm.count("sample-blocks") && !vm.count("sample-fraction")) {
+            options.total_bytes = get_text_size(inputs);
+        }
+        return options;
+    }
+
+    /**
+     * Rough estimate of the memory used while validating a file: a block of text for each thread validating the
+     * body, and the buffers reading (or decompressing) the input ahead of them.
+     */
+    size_t estimate_memory(size_t threads)
+    {
+        return (threads + ebi::util::default_read_ahead_buffers) * ebi::vcf::default_read_block_size;
+    }
+
+    /**
+     * Validates the header and a sample of the body of an input, and writes a summary of the sample to `out`
+     */
+    bool validate_sample(std::string const & path,
+                         ValidationSettings const & settings,
+                         std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> & outputs,
+                         std::ostream & out)
+    {
+        // The windows of the sample are read from random positions, so the input must be a file that can be seeked
+        std::ifstream input{path, std::ios::binary};
+        if (path == "stdin" || !input) {
+            throw std::invalid_argument{"Only plain text and bgzipped files can be sampled, not " + path};
+        }
+
+        out << "Reading a sample of the input file..." << std::endl;
+        bool is_valid;
+        ebi::vcf::SampleSummary summary;
+        if (ebi::util::is_gzip(input)) {
+            is_valid = ebi::vcf::is_valid_vcf_sample(input, path, settings.level, settings.ploidy, outputs,
+                                                     settings.sampling, summary);
+        } else if (ebi::util::MappedFile::is_mappable(path)) {
+            ebi::util::MappedFile mapped{path};
+            is_valid = ebi::vcf::is_valid_vcf_sample(mapped.begin(), mapped.end(), path, settings.level,
+                                                     settings.ploidy, outputs, settings.sampling, summary);
+        } else {
+            throw std::invalid_argument{"Only plain text and bgzipped files can be sampled, not " + path};
+        }
+
+        if (!summary.sampled) {
+            out << "The body of the input file is small, so it was validated in full instead of sampled" << std::endl;
+            return is_valid;
+        }
+        out << std::fixed << std::setprecision(4)
+            << "SAMPLED VALIDATION: only " << summary.n_records << " records in " << summary.n_windows
+            << " windows of the body were validated, and their line numbers are relative to the sample" << std::endl
+            << "Estimated rate of records with errors: " << summary.error_rate * 100 << "% (95% confidence interval: "
+            << summary.error_rate_low * 100 << "% - " << summary.error_rate_high * 100 << "%)" << std::endl;
+        out.unsetf(std::ios::floatfield);
+        return is_valid;
+    }
+
+    /**
+     * Validates a whole input writing checkpoints, or resuming from one. The checkpoint is removed once the
+     * validation finishes.
+     */
+    bool validate_checkpointed(std::string const & path,
+                               ValidationSettings const & settings,
+                               std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> & outputs,
+                               std::ostream & out)
+    {
+        auto & options = settings.checkpoints;
+        if (options.resume) {
+            out << "Resuming from the checkpoint " << options.path << "..." << std::endl;
+        }
+
+        bool is_valid;
+        if (path == "stdin") {
+            out << "Reading from standard input..." << std::endl;
+            is_valid = ebi::vcf::is_valid_vcf_file(std::cin, path, settings.level, settings.ploidy, outputs, options,
+                                                   settings.threads);
+        } else if (ebi::util::MappedFile::is_mappable(path)) {
+            out << "Reading from input file..." << std::endl;
+            ebi::util::MappedFile input{path};
+            is_valid = ebi::vcf::is_valid_vcf_file(input, path, settings.level, settings.ploidy, outputs, options);
+        } else {
+            out << "Reading from input file..." << std::endl;
+            std::ifstream input{path, std::ios::binary};
+            if (!input) {
+                throw std::runtime_error{"Couldn't open file " + path};
+            }
+            is_valid = ebi::vcf::is_valid_vcf_file(input, path, settings.level, settings.ploidy, outputs, options,
+                                                   settings.threads);
+        }
+
+        boost::filesystem::remove(options.path);
+        return is_valid;
+    }
+
+    /**
+     * Gives the database report of a finished checkpointed validation the timestamped name of any other validation,
+     * so the next checkpointed validation of the same input can create its own. The report must be closed already.
+     */
+    void rename_checkpoint_database(std::string const & input, std::ostream & out)
+    {
+        boost::filesystem::path checkpoint_db{get_db_filename(input, "checkpoint")};
+        if (boost::filesystem::exists(checkpoint_db)) {
+            auto db_filename = get_db_filename(input, get_timestamp());
+            boost::filesystem::rename(checkpoint_db, db_filename);
+            out << "The database report was written to " << db_filename << std::endl;
+        }
+    }
+
+    /**
+     * Validates a single input, with its own set of reports.
+     *
+     * @param out stream for the messages and the stdout report
+     * @return exit code for the input, 0 if it is valid
+     */
+    int validate_input(std::string const & path, ValidationSettings const & settings, std::ostream & out)
+    {
+        try {
+            bool is_valid;
+            auto outdir = get_output_path(settings.outdir, path);
+            auto outputs = get_outputs(settings.report, outdir, out, settings.checkpoint,
+                                       settings.checkpoints.resume);
+            if (settings.progress) {
+                outputs.emplace_back(new ebi::vcf::ProgressReportWriter);
+            }
+
+            if (settings.checkpoint) {
+                is_valid = validate_checkpointed(path, settings, outputs, out);
+                std::vector<std::string> reports;
+                ebi::util::string_split(settings.report, ",", reports);
+                if (std::find(reports.begin(), reports.end(), "database") != reports.end()) {
+                    outputs.clear();
+                    rename_checkpoint_database(outdir, out);
+                }
+            } else if (settings.sample) {
+                is_valid = validate_sample(path, settings, outputs, out);
+            } else if (!settings.regions.empty()) {
+                // Only the blocks of the regions are read, so the input must be a file that can be seeked
+                auto index_path = ebi::vcf::find_tabix_index(path);
+                if (path == "stdin" || index_path.empty()) {
+                    throw std::invalid_argument{"Regions can only be validated in bgzipped files with a tabix (.tbi) "
+                                                "or CSI (.csi) index next to them"};
+                }
+                out << "Reading regions from input file..." << std::endl;
+                std::ifstream index_input{index_path, std::ios::binary};
+                ebi::vcf::TabixIndex index{index_input};
+                std::ifstream input{path, std::ios::binary};
+                if (!input) {
+                    throw std::runtime_error{"Couldn't open file " + path};
+                }
+                is_valid = ebi::vcf::is_valid_vcf_file(input, index, settings.regions, path, settings.level,
+                                                       settings.ploidy, outputs, settings.threads);
+                out << "REGION VALIDATION: only the records in the blocks overlapping the regions were validated, "
+                       "and their line numbers count from the header as if no other records came before them"
+                    << std::endl;
+            } else if (path == "stdin") {
+                out << "Reading from standard input..." << std::endl;
+                is_valid = ebi::vcf::is_valid_vcf_file(std::cin, path, settings.level, settings.ploidy, outputs,
+                                                       settings.threads);
+            } else if (ebi::util::MappedFile::is_mappable(path)) {
+                out << "Reading from input file..." << std::endl;
+                ebi::util::MappedFile input{path};
+                is_valid = ebi::vcf::is_valid_vcf_file(input, path, settings.level, settings.ploidy, outputs,
+                                                       settings.threads);
+            } else {
+                // Pipes and other special files can't be mapped into memory, so they are read as streams
+                out << "Reading from input file..." << std::endl;
+                std::ifstream input{path};
+                if (!input) {
+                    throw std::runtime_error{"Couldn't open file " + path};
+                } else {
+                    is_valid = ebi::vcf::is_valid_vcf_file(input, path, settings.level, settings.ploidy, outputs,
+                                                           settings.threads);
+                }
+            }
+
+            out << "According to the VCF specification, the " << (settings.sample ? "sampled " : "") << "input file is "
+                << (is_valid ? "valid" : "not valid") << std::endl;
+            return !is_valid; // A valid file returns an exit code 0
+
+        } catch (std::invalid_argument const & ex) {
+            std::cerr << path << ": " << ex.what() << std::endl;
+            return 1;
+        } catch (std::runtime_error const & ex) {
+            out << "The input file is not valid: " << ex.what() << std::endl;
+            return 1;
+        } catch (std::exception const &ex) {
+            std::cerr << path << ": " << ex.what() << std::endl;
+            return 1;
+        } catch (ebi::vcf::Error * error) {
+            // The stop validation level ends at the first error, which is thrown instead of reported
+            std::unique_ptr<ebi::vcf::Error> owned_error{error};
+            out << "The input file is not valid: " << error->what() << std::endl;
+            return 1;
+        } catch (...) {
+            std::cerr << path << ": unknown error while validating the input file" << std::endl;
+            return 1;
+        }
+    }
+
+    /**
+     * Validates several inputs at the same time, the biggest first. The messages and stdout report of each input
+     * are written as soon as each of their lines is complete, after the name of the input, so the lines of
+     * different inputs can be told apart without keeping whole reports in memory.
+     *
+     * @return exit code for the whole batch, 0 if all the inputs are valid
+     */
+    int validate_inputs(std::vector<std::string> const & paths,
+                        ValidationSettings const & settings,
+                        size_t jobs,
+                        size_t memory_budget)
+    {
+        std::vector<ebi::util::BatchScheduler::Job> batch;
+        for (size_t i = 0; i < paths.size(); ++i) {
+            batch.push_back({i, get_input_size(paths[i]), estimate_memory(settings.threads)});
+        }
+
+        std::vector<int> exit_codes(paths.size(), 1);
+        std::mutex stdout_mutex;
+        ebi::util::BatchScheduler scheduler{jobs, memory_budget};
+        scheduler.run(batch, [&](size_t index) {
+            ebi::util::PrefixedLineStreambuf buffer{std::cout, stdout_mutex, paths[index] + ": "};
+            std::ostream out{&buffer};
+            exit_codes[index] = validate_input(paths[index], settings, out);
+        });
+
+        size_t n_valid = std::count(exit_codes.begin(), exit_codes.end(), 0);
+        std::cout << n_valid << " of " << paths.size() << " input files are valid" << std::endl;
+        return n_valid == paths.size() ? 0 : 1;
+    }
 }
 
 int main(int argc, char** argv)
@@ -190,40 +626,45 @@ int main(int argc, char** argv)
     int check_options = check_command_line_options(vm, desc);
     if (check_options < 0) { return 0; }
     if (check_options > 0) { return check_options; }
-    
-    bool is_valid;
 
     try {
-        auto path = vm["input"].as<std::string>();
+        auto inputs = get_inputs(vm);
         auto level = vm["level"].as<std::string>();
-        ebi::vcf::Ploidy ploidy = get_ploidy(vm["ploidy"].as<long>(), vm);
-        ebi::vcf::ValidationLevel validationLevel = get_validation_level(level);
-        auto outdir = get_output_path(vm["outdir"].as<std::string>(), path);
-        auto outputs = get_outputs(vm["report"].as<std::string>(), outdir);
+        ValidationSettings settings{get_validation_level(level),
+                                    get_ploidy(vm["ploidy"].as<long>(), vm),
+                                    vm["report"].as<std::string>(),
+                                    vm["outdir"].as<std::string>(),
+                                    static_cast<size_t>(vm["threads"].as<long>()),
+                                    get_regions(vm),
+                                    vm.count("sample-blocks") || vm.count("sample-fraction"),
+                                    get_sampling_options(vm),
+                                    vm.count("checkpoint") > 0,
+                                    get_checkpoint_options(vm),
+                                    vm["progress"].as<bool>() || vm.count("progress-file") > 0};
 
-        if (path == "stdin") {
-            std::cout << "Reading from standard input..." << std::endl;
-            is_valid = ebi::vcf::is_valid_vcf_file(std::cin, path, validationLevel, ploidy, outputs);
-        } else {
-            std::cout << "Reading from input file..." << std::endl;
-            std::ifstream input{path};
-            if (!input) {
-                throw std::runtime_error{"Couldn't open file " + path};
-            } else {
-                is_valid = ebi::vcf::is_valid_vcf_file(input, path, validationLevel, ploidy, outputs);
-            }
+        if (inputs.empty()) {
+            std::cerr << "The list of input files is empty" << std::endl;
+            return 1;
+        } else if (settings.checkpoint && inputs.size() > 1) {
+            std::cerr << "Checkpoints can only be written while validating a single input file" << std::endl;
+            return 1;
         }
 
-        std::cout << "According to the VCF specification, the input file is "
-                  << (is_valid ? "valid" : "not valid") << std::endl;
-        return !is_valid; // A valid file returns an exit code 0
-        
+        std::unique_ptr<ebi::util::ProgressReporter> progress;
+        if (settings.progress) {
+            progress.reset(new ebi::util::ProgressReporter{get_progress_options(vm, inputs)});
+        }
+
+        if (inputs.size() == 1) {
+            return validate_input(inputs[0], settings, std::cout);
+        }
+
+        size_t memory_budget = static_cast<size_t>(vm["memory"].as<long>()) * 1024 * 1024;
+        return validate_inputs(inputs, settings, static_cast<size_t>(vm["jobs"].as<long>()), memory_budget);
+
     } catch (std::invalid_argument const & ex) {
         std::cerr << ex.what() << std::endl;
         return 1;
-    } catch (std::runtime_error const & ex) {
-        std::cout << "The input file is not valid: " << ex.what() << std::endl;
-        return 1;
     } catch (std::exception const &ex) {
         std::cerr << ex.what() << std::endl;
         return 1;
@@ -0,0 +1,519 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#include "vcf/bcf_parser.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    namespace
+    {
+      enum BcfType
+      {
+          BCF_MISSING = 0,
+          BCF_INT8 = 1,
+          BCF_INT16 = 2,
+          BCF_INT32 = 3,
+          BCF_FLOAT = 5,
+          BCF_CHAR = 7
+      };
+
+      uint32_t const bcf_float_missing = 0x7F800001;
+      uint32_t const bcf_float_vector_end = 0x7F800002;
+
+      /**
+       * Appends a float with the fewest significant digits (6 at least, like the default stream formatting) that
+       * read back as the same value, so no precision is lost when its text is checked
+       */
+      void append_float(float value, std::string & text)
+      {
+          char number[32];
+          for (int digits = 6; ; ++digits) {
+              std::snprintf(number, sizeof(number), "%.*g", digits, value);
+              if (digits == std::numeric_limits<float>::max_digits10 || std::strtof(number, nullptr) == value) {
+                  break;
+              }
+          }
+          text += number;
+      }
+
+      /**
+       * Type and amount of values of a typed vector
+       */
+      struct BcfDescriptor
+      {
+          int type;
+          size_t size;
+      };
+
+      /**
+       * Reads the typed values of a record, checking that they don't go past its end
+       */
+      class BcfCursor
+      {
+        public:
+          BcfCursor(char const * begin, size_t size, size_t line) : current{begin}, end{begin + size}, line{line} { }
+
+          char const * take(size_t size)
+          {
+              if (static_cast<size_t>(end - current) < size) {
+                  throw new BodySectionError{line, "The BCF record is shorter than the values it contains"};
+              }
+              char const * data = current;
+              current += size;
+              return data;
+          }
+
+          uint32_t uint32()
+          {
+              return read_bcf_uint32(take(4));
+          }
+
+          BcfDescriptor descriptor()
+          {
+              auto byte = static_cast<unsigned char>(*take(1));
+              BcfDescriptor descriptor{byte & 0x0F, static_cast<size_t>(byte >> 4)};
+              if (type_size(descriptor.type) == 0) {
+                  throw new BodySectionError{line, "The BCF record contains a value of unknown type "
+                                                   + std::to_string(descriptor.type)};
+              }
+              if (descriptor.size == 15) {
+                  // Longer vectors store their size in a typed integer that follows
+                  int64_t size = typed_int();
+                  if (size < 0) {
+                      throw new BodySectionError{line, "The BCF record contains a vector of negative size"};
+                  }
+                  descriptor.size = static_cast<size_t>(size);
+              }
+              if (descriptor.type == BCF_MISSING) {
+                  descriptor.size = 0;    // a missing value has no payload
+              }
+              return descriptor;
+          }
+
+          /**
+           * Reads a value preceded by its own descriptor, as the keys of INFO and FORMAT fields
+           */
+          int64_t typed_int()
+          {
+              BcfDescriptor descriptor = this->descriptor();
+              if (descriptor.size != 1 || descriptor.type == BCF_FLOAT || descriptor.type == BCF_CHAR) {
+                  throw new BodySectionError{line, "The BCF record contains a malformed typed integer"};
+              }
+              int64_t value = 0;
+              int_value(descriptor.type, value);
+              return value;
+          }
+
+          /**
+           * Reads an integer of the given type
+           * @return whether the value is present, false if it is missing or the end of the vector
+           */
+          bool int_value(int type, int64_t & value, bool * vector_end = nullptr)
+          {
+              int64_t missing;
+              switch (type) {
+                  case BCF_INT8:
+                      value = static_cast<int8_t>(*take(1));
+                      missing = INT8_MIN;
+                      break;
+                  case BCF_INT16: {
+                      auto bytes = reinterpret_cast<unsigned char const *>(take(2));
+                      value = static_cast<int16_t>(bytes[0] | (bytes[1] << 8));
+                      missing = INT16_MIN;
+                      break;
+                  }
+                  default:
+                      value = static_cast<int32_t>(uint32());
+                      missing = INT32_MIN;
+                      break;
+              }
+              if (vector_end != nullptr) {
+                  *vector_end = value == missing + 1;
+              }
+              return value != missing && value != missing + 1;
+          }
+
+          /**
+           * Appends the values of a typed vector to `text`, as they would be written in a VCF file
+           * @param genotype whether the values are the alleles of a GT field
+           * @param typed where the numbers are also stored as they are, unless they are alleles
+           * @return whether any value was appended (a missing value is appended as a dot)
+           */
+          bool append_values(BcfDescriptor const & descriptor, std::string & text, bool genotype = false,
+                             TypedValues * typed = nullptr)
+          {
+              size_t initial_size = text.size();
+              if (typed != nullptr) {
+                  typed->kind = genotype || descriptor.type == BCF_CHAR ? ValueKind::text
+                              : descriptor.type == BCF_FLOAT ? ValueKind::floating
+                              : ValueKind::integer;
+                  typed->values.clear();
+              }
+
+              if (descriptor.type == BCF_CHAR) {
+                  char const * data = take(descriptor.size);
+                  text.append(data, strnlen(data, descriptor.size));
+                  return text.size() != initial_size;
+              }
+
+              bool ended = false;
+              for (size_t i = 0; i < descriptor.size; ++i) {
+                  if (descriptor.type == BCF_FLOAT) {
+                      uint32_t bits = uint32();
+                      ended = ended || bits == bcf_float_vector_end;
+                      if (ended) {
+                          continue;   // the remaining values are padding, but must be consumed anyway
+                      }
+                      if (i > 0) {
+                          text += ',';
+                      }
+                      if (bits == bcf_float_missing) {
+                          text += '.';
+                          if (typed != nullptr) {
+                              typed->values.push_back({true, 0});
+                          }
+                      } else {
+                          float value;
+                          std::memcpy(&value, &bits, sizeof(value));
+                          append_float(value, text);
+                          if (typed != nullptr) {
+                              typed->values.push_back({false, value});
+                          }
+                      }
+                      continue;
+                  }
+
+                  int64_t value;
+                  bool vector_end;
+                  bool present = int_value(descriptor.type, value, &vector_end);
+                  ended = ended || vector_end;
+                  if (ended) {
+                      continue;
+                  }
+                  if (genotype) {
+                      // Alleles are stored as (index + 1) << 1, with the lowest bit telling whether they are phased
+                      if (i > 0) {
+                          text += (present && (value & 1)) ? '|' : '/';
+                      }
+                      if (!present || (value >> 1) == 0) {
+                          text += '.';
+                      } else {
+                          text += std::to_string((value >> 1) - 1);
+                      }
+                  } else {
+                      if (i > 0) {
+                          text += ',';
+                      }
+                      text += present ? std::to_string(value) : ".";
+                      if (typed != nullptr) {
+                          typed->values.push_back({!present, static_cast<double>(value)});
+                      }
+                  }
+              }
+              return text.size() != initial_size;
+          }
+
+        private:
+          static size_t type_size(int type)
+          {
+              switch (type) {
+                  case BCF_MISSING: return 1;  // no values are read, but the type is valid
+                  case BCF_INT8: return 1;
+                  case BCF_INT16: return 2;
+                  case BCF_INT32: return 4;
+                  case BCF_FLOAT: return 4;
+                  case BCF_CHAR: return 1;
+                  default: return 0;
+              }
+          }
+
+          char const * current;
+          char const * end;
+          size_t line;
+      };
+
+      /**
+       * @return the value of `key` in a meta line like ##INFO=<ID=DP,Number=1,...>, or an empty string
+       */
+      std::string meta_value(std::string const & line, std::string const & key)
+      {
+          for (auto prefix : {"<", ","}) {
+              auto position = line.find(prefix + key + "=");
+              if (position != std::string::npos) {
+                  position += key.size() + 2;
+                  return line.substr(position, line.find_first_of(",>", position) - position);
+              }
+          }
+          return "";
+      }
+
+      /**
+       * Adds an ID to a dictionary, at the position given by its IDX attribute if present, or after the last one
+       */
+      void add_to_dictionary(std::vector<std::string> & dictionary, std::string const & id, std::string const & idx)
+      {
+          if (id.empty() || std::find(dictionary.begin(), dictionary.end(), id) != dictionary.end()) {
+              return;
+          }
+          size_t position = dictionary.size();
+          if (!idx.empty()) {
+              try {
+                  position = std::stoul(idx);
+              } catch (std::logic_error const &) {
+                  // a malformed IDX is reported by the validation of the header text
+              }
+          }
+          if (position >= dictionary.size()) {
+              dictionary.resize(position + 1);
+          }
+          dictionary[position] = id;
+      }
+
+      bool is_bases(std::string const & allele)
+      {
+          return !allele.empty() && allele.find_first_not_of("ACGTNacgtn") == std::string::npos;
+      }
+
+      /**
+       * @return whether an alternate allele is made of bases, or is a symbolic allele, a breakend or an asterisk
+       */
+      bool is_alternate(std::string const & allele)
+      {
+          bool symbolic = allele.size() > 2 && allele.front() == '<'
+                  && allele.find_first_of("<>", 1) == allele.size() - 1;
+          bool single_breakend = allele.size() > 1 && (allele.front() == '.' || allele.back() == '.')
+                  && is_bases(allele.substr(allele.front() == '.' ? 1 : 0, allele.size() - 1));
+          return is_bases(allele) || allele == "*" || symbolic || single_breakend
+                  || allele.find_first_of("[]") != std::string::npos;
+      }
+
+      std::string const & dictionary_entry(std::vector<std::string> const & dictionary, int64_t index)
+      {
+          static std::string const not_found;
+          if (index < 0 || static_cast<size_t>(index) >= dictionary.size()) {
+              return not_found;
+          }
+          return dictionary[index];
+      }
+    }
+
+    bool is_bcf(char const * data, size_t size)
+    {
+        return size >= 4 && std::memcmp(data, "BCF\2", 4) == 0;
+    }
+
+    BcfHeader::BcfHeader(std::string const & text) : strings{"PASS"}, contigs{}, info_flags{}, n_samples{0}
+    {
+        std::istringstream lines{text};
+        std::string line;
+        while (std::getline(lines, line)) {
+            if (line.compare(0, 10, "##FILTER=<") == 0 || line.compare(0, 8, "##INFO=<") == 0
+                    || line.compare(0, 10, "##FORMAT=<") == 0) {
+                std::string id = meta_value(line, "ID");
+                add_to_dictionary(strings, id, meta_value(line, "IDX"));
+                if (line.compare(0, 8, "##INFO=<") == 0 && meta_value(line, "Type") == "Flag") {
+                    info_flags.insert(id);
+                }
+            } else if (line.compare(0, 10, "##contig=<") == 0) {
+                add_to_dictionary(contigs, meta_value(line, "ID"), meta_value(line, "IDX"));
+            } else if (line.compare(0, 6, "#CHROM") == 0) {
+                // Sample names follow the 9 fixed columns
+                size_t n_columns = std::count(line.begin(), line.end(), '\t') + 1;
+                n_samples = n_columns > 9 ? n_columns - 9 : 0;
+            }
+        }
+    }
+
+    void decode_bcf_record(char const * shared,
+                           size_t l_shared,
+                           char const * indiv,
+                           size_t l_indiv,
+                           BcfHeader const & header,
+                           size_t line,
+                           std::vector<std::vector<std::string>> & columns,
+                           TypedFields & typed)
+    {
+        BcfCursor cursor{shared, l_shared, line};
+
+        int32_t chromosome_index = static_cast<int32_t>(cursor.uint32());
+        int32_t position = static_cast<int32_t>(cursor.uint32());
+        cursor.uint32();    // rlen, the length of the reference allele
+        uint32_t quality_bits = cursor.uint32();
+        uint32_t n_allele_info = cursor.uint32();
+        uint32_t n_fmt_sample = cursor.uint32();
+        size_t n_info = n_allele_info & 0xFFFF;
+        size_t n_allele = n_allele_info >> 16;
+        size_t n_sample = n_fmt_sample & 0xFFFFFF;
+        size_t n_fmt = n_fmt_sample >> 24;
+
+        // CHROM
+        std::string const & chromosome = dictionary_entry(header.contigs, chromosome_index);
+        if (chromosome.empty()) {
+            throw new ChromosomeBodyError{line, "Chromosome index " + std::to_string(chromosome_index)
+                                                + " is not defined in the contigs of the header"};
+        }
+        columns.push_back({chromosome});
+
+        // POS, 0-based in BCF
+        if (position < 0) {
+            throw new PositionBodyError{line};
+        }
+        columns.push_back({std::to_string(static_cast<int64_t>(position) + 1)});
+
+        // ID
+        std::string ids;
+        cursor.append_values(cursor.descriptor(), ids);
+        std::vector<std::string> id_tokens;
+        util::string_split(ids.empty() ? "." : ids, ";", id_tokens);
+        columns.push_back(id_tokens);
+
+        // REF and ALT
+        if (n_allele == 0) {
+            throw new ReferenceAlleleBodyError{line, "The BCF record does not contain a reference allele"};
+        }
+        std::vector<std::string> alleles(n_allele);
+        for (auto & allele : alleles) {
+            cursor.append_values(cursor.descriptor(), allele);
+        }
+        // Text records are checked by the VCF grammar, while BCF alleles are plain strings that must be checked here
+        if (!is_bases(alleles[0])) {
+            throw new ReferenceAlleleBodyError{line};
+        }
+        if (!std::all_of(alleles.begin() + 1, alleles.end(), is_alternate)) {
+            throw new AlternateAllelesBodyError{line};
+        }
+        columns.push_back({alleles[0]});
+        if (n_allele == 1) {
+            columns.push_back({"."});
+        } else {
+            columns.push_back({alleles.begin() + 1, alleles.end()});
+        }
+
+        // QUAL, whose text is only kept for the policies that read it
+        if (quality_bits == bcf_float_missing) {
+            columns.push_back({"."});
+            typed.quality = 0;
+        } else {
+            std::memcpy(&typed.quality, &quality_bits, sizeof(typed.quality));
+            std::string text;
+            append_float(typed.quality, text);
+            columns.push_back({text});
+        }
+
+        // FILTER
+        BcfDescriptor filter_descriptor = cursor.descriptor();
+        if (filter_descriptor.type == BCF_FLOAT || filter_descriptor.type == BCF_CHAR) {
+            throw new FilterBodyError{line, "The filters of a BCF record must be integers"};
+        }
+        std::vector<std::string> filters;
+        for (size_t i = 0; i < filter_descriptor.size; ++i) {
+            int64_t index;
+            if (cursor.int_value(filter_descriptor.type, index)) {
+                std::string const & filter = dictionary_entry(header.strings, index);
+                if (filter.empty()) {
+                    throw new FilterBodyError{line, "Filter index " + std::to_string(index)
+                                                    + " is not defined in the header"};
+                }
+                filters.push_back(filter);
+            }
+        }
+        if (filters.empty()) {
+            filters.push_back(".");
+        }
+        columns.push_back(filters);
+
+        // INFO
+        std::vector<std::string> info;
+        for (size_t i = 0; i < n_info; ++i) {
+            int64_t index = cursor.typed_int();
+            std::string const & key = dictionary_entry(header.strings, index);
+            if (key.empty()) {
+                throw new InfoBodyError{line, "INFO index " + std::to_string(index) + " is not defined in the header"};
+            }
+            std::string field = key + "=";
+            TypedValues values;
+            if (!cursor.append_values(cursor.descriptor(), field, false, &values)
+                    || header.info_flags.count(key) != 0) {
+                field.pop_back();
+            } else {
+                typed.info.emplace(key, std::move(values));
+            }
+            info.push_back(field);
+        }
+        if (info.empty()) {
+            info.push_back(".");
+        }
+        columns.push_back(info);
+
+        if (n_fmt == 0) {
+            return;
+        }
+
+        // FORMAT and samples
+        if (n_sample != header.n_samples) {
+            throw new SamplesBodyError{line, "The BCF record contains " + std::to_string(n_sample)
+                                             + " samples, but the header lists " + std::to_string(header.n_samples)};
+        }
+
+        BcfCursor samples_cursor{indiv, l_indiv, line};
+        std::vector<std::string> format;
+        std::vector<std::string> samples(n_sample);
+        std::vector<bool> truncated(n_sample, false);
+        typed.samples.assign(n_sample, {});
+        TypedValues values;
+        for (size_t i = 0; i < n_fmt; ++i) {
+            int64_t index = samples_cursor.typed_int();
+            std::string const & key = dictionary_entry(header.strings, index);
+            if (key.empty()) {
+                throw new FormatBodyError{line, "FORMAT index " + std::to_string(index)
+                                                + " is not defined in the header"};
+            }
+            format.push_back(key);
+
+            BcfDescriptor descriptor = samples_cursor.descriptor();
+            for (size_t j = 0; j < n_sample; ++j) {
+                std::string value;
+                bool present = samples_cursor.append_values(descriptor, value, key == "GT", &values);
+                if (i > 0 && !present && descriptor.type != BCF_CHAR) {
+                    // A vector that ends before its first value is a trailing field omitted in this sample
+                    truncated[j] = true;
+                }
+                if (truncated[j]) {
+                    continue;
+                }
+                if (i > 0) {
+                    samples[j] += ':';
+                }
+                samples[j] += present ? value : ".";
+                typed.samples[j].push_back(present ? values : TypedValues{ValueKind::text, {}});
+            }
+        }
+        columns.push_back(format);
+        for (auto & sample : samples) {
+            columns.push_back({sample});
+        }
+    }
+  }
+}
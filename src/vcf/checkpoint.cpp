@@ -0,0 +1,456 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+
+#include "util/compression.hpp"
+#include "util/read_ahead.hpp"
+#include "util/stream_utils.hpp"
+#include "vcf/bcf_parser.hpp"
+#include "vcf/checkpoint.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    Version detect_version(const std::vector<char> &line);
+
+    std::unique_ptr<Parser> build_parser(ValidationLevel level, std::shared_ptr<Source> source);
+
+    void write_errors(const Parser &validator, const std::vector<std::unique_ptr<ReportWriter>> &outputs);
+
+    namespace
+    {
+      std::string const checkpoint_signature = "##vcf-validator checkpoint 1";
+
+      /**
+       * Splits a line of a checkpoint at tabs, keeping empty fields
+       */
+      std::vector<std::string> split_fields(std::string const & line)
+      {
+          std::vector<std::string> fields;
+          size_t begin = 0;
+          for (size_t tab = line.find('\t'); tab != std::string::npos; tab = line.find('\t', begin)) {
+              fields.push_back(line.substr(begin, tab - begin));
+              begin = tab + 1;
+          }
+          fields.push_back(line.substr(begin));
+          return fields;
+      }
+
+      uint64_t parse_number(std::string const & text)
+      {
+          if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) {
+              throw std::invalid_argument{"Not a number: " + text};
+          }
+          return std::stoull(text);
+      }
+
+      /**
+       * Validates a text, from its beginning or from a checkpoint, writing a checkpoint periodically
+       */
+      class CheckpointedValidator
+      {
+        public:
+          CheckpointedValidator(std::string const & source_name,
+                                unsigned input_format,
+                                ValidationLevel level,
+                                Ploidy ploidy,
+                                std::vector<std::unique_ptr<ReportWriter>> &outputs,
+                                CheckpointOptions const & options)
+          : source_name{source_name}, input_format{input_format}, ploidy{ploidy}, outputs(outputs),
+            options(options), parser{}, checkpoint{}, offset{0}, header_found{false}, line_start{true},
+            next_checkpoint{}
+          {
+              checkpoint.source = source_name;
+              checkpoint.level = level;
+              schedule();
+          }
+
+          /**
+           * Starts the validation from the beginning of the text, parsing its first line
+           *
+           * @return false if the fileformat line is not valid, which is reported to the outputs
+           */
+          bool start(std::vector<char> const & first_line)
+          {
+              if (is_bcf(first_line.data(), first_line.size())) {
+                  throw std::runtime_error{"Checkpoints can only be written while validating VCF files"};
+              }
+              try {
+                  checkpoint.version = detect_version(first_line);
+              } catch (FileformatError * error) {
+                  for (auto &output : outputs) {
+                      output->write_error(*error);
+                  }
+                  return false;
+              }
+              build();
+              parse(first_line.data(), first_line.data() + first_line.size());
+              return true;
+          }
+
+          /**
+           * Resumes the validation at a checkpoint. The meta and header sections are parsed again without reporting
+           * their errors, which were reported by the validation that wrote the checkpoint.
+           *
+           * @param header text in the range [0, checkpoint.header_end)
+           */
+          void resume(std::vector<char> const & header, Checkpoint const & saved)
+          {
+              if (saved.source != checkpoint.source || saved.level != checkpoint.level) {
+                  throw std::runtime_error{"The checkpoint was written while validating " + saved.source
+                                           + ", maybe with another validation level"};
+              }
+              checkpoint = saved;
+              build();
+              parser->parse(header);
+              parser->restore(checkpoint);
+
+              offset = checkpoint.offset;
+              header_found = true;
+              for (auto &output : outputs) {
+                  output->resume(checkpoint.n_reports);
+              }
+          }
+
+          /**
+           * Validates the range [begin, end) of the text, which must follow the one validated before
+           */
+          void parse(char const * begin, char const * end)
+          {
+              find_header_end(begin, end);
+              if (header_found && std::chrono::steady_clock::now() >= next_checkpoint) {
+                  // The checkpoint is taken at the last line boundary of the range
+                  auto last_newline = std::find(std::reverse_iterator<char const *>(end),
+                                                std::reverse_iterator<char const *>(begin), '\n');
+                  char const * line = last_newline.base();
+                  if (line != begin && offset + (line - begin) >= checkpoint.header_end) {
+                      parse_lines(begin, line);
+                      save();
+                      begin = line;
+                  }
+              }
+              parse_lines(begin, end);
+          }
+
+          bool end()
+          {
+              parser->end();
+              report();
+              return parser->is_valid();
+          }
+
+        private:
+          void build()
+          {
+              auto source = std::make_shared<Source>(source_name, input_format, checkpoint.version, ploidy);
+              parser = build_parser(checkpoint.level, source);
+          }
+
+          void schedule()
+          {
+              next_checkpoint = std::chrono::steady_clock::now() + std::chrono::seconds{options.interval};
+          }
+
+          /**
+           * Finds the beginning of the first line that doesn't start with '#', where checkpoints can be taken from
+           */
+          void find_header_end(char const * begin, char const * end)
+          {
+              for (char const * position = begin; !header_found && position < end; ++position) {
+                  if (line_start && *position != '#') {
+                      header_found = true;
+                      checkpoint.header_end = offset + (position - begin);
+                  }
+                  line_start = *position == '\n';
+              }
+          }
+
+          void parse_lines(char const * begin, char const * end)
+          {
+              if (begin == end) {
+                  return;
+              }
+              try {
+                  parser->parse(begin, end);
+              } catch (...) {
+                  report();
+                  throw;
+              }
+              report();
+              offset += end - begin;
+          }
+
+          void report()
+          {
+              write_errors(*parser, outputs);
+              checkpoint.n_reports += parser->errors().size() + parser->warnings().size();
+          }
+
+          void save()
+          {
+              for (auto &output : outputs) {
+                  output->flush();
+              }
+              parser->save(checkpoint);
+              checkpoint.offset = offset;
+              write_checkpoint(options.path, checkpoint);
+              schedule();
+          }
+
+          std::string source_name;
+          unsigned input_format;
+          Ploidy ploidy;
+          std::vector<std::unique_ptr<ReportWriter>> &outputs;
+          CheckpointOptions const & options;
+
+          std::unique_ptr<Parser> parser;
+          Checkpoint checkpoint;
+          uint64_t offset;        ///< length of the text validated so far
+          bool header_found;      ///< whether the beginning of the body has been found
+          bool line_start;        ///< whether the next character of the text starts a line
+          std::chrono::steady_clock::time_point next_checkpoint;
+      };
+
+      /**
+       * Skips the text of a stream up to a checkpoint. Plain files are seeked, while the text of compressed ones
+       * has to be decompressed.
+       */
+      void skip(std::istream & input, uint64_t length)
+      {
+          auto position = input.tellg();
+          if (position != std::streampos(-1) && input.seekg(0, std::ios::end)) {
+              uint64_t size = static_cast<uint64_t>(input.tellg() - position);
+              if (size < length) {
+                  throw std::runtime_error{"The input is shorter than when the checkpoint was written"};
+              }
+              input.seekg(position + static_cast<std::streamoff>(length));
+              return;
+          }
+
+          input.clear();
+          input.ignore(static_cast<std::streamsize>(length));
+          if (static_cast<uint64_t>(input.gcount()) < length) {
+              throw std::runtime_error{"The input is shorter than when the checkpoint was written"};
+          }
+      }
+
+      /**
+       * Reads the beginning of a stream to start the validation: either its first line, or all the text until the
+       * checkpoint to resume from
+       *
+       * @return false if the validation can't start because the fileformat line is not valid
+       */
+      bool start(std::istream & input, CheckpointedValidator & validator, CheckpointOptions const & options)
+      {
+          if (options.resume) {
+              Checkpoint checkpoint = read_checkpoint(options.path);
+              std::vector<char> header(checkpoint.header_end);
+              input.read(header.data(), header.size());
+              if (static_cast<uint64_t>(input.gcount()) < header.size()) {
+                  throw std::runtime_error{"The input is shorter than when the checkpoint was written"};
+              }
+              validator.resume(header, checkpoint);
+              skip(input, checkpoint.offset - checkpoint.header_end);
+              return true;
+          }
+
+          std::vector<char> line;
+          ebi::util::readline(input, line);
+          return validator.start(line);
+      }
+
+      bool validate(std::istream & input, CheckpointedValidator & validator)
+      {
+          std::vector<char> block;
+          block.reserve(default_read_block_size);
+          while (ebi::util::readblock(input, block, default_read_block_size).size() != 0) {
+              validator.parse(block.data(), block.data() + block.size());
+          }
+          return validator.end();
+      }
+    }
+
+    void write_checkpoint(std::string const & path, Checkpoint const & checkpoint)
+    {
+        std::string temporary = path + ".tmp";
+        {
+            std::ofstream output{temporary};
+            output << checkpoint_signature << "\n"
+                   << "source\t" << checkpoint.source << "\n"
+                   << "level\t" << static_cast<int>(checkpoint.level) << "\n"
+                   << "version\t" << static_cast<int>(checkpoint.version) << "\n"
+                   << "header_end\t" << checkpoint.header_end << "\n"
+                   << "offset\t" << checkpoint.offset << "\n"
+                   << "n_lines\t" << checkpoint.n_lines << "\n"
+                   << "state\t" << checkpoint.state << "\n"
+                   << "valid\t" << checkpoint.valid << "\n"
+                   << "n_reports\t" << checkpoint.n_reports << "\n"
+                   << "previous_contig\t" << checkpoint.sorting.contig() << "\n"
+                   << "previous_position\t" << checkpoint.sorting.position() << "\n";
+            for (auto & contig : checkpoint.sorting.contigs()) {
+                output << "contig\t" << contig.first << "\t" << contig.second << "\n";
+            }
+            for (auto & record : checkpoint.records) {
+                output << "record\t" << record.line << "\t" << record.chromosome << "\t" << record.position << "\t"
+                       << record.reference_allele << "\t" << record.alternate_allele << "\n";
+            }
+            output.flush();
+            if (!output) {
+                throw std::runtime_error{"Couldn't write the checkpoint " + temporary};
+            }
+        }
+
+        if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+            throw std::runtime_error{"Couldn't replace the checkpoint " + path};
+        }
+    }
+
+    Checkpoint read_checkpoint(std::string const & path)
+    {
+        std::ifstream input{path};
+        if (!input) {
+            throw std::runtime_error{"Couldn't open the checkpoint " + path};
+        }
+        std::string line;
+        if (!std::getline(input, line) || line != checkpoint_signature) {
+            throw std::runtime_error{path + " is not a checkpoint of a validation"};
+        }
+
+        Checkpoint checkpoint{};
+        std::map<std::string, std::string> values;
+        std::map<std::string, bool> contigs;
+        try {
+            while (std::getline(input, line)) {
+                auto fields = split_fields(line);
+                if (fields[0] == "contig" && fields.size() == 3) {
+                    contigs[fields[1]] = parse_number(fields[2]) != 0;
+                } else if (fields[0] == "record" && fields.size() == 6) {
+                    checkpoint.records.emplace_back(parse_number(fields[1]), fields[2], parse_number(fields[3]),
+                                                    fields[4], fields[5]);
+                } else if (fields.size() == 2) {
+                    values[fields[0]] = fields[1];
+                } else {
+                    throw std::invalid_argument{"Unknown line: " + line};
+                }
+            }
+
+            checkpoint.source = values.at("source");
+            checkpoint.level = static_cast<ValidationLevel>(parse_number(values.at("level")));
+            checkpoint.version = static_cast<Version>(parse_number(values.at("version")));
+            checkpoint.header_end = parse_number(values.at("header_end"));
+            checkpoint.offset = parse_number(values.at("offset"));
+            checkpoint.n_lines = parse_number(values.at("n_lines"));
+            checkpoint.state = static_cast<int>(parse_number(values.at("state")));
+            checkpoint.valid = parse_number(values.at("valid")) != 0;
+            checkpoint.n_reports = parse_number(values.at("n_reports"));
+            checkpoint.sorting = SortingChecker{contigs, values.at("previous_contig"),
+                                                parse_number(values.at("previous_position"))};
+        } catch (std::logic_error const & error) {
+            // std::invalid_argument and std::out_of_range, also thrown for missing values
+            throw std::runtime_error{"The checkpoint " + path + " is not well-formed: " + error.what()};
+        }
+
+        if (checkpoint.offset < checkpoint.header_end) {
+            throw std::runtime_error{"The checkpoint " + path + " is not well-formed: it is inside the header"};
+        }
+        return checkpoint;
+    }
+
+    bool is_valid_vcf_file(std::istream &input,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           Ploidy ploidy,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           CheckpointOptions const &options,
+                           size_t n_threads)
+    {
+        if (util::is_gzip(input)) {
+            bool bgzf;
+            std::unique_ptr<std::streambuf> inflated = util::make_gzip_streambuf(input, n_threads, bgzf);
+            std::istream text{inflated.get()};
+            text.exceptions(std::ios::badbit);
+            unsigned input_format = InputFormat::VCF_FILE_VCF
+                    | (bgzf ? InputFormat::VCF_FILE_BGZIP : InputFormat::VCF_FILE_GZIP);
+            CheckpointedValidator validator{sourceName, input_format, validationLevel, ploidy, outputs, options};
+            return start(text, validator, options) && validate(text, validator);
+        }
+
+        // Plain files are positioned at the checkpoint before being read ahead
+        CheckpointedValidator validator{sourceName, InputFormat::VCF_FILE_VCF, validationLevel, ploidy, outputs,
+                                        options};
+        if (!start(input, validator, options)) {
+            return false;
+        }
+        util::ReadAheadStreambuf read_ahead{input};
+        std::istream text{&read_ahead};
+        text.exceptions(std::ios::badbit);
+        return validate(text, validator);
+    }
+
+    bool is_valid_vcf_file(util::MappedFile &input,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           Ploidy ploidy,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           CheckpointOptions const &options)
+    {
+        char const * begin = input.begin();
+        char const * end = input.end();
+        if (begin != end && static_cast<unsigned char>(*begin) == 0x1f) {
+            // Compressed contents are decoded through the stream path
+            util::RangeStreambuf range{begin, end};
+            std::istream stream{&range};
+            return is_valid_vcf_file(stream, sourceName, validationLevel, ploidy, outputs, options);
+        }
+
+        CheckpointedValidator validator{sourceName, InputFormat::VCF_FILE_VCF, validationLevel, ploidy, outputs,
+                                        options};
+        char const * position;
+        if (options.resume) {
+            Checkpoint checkpoint = read_checkpoint(options.path);
+            if (checkpoint.offset > static_cast<uint64_t>(end - begin)) {
+                throw std::runtime_error{"The input is shorter than when the checkpoint was written"};
+            }
+            validator.resume({begin, begin + checkpoint.header_end}, checkpoint);
+            position = begin + checkpoint.offset;
+        } else {
+            auto newline = begin == end ? nullptr
+                                        : static_cast<char const *>(std::memchr(begin, '\n', end - begin));
+            position = newline == nullptr ? end : newline + 1;
+            if (!validator.start({begin, position})) {
+                return false;
+            }
+        }
+
+        while (position < end) {
+            char const * block_end = position + std::min<size_t>(default_read_block_size, end - position);
+            validator.parse(position, block_end);
+            input.release_until(block_end);
+            position = block_end;
+        }
+        return validator.end();
+    }
+  }
+}
@@ -0,0 +1,160 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "vcf/genotype.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    namespace
+    {
+      bool is_separator(char c)
+      {
+          return c == '/' || c == '|';
+      }
+
+      void add_allele(GenotypeAlleles & genotype,
+                      char const * begin,
+                      char const * allele_begin,
+                      char const * allele_end,
+                      size_t max_index)
+      {
+          ++genotype.ploidy;
+
+          if (allele_end - allele_begin == 1 && *allele_begin == '.') {
+              return; // Missing alleles are always valid
+          }
+
+          size_t const saturated = std::numeric_limits<size_t>::max();
+          size_t value = 0;
+          bool integer = allele_begin != allele_end;
+          for (char const * p = allele_begin; p != allele_end; ++p) {
+              if (*p < '0' || *p > '9') {
+                  integer = false;
+                  break;
+              }
+              size_t digit = static_cast<size_t>(*p - '0');
+              value = value > (saturated - digit) / 10 ? saturated : value * 10 + digit;
+          }
+
+          if (integer && value <= max_index) {
+              genotype.max_allele = std::max(genotype.max_allele, static_cast<long>(value));
+          } else if (genotype.error == AlleleError::none) {
+              genotype.error = integer ? AlleleError::out_of_range : AlleleError::not_integer;
+              genotype.error_begin = static_cast<size_t>(allele_begin - begin);
+              genotype.error_end = static_cast<size_t>(allele_end - begin);
+              genotype.error_value = value;
+          }
+      }
+
+      size_t const max_table_ploidy = 8;
+      size_t const max_table_alleles = 64;
+
+      size_t greatest_common_divisor(size_t a, size_t b)
+      {
+          while (b != 0) {
+              size_t remainder = a % b;
+              a = b;
+              b = remainder;
+          }
+          return a;
+      }
+
+      long count_genotypes_exact(size_t ploidy, size_t n_alleles)
+      {
+          if (n_alleles == 0) {
+              return ploidy == 0 ? 1 : 0;
+          }
+
+          // C(n + k - 1, k) is C(n + k - 2, k - 1) * (n + k - 1) / k, and the division is exact. Dividing first by
+          // the common factors keeps every intermediate value below the result, so only the result may overflow.
+          unsigned long long count = 1;
+          unsigned long long const limit = std::numeric_limits<long>::max();
+          for (size_t k = 1; k <= ploidy; ++k) {
+              size_t factor = n_alleles - 1 + k;
+              size_t divisor = greatest_common_divisor(factor, k);
+              count /= k / divisor;
+              if (count > limit / (factor / divisor)) {
+                  return std::numeric_limits<long>::max();
+              }
+              count *= factor / divisor;
+          }
+          return static_cast<long>(count);
+      }
+    }
+
+    GenotypeAlleles scan_genotype(char const * begin, char const * end, size_t max_index)
+    {
+        GenotypeAlleles genotype{0, true, -1, AlleleError::none, 0, 0, 0};
+
+        if (end - begin == 3 && is_separator(begin[1])) {
+            char first = begin[0];
+            char second = begin[2];
+            bool first_digit = first >= '0' && first <= '9';
+            bool second_digit = second >= '0' && second <= '9';
+            bool first_valid = first == '.' || (first_digit && static_cast<size_t>(first - '0') <= max_index);
+            bool second_valid = second == '.' || (second_digit && static_cast<size_t>(second - '0') <= max_index);
+
+            if (first_valid && second_valid) {
+                genotype.ploidy = 2;
+                genotype.phased = begin[1] == '|';
+                genotype.max_allele = std::max(first_digit ? first - '0' : -1, second_digit ? second - '0' : -1);
+                return genotype;
+            }
+        }
+
+        // A separator in the first character is not splitting anything, as in util::string_split
+        char const * allele_begin = begin;
+        for (char const * p = begin + 1; p < end; ++p) {
+            if (is_separator(*p)) {
+                add_allele(genotype, begin, allele_begin, p, max_index);
+                genotype.phased = genotype.phased && *p == '|';
+                allele_begin = p + 1;
+            }
+        }
+        if (allele_begin < end) {
+            add_allele(genotype, begin, allele_begin, end, max_index);
+        }
+
+        return genotype;
+    }
+
+    long count_genotypes(size_t ploidy, size_t n_alleles)
+    {
+        // Built once, by the first thread that needs it
+        static std::vector<long> const table = []() {
+            std::vector<long> counts((max_table_ploidy + 1) * (max_table_alleles + 1));
+            for (size_t p = 0; p <= max_table_ploidy; ++p) {
+                for (size_t n = 0; n <= max_table_alleles; ++n) {
+                    counts[p * (max_table_alleles + 1) + n] = count_genotypes_exact(p, n);
+                }
+            }
+            return counts;
+        }();
+
+        if (ploidy <= max_table_ploidy && n_alleles <= max_table_alleles) {
+            return table[ploidy * (max_table_alleles + 1) + n_alleles];
+        }
+        return count_genotypes_exact(ploidy, n_alleles);
+    }
+  }
+}
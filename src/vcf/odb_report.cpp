@@ -73,6 +73,7 @@ namespace ebi
         if (transaction.has_current()) {
             transaction.commit();
         }
+        current_transaction_size = 0;
 
         {
             odb::core::connection_ptr c{db->connection()};
@@ -105,10 +106,31 @@ namespace ebi
         if (current_transaction_size == transaction_size) {
             // commit transaction
             flush();
-            current_transaction_size = 0;
         }
     }
 
+    void OdbReportRW::resume(size_t n_reports)
+    {
+        typedef odb::result<Error> result_t;
+
+        flush();
+        transaction.reset(db->begin());
+
+        // Reports are stored in the order they were written, so the ones after the first n_reports were written
+        // after the checkpoint, and will be written again
+        std::vector<unsigned long> ids;
+        result_t result{db->query<Error>((odb::query<Error>::id > 0) + " ORDER BY " + odb::query<Error>::id
+                                         + " LIMIT -1 OFFSET " + std::to_string(n_reports))};
+        for (result_t::iterator it{result.begin()}; it != result.end(); ++it) {
+            ids.push_back(it.id());
+        }
+        for (auto id : ids) {
+            db->erase<Error>(id);
+        }
+
+        flush();
+    }
+
     // ReportReader implementation
     size_t OdbReportRW::count_warnings()
     {
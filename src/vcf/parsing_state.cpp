@@ -22,10 +22,11 @@ namespace ebi
   {
 
     ParsingState::ParsingState(std::shared_ptr<Source> source)
-    : n_lines{1}, n_columns{1}, n_batches{0}, cs{0}, m_is_valid{true}, 
-      source{source}, record{},
+    : n_lines{1}, n_records{0}, n_columns{1}, n_batches{0}, cs{0}, m_is_valid{true}, 
+      source{source}, record{}, typed_fields{nullptr},
       errors{}, warnings{},
-      defined_metadata{}
+      error_n_lines{}, warning_n_lines{},
+      defined_metadata{}, record_checks_deferred{false}, sorting{}
     {
     }
 
@@ -36,7 +37,7 @@ namespace ebi
     
     void ParsingState::add_meta(MetaEntry const & meta)
     {
-        source->meta_entries.emplace(meta.id, meta);
+        source->add_meta(meta);
     }
     
     void ParsingState::set_record(std::unique_ptr<Record> record)
@@ -47,18 +48,23 @@ namespace ebi
     void ParsingState::add_error(std::unique_ptr<Error> error)
     {
         errors.push_back(std::move(error));
+        error_n_lines.push_back(n_lines);
     }
 
     void ParsingState::add_warning(std::unique_ptr<Error> error)
     {
         warnings.push_back(std::move(error));
+        warning_n_lines.push_back(n_lines);
     }
 
     void ParsingState::clear()
     {
         record.reset();
+        record_errors.clear();
         errors.clear();
         warnings.clear();
+        error_n_lines.clear();
+        warning_n_lines.clear();
     }
 
     std::vector<std::string> const & ParsingState::samples() const
@@ -15,6 +15,10 @@
  */
 
 #include <functional>
+#include <limits>
+
+#include "util/number_scanner.hpp"
+#include "vcf/error_thrower.hpp"
 #include "vcf/file_structure.hpp"
 #include "vcf/record.hpp"
 
@@ -23,6 +27,38 @@ namespace ebi
   namespace vcf
   {
 
+    FormatSpec::FormatSpec(Source const & source, std::vector<std::string> const & format)
+    : definitions{},
+      gt_misplaced{std::find(format.begin(), format.end(), "GT") != format.end() && format[0] != "GT"},
+      duplicated{false}
+    {
+        for (auto & field : format) {
+            definitions.push_back(source.format_definition(field));
+            duplicated = duplicated || std::count(format.begin(), format.end(), field) > 1;
+        }
+    }
+
+    void TypedFields::clear()
+    {
+        quality = 0;
+        info.clear();
+        samples.clear();
+    }
+
+    TypedValues const * TypedFields::info_values(std::string const & key) const
+    {
+        auto values = info.find(key);
+        return values != info.end() && values->second.kind != ValueKind::text ? &values->second : nullptr;
+    }
+
+    TypedValues const * TypedFields::sample_values(size_t i, size_t j) const
+    {
+        if (i >= samples.size() || j >= samples[i].size() || samples[i][j].kind == ValueKind::text) {
+            return nullptr;
+        }
+        return &samples[i][j];
+    }
+
     Record::Record(size_t const line,
             std::string const & chromosome,
             size_t const position,
@@ -33,8 +69,11 @@ namespace ebi
             std::vector<std::string> const & filters,
             std::map<std::string, std::string> const & info,
             std::vector<std::string> const & format,
-            std::vector<std::string> const & samples,
-            std::shared_ptr<Source> source)
+            std::vector<std::string> samples,
+            std::shared_ptr<Source> source,
+            std::shared_ptr<FormatSpec const> format_spec,
+            RecordErrors * errors,
+            TypedFields const * typed)
     : line(line),
         chromosome{chromosome},
         position{position},
@@ -46,18 +85,27 @@ namespace ebi
         filters{filters}, 
         info{info}, 
         format{format}, 
-        samples{samples},
-        source{source}
+        samples{std::move(samples)},
+        source{source},
+        format_spec{format_spec ? format_spec : std::make_shared<FormatSpec const>(*source, format)},
+        ploidy{source->ploidy.get_ploidy(chromosome)}
     {
+        RecordErrors first_errors;
+        RecordErrors & found = errors != nullptr ? *errors : first_errors;
+
         set_types();
-        check_chromosome();
-        check_ids();
-        check_alternate_alleles();
-        check_quality();
-        check_filter();
-        check_info();
-        check_format();
-        check_samples();
+        check_chromosome(found);
+        check_ids(found);
+        check_alternate_alleles(found);
+        check_quality(found);
+        check_filter(found);
+        check_info(typed, found);
+        check_format(found);
+        check_samples(typed, found);
+
+        if (!first_errors.empty()) {
+            ErrorThrower{}.raise(first_errors.front().release());
+        }
     }
 
     bool Record::operator==(Record const & other) const
@@ -79,6 +127,68 @@ namespace ebi
         return !(*this == other);
     }
 
+    size_t Record::n_sample_subfields(size_t i) const
+    {
+        split_sample_subfields();
+        return sample_first_subfield[i + 1] - sample_first_subfield[i];
+    }
+
+    std::string Record::sample_subfield(size_t i, size_t j) const
+    {
+        size_t begin, end;
+        sample_subfield_bounds(i, j, begin, end);
+        return samples[i].substr(begin, end - begin);
+    }
+
+    GenotypeAlleles const & Record::sample_genotype(size_t i) const
+    {
+        if (sample_genotypes.empty()) {
+            sample_genotypes.reserve(samples.size());
+            for (size_t k = 0; k < samples.size(); ++k) {
+                size_t begin, end;
+                sample_subfield_bounds(k, 0, begin, end);
+                char const * data = samples[k].data();
+                sample_genotypes.push_back(scan_genotype(data + begin, data + end, alternate_alleles.size()));
+            }
+        }
+        return sample_genotypes[i];
+    }
+
+    void Record::sample_subfield_bounds(size_t i, size_t j, size_t & begin, size_t & end) const
+    {
+        if (j >= n_sample_subfields(i)) {
+            begin = end = 0;
+            return;
+        }
+
+        size_t subfield = sample_first_subfield[i] + j;
+        begin = j == 0 ? 0 : sample_subfield_ends[subfield - 1] + 1;
+        end = sample_subfield_ends[subfield];
+    }
+
+    void Record::split_sample_subfields() const
+    {
+        if (!sample_first_subfield.empty()) {
+            return;
+        }
+
+        // Split the same way as util::string_split: empty subfields are kept, but not a trailing one
+        for (auto & sample : samples) {
+            sample_first_subfield.push_back(sample_subfield_ends.size());
+            size_t begin = 0;
+            for (size_t k = 1; k < sample.size(); ++k) {
+                if (sample[k] == ':') {
+                    sample_subfield_ends.push_back(k);
+                    begin = k + 1;
+                }
+            }
+            if (begin < sample.size()) {
+                sample_subfield_ends.push_back(sample.size());
+            }
+        }
+        sample_first_subfield.push_back(sample_subfield_ends.size());
+    }
+
     void Record::set_types()
     {
         for (std::vector<std::string>::iterator it = alternate_alleles.begin(); it != alternate_alleles.end(); ++it) {
@@ -98,81 +208,85 @@ namespace ebi
         }
     }
     
-    void Record::check_chromosome() const
+    void Record::check_chromosome(RecordErrors & errors) const
     {
-        check_chromosome_no_colons();
-        check_chromosome_no_whitespaces();
+        check_chromosome_no_colons(errors);
+        check_chromosome_no_whitespaces(errors);
     }
 
-    void Record::check_chromosome_no_colons() const
+    void Record::check_chromosome_no_colons(RecordErrors & errors) const
     {
         if (chromosome.find(':') != std::string::npos) {
-            throw new ChromosomeBodyError{line, "Chromosome must not contain colons"};
+            errors.emplace_back(new ChromosomeBodyError{line, "Chromosome must not contain colons"});
         }
     }
 
-    void Record::check_chromosome_no_whitespaces() const
+    void Record::check_chromosome_no_whitespaces(RecordErrors & errors) const
     {
         if (chromosome.find(' ') != std::string::npos) {
-            throw new ChromosomeBodyError{line, "Chromosome must not contain white-spaces"};
+            errors.emplace_back(new ChromosomeBodyError{line, "Chromosome must not contain white-spaces"});
         }
     }
 
-    void Record::check_ids() const
+    void Record::check_ids(RecordErrors & errors) const
     {
         if (ids.size() == 1 && ids[0] == ".") {
             return; // No need to check if no IDs are provided
         }
         
-        check_ids_no_semicolons_whitespaces();
-        check_ids_no_duplicates();
+        check_ids_no_semicolons_whitespaces(errors);
+        check_ids_no_duplicates(errors);
     }
 
-    void Record::check_ids_no_semicolons_whitespaces() const {
+    void Record::check_ids_no_semicolons_whitespaces(RecordErrors & errors) const {
         for (auto & id : ids) {
             if (std::find_if(id.begin(), id.end(), [](char c) { return c == ' ' || c == ';'; }) != id.end()) {
-                throw new IdBodyError{line, "ID must not contain semicolons or whitespaces"};
+                errors.emplace_back(new IdBodyError{line, "ID must not contain semicolons or whitespaces"});
+                return;
             }
         }
     }
 
-    void Record::check_ids_no_duplicates() const {
+    void Record::check_ids_no_duplicates(RecordErrors & errors) const {
         if (ids.size() > 1 && source->version == Version::v43) {
             std::map<std::string, int> counter;
             for (auto & id : ids) {
                 counter[id]++;
                 if (counter[id] >= 2) {
-                    throw new IdBodyError{line, "ID must not have duplicate values"};
+                    errors.emplace_back(new IdBodyError{line, "ID must not have duplicate values"});
+                    return;
                 }
             }
         }
     }
 
-    void Record::check_alternate_alleles() const
+    void Record::check_alternate_alleles(RecordErrors & errors) const
     {        
         for (size_t i = 0 ; i < alternate_alleles.size(); ++i) {
             auto & alternate = alternate_alleles[i];
             auto & type = types[i];
             
-            check_alternate_allele_structure(alternate, type);
-            check_alternate_allele_symbolic_prefix(alternate);
+            check_alternate_allele_structure(alternate, type, errors);
+            check_alternate_allele_symbolic_prefix(alternate, errors);
         }
         
     }
     
-    void Record::check_alternate_allele_structure(std::string const & alternate, RecordType type) const
+    void Record::check_alternate_allele_structure(std::string const & alternate, RecordType type,
+                                                  RecordErrors & errors) const
     {
         switch (type) {
             case RecordType::NO_VARIATION:
                 if (alternate_alleles.size() > 1) {
-                    throw new AlternateAllelesBodyError{line,
-                            "The no-alternate alleles symbol (dot) can not be combined with others"};
+                    errors.emplace_back(new AlternateAllelesBodyError{line,
+                            "The no-alternate alleles symbol (dot) can not be combined with others"});
                 }
                 break;
             case RecordType::SNV:
             case RecordType::MNV:
                 if (alternate == reference_allele) {
-                    throw new AlternateAllelesBodyError{line, "Reference and alternate alleles must not be the same"};
+                    errors.emplace_back(new AlternateAllelesBodyError{line,
+                            "Reference and alternate alleles must not be the same"});
                 }
             case RecordType::INDEL:
                 // Nothing to check
@@ -185,425 +299,549 @@ namespace ebi
         
     }
     
-    void Record::check_alternate_allele_symbolic_prefix(std::string const & alternate) const
-    {
-        static boost::regex square_brackets_regex("<([a-zA-Z0-9:_]+)>");
-        boost::cmatch pieces_match;
-
-        if (alternate[0] == '<' && boost::regex_match(alternate.c_str(), pieces_match, square_brackets_regex)) {
-            std::string alt_id = pieces_match[1];
-            if (!boost::starts_with(alt_id, "DEL") && 
-                !boost::starts_with(alt_id, "INS") && 
-                !boost::starts_with(alt_id, "DUP") && 
-                !boost::starts_with(alt_id, "INV") && 
-                !boost::starts_with(alt_id, "CNV")) {
-                throw new AlternateAllelesBodyError{line,
-                        "Alternate ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"};
+    void Record::check_alternate_allele_symbolic_prefix(std::string const & alternate, RecordErrors & errors) const
+    {
+        size_t id_length;
+        if (is_symbolic_allele(alternate, id_length)) {
+            if (alternate.compare(0, 4, "<DEL") != 0 &&
+                alternate.compare(0, 4, "<INS") != 0 &&
+                alternate.compare(0, 4, "<DUP") != 0 &&
+                alternate.compare(0, 4, "<INV") != 0 &&
+                alternate.compare(0, 4, "<CNV") != 0) {
+                errors.emplace_back(new AlternateAllelesBodyError{line,
+                        "Alternate ID is not prefixed by DEL/INS/DUP/INV/CNV and suffixed by ':' and a text sequence"});
             }
         }
     }
-    void Record::check_quality() const
+    void Record::check_quality(RecordErrors & errors) const
     {
         if (quality < 0) {
-            throw new QualityBodyError{line, "Quality is not equal or greater than zero"};
+            errors.emplace_back(new QualityBodyError{line, "Quality is not equal or greater than zero"});
         }
     }
     
-    void Record::check_filter() const
-    {
-    }
-
-    void Record::check_info() const
+    void Record::check_filter(RecordErrors & errors) const
+    {
+    }
+
+    namespace
+    {
+      FieldDictionary compile_predefined_tags(std::map<std::string, std::pair<std::string, std::string>> const & tags)
+      {
+          FieldDictionary definitions;
+          for (auto & tag : tags) {
+              definitions.emplace(tag.first, FieldDefinition{tag.first, tag.second.second, tag.second.first});
+          }
+          return definitions;
+      }
+
+      FieldDictionary const & predefined_info_tags(Version version)
+      {
+          static FieldDictionary const tags_v41_v42 = compile_predefined_tags(info_v41_v42);
+          static FieldDictionary const tags_v43 = compile_predefined_tags(info_v43);
+          return version == Version::v41 || version == Version::v42 ? tags_v41_v42 : tags_v43;
+      }
+
+      /**
+       * Reads the value of an Integer field, which must fit in 32 bits
+       */
+      util::NumberStatus scan_integer_value(std::string const & value, int64_t & integer)
+      {
+          auto status = util::scan_integer(value.data(), value.data() + value.size(), integer);
+          if (status == util::NumberStatus::valid && (integer < std::numeric_limits<int32_t>::min()
+                                                      || integer > std::numeric_limits<int32_t>::max())) {
+              return util::NumberStatus::out_of_range;
+          }
+          return status;
+      }
+
+      /**
+       * Matches the value of the AA field: printable characters other than ',', ';' and '='
+       */
+      bool is_ancestral_allele(std::string const & value)
+      {
+          return !value.empty() && std::all_of(value.begin(), value.end(), [](char c) {
+              return c >= ' ' && c <= '~' && c != ',' && c != ';' && c != '=';
+          });
+      }
+
+      /**
+       * Matches a CIGAR string of the SAM specification: one or more operations, each of them a length followed by
+       * one of the letters MIDNSHPX
+       */
+      bool is_cigar(std::string const & value)
+      {
+          auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+          auto current = value.begin();
+          do {
+              auto operation = std::find_if_not(current, value.end(), is_digit);
+              if (operation == current || operation == value.end()) {
+                  return false;
+              }
+              switch (*operation) {
+                  case 'M': case 'I': case 'D': case 'N': case 'S': case 'H': case 'P': case 'X':
+                      break;
+                  default:
+                      return false;
+              }
+              current = operation + 1;
+          } while (current != value.end());
+          return true;
+      }
+    }
+
+    void Record::check_info(TypedFields const * typed, RecordErrors & errors) const
     {
-        typedef std::multimap<std::string, MetaEntry>::iterator iter;
-        std::pair<iter, iter> range = source->meta_entries.equal_range("INFO");
         std::vector<std::string> values;
+        std::string message;
 
         // Check that INFO fields listed in the meta section
         // match the Number and Type specified in there
         for (auto & field : info) {
             if (field.first == ".") { continue; } // No need to check missing data
 
-            util::string_split(field.second, ",", values);
-            bool found_in_meta = false;
-            for (iter current = range.first; current != range.second; ++current) {
-                auto & key_values = boost::get<std::map < std::string, std::string >> ((current->second).value);
-                if (key_values["ID"] == field.first) {
-                    found_in_meta = true;
-                    try {
-                        check_field_cardinality(field.second, values, key_values["Number"]);
-                        check_field_type(values, key_values["Type"]);
-                    } catch (std::shared_ptr<Error> ex) {
-                        std::string message = "INFO " + key_values["ID"] + "=" + field.second
-                                + " does not match the meta" + ex->message;
-                        throw new InfoBodyError{line, message, key_values["ID"]};
-                    }
-                    
-                    break;
-                }
+            // Numbers read from a binary file are checked as they are, without splitting their text
+            TypedValues const * typed_values = typed != nullptr ? typed->info_values(field.first) : nullptr;
+            if (typed_values == nullptr) {
+                util::string_split(field.second, ",", values);
             }
-            
-            if (!found_in_meta) {
-                try {
-                    if (source->version == Version::v41 || source->version == Version::v42) {
-                        check_predefined_tag(field.first, field.second, values, info_v41_v42);
-                    } else {
-                        check_predefined_tag(field.first, field.second, values, info_v43);
-                    }
-                } catch (std::shared_ptr<Error> ex) {
-                    throw new InfoBodyError{line, "INFO " + ex->message, field.first};
+            size_t n_values = typed_values != nullptr ? typed_values->values.size() : values.size();
+
+            FieldDefinition const * definition = source->info_definition(field.first);
+            if (definition != nullptr) {
+                if (!check_field_cardinality(field.second, n_values, *definition, message)
+                        || !check_field_type(values, typed_values, *definition, message)) {
+                    errors.emplace_back(new InfoBodyError{line, "INFO " + definition->id + "=" + field.second
+                            + " does not match the meta" + message, definition->id});
+                    continue;
                 }
+            } else if (!check_predefined_tag(field.first, field.second, values, typed_values,
+                                             predefined_info_tags(source->version), message)) {
+                errors.emplace_back(new InfoBodyError{line, "INFO " + message, field.first});
+                continue;
             }
 
-            strict_validation_info_predefined_tags(field.first, field.second);
+            strict_validation_info_predefined_tags(field.first, field.second, typed_values, errors);
        }
     }
     
-    void Record::check_format() const
+    void Record::check_format(RecordErrors & errors) const
     {
         if (format.size() == 0) {
             return; // Nothing to check
         }
         
-        check_format_GT();
-        check_format_no_duplicates();
+        check_format_GT(errors);
+        check_format_no_duplicates(errors);
     }
 
-    void Record::check_format_GT() const
+    void Record::check_format_GT(RecordErrors & errors) const
     {
-        if (std::find(format.begin(), format.end(), "GT") != format.end() && format[0] != "GT") {
-            throw new FormatBodyError{line, "GT must be the first field in the FORMAT column"};
+        if (format_spec->gt_misplaced) {
+            errors.emplace_back(new FormatBodyError{line, "GT must be the first field in the FORMAT column"});
         }
     }
 
-    void Record::check_format_no_duplicates() const
+    void Record::check_format_no_duplicates(RecordErrors & errors) const
     {
-        if (format.size() > 1 && source->version == Version::v43) {
-            std::map<std::string, int> counter;
-            for (auto & form : format) {
-                counter[form]++;
-                if (counter[form] >= 2) {
-                    throw new FormatBodyError{line, "FORMAT must not have duplicate fields"};
-                }
-            }
+        if (format_spec->duplicated && source->version == Version::v43) {
+            errors.emplace_back(new FormatBodyError{line, "FORMAT must not have duplicate fields"});
         }
     }
 
-    void Record::check_predefined_tag(std::string const & field_key, std::string const & field_value, std::vector<std::string> const & values,
-                                      std::map<std::string, std::pair<std::string, std::string>> const & tags) const
+    bool Record::check_predefined_tag(std::string const & field_key, std::string const & field_value, std::vector<std::string> const & values,
+                                      TypedValues const * typed, FieldDictionary const & tags, std::string & message) const
     {
         auto iterator = tags.find(field_key);
         if (iterator != tags.end()) {
-            try {
-                check_field_cardinality(field_key, values, iterator->second.second);
-                check_field_type(values, iterator->second.first);
-            } catch (std::shared_ptr<Error> ex) {
-                raise(std::make_shared<Error>(line, field_key + "=" + field_value
-                                + " does not match the" + ex->message));
+            size_t n_values = typed != nullptr ? typed->values.size() : values.size();
+            if (!check_field_cardinality(field_key, n_values, iterator->second, message)
+                    || !check_field_type(values, typed, iterator->second, message)) {
+                message = field_key + "=" + field_value + " does not match the" + message;
+                return false;
             }
-            if (iterator->second.first == "Integer") {
-                check_field_integer_range(field_key, values);
+            if (iterator->second.field_type == FieldType::integer) {
+                return check_field_integer_range(field_key, values, typed, message);
             }
         }
+        return true;
     }
 
-    void Record::strict_validation_info_predefined_tags(std::string const & field_key, std::string const & field_value) const
+    bool Record::strict_validation_info_predefined_tags(std::string const & field_key, std::string const & field_value,
+                                                        TypedValues const * typed, RecordErrors & errors) const
     {
         if (field_key == "AA") {
-            static boost::regex aa_regex("((?![,;=])[[:print:]])+");
-            if (!boost::regex_match(field_value, aa_regex)) {
-                throw new InfoBodyError{line, "INFO AA=" + field_value + " value is not a single dot or a string of bases", field_key};
+            if (!is_ancestral_allele(field_value)) {
+                errors.emplace_back(new InfoBodyError{line, "INFO AA=" + field_value + " value is not a single dot or a string of bases", field_key});
+                return false;
+            }
+        } else if (field_key == "AF" && typed != nullptr) {
+            for (auto & value : typed->values) {
+                // NaN is not rejected, same as it would not be when compared to the interval
+                if (!value.missing && (value.number < 0 || value.number > 1)) {
+                    errors.emplace_back(new InfoBodyError{line, "INFO AF=" + field_value + " value does not lie in the interval [0,1]", field_key});
+                    return false;
+                }
             }
         } else if (field_key == "AF") {
             std::vector<std::string> values;
             util::string_split(field_value, ",", values);
             for (auto & value : values) {
-                if (std::stold(value) < 0 || std::stold(value) > 1) {
-                    throw new InfoBodyError{line, "INFO AF=" + field_value + " value does not lie in the interval [0,1]", field_key};
+                if (value == ".") { continue; }
+
+                // NaN is not rejected, same as it would not be when compared to the interval
+                double frequency;
+                if (util::scan_float(value.data(), value.data() + value.size(), frequency) != util::NumberStatus::valid
+                        || frequency < 0 || frequency > 1) {
+                    errors.emplace_back(new InfoBodyError{line, "INFO AF=" + field_value + " value does not lie in the interval [0,1]", field_key});
+                    return false;
                 }
             }
         } else if (field_key == "CIGAR") {
             std::vector<std::string> values;
             util::string_split(field_value, ",", values);
-            static boost::regex cigar_string("([0-9]+[MIDNSHPX])+");
             for (auto & value : values) {
-                if (!boost::regex_match(value, cigar_string)) {
-                    throw new InfoBodyError{line, "INFO CIGAR=" + field_value + " value is not an alphanumeric string compliant with the SAM specification", field_key};
+                if (!is_cigar(value)) {
+                    errors.emplace_back(new InfoBodyError{line, "INFO CIGAR=" + field_value + " value is not an alphanumeric string compliant with the SAM specification", field_key});
+                    return false;
                 }
             }
         }
+        return true;
     }
 
-    void Record::check_samples() const
+    void Record::check_samples(TypedFields const * typed, RecordErrors & errors) const
     {
-        check_samples_count();
+        check_samples_count(errors);
         
         if (samples.size() == 0) {
             return; // Nothing to check if no samples are listed in the file
         }
         
-        std::vector<MetaEntry> format_meta = get_meta_entry_objects();
-
         for (size_t i = 0; i < samples.size(); ++i) {
-            check_sample(i, format_meta);
+            check_sample(i, format_spec->definitions, typed, errors);
         }
     }
     
-    void Record::check_samples_count() const
+    void Record::check_samples_count(RecordErrors & errors) const
     {
         if (samples.size() != source->samples_names.size()) {
-            throw new SamplesBodyError{line, "The number of samples must match those listed in the header line"};
+            errors.emplace_back(new SamplesBodyError{line,
+                    "The number of samples must match those listed in the header line"});
         }
     }
 
-    std::vector<MetaEntry> Record::get_meta_entry_objects() const
+    void Record::check_sample(size_t i, std::vector<FieldDefinition const *> const & format_definitions,
+                              TypedFields const * typed, RecordErrors & errors) const
     {
-        typedef std::multimap<std::string, MetaEntry>::iterator iter;
-        std::pair<iter, iter> range = source->meta_entries.equal_range("FORMAT");
-        std::vector<MetaEntry> format_meta;
-
-        for (auto & fm : format) {
-            bool found_in_header = false;
-            
-            for (iter current = range.first; current != range.second; ++current) {
-                auto & key_values = boost::get<std::map < std::string, std::string>>((current->second).value);
-
-                if (key_values["ID"] == fm) {
-                    format_meta.push_back(current->second);
-                    found_in_header = true;
-                    break;
-                }
-            }
-            
-            if (!found_in_header) {
-                // If not found in header, a null-value meta entry must be created to make sizes match
-                format_meta.push_back(MetaEntry{line, "", source});
-            }
+        // Only the first error of each sample is reported, the rest of its checks may depend on it
+        if (!check_sample_subfields_count(i, errors)) {
+            return;
         }
-
-        return format_meta;
-    }
-
-    void Record::check_sample(size_t i, std::vector<MetaEntry> const & format_meta) const
-    {
-        std::vector<std::string> subfields;
-        util::string_split(samples[i], ":", subfields);
-        
-        check_sample_subfields_count(i, subfields);
         
         // If the first format field is not a GT, then no alleles need to be checked
-        if (format[0] == "GT") {
-            check_sample_alleles(subfields);
+        if (format[0] == "GT" && !check_sample_alleles(i, errors)) {
+            return;
         }        
         
-        check_sample_subfields_cardinality_type(i, subfields, format_meta);
+        check_sample_subfields_cardinality_type(i, format_definitions, typed, errors);
     }
 
-    void Record::check_sample_subfields_count(size_t i, std::vector<std::string> const & subfields) const
+    bool Record::check_sample_subfields_count(size_t i, RecordErrors & errors) const
     {
-        if (subfields.size() > format.size()) {
-            throw new SamplesBodyError{line, "Sample #" + std::to_string(i+1) +
-                    " has more fields than specified in the FORMAT column"};
+        if (n_sample_subfields(i) > format.size()) {
+            errors.emplace_back(new SamplesBodyError{line, "Sample #" + std::to_string(i+1) +
+                    " has more fields than specified in the FORMAT column"});
+            return false;
         }
+        return true;
     }
 
-    void Record::check_sample_subfields_cardinality_type(size_t i, std::vector<std::string> const & subfields, std::vector<MetaEntry> const & format_meta) const
+    void Record::check_sample_subfields_cardinality_type(size_t i,
+                                                         std::vector<FieldDefinition const *> const & format_definitions,
+                                                         TypedFields const * typed,
+                                                         RecordErrors & errors) const
     {
-        for (size_t j = 0; j < subfields.size(); ++j) {
-            MetaEntry meta = format_meta[j];
-            auto & subfield = subfields[j];
+        std::vector<std::string> values;
+        std::string message;
+        for (size_t j = 0; j < n_sample_subfields(i); ++j) {
+            FieldDefinition const * definition = format_definitions[j];
             
-            if (meta.id == "") {
+            if (definition == nullptr) {
                 // FORMAT fields not described in the meta section can't be checked
                 continue;
             }
             
-            auto & key_values = boost::get<std::map < std::string, std::string>>(meta.value);
+            std::string subfield = sample_subfield(i, j);
 
-            std::vector<std::string> values;
-            util::string_split(subfield, ",", values);
+            TypedValues const * typed_values = typed != nullptr ? typed->sample_values(i, j) : nullptr;
+            if (typed_values == nullptr) {
+                util::string_split(subfield, ",", values);
+            }
+            size_t n_values = typed_values != nullptr ? typed_values->values.size() : values.size();
 
-            try {
-                check_field_cardinality(subfield, values, key_values["Number"]);
-                check_field_type(values, key_values["Type"]);
-            } catch (std::shared_ptr<Error> ex) {
+            if (!check_field_cardinality(subfield, n_values, *definition, message)
+                    || !check_field_type(values, typed_values, *definition, message)) {
                 long cardinality;
-                bool valid = is_valid_cardinality(key_values["Number"], alternate_alleles.size(), cardinality);
+                bool valid = is_valid_cardinality(*definition, alternate_alleles.size(), cardinality);
                 long number = valid ? cardinality : -1;
  
-                std::string message = "Sample #" + std::to_string(i + 1) + ", " + key_values["ID"] + "=" + subfield
-                        + " does not match the meta" + ex->message;
-                throw new SamplesFieldBodyError{line, message, key_values["ID"], number};
+                errors.emplace_back(new SamplesFieldBodyError{line, "Sample #" + std::to_string(i + 1) + ", "
+                        + definition->id + "=" + subfield + " does not match the meta" + message,
+                        definition->id, number});
+                return;
             }
         }
     }
 
-    void Record::check_sample_alleles(std::vector<std::string> const & subfields) const
+    bool Record::check_sample_alleles(size_t i, RecordErrors & errors) const
     {
-        std::vector<std::string> alleles;
-        util::string_split(subfields[0], "|/", alleles);
-        long ploidy = static_cast<long>(source->ploidy.get_ploidy(chromosome));
-        for (auto & allele : alleles) {
-            if (allele == ".") { continue; } // No need to check missing alleles
-
-            check_sample_alleles_is_integer(allele, ploidy);
-
-            check_sample_alleles_range(allele, ploidy);
+        GenotypeAlleles const & genotype = sample_genotype(i);
+        if (genotype.error == AlleleError::none) {
+            return true;
         }
-    }
 
-    void Record::check_sample_alleles_is_integer(std::string const & allele, long ploidy) const
-    {
-        if (std::find_if_not(allele.begin(), allele.end(), isdigit) != allele.end()) {
-            throw new SamplesFieldBodyError{line, "Allele index " + allele + " is not an integer number",
-                                            "GT", ploidy};
-        }        
-    }
-
-    void Record::check_sample_alleles_range(std::string const & allele, long ploidy) const
-    {
-        size_t num_allele = std::stoi(allele);
-        if (num_allele > alternate_alleles.size()) {
-            throw new SamplesFieldBodyError{line,
-                                            "Allele index " + std::to_string(num_allele)
-                                                    + " is greater than the maximum allowed "
-                                                    + std::to_string(alternate_alleles.size()),
-                                            "GT", ploidy};
+        if (genotype.error == AlleleError::not_integer) {
+            size_t begin, end;
+            sample_subfield_bounds(i, 0, begin, end);
+            std::string allele = samples[i].substr(begin + genotype.error_begin,
+                                                   genotype.error_end - genotype.error_begin);
+            errors.emplace_back(new SamplesFieldBodyError{line, "Allele index " + allele + " is not an integer number",
+                                                          "GT", static_cast<long>(ploidy)});
+            return false;
         }
+
+        errors.emplace_back(new SamplesFieldBodyError{line,
+                                        "Allele index " + std::to_string(genotype.error_value)
+                                                + " is greater than the maximum allowed "
+                                                + std::to_string(alternate_alleles.size()),
+                                        "GT", static_cast<long>(ploidy)});
+        return false;
     }
 
-    bool Record::is_valid_cardinality(std::string const & number, size_t alternate_allele_number, long & cardinality) const
+    bool Record::is_valid_cardinality(FieldDefinition const & definition, size_t alternate_allele_number, long & cardinality) const
     {
-        bool valid = true;
-        size_t ploidy = source->ploidy.get_ploidy(chromosome);
-
-        if (number == "A") {
-            // ...the number of alternate alleles
-            cardinality = alternate_allele_number;
-        } else if (number == "R") {
-            // ...the number of alternate alleles + reference
-            cardinality = alternate_allele_number + 1;
-        } else if (number == "G") {
-            // ...the number of possible genotypes
-            // The binomial coefficient is calculated considering the ploidy of the sample
-            cardinality = boost::math::binomial_coefficient<float>(alternate_allele_number + ploidy, ploidy);
-        } else if (number == ".") {
-            // ...it is unspecified
-            cardinality = -1;
-        } else {
-            // ...specified as a number in range [0, +MAX_LONG)
-            try {
-                cardinality = stoi(number);
-                if (cardinality < 0) {
-                    valid = false;
-                }
-            } catch (...) {
-                valid = false;
+        switch (definition.number_kind) {
+            case NumberKind::alternate_alleles:
+                // ...the number of alternate alleles
+                cardinality = alternate_allele_number;
+                return true;
+            case NumberKind::alleles:
+                // ...the number of alternate alleles + reference
+                cardinality = alternate_allele_number + 1;
+                return true;
+            case NumberKind::genotypes: {
+                // ...the number of possible genotypes, considering the ploidy of the contig
+                cardinality = count_genotypes(ploidy, alternate_allele_number + 1);
+                return true;
             }
+            case NumberKind::unknown:
+                // ...it is unspecified
+                cardinality = -1;
+                return true;
+            case NumberKind::fixed:
+                // ...specified as a number in range [0, +MAX_LONG)
+                cardinality = definition.number_count;
+                return true;
+            default:
+                cardinality = -1;
+                return false;
         }
-        return valid;
     }
 
-    void Record::check_field_cardinality(std::string const & field,
-                                         std::vector<std::string> const & values,
-                                         std::string const & number) const
+    bool Record::check_field_cardinality(std::string const & field,
+                                         size_t n_values,
+                                         FieldDefinition const & definition,
+                                         std::string & message) const
     {
         long expected;
-        if(not is_valid_cardinality(number, alternate_alleles.size(), expected)) {
-            raise(std::make_shared<Error>(line, field + " meta specification Number=" + number + " is not one of [A, R, G, ., <non-negative number>]"));
+        if(not is_valid_cardinality(definition, alternate_alleles.size(), expected)) {
+            message = field + " meta specification Number=" + definition.number + " is not one of [A, R, G, ., <non-negative number>]";
+            return false;
         }
 
         bool number_matches = true;
         if (expected > 0) {
             // The number of values must match the expected
-            number_matches = (values.size() == static_cast<size_t>(expected));
+            number_matches = (n_values == static_cast<size_t>(expected));
         } else if (expected == 0) {
             // There will be one empty value that needs to be specifically checked
-            number_matches = values.size() == 0 || values.size() == 1;
+            number_matches = n_values == 0 || n_values == 1;
         } else {
             // if number=".", then `expected` was set to -1, and it should always match, letting `number_matches` as true
         }
 
         if (!number_matches) {
-            raise(std::make_shared<Error>(line, " specification Number=" + number + " (contains " + std::to_string(values.size()) + " values, expected " + std::to_string(expected) + ")"));
+            message = " specification Number=" + definition.number + " (contains " + std::to_string(n_values) + " values, expected " + std::to_string(expected) + ")";
+            return false;
         }
+        return true;
     }
 
-    void Record::check_value_type(std::string const & type, std::string const & value, std::string & message) const {
-        if (type == "Integer") {
-            // ...try to cast to int
-            std::stoi(value);
-            // ...and also check it's not a float
-            if (std::fmod(std::stof(value), 1) != 0) {
-                message = " (an integer must not contain decimal digits)";
-                throw std::invalid_argument(message);
-            }
-        } else if (type == "Float") {
-            // ...try to cast to float
-            try {
-                std::stof(value);
-            } catch (std::out_of_range) {
-                // It maybe a subnormal number
-                std::stold(value);
-            }
-        } else if (type == "Flag") {
-            int numeric_value = std::stoi(value);
-            if (numeric_value != 0 && numeric_value != 1) {
-                message = " (a flag value must be \"0, 1 or none\")";
-                throw std::invalid_argument(message);
-            }
-            // If no flag is provided then there is nothing to check
-        } else if (type == "Character") {
-            // ...check the length is 1
-            if (value.size() > 1) {
-                message = " (there can be only one character)";
-                throw std::invalid_argument(message);
+    bool Record::check_value_type(FieldType type, std::string const & value, std::string & message) const {
+        message.clear();
+        int64_t integer;
+        double floating;
+
+        switch (type) {
+            case FieldType::integer: {
+                auto status = scan_integer_value(value, integer);
+                if (status == util::NumberStatus::invalid
+                        && util::scan_float(value.data(), value.data() + value.size(), floating)
+                                == util::NumberStatus::valid) {
+                    message = " (an integer must not contain decimal digits)";
+                }
+                return status == util::NumberStatus::valid;
             }
-        } else if (type == "String") {
-            // ...do nothing, it is guaranteed it will be a string
+            case FieldType::floating:
+                // Subnormal numbers are valid too, read as zero
+                return util::scan_float(value.data(), value.data() + value.size(), floating)
+                        == util::NumberStatus::valid;
+            case FieldType::flag:
+                if (scan_integer_value(value, integer) != util::NumberStatus::valid) {
+                    return false;
+                }
+                if (integer != 0 && integer != 1) {
+                    message = " (a flag value must be \"0, 1 or none\")";
+                    return false;
+                }
+                // If no flag is provided then there is nothing to check
+                break;
+            case FieldType::character:
+                // ...check the length is 1
+                if (value.size() > 1) {
+                    message = " (there can be only one character)";
+                    return false;
+                }
+                break;
+            default:
+                // ...do nothing, it is guaranteed it will be a string
+                break;
+        }
+        return true;
+    }
+
+    bool Record::check_value_type(FieldType type, ValueKind kind, double number, std::string & message) const {
+        message.clear();
+
+        switch (type) {
+            case FieldType::integer:
+                if (kind == ValueKind::floating) {
+                    message = " (an integer must not contain decimal digits)";
+                    return false;
+                }
+                break;
+            case FieldType::flag:
+                if (kind == ValueKind::floating) {
+                    return false;
+                }
+                if (number != 0 && number != 1) {
+                    message = " (a flag value must be \"0, 1 or none\")";
+                    return false;
+                }
+                break;
+            case FieldType::character:
+                // ...only a single digit is written as one character
+                if (kind == ValueKind::floating || number < 0 || number > 9) {
+                    message = " (there can be only one character)";
+                    return false;
+                }
+                break;
+            default:
+                // ...any number is a valid float or string
+                break;
         }
+        return true;
     }
 
-    void Record::check_field_type(std::vector<std::string> const & values,
-                                  std::string const & type) const
+    bool Record::check_field_type(std::vector<std::string> const & values,
+                                  TypedValues const * typed,
+                                  FieldDefinition const & definition,
+                                  std::string & message) const
     {
+        if (definition.field_type == FieldType::string || definition.field_type == FieldType::other) {
+            return true; // Any value is a valid string
+        }
+
+        if (typed != nullptr) {
+            for (auto & value : typed->values) {
+                if (value.missing) { continue; }
+
+                if (!check_value_type(definition.field_type, typed->kind, value.number, message)) {
+                    message = " specification Type=" + definition.type + message;
+                    return false;
+                }
+            }
+            return true;
+        }
+
         // To check the field type...
         for (auto & value : values) {
             if (value == ".") { continue; }
 
-            std::string message;
-            try {
-                check_value_type(type, value, message);
-            } catch (std::exception &typeError) {
-                raise(std::make_shared<Error>(line, " specification Type=" + type + message));
+            if (!check_value_type(definition.field_type, value, message)) {
+                message = " specification Type=" + definition.type + message;
+                return false;
             }
         }
+        return true;
     }
 
-    void Record::check_field_integer_range(std::string const & field, std::vector<std::string> const & values) const {
+    bool Record::check_field_integer_range(std::string const & field, std::vector<std::string> const & values,
+                                           TypedValues const * typed, std::string & message) const {
+        if (typed != nullptr) {
+            for (auto & value : typed->values) {
+                if (!value.missing && (typed->kind == ValueKind::floating || value.number < 0)) {
+                    message = field + " value must be a non-negative integer number";
+                    return false;
+                }
+            }
+            return true;
+        }
+
         for (auto & value : values) {
             if (value == ".") { continue; }
 
-            if (std::stoi(value) < 0) {
-                raise(std::make_shared<Error>(line, field + " value must be a non-negative integer number"));
+            int64_t integer;
+            if (scan_integer_value(value, integer) != util::NumberStatus::valid || integer < 0) {
+                message = field + " value must be a non-negative integer number";
+                return false;
             }
         }
+        return true;
     }
 
     bool is_record_subfield_in_header(std::string const & field_value,
-                                      std::multimap<std::string, MetaEntry>::iterator begin,
-                                      std::multimap<std::string, MetaEntry>::iterator end)
+                                      std::multimap<std::string, MetaEntry>::const_iterator begin,
+                                      std::multimap<std::string, MetaEntry>::const_iterator end)
     {
-        for (std::multimap<std::string, MetaEntry>::iterator current = begin; current != end; ++current) {
+        for (std::multimap<std::string, MetaEntry>::const_iterator current = begin; current != end; ++current) {
             auto & key_values = boost::get<std::map < std::string, std::string >> ((current->second).value);
 
-            if (key_values["ID"] == field_value) {
+            auto id = key_values.find("ID");
+            if (id != key_values.end() && id->second == field_value) {
                 return true;
             }
         }
         
         return false;
     }
+
+    bool is_symbolic_allele(std::string const & alternate, size_t & id_length)
+    {
+        if (alternate.size() < 3 || alternate.front() != '<' || alternate.back() != '>') {
+            return false;
+        }
+
+        auto id_end = std::find_if_not(alternate.begin() + 1, alternate.end() - 1, [](char c) {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == ':' || c == '_';
+        });
+        if (id_end != alternate.end() - 1) {
+            return false;
+        }
+        id_length = alternate.size() - 2;
+        return true;
+    }
     
     std::ostream &operator<<(std::ostream &os, const Record &record)
     {
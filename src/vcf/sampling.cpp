@@ -0,0 +1,430 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <set>
+#include <stdexcept>
+
+#include "util/compression.hpp"
+#include "util/line_scanner.hpp"
+#include "vcf/sampling.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    Version detect_version(const std::vector<char> &line);
+
+    std::unique_ptr<Parser> build_parser(ValidationLevel level, std::shared_ptr<Source> source);
+
+    void write_errors(const Parser &validator, const std::vector<std::unique_ptr<ReportWriter>> &outputs);
+
+    namespace
+    {
+      double const confidence_z = 1.96;     ///< 95% confidence for a normal distribution
+      size_t const bgzf_block_search_size = 2 * 64 * 1024;
+
+      /**
+       * @return the beginning of the line after the one that contains `position`, or `end`
+       */
+      char const * next_line(char const * position, char const * end)
+      {
+          auto newline = static_cast<char const *>(std::memchr(position, '\n', end - position));
+          return newline == nullptr ? end : newline + 1;
+      }
+
+      /**
+       * @return the beginning of the first line that doesn't start with '#', or `end`
+       */
+      char const * find_header_end(char const * begin, char const * end)
+      {
+          char const * line = begin;
+          while (line < end && *line == '#') {
+              line = next_line(line, end);
+          }
+          return line;
+      }
+
+      size_t count_windows(SamplingOptions const & options, double body_size, double window_size)
+      {
+          if (options.fraction > 0) {
+              return static_cast<size_t>(std::ceil(options.fraction * body_size / window_size));
+          }
+          return options.n_windows;
+      }
+
+      /**
+       * Validates the windows of a sample one after another, each by its own parser resumed in the body section
+       */
+      class SampleValidator
+      {
+        public:
+          SampleValidator(ValidationLevel level,
+                          std::shared_ptr<Source> source,
+                          std::vector<std::unique_ptr<ReportWriter>> &outputs)
+          : level{level}, source{source}, outputs(outputs), parser{}, body_state{0}, n_lines{1},
+            first_record_line{1}, n_windows{0}, n_records{0}, n_erroneous_records{0}, valid{true}
+          {
+          }
+
+          /**
+           * Validates the beginning of the file: the meta and header sections, and the first window of the body
+           */
+          void validate_first_window(char const * begin, char const * end, bool end_of_file)
+          {
+              char const * header_end = find_header_end(begin, end);
+              first_record_line += std::count(begin, header_end, '\n');
+
+              // Every other window is started at the state the parser is in after the first record
+              parser = build_parser(level, source);
+              char const * first_record_end = next_line(header_end, end);
+              validate(begin, first_record_end, false);
+              body_state = parser->state();
+              ++n_windows;
+
+              size_t n_first_records = std::count(header_end, first_record_end, '\n');
+              n_records += n_first_records;
+              n_lines = first_record_line + n_first_records;
+              validate_lines(first_record_end, end, end_of_file);
+          }
+
+          /**
+           * @param continues whether the window starts right where the previous one ended in the file
+           */
+          void validate_window(char const * begin, char const * end, bool continues, bool end_of_file)
+          {
+              if (!continues) {
+                  parser = build_parser(level, source);
+                  parser->resume(body_state, n_lines);
+                  ++n_windows;
+              }
+              validate_lines(begin, end, end_of_file);
+          }
+
+          bool is_valid() const
+          {
+              return valid;
+          }
+
+          void summarize(SampleSummary &summary) const
+          {
+              summary.sampled = true;
+              summary.n_windows = n_windows;
+              summary.n_records = n_records;
+              summary.n_erroneous_records = n_erroneous_records;
+              if (n_records == 0) {
+                  summary.error_rate = summary.error_rate_low = 0;
+                  summary.error_rate_high = 1;
+                  return;
+              }
+
+              double n = n_records;
+              double rate = n_erroneous_records / n;
+              double z2 = confidence_z * confidence_z;
+              double center = (rate + z2 / (2 * n)) / (1 + z2 / n);
+              double margin = confidence_z * std::sqrt(rate * (1 - rate) / n + z2 / (4 * n * n)) / (1 + z2 / n);
+              summary.error_rate = rate;
+              summary.error_rate_low = std::max(0.0, center - margin);
+              summary.error_rate_high = std::min(1.0, center + margin);
+          }
+
+        private:
+          void validate_lines(char const * begin, char const * end, bool end_of_file)
+          {
+              size_t n_newlines = util::count_newlines(begin, end);
+              n_records += n_newlines;
+              if (end_of_file && begin < end && end[-1] != '\n') {
+                  ++n_records;
+              }
+              validate(begin, end, end_of_file);
+              n_lines += n_newlines;
+          }
+
+          void validate(char const * begin, char const * end, bool end_of_file)
+          {
+              try {
+                  if (begin < end) {
+                      parser->parse(begin, end);
+                      count_errors();
+                      write_errors(*parser, outputs);
+                  }
+                  if (end_of_file) {
+                      parser->end();
+                      count_errors();
+                      write_errors(*parser, outputs);
+                  }
+              } catch (...) {
+                  write_errors(*parser, outputs);
+                  throw;
+              }
+              valid = valid && parser->is_valid();
+          }
+
+          void count_errors()
+          {
+              std::set<size_t> lines;
+              for (size_t line : parser->error_n_lines()) {
+                  if (line >= first_record_line) {
+                      lines.insert(line);
+                  }
+              }
+              n_erroneous_records += lines.size();
+          }
+
+          ValidationLevel level;
+          std::shared_ptr<Source> source;
+          std::vector<std::unique_ptr<ReportWriter>> &outputs;
+
+          std::unique_ptr<Parser> parser;
+          int body_state;
+          size_t n_lines;             ///< number given to the next line validated
+          size_t first_record_line;
+
+          size_t n_windows;
+          size_t n_records;
+          size_t n_erroneous_records;
+          bool valid;
+      };
+
+      std::shared_ptr<Source> build_source(char const * begin,
+                                           char const * end,
+                                           const std::string &sourceName,
+                                           unsigned input_format,
+                                           Ploidy ploidy,
+                                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs)
+      {
+          std::vector<char> line{begin, next_line(begin, end)};
+          try {
+              return std::make_shared<Source>(sourceName, input_format, detect_version(line), ploidy);
+          } catch (FileformatError * error) {
+              for (auto &output : outputs) {
+                  output->write_error(*error);
+              }
+              delete error;
+              return nullptr;
+          }
+      }
+
+      /**
+       * Reads `size` characters, and then until the end of the line
+       *
+       * @return whether the end of the input was reached
+       */
+      bool read_window(util::BgzfRangeStreambuf &inflated, size_t size, std::string &text)
+      {
+          auto eof = std::streambuf::traits_type::eof();
+          size_t read = 0;
+          while (read < size && inflated.sgetc() != eof) {
+              size_t previous = text.size();
+              size_t block_size = std::min(size - read, default_read_block_size);
+              text.resize(previous + block_size);
+              text.resize(previous + static_cast<size_t>(inflated.sgetn(&text[previous], block_size)));
+              read += text.size() - previous;
+          }
+
+          if (size == 0 || (read == size && text.back() != '\n')) {
+              for (auto c = inflated.sbumpc(); c != eof; c = inflated.sbumpc()) {
+                  text.push_back(static_cast<char>(c));
+                  if (c == '\n') {
+                      break;
+                  }
+              }
+          }
+          return inflated.sgetc() == eof;
+      }
+
+      /**
+       * @return the offset of the first BGZF block that starts at `offset` or after it, or `size` if there is none
+       */
+      uint64_t find_bgzf_block(std::istream &input, uint64_t offset, uint64_t size)
+      {
+          std::vector<char> data(bgzf_block_search_size);
+          input.clear();
+          input.seekg(static_cast<std::streamoff>(offset));
+          input.read(data.data(), data.size());
+          data.resize(static_cast<size_t>(input.gcount()));
+
+          for (size_t i = 0; i < data.size(); ++i) {
+              if (data[i] == '\x1f' && util::is_bgzf_header(data.data() + i, data.size() - i)) {
+                  return offset + i;
+              }
+          }
+          return size;
+      }
+    }
+
+    bool is_valid_vcf_sample(char const * begin,
+                             char const * end,
+                             const std::string &sourceName,
+                             ValidationLevel validationLevel,
+                             Ploidy ploidy,
+                             std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                             SamplingOptions const &options,
+                             SampleSummary &summary)
+    {
+        summary = SampleSummary{};
+        char const * header_end = find_header_end(begin, end);
+        size_t body_size = end - header_end;
+        size_t n_windows = count_windows(options, body_size, options.window_size);
+        if ((n_windows + 2) * options.window_size >= body_size) {
+            // The sample would cover most of the body anyway
+            return is_valid_vcf_file(begin, end, sourceName, validationLevel, ploidy, outputs);
+        }
+
+        auto source = build_source(begin, end, sourceName, InputFormat::VCF_FILE_VCF, ploidy, outputs);
+        if (source == nullptr) {
+            return false;
+        }
+
+        auto window_end = [&options, end](char const * window) {
+            return static_cast<size_t>(end - window) <= options.window_size
+                    ? end : next_line(window + options.window_size - 1, end);
+        };
+
+        // Besides the first window, the last one and random ones, moved to the beginning of a line
+        std::mt19937_64 random{options.seed};
+        std::uniform_int_distribution<size_t> offsets{0, body_size - 1};
+        std::vector<char const *> windows{end - options.window_size};
+        for (size_t i = 0; i < n_windows; ++i) {
+            windows.push_back(header_end + offsets(random));
+        }
+        for (auto & window : windows) {
+            if (window > begin && window[-1] != '\n') {
+                window = next_line(window, end);
+            }
+        }
+        std::sort(windows.begin(), windows.end());
+
+        SampleValidator validator{validationLevel, source, outputs};
+        char const * validated = window_end(header_end);
+        validator.validate_first_window(begin, validated, validated == end);
+        for (char const * window : windows) {
+            char const * window_last = window_end(window);
+            if (window_last <= validated) {
+                continue;
+            }
+            // Overlapping windows are validated as a single one
+            window = std::max(window, validated);
+            validator.validate_window(window, window_last, window == validated, window_last == end);
+            validated = window_last;
+        }
+
+        validator.summarize(summary);
+        return validator.is_valid();
+    }
+
+    bool is_valid_vcf_sample(std::istream &input,
+                             const std::string &sourceName,
+                             ValidationLevel validationLevel,
+                             Ploidy ploidy,
+                             std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                             SamplingOptions const &options,
+                             SampleSummary &summary)
+    {
+        summary = SampleSummary{};
+        input.seekg(0, std::ios::end);
+        uint64_t compressed_size = static_cast<uint64_t>(input.tellg());
+        input.seekg(0);
+        std::vector<char> beginning(18);   // the BGZF extra subfield is right after the gzip header
+        input.read(beginning.data(), beginning.size());
+        beginning.resize(static_cast<size_t>(input.gcount()));
+        if (!util::is_bgzf_header(beginning.data(), beginning.size())) {
+            throw std::runtime_error{"Only plain text and bgzipped files can be sampled"};
+        }
+
+        // The meta and header sections, and the first window of the body
+        std::string first_window;
+        uint64_t first_window_end;
+        uint64_t first_block_end;
+        bool end_of_file;
+        {
+            util::BgzfRangeStreambuf inflated{input, {{0, util::bgzf_end_of_input}}};
+            bool line_start = true;
+            auto eof = std::streambuf::traits_type::eof();
+            for (auto c = inflated.sgetc(); c != eof && !(line_start && c != '#'); c = inflated.snextc()) {
+                first_window.push_back(static_cast<char>(c));
+                line_start = c == '\n';
+            }
+            end_of_file = read_window(inflated, options.window_size, first_window);
+            first_window_end = inflated.tell();
+            first_block_end = inflated.block_end();
+        }
+
+        // Compressed size of a window, estimated from the first one. Its end is only known with the precision of a
+        // block, so the estimate errs on the side of bigger windows
+        uint64_t first_window_compressed = first_window_end >> 16;
+        uint64_t window_compressed = std::max<uint64_t>(
+                first_block_end * options.window_size / std::max<size_t>(first_window.size(), 1), 1);
+        uint64_t body_compressed = compressed_size - std::min(compressed_size, first_window_compressed);
+        size_t n_windows = count_windows(options, body_compressed, window_compressed);
+        if (end_of_file || (n_windows + 2) * window_compressed >= body_compressed) {
+            // The sample would cover most of the body anyway
+            input.clear();
+            input.seekg(0);
+            return is_valid_vcf_file(input, sourceName, validationLevel, ploidy, outputs);
+        }
+
+        unsigned input_format = InputFormat::VCF_FILE_VCF | InputFormat::VCF_FILE_BGZIP;
+        auto source = build_source(first_window.data(), first_window.data() + first_window.size(), sourceName,
+                                   input_format, ploidy, outputs);
+        if (source == nullptr) {
+            return false;
+        }
+
+        SampleValidator validator{validationLevel, source, outputs};
+        validator.validate_first_window(first_window.data(), first_window.data() + first_window.size(), false);
+        first_window = std::string{};
+
+        // Besides the first window, the last one and random ones, starting at the BGZF blocks found from those offsets
+        uint64_t last_window = compressed_size - std::min(compressed_size, window_compressed);
+        std::mt19937_64 random{options.seed};
+        std::uniform_int_distribution<uint64_t> offsets{first_window_compressed, compressed_size - 1};
+        std::vector<uint64_t> windows{std::max(last_window, first_window_compressed)};
+        for (size_t i = 0; i < n_windows; ++i) {
+            windows.push_back(offsets(random));
+        }
+        std::sort(windows.begin(), windows.end());
+
+        uint64_t validated = first_window_end;
+        for (size_t i = 0; i < windows.size() && !end_of_file; ++i) {
+            uint64_t window = find_bgzf_block(input, windows[i], compressed_size) << 16;
+            bool continues = window <= validated;
+            util::BgzfRangeStreambuf inflated{input, {{std::max(window, validated), util::bgzf_end_of_input}}};
+            std::string text;
+            if (!continues) {
+                // Skip the line that may have started in the previous block
+                std::string partial_line;
+                end_of_file = read_window(inflated, 0, partial_line);
+                if (end_of_file) {
+                    break;
+                }
+            }
+
+            // The last window is read until the end of the file, as its compressed size is only an estimate
+            bool is_last = i + 1 == windows.size();
+            end_of_file = read_window(inflated, is_last ? SIZE_MAX : options.window_size, text);
+            validated = inflated.tell();
+            validator.validate_window(text.data(), text.data() + text.size(), continues, end_of_file);
+        }
+
+        validator.summarize(summary);
+        return validator.is_valid();
+    }
+  }
+}
@@ -31,10 +31,99 @@ namespace ebi
       input_format{input_format},
       version{version},
       ploidy{ploidy},
-      meta_entries{meta_entries},
-      samples_names{samples_names}
+      samples_names{samples_names},
+      meta_entry_map{meta_entries},
+      info_definitions{},
+      format_definitions{}
     {
-        
+        for (auto & entry : meta_entry_map) {
+            add_field_definition(entry.second);
+        }
+    }
+
+    std::multimap<std::string, MetaEntry> const & Source::meta_entries() const
+    {
+        return meta_entry_map;
+    }
+
+    void Source::add_meta(MetaEntry const & meta)
+    {
+        meta_entry_map.emplace(meta.id, meta);
+        add_field_definition(meta);
+    }
+
+    FieldDefinition const * Source::info_definition(std::string const & id) const
+    {
+        auto definition = info_definitions.find(id);
+        return definition != info_definitions.end() ? &definition->second : nullptr;
+    }
+
+    FieldDefinition const * Source::format_definition(std::string const & id) const
+    {
+        auto definition = format_definitions.find(id);
+        return definition != format_definitions.end() ? &definition->second : nullptr;
+    }
+
+    void Source::add_field_definition(MetaEntry const & meta)
+    {
+        FieldDictionary * definitions = meta.id == "INFO" ? &info_definitions
+                                      : meta.id == "FORMAT" ? &format_definitions
+                                      : nullptr;
+        auto key_values = boost::get<std::map<std::string, std::string>>(&meta.value);
+        if (definitions == nullptr || key_values == nullptr) {
+            return;
+        }
+
+        auto id = key_values->find("ID");
+        auto number = key_values->find("Number");
+        auto type = key_values->find("Type");
+        std::string const none;
+        // emplace leaves the definition already there, so the first one of each ID is kept
+        definitions->emplace(id != key_values->end() ? id->second : none,
+                             FieldDefinition{id != key_values->end() ? id->second : none,
+                                             number != key_values->end() ? number->second : none,
+                                             type != key_values->end() ? type->second : none});
+    }
+
+    FieldDefinition::FieldDefinition(std::string const & id, std::string const & number, std::string const & type)
+    : id{id},
+      number{number},
+      type{type},
+      number_kind{NumberKind::fixed},
+      number_count{0},
+      field_type{FieldType::other}
+    {
+        if (number == "A") {
+            number_kind = NumberKind::alternate_alleles;
+        } else if (number == "R") {
+            number_kind = NumberKind::alleles;
+        } else if (number == "G") {
+            number_kind = NumberKind::genotypes;
+        } else if (number == ".") {
+            number_kind = NumberKind::unknown;
+        } else {
+            // ...specified as a number in range [0, +MAX_LONG)
+            try {
+                number_count = std::stoi(number);
+                if (number_count < 0) {
+                    number_kind = NumberKind::invalid;
+                }
+            } catch (...) {
+                number_kind = NumberKind::invalid;
+            }
+        }
+
+        if (type == "Integer") {
+            field_type = FieldType::integer;
+        } else if (type == "Float") {
+            field_type = FieldType::floating;
+        } else if (type == "Flag") {
+            field_type = FieldType::flag;
+        } else if (type == "Character") {
+            field_type = FieldType::character;
+        } else if (type == "String") {
+            field_type = FieldType::string;
+        }
     }
 
   }
@@ -14,6 +14,10 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <functional>
+
+#include "util/number_scanner.hpp"
 #include "vcf/parse_policy.hpp"
 
 namespace ebi
@@ -21,42 +25,70 @@ namespace ebi
   namespace vcf
   {
 
-    void StoreParsePolicy::handle_token_begin(ParsingState const & state)
+    void StoreParsePolicy::handle_buffer_begin(ParsingState const & state, char const * p)
+    {
+        m_buffer_begin = p;
+    }
+
+    void StoreParsePolicy::handle_buffer_end(ParsingState const & state, char const * pe)
     {
-        m_current_token = std::string{};
+        // The buffer may be gone when the next one arrives, so copy what the rest of the line still needs
+        std::less_equal<char const *> less_equal;
+        auto relocate = [&](std::vector<TokenSpan> & tokens) {
+            for (auto & token : tokens) {
+                if (less_equal(m_buffer_begin, token.begin) && less_equal(token.end, pe)) {
+                    token = store(token.begin, token.end);
+                }
+            }
+        };
+        relocate(m_grouped_tokens);
+        for (auto & column : m_line_columns) {
+            relocate(column);
+        }
+
+        add_token_prefix();
+        m_buffer_begin = nullptr;
     }
 
-    void StoreParsePolicy::handle_token_char(ParsingState const & state, char c)
+    void StoreParsePolicy::handle_token_begin(ParsingState const & state)
     {
-        m_current_token.push_back(c);
+        m_token_prefix.clear();
+        m_token_begin = nullptr;
+        m_token_end = nullptr;
     }
 
     void StoreParsePolicy::handle_token_end(ParsingState const & state) 
     {
-        m_grouped_tokens.push_back(m_current_token);
+        m_grouped_tokens.push_back(take_token());
     }
     
     void StoreParsePolicy::handle_token_end(ParsingState const & state, std::string token) 
     {
-        m_grouped_tokens.push_back(token);
+        m_grouped_tokens.push_back(store(token.data(), token.data() + token.size()));
     }
     
     void StoreParsePolicy::handle_newline(ParsingState const & state) 
     {
-        m_current_token.clear();
+        m_token_prefix.clear();
+        m_token_begin = nullptr;
+        m_token_end = nullptr;
         m_grouped_tokens.clear();
-        m_line_tokens.clear();
+        for (auto & column : m_line_columns) {
+            column.clear();
+        }
+        m_arena_size = 0;
     }
 
     void StoreParsePolicy::handle_fileformat(ParsingState & state)
     {
         Version fileformat_version = Version::v41;
+        std::string fileformat = take_token().str();
 
-        if (m_current_token == "VCFv4.1") {
+        if (fileformat == "VCFv4.1") {
             fileformat_version = Version::v41;
-        } else if (m_current_token == "VCFv4.2") {
+        } else if (fileformat == "VCFv4.2") {
             fileformat_version = Version::v42;
-        } else if (m_current_token == "VCFv4.3") {
+        } else if (fileformat == "VCFv4.3") {
             fileformat_version = Version::v43;
         } else {
             throw new FileformatError{state.n_lines, "Not allowed VCF fileformat version"};
@@ -71,7 +103,7 @@ namespace ebi
 
     void StoreParsePolicy::handle_meta_typeid(ParsingState const & state)
     {
-        m_line_typeid = m_current_token;
+        m_line_typeid = take_token().str();
     }
 
     void StoreParsePolicy::handle_meta_typeid(ParsingState const & state, std::string type_id) 
@@ -86,15 +118,15 @@ namespace ebi
         // Add MetaEntry to Source
 
         if (m_line_typeid == "") { // Plain value
-            state.add_meta(MetaEntry{state.n_lines, m_grouped_tokens[0], state.source});
+            state.add_meta(MetaEntry{state.n_lines, m_grouped_tokens[0].str(), state.source});
 
         } else if (m_grouped_tokens.size() == 1) { // TypeID=value
-            state.add_meta(MetaEntry{state.n_lines, m_line_typeid, m_grouped_tokens[0], state.source});
+            state.add_meta(MetaEntry{state.n_lines, m_line_typeid, m_grouped_tokens[0].str(), state.source});
 
         } else if (m_grouped_tokens.size() % 2 == 0) { // TypeID=<Key-value pairs>
             auto key_values = std::map<std::string, std::string>{};
             for (size_t i = 0; i < m_grouped_tokens.size(); i += 2) {
-                key_values[m_grouped_tokens[i]] = m_grouped_tokens[i+1];
+                key_values[m_grouped_tokens[i].str()] = m_grouped_tokens[i+1].str();
             }
             state.add_meta(MetaEntry{state.n_lines, m_line_typeid, key_values, state.source});
 
@@ -106,81 +138,66 @@ namespace ebi
 
     void StoreParsePolicy::handle_sample_name(ParsingState const & state)
     {
-        m_grouped_tokens.push_back(m_current_token);
+        m_grouped_tokens.push_back(take_token());
     }
 
     void StoreParsePolicy::handle_header_line(ParsingState & state)
     {
-        state.set_samples(m_grouped_tokens);
+        auto samples = strings(m_grouped_tokens);
+        state.set_samples(samples);
     }
 
 
     void StoreParsePolicy::handle_column_end(ParsingState const & state, size_t n_columns) 
     {
-        switch(n_columns) {
-            case 1:
-                m_line_tokens["CHROM"] = m_grouped_tokens;
-                break;
-            case 2:
-                m_line_tokens["POS"] = m_grouped_tokens;
-                break;
-            case 3:
-                m_line_tokens["ID"] = m_grouped_tokens;
-                break;
-            case 4:
-                m_line_tokens["REF"] = m_grouped_tokens;
-                break;
-            case 5:
-                m_line_tokens["ALT"] = m_grouped_tokens;
-                break;
-            case 6:
-                m_line_tokens["QUAL"] = m_grouped_tokens;
-                break;
-            case 7:
-                m_line_tokens["FILTER"] = m_grouped_tokens;
-                break;
-            case 8:
-                m_line_tokens["INFO"] = m_grouped_tokens;
-                break;
-            case 9:
-                m_line_tokens["FORMAT"] = m_grouped_tokens;
-                break;
-            default:
-                // Collection of samples
-                if (m_line_tokens.find("SAMPLES") == m_line_tokens.end()) {
-                    m_line_tokens["SAMPLES"] = std::vector<std::string>{};
-                }
-                // Samples are stored as a single string
-                m_line_tokens["SAMPLES"].push_back(m_grouped_tokens[0]);
+        if (n_columns <= FORMAT + 1) {
+            m_line_columns[n_columns - 1].assign(m_grouped_tokens.begin(), m_grouped_tokens.end());
+        } else {
+            // Samples are stored as a single string
+            m_line_columns[SAMPLES].push_back(m_grouped_tokens[0]);
         }
-        m_grouped_tokens = std::vector<std::string>{};
+        m_grouped_tokens.clear();
     }
 
     void StoreParsePolicy::handle_body_line(ParsingState & state)
     {
-        size_t position;
-        try {
-            // Transform the position token into a size_t
-            position = static_cast<size_t>(std::stoi(m_line_tokens["POS"][0]));
-        } catch (std::invalid_argument ex) {
-            throw new PositionBodyError{state.n_lines};
+        // The errors of all the columns are collected, so they can be reported at once
+        state.record_errors.clear();
+
+        std::string chromosome = m_line_columns[CHROM][0].str();
+
+        // Transform the position token into a size_t
+        size_t position = 0;
+        int64_t position_value;
+        TokenSpan const & position_token = m_line_columns[POS][0];
+        auto position_status = util::scan_integer(position_token.begin, position_token.end, position_value);
+        if (position_status == util::NumberStatus::out_of_range) {
+            state.record_errors.emplace_back(new PositionBodyError{state.n_lines, "Position is too large"});
+        } else if (position_status != util::NumberStatus::valid || position_value < 0) {
+            state.record_errors.emplace_back(new PositionBodyError{state.n_lines});
+        } else {
+            position = static_cast<size_t>(position_value);
         }
 
-        // Transform all the quality tokens into floating point numbers
+        // Transform the quality token into a floating point number
         float quality = 0;
-        if (m_line_tokens["QUAL"][0] != ".") {
-            try {
-                quality = std::stof(m_line_tokens["QUAL"][0]);
-            } catch (std::invalid_argument ex) {
-                throw new QualityBodyError{state.n_lines};
+        TokenSpan const & quality_token = m_line_columns[QUAL][0];
+        if (state.typed_fields != nullptr) {
+            quality = state.typed_fields->quality;
+        } else if (quality_token.end - quality_token.begin != 1 || *quality_token.begin != '.') {
+            double quality_value;
+            if (util::scan_float(quality_token.begin, quality_token.end, quality_value) == util::NumberStatus::valid) {
+                quality = static_cast<float>(quality_value);
+            } else {
+                state.record_errors.emplace_back(new QualityBodyError{state.n_lines});
             }
         }
 
         // Split the info tokens by the equals (=) symbol
         std::map<std::string, std::string> info;
-        for (auto &field : m_line_tokens["INFO"]) {
+        for (auto &field : m_line_columns[INFO]) {
             std::vector<std::string> subfields;
-            util::string_split(field, "=", subfields);
+            util::string_split(field.str(), "=", subfields);
             if (subfields.size() > 1) {
                 info.emplace(subfields[0], subfields[1]);
             } else {
@@ -188,73 +205,104 @@ namespace ebi
             }
         }
 
-        // Format and samples are optional
-        auto format = m_line_tokens.find("FORMAT") != m_line_tokens.end() ?
-                      m_line_tokens["FORMAT"] : std::vector<std::string>{};
-        auto samples = m_line_tokens.find("SAMPLES") != m_line_tokens.end() ?
-                       m_line_tokens["SAMPLES"] : std::vector<std::string>{};
+        // Format and samples are optional, and their columns are left empty if missing
+        std::vector<std::string> format = strings(m_line_columns[FORMAT]);
+
+        m_format_key.clear();
+        for (auto & field : m_line_columns[FORMAT]) {
+            m_format_key.append(field.begin, field.end).push_back(':');
+        }
+        auto format_spec = m_format_specs.find(m_format_key);
+        if (format_spec == m_format_specs.end()) {
+            if (m_format_specs.size() >= max_format_specs) {
+                m_format_specs.clear();
+            }
+            format_spec = m_format_specs.emplace(m_format_key, std::make_shared<FormatSpec const>(*state.source, format)).first;
+        }
 
-        state.set_record(std::unique_ptr<Record>{new Record{
+        std::unique_ptr<Record> record{new Record{
                 state.n_lines,
-                m_line_tokens["CHROM"][0],
+                chromosome,
                 position,
-                m_line_tokens["ID"],
-                m_line_tokens["REF"][0],
-                m_line_tokens["ALT"],
+                strings(m_line_columns[ID]),
+                m_line_columns[REF][0].str(),
+                strings(m_line_columns[ALT]),
                 quality,
-                m_line_tokens["FILTER"],
+                strings(m_line_columns[FILTER]),
                 info,
                 format,
-                samples,
-                state.source
-        }});
+                strings(m_line_columns[SAMPLES]),
+                state.source,
+                format_spec->second,
+                &state.record_errors,
+                state.typed_fields
+        }};
+
+        if (!state.record_errors.empty()) {
+            state.set_record(nullptr);
+            return;
+        }
 
-        check_sorted(state, position);
+        state.set_record(std::move(record));
+
+        if (!state.record_checks_deferred) {
+            state.sorting.check(state.n_lines, chromosome, position);
+        }
     }
     
     std::string StoreParsePolicy::current_token() const
     {
-        return m_current_token;
+        return m_token_prefix + std::string{m_token_begin, m_token_end};
     }
 
     std::vector<std::string> StoreParsePolicy::column_tokens(std::string const & column) const
     {
-        try {
-            return m_line_tokens.at(column);
-        } catch (std::out_of_range) {
+        static std::array<std::string, N_COLUMNS> const names{
+                {"CHROM", "POS", "ID", "REF", "ALT", "QUAL", "FILTER", "INFO", "FORMAT", "SAMPLES"}};
+
+        auto name = std::find(names.begin(), names.end(), column);
+        if (name == names.end()) {
             return {};
         }
+        return strings(m_line_columns[name - names.begin()]);
     }
 
-    void StoreParsePolicy::check_sorted(ParsingState &state, size_t position)
+    StoreParsePolicy::TokenSpan StoreParsePolicy::take_token()
     {
-        // check contigs are contiguous
-        auto iterator = finished_contigs.find(m_line_tokens["CHROM"][0]);
-        bool contig_not_found = iterator == finished_contigs.end();
-        bool contig_already_finished = iterator->second;
-        if (contig_not_found) {
-            // contig not found in the map: finishing the previous contig, and starting a new one
-            if (finished_contigs.size() != 0) {
-                // with the first contig there's no previous contig
-                finished_contigs[previous_contig] = true;
-            }
-            finished_contigs[m_line_tokens["CHROM"][0]] = false;
-            previous_contig = m_line_tokens["CHROM"][0];
-            previous_position = 0;  // position sorting is reset
-        } else if (contig_already_finished) {
-            std::stringstream ss;
-            ss << "Variant " << m_line_tokens["CHROM"][0] << ":" << position << " is not contiguous to the rest of the contig";
-            throw new BodySectionError{state.n_lines, ss.str()};
+        if (m_token_prefix.empty()) {
+            return {m_token_begin, m_token_end};
         }
+        std::string token = m_token_prefix + std::string{m_token_begin, m_token_end};
+        return store(token.data(), token.data() + token.size());
+    }
 
-        // check all positions are sorted within a contig
-        if (position < previous_position) {
-            std::stringstream ss;
-            ss << "Contig " << m_line_tokens["CHROM"][0] << " is not sorted by position: "
-               << position << " found after " << previous_position;
-            throw new PositionBodyError{state.n_lines, ss.str()};
+    void StoreParsePolicy::add_token_prefix()
+    {
+        if (m_token_begin != nullptr) {
+            m_token_prefix.append(m_token_begin, m_token_end);
+        }
+        m_token_begin = nullptr;
+        m_token_end = nullptr;
+    }
+
+    StoreParsePolicy::TokenSpan StoreParsePolicy::store(char const * begin, char const * end)
+    {
+        if (m_arena_size == m_line_arena.size()) {
+            m_line_arena.emplace_back();
+        }
+        std::string & copy = m_line_arena[m_arena_size++];
+        copy.assign(begin, end);
+        return {copy.data(), copy.data() + copy.size()};
+    }
+
+    std::vector<std::string> StoreParsePolicy::strings(std::vector<TokenSpan> const & tokens) const
+    {
+        std::vector<std::string> result;
+        result.reserve(tokens.size());
+        for (auto & token : tokens) {
+            result.push_back(token.str());
         }
-        previous_position = position;
+        return result;
     }
   }
 }
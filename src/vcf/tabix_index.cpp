@@ -0,0 +1,299 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+
+#include "vcf/tabix_index.hpp"
+
+namespace ebi
+{
+  namespace vcf
+  {
+    namespace
+    {
+      int const tabix_min_shift = 14;
+      int const tabix_depth = 5;
+      size_t const tabix_header_size = 7 * 4;   ///< format, col_seq, col_beg, col_end, meta, skip and l_nm
+
+      /**
+       * Reads the little-endian values of an index, throwing if there are not enough bytes left
+       */
+      class IndexCursor
+      {
+        public:
+          IndexCursor(char const * data, size_t size) : data{data}, size{size}, position{0} {}
+
+          char const * read_bytes(size_t length)
+          {
+              if (size - position < length) {
+                  throw std::runtime_error{"The index is truncated"};
+              }
+              char const * bytes = data + position;
+              position += length;
+              return bytes;
+          }
+
+          uint64_t read_unsigned(size_t length)
+          {
+              auto bytes = reinterpret_cast<unsigned char const *>(read_bytes(length));
+              uint64_t value = 0;
+              for (size_t i = length; i > 0; --i) {
+                  value = (value << 8) | bytes[i - 1];
+              }
+              return value;
+          }
+
+          int32_t read_int32() { return static_cast<int32_t>(read_unsigned(4)); }
+          uint32_t read_uint32() { return static_cast<uint32_t>(read_unsigned(4)); }
+          uint64_t read_uint64() { return read_unsigned(8); }
+
+          size_t read_count()
+          {
+              int32_t count = read_int32();
+              if (count < 0) {
+                  throw std::runtime_error{"The index contains a negative count"};
+              }
+              return static_cast<size_t>(count);
+          }
+
+        private:
+          char const * data;
+          size_t size;
+          size_t position;
+      };
+
+      /**
+       * Reads the tabix header (also stored in the auxiliary data of CSI indexes) and returns the contig names
+       */
+      std::vector<std::string> read_contig_names(IndexCursor & cursor)
+      {
+          for (size_t i = 0; i < 6; ++i) {
+              cursor.read_int32();  // format and columns of the indexed file, always those of VCF here
+          }
+          size_t names_length = cursor.read_count();
+          char const * names = cursor.read_bytes(names_length);
+
+          std::vector<std::string> contigs;
+          for (char const * name = names; name < names + names_length; name += contigs.back().size() + 1) {
+              contigs.emplace_back(name, strnlen(name, names + names_length - name));
+          }
+          return contigs;
+      }
+
+      /**
+       * Collects the bins that overlap the 0-based range [begin, end), as in the reg2bins function of the CSI
+       * specification
+       */
+      std::vector<uint32_t> overlapping_bins(uint64_t begin, uint64_t end, int min_shift, int depth)
+      {
+          std::vector<uint32_t> bins;
+          int shift = min_shift + depth * 3;
+          end = std::min(end, uint64_t{1} << shift);
+          if (begin >= end) {
+              return bins;
+          }
+
+          --end;
+          for (int level = 0; level <= depth; ++level, shift -= 3) {
+              uint64_t first_bin = ((uint64_t{1} << (level * 3)) - 1) / 7;
+              for (uint64_t bin = first_bin + (begin >> shift); bin <= first_bin + (end >> shift); ++bin) {
+                  bins.push_back(static_cast<uint32_t>(bin));
+              }
+          }
+          return bins;
+      }
+
+      bool parse_position(std::string const & text, uint64_t & position)
+      {
+          if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos || text.size() > 18) {
+              return false;
+          }
+          position = std::stoull(text);
+          return true;
+      }
+    }
+
+    Region parse_region(std::string const & text)
+    {
+        Region region{text, 1, UINT64_MAX};
+
+        // Contig names may contain colons, so only the last one may start the positions
+        auto colon = text.rfind(':');
+        if (colon != std::string::npos) {
+            std::string positions = text.substr(colon + 1);
+            positions.erase(std::remove(positions.begin(), positions.end(), ','), positions.end());
+
+            auto dash = positions.find('-');
+            uint64_t begin, end = UINT64_MAX;
+            if (parse_position(positions.substr(0, dash), begin)
+                    && (dash == std::string::npos || dash + 1 == positions.size()
+                        || parse_position(positions.substr(dash + 1), end))) {
+                region = Region{text.substr(0, colon), begin, end};
+            }
+        }
+
+        if (region.contig.empty() || region.begin == 0 || region.end < region.begin) {
+            throw std::invalid_argument{"The region " + text + " is not valid, please use the format CHROM, "
+                                        "CHROM:BEGIN or CHROM:BEGIN-END with 1-based positions"};
+        }
+        return region;
+    }
+
+    std::string find_tabix_index(std::string const & path)
+    {
+        for (auto extension : {".tbi", ".csi"}) {
+            if (std::ifstream{path + extension}) {
+                return path + extension;
+            }
+        }
+        return "";
+    }
+
+    TabixIndex::TabixIndex(std::istream &input)
+    : min_shift{tabix_min_shift}, depth{tabix_depth}, contigs{}, references{}
+    {
+        bool bgzf;
+        std::unique_ptr<std::streambuf> inflated = util::make_gzip_streambuf(input, 1, bgzf);
+        std::istream text{inflated.get()};
+        text.exceptions(std::ios::badbit);
+        std::vector<char> data{std::istreambuf_iterator<char>{text}, std::istreambuf_iterator<char>{}};
+
+        IndexCursor cursor{data.data(), data.size()};
+        std::string magic{cursor.read_bytes(4), 4};
+        bool csi = magic == std::string{"CSI\1", 4};
+        if (!csi && magic != std::string{"TBI\1", 4}) {
+            throw std::runtime_error{"The index is neither a tabix nor a CSI index"};
+        }
+
+        std::vector<std::string> names;
+        size_t n_references;
+        if (csi) {
+            min_shift = cursor.read_int32();
+            depth = cursor.read_int32();
+            if (min_shift < 0 || depth < 0 || min_shift + depth * 3 > 62) {
+                throw std::runtime_error{"The CSI index has an invalid binning scheme"};
+            }
+            size_t aux_length = cursor.read_count();
+            IndexCursor aux{cursor.read_bytes(aux_length), aux_length};
+            if (aux_length < tabix_header_size) {
+                throw std::runtime_error{"The CSI index doesn't contain the names of the contigs, "
+                                         "only indexes of bgzipped VCF files are supported"};
+            }
+            names = read_contig_names(aux);
+            n_references = cursor.read_count();
+        } else {
+            n_references = cursor.read_count();
+            names = read_contig_names(cursor);
+        }
+        if (names.size() != n_references) {
+            throw std::runtime_error{"The index doesn't contain as many contig names as contigs"};
+        }
+
+        for (size_t i = 0; i < n_references; ++i) {
+            contigs[names[i]] = i;
+            references.emplace_back();
+            Reference & reference = references.back();
+
+            size_t n_bins = cursor.read_count();
+            for (size_t j = 0; j < n_bins; ++j) {
+                Bin & bin = reference.bins[cursor.read_uint32()];
+                bin.loffset = csi ? cursor.read_uint64() : 0;
+                size_t n_chunks = cursor.read_count();
+                for (size_t k = 0; k < n_chunks; ++k) {
+                    uint64_t begin = cursor.read_uint64();
+                    uint64_t end = cursor.read_uint64();
+                    bin.chunks.push_back({begin, end});
+                }
+            }
+
+            if (!csi) {
+                size_t n_intervals = cursor.read_count();
+                for (size_t j = 0; j < n_intervals; ++j) {
+                    reference.intervals.push_back(cursor.read_uint64());
+                }
+            }
+        }
+    }
+
+    std::vector<util::BgzfRangeStreambuf::Range> TabixIndex::chunks(std::vector<Region> const & regions) const
+    {
+        std::vector<util::BgzfRangeStreambuf::Range> found;
+        for (auto & region : regions) {
+            auto contig = contigs.find(region.contig);
+            if (contig == contigs.end()) {
+                continue;
+            }
+
+            Reference const & reference = references[contig->second];
+            uint64_t begin = region.begin - 1;
+            uint64_t min_offset = this->min_offset(reference, begin);
+            for (uint32_t bin_number : overlapping_bins(begin, region.end, min_shift, depth)) {
+                auto bin = reference.bins.find(bin_number);
+                if (bin == reference.bins.end()) {
+                    continue;
+                }
+                for (auto & chunk : bin->second.chunks) {
+                    // Chunks that end before the first record overlapping the region can be skipped
+                    if (chunk.end > min_offset) {
+                        found.push_back(chunk);
+                    }
+                }
+            }
+        }
+
+        std::sort(found.begin(), found.end(), [](util::BgzfRangeStreambuf::Range const & a,
+                                                 util::BgzfRangeStreambuf::Range const & b) {
+            return a.begin < b.begin;
+        });
+
+        std::vector<util::BgzfRangeStreambuf::Range> merged;
+        for (auto & chunk : found) {
+            if (!merged.empty() && chunk.begin <= merged.back().end) {
+                merged.back().end = std::max(merged.back().end, chunk.end);
+            } else {
+                merged.push_back(chunk);
+            }
+        }
+        return merged;
+    }
+
+    uint64_t TabixIndex::min_offset(Reference const & reference, uint64_t begin) const
+    {
+        if (!reference.intervals.empty()) {
+            size_t window = static_cast<size_t>(std::min<uint64_t>(begin >> min_shift, reference.intervals.size() - 1));
+            return reference.intervals[window];
+        }
+
+        // CSI indexes store the offset in the smallest bin that contains the beginning of the region
+        uint64_t bin = ((uint64_t{1} << (depth * 3)) - 1) / 7 + (begin >> min_shift);
+        while (true) {
+            auto found = reference.bins.find(static_cast<uint32_t>(bin));
+            if (found != reference.bins.end()) {
+                return found->second.loffset;
+            }
+            if (bin == 0) {
+                return 0;
+            }
+            bin = (bin - 1) >> 3;
+        }
+    }
+  }
+}
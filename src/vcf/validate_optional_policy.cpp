@@ -23,7 +23,7 @@ namespace ebi
     
     void ValidateOptionalPolicy::optional_check_meta_section(ParsingState const & state) const
     {
-        if (state.source->meta_entries.find("reference") == state.source->meta_entries.end()) {
+        if (state.source->meta_entries().find("reference") == state.source->meta_entries().end()) {
             throw new MetaSectionError{state.n_lines, "A valid 'reference' entry is not listed in the meta section"};
         }
     }
@@ -73,30 +73,24 @@ namespace ebi
         if (format_column_contains_gt) {
             // All samples should have the same ploidy
             size_t ploidy = 0;
-            size_t i = 1;
-            for (auto &sample : record.samples) {
-                std::vector<std::string> subfields;
-                util::string_split(sample, ":", subfields);
-                std::vector<std::string> alleles;
-                util::string_split(subfields[0], "|/", alleles);
+            for (size_t i = 0; i < record.samples.size(); ++i) {
+                size_t sample_ploidy = record.sample_genotype(i).ploidy;
 
                 if (ploidy > 0) {
-                    if (alleles.size() != ploidy) {
+                    if (sample_ploidy != ploidy) {
                         throw new SamplesFieldBodyError{
                                 state.n_lines,
-                                "Sample #" + std::to_string(i) + " has " + std::to_string(alleles.size())
+                                "Sample #" + std::to_string(i + 1) + " has " + std::to_string(sample_ploidy)
                                         + " allele(s), but " + std::to_string(ploidy) + " were found in others",
                                 "GT",
                                 static_cast<long>(ploidy)};
                     }
                 } else {
-                    ploidy = alleles.size();
+                    ploidy = sample_ploidy;
                 }
-
-                ++i;
             }
 
-            size_t provided_ploidy = state.source->ploidy.get_ploidy(record.chromosome);
+            size_t provided_ploidy = record.ploidy;
             if (provided_ploidy != ploidy) {
                 std::stringstream ss;
                 ss << "The specified ploidy for contig \"" << record.chromosome << "\" was " << provided_ploidy
@@ -146,7 +140,7 @@ namespace ebi
             return; // Check only once
         }
         
-        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range("contig");
+        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries().equal_range("contig");
 
         if (is_record_subfield_in_header(current_chromosome, range.first, range.second)) {
             state.add_well_defined_meta("contig", current_chromosome);
@@ -162,14 +156,13 @@ namespace ebi
     
     void ValidateOptionalPolicy::check_alternate_allele_meta(ParsingState & state, Record & record) const
     {
-        static boost::regex square_brackets_regex("<([a-zA-Z0-9:_]+)>");
-        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range("ALT");
-        boost::cmatch pieces_match;
+        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries().equal_range("ALT");
+        size_t id_length;
         
         for (auto & alternate : record.alternate_alleles) {
             // Check alternate ID is present in meta-entry (only applies to the form <SOME_ALT_ID>)
-            if (alternate[0] == '<' && boost::regex_match(alternate.c_str(), pieces_match, square_brackets_regex)) {
-                std::string alt_id = pieces_match[1];
+            if (is_symbolic_allele(alternate, id_length)) {
+                std::string alt_id = alternate.substr(1, id_length);
                 
                 if (state.is_well_defined_meta("ALT", alt_id)) {
                     continue; // Check only once
@@ -191,7 +184,7 @@ namespace ebi
     
     void ValidateOptionalPolicy::check_filter_meta(ParsingState & state, Record & record) const
     {
-        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range("FILTER");
+        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries().equal_range("FILTER");
         
         for (auto & filter : record.filters) {
             if (filter == "PASS" || filter == ".") { continue; } // No need to check PASS or missing data
@@ -215,7 +208,7 @@ namespace ebi
     
     void ValidateOptionalPolicy::check_info_meta(ParsingState & state, Record & record) const
     {
-        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range("INFO");
+        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries().equal_range("INFO");
         
         for (auto & field : record.info) {
             auto & id = field.first;
@@ -240,7 +233,7 @@ namespace ebi
     
     void ValidateOptionalPolicy::check_format_meta(ParsingState & state, Record & record) const
     {
-        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries.equal_range("FORMAT");
+        std::pair<meta_iterator, meta_iterator> range = state.source->meta_entries().equal_range("FORMAT");
         
         for (auto & fm : record.format) {
             if (state.is_well_defined_meta("FORMAT", fm)) {
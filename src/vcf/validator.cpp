@@ -14,6 +14,20 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <sstream>
+#include <thread>
+
+#include "util/compression.hpp"
+#include "util/line_scanner.hpp"
+#include "util/progress.hpp"
+#include "util/read_ahead.hpp"
+#include "vcf/bcf_parser.hpp"
+#include "vcf/checkpoint.hpp"
 #include "vcf/validator.hpp"
 
 namespace ebi
@@ -22,42 +36,98 @@ namespace ebi
   {
     Version detect_version(const std::vector<char> &line);
 
+    bool is_valid_vcf_range(char const * begin,
+                            char const * end,
+                            const std::string &sourceName,
+                            ValidationLevel validationLevel,
+                            Ploidy ploidy,
+                            std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                            size_t n_threads,
+                            std::function<void(char const *)> const &on_parsed);
+
     std::unique_ptr<Parser> build_parser(std::string const &path,
                                          ValidationLevel level,
                                          Version version,
-                                         Ploidy ploidy);
+                                         Ploidy ploidy,
+                                         unsigned input_format = InputFormat::VCF_FILE_VCF);
+
+    std::unique_ptr<Parser> build_parser(ValidationLevel level, std::shared_ptr<Source> source);
+
+    std::unique_ptr<Parser> build_bcf_parser(ValidationLevel level,
+                                             std::shared_ptr<Source> source,
+                                             BcfHeader const & header,
+                                             size_t n_lines);
+
+    bool is_valid_vcf_text(std::istream &input,
+                           unsigned input_format,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           Ploidy ploidy,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t n_threads);
+
+    bool is_valid_bcf(std::vector<char> const &beginning,
+                      std::istream &input,
+                      unsigned input_format,
+                      const std::string &sourceName,
+                      ValidationLevel validationLevel,
+                      Ploidy ploidy,
+                      std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs);
 
     bool validate(const std::vector<char> &firstLine,
                   std::istream &input,
                   ebi::vcf::Parser &validator,
                   std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs);
 
+    bool validate(char const * begin,
+                  char const * end,
+                  ebi::vcf::Parser &validator,
+                  std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                  std::function<void(char const *)> const &on_parsed);
+
+    bool validate(const std::vector<char> &firstLine, std::istream &input, ChunkValidator &validator);
+
+    bool validate(char const * begin,
+                  char const * end,
+                  ChunkValidator &validator,
+                  std::function<void(char const *)> const &on_parsed);
+
     void write_errors(const Parser &validator, const std::vector<std::unique_ptr<ReportWriter>> &outputs);
 
     ParserImpl::ParserImpl(std::shared_ptr<Source> source)
-            : ParsingState{source}
+            : ParsingState{source}, last_parse_bytes{0}, last_parse_lines{0}, last_parse_records{0}
     {
         
     }
 
     void ParserImpl::parse(std::vector<char> const & text)
     {
-        char const * p = &text[0];
-        char const * pe = &text[0] + text.size();
-        char const * eof = nullptr;
-
-        clear();
-        parse_buffer(p, pe, eof);
+        parse(text.data(), text.data() + text.size());
     }
 
     void ParserImpl::parse(std::string const & text)
     {
-        char const * p = text.data();
-        char const * pe = text.data() + text.size();
+        parse(text.data(), text.data() + text.size());
+    }
+
+    void ParserImpl::parse(char const * begin, char const * end)
+    {
+        char const * p = begin;
+        char const * pe = end;
         char const * eof = nullptr;
+        size_t lines_before = n_lines;
+        size_t records_before = n_records;
 
+        last_parse_bytes = last_parse_lines = last_parse_records = 0;
         clear();
         parse_buffer(p, pe, eof);
+
+        last_parse_bytes = end - begin;
+        last_parse_lines = n_lines - lines_before;
+        last_parse_records = n_records - records_before;
+        if (!record_checks_deferred) {
+            count_progress();
+        }
     }
 
     void ParserImpl::end()
@@ -82,13 +152,76 @@ namespace ebi
         return ParsingState::warnings;
     }
 
+    const std::vector<size_t> & ParserImpl::error_n_lines() const
+    {
+        return ParsingState::error_n_lines;
+    }
+
+    const std::vector<size_t> & ParserImpl::warning_n_lines() const
+    {
+        return ParsingState::warning_n_lines;
+    }
+
+    int ParserImpl::state() const
+    {
+        return cs;
+    }
+
+    void ParserImpl::resume(int state, size_t n_lines)
+    {
+        cs = state;
+        ParsingState::n_lines = n_lines;
+        n_columns = 1;
+    }
+
+    void ParserImpl::defer_record_checks()
+    {
+        record_checks_deferred = true;
+        previous_records.defer_checks();
+    }
+
+    std::vector<DeferredRecord> & ParserImpl::deferred_records()
+    {
+        return previous_records.deferred_records();
+    }
+
+    void ParserImpl::count_progress() const
+    {
+        auto & progress = util::progress_counters();
+        progress.bytes.fetch_add(last_parse_bytes, std::memory_order_relaxed);
+        progress.lines.fetch_add(last_parse_lines, std::memory_order_relaxed);
+        progress.records.fetch_add(last_parse_records, std::memory_order_relaxed);
+    }
+
+    void ParserImpl::save(Checkpoint & checkpoint) const
+    {
+        checkpoint.n_lines = ParsingState::n_lines;
+        checkpoint.state = cs;
+        checkpoint.valid = m_is_valid;
+        checkpoint.sorting = sorting;
+        checkpoint.records = previous_records.contents();
+    }
+
+    void ParserImpl::restore(Checkpoint const & checkpoint)
+    {
+        resume(checkpoint.state, checkpoint.n_lines);
+        m_is_valid = checkpoint.valid;
+        sorting = checkpoint.sorting;
+        previous_records.restore(checkpoint.records);
+    }
+
     std::unique_ptr<ebi::vcf::Parser> build_parser(std::string const &path,
                                                    ValidationLevel level,
                                                    ebi::vcf::Version version,
-                                                   ebi::vcf::Ploidy ploidy)
+                                                   ebi::vcf::Ploidy ploidy,
+                                                   unsigned input_format)
+    {
+        return build_parser(level, std::make_shared<Source>(path, input_format, version, ploidy));
+    }
+
+    std::unique_ptr<ebi::vcf::Parser> build_parser(ValidationLevel level, std::shared_ptr<Source> source)
     {
-        std::shared_ptr<Source> source = std::make_shared<Source>(path, InputFormat::VCF_FILE_VCF, version, ploidy);
-        auto records = std::vector<Record>{};
+        Version version = source->version;
 
         switch (level) {
         case ValidationLevel::error:
@@ -132,14 +265,110 @@ namespace ebi
         }
     }
 
+    std::unique_ptr<ebi::vcf::Parser> build_bcf_parser(ValidationLevel level,
+                                                       std::shared_ptr<Source> source,
+                                                       BcfHeader const & header,
+                                                       size_t n_lines)
+    {
+        switch (level) {
+        case ValidationLevel::error:
+            return std::unique_ptr<ebi::vcf::Parser>(new ebi::vcf::QuickBcfValidator(source, header, n_lines));
+        case ValidationLevel::warning:
+            return std::unique_ptr<ebi::vcf::Parser>(new ebi::vcf::FullBcfValidator(source, header, n_lines));
+        case ValidationLevel::stop:
+            return std::unique_ptr<ebi::vcf::Parser>(new ebi::vcf::BcfReader(source, header, n_lines));
+        default:
+            throw std::invalid_argument{"Please choose one of the accepted validation levels"};
+        }
+    }
+
+    bool is_valid_vcf_file(std::istream &input,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           Ploidy ploidy,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t n_threads)
+    {
+        if (util::is_gzip(input)) {
+            bool bgzf;
+            std::unique_ptr<std::streambuf> inflated = util::make_gzip_streambuf(input, n_threads, bgzf);
+            std::istream text{inflated.get()};
+            text.exceptions(std::ios::badbit);  // report decompression errors instead of a truncated file
+            unsigned input_format = InputFormat::VCF_FILE_VCF
+                    | (bgzf ? InputFormat::VCF_FILE_BGZIP : InputFormat::VCF_FILE_GZIP);
+            return is_valid_vcf_text(text, input_format, sourceName, validationLevel, ploidy, outputs, n_threads);
+        }
+
+        // The input is read on a separate thread, so the parser doesn't wait for every block to be read
+        util::ReadAheadStreambuf read_ahead{input};
+        std::istream text{&read_ahead};
+        text.exceptions(std::ios::badbit);
+        return is_valid_vcf_text(text, InputFormat::VCF_FILE_VCF, sourceName, validationLevel, ploidy, outputs,
+                                 n_threads);
+    }
+
     bool is_valid_vcf_file(std::istream &input,
+                           TabixIndex const &index,
+                           std::vector<Region> const &regions,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           Ploidy ploidy,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t n_threads)
+    {
+        std::vector<char> beginning(18);   // the BGZF extra subfield is right after the gzip header
+        input.read(beginning.data(), beginning.size());
+        beginning.resize(static_cast<size_t>(input.gcount()));
+        if (!util::is_bgzf_header(beginning.data(), beginning.size())) {
+            throw std::runtime_error{"Regions can only be validated in bgzipped files"};
+        }
+
+        // The meta and header sections are read from the beginning of the file until the first record
+        uint64_t header_end;
+        {
+            util::BgzfRangeStreambuf header{input, {{0, util::bgzf_end_of_input}}};
+            if (header.sgetc() != '#') {
+                throw std::runtime_error{"Regions can only be validated in bgzipped VCF files"};
+            }
+            bool line_start = true;
+            for (auto c = header.sgetc(); c != std::streambuf::traits_type::eof(); c = header.snextc()) {
+                if (line_start && c != '#') {
+                    break;
+                }
+                line_start = c == '\n';
+            }
+            header_end = header.tell();
+        }
+
+        std::vector<util::BgzfRangeStreambuf::Range> ranges{{0, header_end}};
+        for (auto & chunk : index.chunks(regions)) {
+            if (chunk.end > header_end) {
+                ranges.push_back({std::max(chunk.begin, header_end), chunk.end});
+            }
+        }
+
+        util::BgzfRangeStreambuf inflated{input, ranges};
+        std::istream text{&inflated};
+        text.exceptions(std::ios::badbit);
+        unsigned input_format = InputFormat::VCF_FILE_VCF | InputFormat::VCF_FILE_BGZIP;
+        return is_valid_vcf_text(text, input_format, sourceName, validationLevel, ploidy, outputs, n_threads);
+    }
+
+    bool is_valid_vcf_text(std::istream &input,
+                           unsigned input_format,
                            const std::string &sourceName,
                            ValidationLevel validationLevel,
                            Ploidy ploidy,
-                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs)
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t n_threads)
     {
         std::vector<char> line;
         ebi::util::readline(input, line);
+        if (is_bcf(line.data(), line.size())) {
+            unsigned bcf_format = (input_format & ~InputFormat::VCF_FILE_VCF) | InputFormat::VCF_FILE_BCF;
+            return is_valid_bcf(line, input, bcf_format, sourceName, validationLevel, ploidy, outputs);
+        }
+
         ebi::vcf::Version version;
         try {
             version = detect_version(line);
@@ -149,10 +378,135 @@ namespace ebi
             }
             return false;
         }
-        std::unique_ptr<Parser> validator = build_parser(sourceName, validationLevel, version, ploidy);
+        auto source = std::make_shared<Source>(sourceName, input_format, version, ploidy);
+        std::unique_ptr<Parser> validator = build_parser(validationLevel, source);
+        if (n_threads > 1 && validationLevel != ValidationLevel::stop) {
+            ChunkValidator chunks{*validator, n_threads, [&] { return build_parser(validationLevel, source); }, outputs};
+            return validate(line, input, chunks);
+        }
         return validate(line, input, *validator, outputs);
     }
 
+    bool is_valid_vcf_file(char const * begin,
+                           char const * end,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           Ploidy ploidy,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t n_threads)
+    {
+        return is_valid_vcf_range(begin, end, sourceName, validationLevel, ploidy, outputs, n_threads,
+                                  [](char const *) {});
+    }
+
+    bool is_valid_vcf_file(util::MappedFile &input,
+                           const std::string &sourceName,
+                           ValidationLevel validationLevel,
+                           Ploidy ploidy,
+                           std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                           size_t n_threads)
+    {
+        return is_valid_vcf_range(input.begin(), input.end(), sourceName, validationLevel, ploidy, outputs, n_threads,
+                                  [&input](char const * position) { input.release_until(position); });
+    }
+
+    bool is_valid_vcf_range(char const * begin,
+                            char const * end,
+                            const std::string &sourceName,
+                            ValidationLevel validationLevel,
+                            Ploidy ploidy,
+                            std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                            size_t n_threads,
+                            std::function<void(char const *)> const &on_parsed)
+    {
+        if (begin != end && (static_cast<unsigned char>(*begin) == 0x1f || is_bcf(begin, end - begin))) {
+            // Compressed and BCF contents are decoded through the stream path
+            util::RangeStreambuf range{begin, end};
+            std::istream input{&range};
+            return is_valid_vcf_file(input, sourceName, validationLevel, ploidy, outputs, n_threads);
+        }
+
+        char const * newline = begin == end ? nullptr : static_cast<char const *>(std::memchr(begin, '\n', end - begin));
+        std::vector<char> line{begin, newline == nullptr ? end : newline + 1};
+        ebi::vcf::Version version;
+        try {
+            version = detect_version(line);
+        } catch (FileformatError * error) {
+            for (auto &output : outputs) {
+                output->write_error(*error);
+            }
+            return false;
+        }
+        auto source = std::make_shared<Source>(sourceName, InputFormat::VCF_FILE_VCF, version, ploidy);
+        std::unique_ptr<Parser> validator = build_parser(validationLevel, source);
+        if (n_threads > 1 && validationLevel != ValidationLevel::stop) {
+            ChunkValidator chunks{*validator, n_threads, [&] { return build_parser(validationLevel, source); }, outputs};
+            return validate(begin, end, chunks, on_parsed);
+        }
+        return validate(begin, end, *validator, outputs, on_parsed);
+    }
+
+    bool is_valid_bcf(std::vector<char> const &beginning,
+                      std::istream &input,
+                      unsigned input_format,
+                      const std::string &sourceName,
+                      ValidationLevel validationLevel,
+                      Ploidy ploidy,
+                      std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs)
+    {
+        // The magic string and the length of the header text, followed by the header text itself
+        std::vector<char> data{beginning};
+        auto read_until = [&input, &data](size_t size) {
+            size_t previous = data.size();
+            if (previous < size) {
+                data.resize(size);
+                input.read(data.data() + previous, size - previous);
+                data.resize(previous + static_cast<size_t>(input.gcount()));
+            }
+            return data.size() >= size;
+        };
+        size_t header_end = 0;
+        if (read_until(bcf_fixed_header_size)) {
+            header_end = bcf_fixed_header_size + read_bcf_uint32(data.data() + 5);
+        }
+        if (header_end == 0 || !read_until(header_end)) {
+            MetaSectionError error{1, "The BCF header is truncated"};
+            for (auto &output : outputs) {
+                output->write_error(error);
+            }
+            return false;
+        }
+
+        std::string header_text{data.data() + bcf_fixed_header_size, data.data() + header_end};
+        header_text.erase(header_text.find_last_not_of('\0') + 1);
+        std::vector<char> records{data.begin() + header_end, data.end()};
+
+        auto first_line_end = std::find(header_text.begin(), header_text.end(), '\n');
+        std::vector<char> line{header_text.begin(), first_line_end == header_text.end() ? first_line_end
+                                                                                        : first_line_end + 1};
+        ebi::vcf::Version version;
+        try {
+            version = detect_version(line);
+        } catch (FileformatError * error) {
+            for (auto &output : outputs) {
+                output->write_error(*error);
+            }
+            return false;
+        }
+
+        // The header text is validated as the meta and header sections of a VCF file, filling the shared Source
+        auto source = std::make_shared<Source>(sourceName, input_format, version, ploidy);
+        std::unique_ptr<Parser> header_validator = build_parser(validationLevel, source);
+        std::istringstream header_input{header_text.substr(line.size())};
+        bool header_valid = validate(line, header_input, *header_validator, outputs);
+
+        size_t n_lines = std::count(header_text.begin(), header_text.end(), '\n') + 1;
+        std::unique_ptr<Parser> validator = build_bcf_parser(validationLevel, source, BcfHeader{header_text}, n_lines);
+        bool records_valid = validate(records, input, *validator, outputs);
+
+        return header_valid && records_valid;
+    }
+
     Version detect_version(const std::vector<char> &vector_line)
     {
         std::string common_substring{"##fileformat="};
@@ -179,14 +533,21 @@ namespace ebi
                   ebi::vcf::Parser &validator,
                   std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs)
     {
-        std::vector<char> line;
-        line.reserve(default_line_buffer_size);
+        std::vector<char> block;
+        block.reserve(default_read_block_size);
 
         validator.parse(firstLine);
         write_errors(validator, outputs);
 
-        while (ebi::util::readline(input, line).size() != 0) {
-            validator.parse(line);
+        // The parser keeps its state between calls, so lines can be split across blocks
+        while (ebi::util::readblock(input, block, default_read_block_size).size() != 0) {
+            try {
+                validator.parse(block);
+            } catch (...) {
+                // Errors and warnings from previous lines in the block must be reported anyway
+                write_errors(validator, outputs);
+                throw;
+            }
             write_errors(validator, outputs);
         }
 
@@ -196,16 +557,293 @@ namespace ebi
         return validator.is_valid();
     }
 
+    bool validate(char const * begin,
+                  char const * end,
+                  ebi::vcf::Parser &validator,
+                  std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> &outputs,
+                  std::function<void(char const *)> const &on_parsed)
+    {
+        // The range is parsed in blocks so the errors are reported (and the memory released) as the validation advances
+        char const * block = begin;
+        while (block < end) {
+            char const * block_end = block + std::min<size_t>(default_read_block_size, end - block);
+            try {
+                validator.parse(block, block_end);
+            } catch (...) {
+                write_errors(validator, outputs);
+                throw;
+            }
+            write_errors(validator, outputs);
+            on_parsed(block_end);
+            block = block_end;
+        }
+
+        validator.end();
+        write_errors(validator, outputs);
+
+        return validator.is_valid();
+    }
+
+    bool validate(const std::vector<char> &firstLine, std::istream &input, ChunkValidator &validator)
+    {
+        std::vector<char> text{firstLine};
+        std::vector<char> block;
+        block.reserve(default_read_block_size);
+
+        while (ebi::util::readblock(input, block, default_read_block_size).size() != 0) {
+            text.insert(text.end(), block.begin(), block.end());
+            if (text.size() >= validator.round_size()) {
+                // Only complete lines are validated, the last one may continue in the next block
+                auto last_newline = std::find(text.rbegin(), text.rend(), '\n');
+                if (last_newline != text.rend()) {
+                    size_t complete = text.rend() - last_newline;
+                    validator.parse(text.data(), text.data() + complete);
+                    text.erase(text.begin(), text.begin() + complete);
+                }
+            }
+        }
+
+        validator.end(text.data(), text.data() + text.size());
+        return validator.is_valid();
+    }
+
+    bool validate(char const * begin,
+                  char const * end,
+                  ChunkValidator &validator,
+                  std::function<void(char const *)> const &on_parsed)
+    {
+        char const * round = begin;
+        while (static_cast<size_t>(end - round) > validator.round_size()) {
+            char const * round_end = round + validator.round_size();
+            auto newline = static_cast<char const *>(std::memchr(round_end, '\n', end - round_end));
+            if (newline == nullptr) {
+                break;
+            }
+            validator.parse(round, newline + 1);
+            on_parsed(newline + 1);
+            round = newline + 1;
+        }
+
+        validator.end(round, end);
+        return validator.is_valid();
+    }
+
     void write_errors(const Parser &validator, const std::vector<std::unique_ptr<ReportWriter>> &outputs)
     {
-        for (auto &error : validator.errors()) {
-            for (auto &output : outputs) {
-                output->write_error(*error);
+        auto & errors = validator.errors();
+        auto & warnings = validator.warnings();
+        auto & error_n_lines = validator.error_n_lines();
+        auto & warning_n_lines = validator.warning_n_lines();
+
+        // Within the same line errors go first, as if the file was read line by line
+        size_t i = 0, j = 0;
+        while (i < errors.size() || j < warnings.size()) {
+            if (j == warnings.size() || (i < errors.size() && error_n_lines[i] <= warning_n_lines[j])) {
+                for (auto &output : outputs) {
+                    output->write_error(*errors[i]);
+                }
+                ++i;
+            } else {
+                for (auto &output : outputs) {
+                    output->write_warning(*warnings[j]);
+                }
+                ++j;
             }
         }
-        for (auto &error : validator.warnings()) {
-            for (auto &output : outputs) {
-                output->write_warning(*error);
+    }
+
+    ChunkValidator::ChunkValidator(Parser &parser,
+                                   size_t n_threads,
+                                   std::function<std::unique_ptr<Parser>()> const & build_parser,
+                                   std::vector<std::unique_ptr<ReportWriter>> &outputs)
+    : parsers{}, outputs(outputs), current{&parser}, n_lines{1}, in_body{false}, previous_records{}, sorting{},
+      valid{true}
+    {
+        parser.defer_record_checks();
+        for (size_t i = 0; i < n_threads; ++i) {
+            parsers.push_back(build_parser());
+            parsers.back()->defer_record_checks();
+        }
+    }
+
+    size_t ChunkValidator::round_size() const
+    {
+        return parsers.size() * default_read_block_size;
+    }
+
+    void ChunkValidator::parse(char const * begin, char const * end)
+    {
+        if (!in_body) {
+            // Read sequentially until the end of the first record, the state every chunk of the body is started at
+            char const * line = begin;
+            while (line < end && *line == '#') {
+                line = static_cast<char const *>(std::memchr(line, '\n', end - line)) + 1;
+            }
+            if (line < end) {
+                line = static_cast<char const *>(std::memchr(line, '\n', end - line)) + 1;
+                in_body = true;
+            }
+            parse_sequentially(begin, line);
+            begin = line;
+        }
+        if (begin == end) {
+            return;
+        }
+
+        // Split at newlines in chunks of similar size
+        std::vector<char const *> bounds{begin};
+        for (size_t i = 1; i < parsers.size() && bounds.back() < end; ++i) {
+            char const * middle = std::max(bounds.back(), begin + (end - begin) * i / parsers.size());
+            auto newline = static_cast<char const *>(std::memchr(middle, '\n', end - middle));
+            bounds.push_back(newline == nullptr ? end : newline + 1);
+        }
+        if (bounds.back() != end) {
+            bounds.push_back(end);
+        }
+        size_t n_chunks = bounds.size() - 1;
+
+        std::vector<size_t> chunk_n_lines{n_lines};
+        for (size_t i = 0; i < n_chunks; ++i) {
+            chunk_n_lines.push_back(chunk_n_lines.back() + util::count_newlines(bounds[i], bounds[i + 1]));
+        }
+
+        // Every chunk is started at the state the previous text ended in, which is usually the same for all lines
+        int state = current->state();
+        std::vector<std::exception_ptr> failures(n_chunks);
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < n_chunks; ++i) {
+            parsers[i]->resume(state, chunk_n_lines[i]);
+            threads.emplace_back([this, i, &bounds, &failures] {
+                try {
+                    parsers[i]->parse(bounds[i], bounds[i + 1]);
+                } catch (...) {
+                    failures[i] = std::current_exception();
+                }
+            });
+        }
+        for (auto & thread : threads) {
+            thread.join();
+        }
+
+        for (size_t i = 0; i < n_chunks; ++i) {
+            Parser &parser = *parsers[i];
+            if (i > 0 && parsers[i - 1]->state() != state) {
+                // The previous chunk ended in another state, so this one must be parsed again from there
+                parser.deferred_records().clear();
+                parser.resume(parsers[i - 1]->state(), chunk_n_lines[i]);
+                failures[i] = nullptr;
+                try {
+                    parser.parse(bounds[i], bounds[i + 1]);
+                } catch (...) {
+                    failures[i] = std::current_exception();
+                }
+            }
+
+            parser.count_progress();
+            write_errors(parser);
+            if (failures[i]) {
+                std::rethrow_exception(failures[i]);
+            }
+        }
+
+        current = parsers[n_chunks - 1].get();
+        n_lines = chunk_n_lines[n_chunks];
+    }
+
+    void ChunkValidator::end(char const * begin, char const * end)
+    {
+        auto last_newline = std::find(std::reverse_iterator<char const *>(end),
+                                      std::reverse_iterator<char const *>(begin), '\n');
+        char const * complete = last_newline.base();
+        if (complete != begin) {
+            parse(begin, complete);
+        }
+        if (complete != end) {
+            parse_sequentially(complete, end);
+        }
+
+        try {
+            current->end();
+        } catch (...) {
+            write_errors(*current);
+            throw;
+        }
+        write_errors(*current);
+    }
+
+    bool ChunkValidator::is_valid() const
+    {
+        return valid;
+    }
+
+    void ChunkValidator::parse_sequentially(char const * begin, char const * end)
+    {
+        try {
+            current->parse(begin, end);
+        } catch (...) {
+            current->count_progress();
+            write_errors(*current);
+            throw;
+        }
+        current->count_progress();
+        write_errors(*current);
+        n_lines += util::count_newlines(begin, end);
+    }
+
+    void ChunkValidator::write_errors(Parser &parser)
+    {
+        // Run the deferred checks in file order. A record that is not sorted is not checked any further, so it
+        // can't be duplicated and its warnings must be discarded.
+        std::vector<std::unique_ptr<Error>> record_errors;
+        std::vector<size_t> record_error_n_lines;
+        std::vector<size_t> unsorted_lines;
+        for (auto &record : parser.deferred_records()) {
+            try {
+                sorting.check(record.line, record.chromosome, record.position);
+            } catch (Error *error) {
+                record_errors.emplace_back(error);
+                record_error_n_lines.push_back(record.line);
+                unsorted_lines.push_back(record.line);
+                continue;
+            }
+            for (auto &error : previous_records.check_duplicates(record.record_cores)) {
+                record_errors.push_back(std::move(error));
+                record_error_n_lines.push_back(record.line);
+            }
+        }
+        parser.deferred_records().clear();
+
+        auto & errors = parser.errors();
+        auto & warnings = parser.warnings();
+        auto & error_n_lines = parser.error_n_lines();
+        auto & warning_n_lines = parser.warning_n_lines();
+        if (!errors.empty() || !record_errors.empty()) {
+            valid = false;
+        }
+
+        // Within the same line the errors of the parser go first, then the deferred ones, and then the warnings
+        size_t i = 0, j = 0, k = 0;
+        while (i < errors.size() || j < record_errors.size() || k < warnings.size()) {
+            size_t record_error_line = j < record_errors.size() ? record_error_n_lines[j] : SIZE_MAX;
+            size_t warning_line = k < warnings.size() ? warning_n_lines[k] : SIZE_MAX;
+
+            if (i < errors.size() && error_n_lines[i] <= record_error_line && error_n_lines[i] <= warning_line) {
+                for (auto &output : outputs) {
+                    output->write_error(*errors[i]);
+                }
+                ++i;
+            } else if (j < record_errors.size() && record_error_line <= warning_line) {
+                for (auto &output : outputs) {
+                    output->write_error(*record_errors[j]);
+                }
+                ++j;
+            } else {
+                if (!std::binary_search(unsorted_lines.begin(), unsorted_lines.end(), warning_line)) {
+                    for (auto &output : outputs) {
+                        output->write_warning(*warnings[k]);
+                    }
+                }
+                ++k;
             }
         }
     }
@@ -0,0 +1,141 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "util/batch_scheduler.hpp"
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  TEST_CASE("Batch scheduler runs every job once", "[batch]")
+  {
+      std::vector<util::BatchScheduler::Job> jobs;
+      for (size_t i = 0; i < 20; ++i) {
+          jobs.push_back({i, i % 7, 1});
+      }
+
+      for (size_t n_threads : {1, 3, 8}) {
+          std::vector<std::atomic<int>> runs(jobs.size());
+          for (auto & run : runs) {
+              run = 0;
+          }
+          util::BatchScheduler scheduler{n_threads, 0};
+          scheduler.run(jobs, [&](size_t index) { ++runs[index]; });
+          CHECK(std::all_of(runs.begin(), runs.end(), [](std::atomic<int> const & run) { return run == 1; }));
+      }
+  }
+
+  TEST_CASE("Batch scheduler starts the biggest jobs first", "[batch]")
+  {
+      std::vector<util::BatchScheduler::Job> jobs{{0, 10, 1}, {1, 30, 1}, {2, 20, 1}, {3, 40, 1}};
+      std::vector<size_t> order;
+
+      util::BatchScheduler scheduler{1, 0};
+      scheduler.run(jobs, [&](size_t index) { order.push_back(index); });
+      CHECK(order == (std::vector<size_t>{3, 1, 2, 0}));
+  }
+
+  TEST_CASE("Batch scheduler respects the memory budget", "[batch]")
+  {
+      std::vector<util::BatchScheduler::Job> jobs;
+      for (size_t i = 0; i < 12; ++i) {
+          jobs.push_back({i, i, 3});
+      }
+      jobs.push_back({12, 0, 50});  // bigger than the whole budget, so it runs alone
+
+      std::mutex mutex;
+      size_t in_use = 0;
+      size_t max_in_use = 0;
+      bool big_job_alone = false;
+
+      util::BatchScheduler scheduler{4, 7};
+      scheduler.run(jobs, [&](size_t index) {
+          {
+              std::lock_guard<std::mutex> lock{mutex};
+              in_use += jobs[index].memory;
+              if (index == 12) {
+                  big_job_alone = in_use == jobs[index].memory;
+              } else {
+                  max_in_use = std::max(max_in_use, in_use);
+              }
+          }
+          std::this_thread::sleep_for(std::chrono::milliseconds{2});
+          std::lock_guard<std::mutex> lock{mutex};
+          in_use -= jobs[index].memory;
+      });
+
+      CHECK(max_in_use <= 6);
+      CHECK(big_job_alone);
+  }
+
+  TEST_CASE("Batch scheduler rethrows the errors of the jobs", "[batch]")
+  {
+      std::vector<util::BatchScheduler::Job> jobs{{0, 1, 1}, {1, 2, 1}, {2, 3, 1}, {3, 0, 1}};
+      std::vector<std::atomic<int>> runs(jobs.size());
+      for (auto & run : runs) {
+          run = 0;
+      }
+      util::BatchScheduler scheduler{2, 0};
+      CHECK_THROWS_AS(scheduler.run(jobs, [&](size_t index) {
+                          ++runs[index];
+                          if (index == 2) {
+                              throw std::runtime_error{"job failed"};
+                          }
+                      }),
+                      std::runtime_error);
+      // The jobs after the failed one are run anyway
+      CHECK(std::all_of(runs.begin(), runs.end(), [](std::atomic<int> const & run) { return run == 1; }));
+  }
+
+  TEST_CASE("Batch of files validated at the stop level", "[batch]")
+  {
+      std::vector<std::string> paths{"test/input_files/v4.3/passed/passed_body_alt.vcf",
+                                     "test/input_files/v4.3/failed/failed_body_alt_000.vcf",
+                                     "test/input_files/v4.3/passed/passed_body_chrom.vcf"};
+      std::vector<util::BatchScheduler::Job> jobs;
+      for (size_t i = 0; i < paths.size(); ++i) {
+          jobs.push_back({i, paths.size() - i, 1});
+      }
+
+      // Each file gets its own verdict, even when the first error of another one is thrown out of its validation
+      std::vector<int> verdicts(paths.size(), -1);
+      util::BatchScheduler scheduler{2, 0};
+      scheduler.run(jobs, [&](size_t index) {
+          std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+          std::ifstream input{paths[index]};
+          try {
+              verdicts[index] = vcf::is_valid_vcf_file(input, paths[index], vcf::ValidationLevel::stop, vcf::Ploidy{2},
+                                                       outputs);
+          } catch (vcf::Error * error) {
+              std::unique_ptr<vcf::Error> owned_error{error};
+              verdicts[index] = 0;
+          }
+      });
+      CHECK(verdicts == (std::vector<int>{1, 0, 1}));
+  }
+}
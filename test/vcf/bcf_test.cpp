@@ -0,0 +1,185 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "vcf/bcf_parser.hpp"
+#include "vcf/report_writer.hpp"
+#include "vcf/validator.hpp"
+
+#include "parser_test_aux.hpp"
+
+namespace ebi
+{
+  bool is_valid_bcf_file(std::string const &path, vcf::ValidationLevel level, CollectedReports &reports)
+  {
+      auto outputs = collecting_outputs(reports);
+      std::ifstream input{path};
+      return vcf::is_valid_vcf_file(input, path, level, vcf::Ploidy{2}, outputs);
+  }
+
+  TEST_CASE("BCF header dictionaries", "[bcf]")
+  {
+      vcf::BcfHeader header{
+          "##fileformat=VCFv4.3\n"
+          "##contig=<ID=20,length=62435964>\n"
+          "##contig=<ID=X,length=155270560>\n"
+          "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+          "##FILTER=<ID=q10,Description=\"Quality below 10\">\n"
+          "##INFO=<ID=DB,Number=0,Type=Flag,Description=\"dbSNP membership\">\n"
+          "##FORMAT=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+          "##FORMAT=<ID=GQ,Number=1,Type=Integer,Description=\"Quality\",IDX=6>\n"
+          "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\tFORMAT\tNA00001\tNA00002\n"};
+
+      SECTION("Filters, INFO and FORMAT share a dictionary that starts with PASS")
+      {
+          REQUIRE(header.strings.size() == 7);
+          CHECK(header.strings[0] == "PASS");
+          CHECK(header.strings[1] == "DP");
+          CHECK(header.strings[2] == "q10");
+          CHECK(header.strings[3] == "DB");
+          CHECK(header.strings[4] == "");
+          CHECK(header.strings[6] == "GQ");
+      }
+
+      SECTION("Contigs")
+      {
+          CHECK(header.contigs == (std::vector<std::string>{"20", "X"}));
+      }
+
+      SECTION("Flags and samples")
+      {
+          CHECK(header.info_flags == (std::set<std::string>{"DB"}));
+          CHECK(header.n_samples == 2);
+      }
+  }
+
+  TEST_CASE("BCF float values", "[bcf]")
+  {
+      vcf::BcfHeader header{
+          "##fileformat=VCFv4.3\n"
+          "##contig=<ID=20,length=62435964>\n"
+          "##INFO=<ID=AF,Number=A,Type=Float,Description=\"Allele frequency\">\n"
+          "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"};
+
+      auto append_uint32 = [](std::string & data, uint32_t value) {
+          data.append(reinterpret_cast<char const *>(&value), sizeof(value));
+      };
+      auto append_float = [](std::string & data, float value) {
+          data.append(reinterpret_cast<char const *>(&value), sizeof(value));
+      };
+
+      // 20  100  .  A  C,G  <quality>  .  AF=<frequencies>
+      std::string shared;
+      append_uint32(shared, 0);
+      append_uint32(shared, 99);
+      append_uint32(shared, 1);
+      append_float(shared, 1.0000001f);
+      append_uint32(shared, (3 << 16) | 1);
+      append_uint32(shared, 0);
+      shared += std::string{"\x07\x17" "A" "\x17" "C" "\x17" "G" "\x00" "\x11\x01" "\x25", 11};
+      append_float(shared, 0.1f);
+      append_float(shared, 1.0000001f);
+
+      std::vector<std::vector<std::string>> columns;
+      vcf::TypedFields typed;
+      vcf::decode_bcf_record(shared.data(), shared.size(), nullptr, 0, header, 1, columns, typed);
+
+      REQUIRE(columns.size() == 8);
+      CHECK(columns[5] == (std::vector<std::string>{"1.0000001"}));
+      CHECK(columns[7] == (std::vector<std::string>{"AF=0.1,1.0000001"}));
+
+      CHECK(typed.quality == 1.0000001f);
+      auto frequencies = typed.info_values("AF");
+      REQUIRE(frequencies != nullptr);
+      CHECK(frequencies->kind == vcf::ValueKind::floating);
+      REQUIRE(frequencies->values.size() == 2);
+      CHECK(frequencies->values[0].number == 0.1f);
+      CHECK(frequencies->values[1].number == 1.0000001f);
+  }
+
+  TEST_CASE("BCF typed values", "[bcf]")
+  {
+      std::shared_ptr<vcf::Source> source{
+          new vcf::Source{"typed.bcf", vcf::InputFormat::VCF_FILE_BCF, vcf::Version::v43, vcf::Ploidy{2}}};
+      source->add_meta(vcf::MetaEntry{1, "INFO", {{"ID", "XC"}, {"Number", "2"}, {"Type", "Integer"},
+                                                  {"Description", "Some count"}}, source});
+
+      auto record_with = [&](vcf::TypedFields const & typed) {
+          return vcf::Record{1, "20", 100, {"."}, "A", {"C"}, 0, {"."}, {{"XC", "3,."}}, {}, {}, source,
+                             nullptr, nullptr, &typed};
+      };
+
+      vcf::TypedFields typed{};
+      typed.info["XC"] = vcf::TypedValues{vcf::ValueKind::integer, {{false, 3}, {true, 0}}};
+      CHECK_NOTHROW(record_with(typed));
+
+      // The text of the float 3 reads as an integer, but its type doesn't match
+      typed.info["XC"].kind = vcf::ValueKind::floating;
+      CHECK_THROWS_AS(record_with(typed), vcf::InfoBodyError*);
+
+      // The number of values is taken from the typed vector too
+      typed.info["XC"] = vcf::TypedValues{vcf::ValueKind::integer, {{false, 3}}};
+      CHECK_THROWS_AS(record_with(typed), vcf::InfoBodyError*);
+  }
+
+  TEST_CASE("BCF files", "[bcf]")
+  {
+      CollectedReports reports;
+
+      SECTION("Correct file")
+      {
+          for (auto level : {vcf::ValidationLevel::warning, vcf::ValidationLevel::error}) {
+              CHECK(is_valid_bcf_file("test/input_files/bcf/passed_000.bcf", level, reports));
+          }
+          CHECK(reports.error_lines.empty());
+      }
+
+      SECTION("Incorrect records")
+      {
+          CHECK_FALSE(is_valid_bcf_file("test/input_files/bcf/failed_body_000.bcf", vcf::ValidationLevel::warning,
+                                        reports));
+          CHECK(reports.error_lines == (std::vector<size_t>{11, 14, 15, 16}));
+      }
+
+      SECTION("Incorrect records, only syntax")
+      {
+          CHECK_FALSE(is_valid_bcf_file("test/input_files/bcf/failed_body_000.bcf", vcf::ValidationLevel::error,
+                                        reports));
+          CHECK(reports.error_lines == (std::vector<size_t>{16}));
+      }
+
+      SECTION("Uncompressed and truncated")
+      {
+          CHECK_FALSE(is_valid_bcf_file("test/input_files/bcf/truncated_000.bcf", vcf::ValidationLevel::warning,
+                                        reports));
+          CHECK(reports.error_lines == (std::vector<size_t>{22}));
+      }
+
+      SECTION("Memory-mapped")
+      {
+          std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+          util::MappedFile input{"test/input_files/bcf/truncated_000.bcf"};
+          CHECK_FALSE(vcf::is_valid_vcf_file(input, "truncated_000.bcf", vcf::ValidationLevel::warning,
+                                             vcf::Ploidy{2}, outputs));
+      }
+  }
+}
@@ -0,0 +1,156 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "util/stream_utils.hpp"
+#include "vcf/checkpoint.hpp"
+
+#include "parser_test_aux.hpp"
+
+namespace ebi
+{
+  std::string const checkpoint_path = "test/input_files/checkpoint_test.checkpoint";
+
+  std::string const checkpoint_header = vcf_header({"1", "2"});
+
+  // The checkpoint is written after these records
+  std::string const checkpoint_before =
+          "1\t100\t.\tA\tT\t10\tPASS\t.\n"
+          "1\t200\t.\tA\tT\tq10\tPASS\t.\n"
+          "1\t300\t.\tA\tT\t10\tPASS\t.\n"
+          "2\t100\t.\tA\tT\t10\tPASS\t.\n"
+          "2\t200\t.\tA\tT\t10\tPASS\t.\n";
+
+  // Unsorted, duplicated and non-contiguous records that can only be found remembering the ones before
+  std::string const checkpoint_after =
+          "2\t150\t.\tA\tT\t10\tPASS\t.\n"
+          "2\t200\t.\tA\tT\t10\tPASS\t.\n"
+          "1\t400\t.\tA\tT\t10\tPASS\t.\n"
+          "1\t500\t.\tA\tT\tq10\tPASS\t.\n";
+
+  size_t const checkpoint_line = 11;
+
+  bool is_valid_checkpointed(std::istream &input, bool resume, CollectedReports &reports)
+  {
+      auto outputs = collecting_outputs(reports);
+      vcf::CheckpointOptions options{checkpoint_path, 0, resume};
+      return vcf::is_valid_vcf_file(input, "checkpoint", vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs,
+                                    options);
+  }
+
+  TEST_CASE("Resume a validation from a checkpoint", "[checkpoint]")
+  {
+      std::string text = checkpoint_header + checkpoint_before + checkpoint_after;
+
+      CollectedReports expected;
+      std::istringstream full{text};
+      bool valid = is_valid_checkpointed(full, false, expected);
+      CHECK_FALSE(valid);
+
+      // Validating only the beginning leaves a checkpoint at its end
+      CollectedReports before;
+      std::istringstream beginning{checkpoint_header + checkpoint_before};
+      CHECK_FALSE(is_valid_checkpointed(beginning, false, before));
+      auto lines_before = before.lines();
+      CHECK(lines_before == std::multiset<size_t>{7});
+
+      vcf::Checkpoint checkpoint = vcf::read_checkpoint(checkpoint_path);
+      CHECK(checkpoint.source == "checkpoint");
+      CHECK(checkpoint.header_end == checkpoint_header.size());
+      CHECK(checkpoint.offset == checkpoint_header.size() + checkpoint_before.size());
+      CHECK(checkpoint.n_lines == checkpoint_line);
+      CHECK_FALSE(checkpoint.valid);
+      CHECK(checkpoint.n_reports == lines_before.size());
+      CHECK(checkpoint.sorting.contig() == "2");
+      CHECK(checkpoint.sorting.position() == 200);
+      CHECK(checkpoint.records.size() == 4);   // the record with an error is not remembered
+
+      SECTION("Seekable input")
+      {
+          CollectedReports after;
+          std::istringstream input{text};
+          CHECK(is_valid_checkpointed(input, true, after) == valid);
+          CHECK(after.n_resumed_reports == lines_before.size());
+
+          auto lines_after = after.lines();
+          lines_after.insert(lines_before.begin(), lines_before.end());
+          CHECK(lines_after == expected.lines());
+      }
+
+      SECTION("Input that can't be seeked")
+      {
+          CollectedReports after;
+          util::RangeStreambuf range{text.data(), text.data() + text.size()};
+          std::istream input{&range};
+          CHECK(is_valid_checkpointed(input, true, after) == valid);
+
+          auto lines_after = after.lines();
+          lines_after.insert(lines_before.begin(), lines_before.end());
+          CHECK(lines_after == expected.lines());
+      }
+
+      SECTION("Another input")
+      {
+          std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+          std::istringstream input{text};
+          vcf::CheckpointOptions options{checkpoint_path, 0, true};
+          CHECK_THROWS_AS(vcf::is_valid_vcf_file(input, "another", vcf::ValidationLevel::warning, vcf::Ploidy{2},
+                                                 outputs, options),
+                          std::runtime_error);
+      }
+
+      SECTION("Shorter input")
+      {
+          CollectedReports after;
+          std::istringstream input{checkpoint_header};
+          CHECK_THROWS_AS(is_valid_checkpointed(input, true, after), std::runtime_error);
+      }
+
+      std::remove(checkpoint_path.c_str());
+  }
+
+  TEST_CASE("Read malformed checkpoints", "[checkpoint]")
+  {
+      SECTION("Missing file")
+      {
+          CHECK_THROWS_AS(vcf::read_checkpoint(checkpoint_path), std::runtime_error);
+      }
+
+      SECTION("Not a checkpoint")
+      {
+          CHECK_THROWS_AS(vcf::read_checkpoint("test/input_files/v4.3/passed/complexfile_passed_000.vcf"),
+                          std::runtime_error);
+      }
+
+      SECTION("Missing values")
+      {
+          std::ofstream{checkpoint_path} << "##vcf-validator checkpoint 1\nsource\tcheckpoint\nlevel\t1\n";
+          CHECK_THROWS_AS(vcf::read_checkpoint(checkpoint_path), std::runtime_error);
+      }
+
+      std::remove(checkpoint_path.c_str());
+  }
+}
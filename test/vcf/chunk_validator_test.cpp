@@ -0,0 +1,153 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "util/progress.hpp"
+#include "vcf/report_writer.hpp"
+#include "vcf/validator.hpp"
+
+#include "parser_test_aux.hpp"
+
+namespace ebi
+{
+  std::pair<bool, std::vector<std::string>> validate_text(std::string const &text,
+                                                         vcf::ValidationLevel level,
+                                                         size_t n_threads)
+  {
+      CollectedReports reports;
+      auto outputs = collecting_outputs(reports);
+      bool valid = vcf::is_valid_vcf_file(text.data(), text.data() + text.size(), "chunks", level, vcf::Ploidy{2},
+                                          outputs, n_threads);
+      return {valid, reports.messages};
+  }
+
+  std::pair<bool, std::vector<std::string>> validate_file(std::string const &path,
+                                                         vcf::ValidationLevel level,
+                                                         size_t n_threads)
+  {
+      CollectedReports reports;
+      auto outputs = collecting_outputs(reports);
+      std::ifstream input{path};
+      bool valid = vcf::is_valid_vcf_file(input, path, level, vcf::Ploidy{2}, outputs, n_threads);
+      return {valid, reports.messages};
+  }
+
+  std::string const chunk_header = vcf_header({"1", "2"}, "##FILTER=<ID=q10,Description=\"Quality below 10\">\n");
+
+  std::string chunk_record(std::string const &chromosome, size_t position, std::string const &filter = "PASS")
+  {
+      return chromosome + "\t" + std::to_string(position) + "\t.\tA\tT\t10\t" + filter + "\t.\n";
+  }
+
+  TEST_CASE("Chunks report the same as a single parser", "[chunks]")
+  {
+      std::string text = chunk_header;
+      for (size_t i = 1; i <= 40; ++i) {
+          text += chunk_record("1", i * 10);
+      }
+      // Records that can only be found wrong by comparing them with records in other chunks
+      text += chunk_record("1", 100);               // duplicated
+      text += chunk_record("1", 50);                // unsorted
+      text += chunk_record("1", 60, "missing");     // unsorted, so its warning is not reported
+      text += "1\tpositionX\t.\tA\tT\t10\tPASS\t.\n"; // syntax error
+      text += chunk_record("1", 420, "missing");    // warning
+      for (size_t i = 1; i <= 40; ++i) {
+          text += chunk_record("2", i * 10);
+      }
+      text += chunk_record("1", 500);               // contig not contiguous
+      text += chunk_record("2", 200);               // duplicated
+      text += chunk_record("2", 410);
+
+      for (auto level : {vcf::ValidationLevel::warning, vcf::ValidationLevel::error}) {
+          auto expected = validate_text(text, level, 1);
+          CHECK_FALSE(expected.first);
+          for (size_t n_threads : {2, 3, 7, 64}) {
+              auto chunked = validate_text(text, level, n_threads);
+              CHECK(chunked.first == expected.first);
+              CHECK(chunked.second == expected.second);
+          }
+      }
+  }
+
+  TEST_CASE("Chunks of a file with a broken header", "[chunks]")
+  {
+      std::string text = "##fileformat=VCFv4.3\n##reference=file:///ref.fa\n";
+      for (size_t i = 1; i <= 20; ++i) {
+          text += chunk_record("1", i * 10);
+      }
+
+      auto expected = validate_text(text, vcf::ValidationLevel::warning, 1);
+      auto chunked = validate_text(text, vcf::ValidationLevel::warning, 4);
+      CHECK_FALSE(chunked.first);
+      CHECK(chunked.second == expected.second);
+  }
+
+  TEST_CASE("Chunks of a file with records after an empty line", "[chunks]")
+  {
+      std::string text = chunk_header;
+      for (size_t i = 1; i <= 20; ++i) {
+          text += chunk_record("1", i * 10);
+      }
+      text += "\n";
+      for (size_t i = 21; i <= 40; ++i) {
+          text += chunk_record("1", i * 10);
+      }
+
+      auto & counters = util::progress_counters();
+      uint64_t bytes = counters.bytes, lines = counters.lines, records = counters.records;
+      auto expected = validate_text(text, vcf::ValidationLevel::warning, 1);
+      uint64_t expected_bytes = counters.bytes - bytes, expected_lines = counters.lines - lines,
+               expected_records = counters.records - records;
+
+      // The chunks after the empty line are parsed again from another state, but their progress is counted once
+      bytes = counters.bytes, lines = counters.lines, records = counters.records;
+      auto chunked = validate_text(text, vcf::ValidationLevel::warning, 4);
+      CHECK_FALSE(chunked.first);
+      REQUIRE(expected.second.size() == 1);
+      CHECK(chunked.second == expected.second);
+      CHECK(counters.bytes - bytes == expected_bytes);
+      CHECK(counters.lines - lines == expected_lines);
+      CHECK(counters.records - records == expected_records);
+  }
+
+  TEST_CASE("Chunks of the test files report the same as a single parser", "[chunks]")
+  {
+      for (std::string version : {"v4.1", "v4.2", "v4.3"}) {
+          for (std::string folder : {"passed", "failed"}) {
+              boost::filesystem::path path{"test/input_files/" + version + "/" + folder};
+              boost::filesystem::directory_iterator end;
+              for (boost::filesystem::directory_iterator it{path}; it != end; ++it) {
+                  auto file = it->path().string();
+                  for (auto level : {vcf::ValidationLevel::warning, vcf::ValidationLevel::error}) {
+                      auto expected = validate_file(file, level, 1);
+                      auto chunked = validate_file(file, level, 3);
+                      INFO(file);
+                      CHECK(chunked.first == expected.first);
+                      CHECK(chunked.second == expected.second);
+                  }
+              }
+          }
+      }
+  }
+}
@@ -0,0 +1,191 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "util/compression.hpp"
+#include "util/mapped_file.hpp"
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  std::string const plain_path = "test/input_files/v4.3/passed/complexfile_passed_000.vcf";
+  std::string const gzip_path = "test/input_files/compressed/complexfile_passed_000.gzip.vcf.gz";
+  std::string const bgzip_path = "test/input_files/compressed/complexfile_passed_000.bgzip.vcf.gz";
+  std::string const truncated_path = "test/input_files/compressed/complexfile_passed_000.truncated.vcf.gz";
+  std::string const wrong_crc_path = "test/input_files/compressed/complexfile_passed_000.wrong_crc.vcf.gz";
+  std::string const failed_bgzip_path = "test/input_files/compressed/failed_body_duplicated_000.bgzip.vcf.gz";
+
+  std::string read_all(std::istream &input)
+  {
+      return std::string{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+  }
+
+  TEST_CASE("Detect compressed inputs", "[compression]")
+  {
+      SECTION("Plain text")
+      {
+          std::ifstream input{plain_path};
+          CHECK_FALSE(util::is_gzip(input));
+      }
+
+      SECTION("Only the first magic byte")
+      {
+          std::istringstream input{"\x1f" "abc"};
+          CHECK_FALSE(util::is_gzip(input));
+          CHECK(read_all(input) == "\x1f" "abc");
+      }
+
+      SECTION("Gzip")
+      {
+          std::ifstream input{gzip_path};
+          CHECK(util::is_gzip(input));
+          bool bgzf;
+          auto inflated = util::make_gzip_streambuf(input, 1, bgzf);
+          CHECK_FALSE(bgzf);
+      }
+
+      SECTION("BGZF")
+      {
+          std::ifstream input{bgzip_path};
+          CHECK(util::is_gzip(input));
+          bool bgzf;
+          auto inflated = util::make_gzip_streambuf(input, 1, bgzf);
+          CHECK(bgzf);
+      }
+  }
+
+  TEST_CASE("Decompress inputs", "[compression]")
+  {
+      std::ifstream plain_input{plain_path};
+      std::string plain = read_all(plain_input);
+      bool bgzf;
+
+      SECTION("Gzip")
+      {
+          std::ifstream input{gzip_path};
+          auto inflated = util::make_gzip_streambuf(input, 1, bgzf);
+          std::istream text{inflated.get()};
+          CHECK(read_all(text) == plain);
+      }
+
+      SECTION("Gzip members followed by zero padding")
+      {
+          std::ifstream gzip_input{gzip_path};
+          std::string member = read_all(gzip_input);
+          std::string padding(1024, '\0');
+
+          // The second member starts right at the end of the first chunk, with only its first byte in it
+          std::vector<char> first_chunk{member.begin(), member.end()};
+          first_chunk.push_back(member[0]);
+          std::istringstream input{member.substr(1) + padding};
+          util::GzipStreambuf inflated{input, first_chunk, 1000, 2};
+          std::istream text{&inflated};
+          CHECK(read_all(text) == plain + plain);
+      }
+
+      SECTION("BGZF, several blocks and small buffers")
+      {
+          std::ifstream input{bgzip_path};
+          util::GzipStreambuf inflated{input, {}, 1000, 2};
+          std::istream text{&inflated};
+          CHECK(read_all(text) == plain);
+      }
+
+      SECTION("BGZF, several threads")
+      {
+          for (size_t n_threads : {2, 3, 8}) {
+              std::ifstream input{bgzip_path};
+              auto inflated = util::make_gzip_streambuf(input, n_threads, bgzf);
+              std::istream text{inflated.get()};
+              CHECK(read_all(text) == plain);
+          }
+      }
+
+      SECTION("Truncated gzip")
+      {
+          for (size_t n_threads : {1, 4}) {
+              std::ifstream input{truncated_path};
+              auto inflated = util::make_gzip_streambuf(input, n_threads, bgzf);
+              std::istream text{inflated.get()};
+              text.exceptions(std::ios::badbit);
+              CHECK_THROWS_AS(read_all(text), std::runtime_error);
+          }
+      }
+
+      SECTION("BGZF with a wrong checksum")
+      {
+          for (size_t n_threads : {1, 4}) {
+              std::ifstream input{wrong_crc_path};
+              auto inflated = util::make_gzip_streambuf(input, n_threads, bgzf);
+              std::istream text{inflated.get()};
+              text.exceptions(std::ios::badbit);
+              CHECK_THROWS_AS(read_all(text), std::runtime_error);
+          }
+      }
+  }
+
+  TEST_CASE("Validate compressed files", "[compression]")
+  {
+      std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> outputs;
+
+      SECTION("Gzip")
+      {
+          std::ifstream input{gzip_path};
+          CHECK(vcf::is_valid_vcf_file(input, gzip_path, vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs));
+      }
+
+      SECTION("BGZF")
+      {
+          std::ifstream input{bgzip_path};
+          CHECK(vcf::is_valid_vcf_file(input, bgzip_path, vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs));
+      }
+
+      SECTION("BGZF, several threads")
+      {
+          std::ifstream input{bgzip_path};
+          CHECK(vcf::is_valid_vcf_file(input, bgzip_path, vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs, 4));
+      }
+
+      SECTION("BGZF, memory-mapped")
+      {
+          util::MappedFile input{bgzip_path};
+          CHECK(vcf::is_valid_vcf_file(input, bgzip_path, vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs));
+      }
+
+      SECTION("BGZF with errors")
+      {
+          std::ifstream input{failed_bgzip_path};
+          CHECK_FALSE(vcf::is_valid_vcf_file(input, failed_bgzip_path, vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs));
+          std::ifstream input_threads{failed_bgzip_path};
+          CHECK_FALSE(vcf::is_valid_vcf_file(input_threads, failed_bgzip_path, vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs, 4));
+      }
+
+      SECTION("Truncated gzip")
+      {
+          std::ifstream input{truncated_path};
+          CHECK_THROWS_AS(vcf::is_valid_vcf_file(input, truncated_path, vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs),
+                          std::runtime_error);
+      }
+  }
+}
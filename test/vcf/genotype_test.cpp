@@ -0,0 +1,120 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <limits>
+#include <string>
+
+#include "catch/catch.hpp"
+
+#include "vcf/genotype.hpp"
+
+namespace ebi
+{
+  vcf::GenotypeAlleles scan(std::string const & gt, size_t max_index)
+  {
+      return vcf::scan_genotype(gt.data(), gt.data() + gt.size(), max_index);
+  }
+
+  TEST_CASE("Valid genotypes", "[genotype]")
+  {
+      for (std::string gt : {"0/1", "1|0", "./.", ".|1", "0/10", "12|3", "0", ".", "0|1|2", "1/./0/2", "0/1/"}) {
+          CHECK(scan(gt, 12).error == vcf::AlleleError::none);
+      }
+
+      auto diploid = scan("0/1", 1);
+      CHECK(diploid.ploidy == 2);
+      CHECK_FALSE(diploid.phased);
+      CHECK(diploid.max_allele == 1);
+
+      auto triploid = scan("2|0|11", 11);
+      CHECK(triploid.ploidy == 3);
+      CHECK(triploid.phased);
+      CHECK(triploid.max_allele == 11);
+
+      auto missing = scan(".|.", 1);
+      CHECK(missing.ploidy == 2);
+      CHECK(missing.phased);
+      CHECK(missing.max_allele == -1);
+
+      CHECK(scan("1/0/", 1).ploidy == 2);
+      CHECK(scan("", 1).ploidy == 0);
+  }
+
+  TEST_CASE("Invalid genotypes", "[genotype]")
+  {
+      SECTION("Allele indexes greater than the alternate alleles")
+      {
+          auto single_digit = scan("0/2", 1);
+          CHECK(single_digit.error == vcf::AlleleError::out_of_range);
+          CHECK(single_digit.error_value == 2);
+          CHECK(single_digit.ploidy == 2);
+
+          auto multiple_digits = scan("0/1|10", 9);
+          CHECK(multiple_digits.error == vcf::AlleleError::out_of_range);
+          CHECK(multiple_digits.error_value == 10);
+          CHECK(multiple_digits.error_begin == 4);
+          CHECK(multiple_digits.error_end == 6);
+          CHECK(multiple_digits.ploidy == 3);
+      }
+
+      SECTION("Allele indexes that are not numbers")
+      {
+          auto letter = scan("0/a", 1);
+          CHECK(letter.error == vcf::AlleleError::not_integer);
+          CHECK(letter.error_begin == 2);
+          CHECK(letter.error_end == 3);
+
+          auto empty = scan("0//1", 1);
+          CHECK(empty.error == vcf::AlleleError::not_integer);
+          CHECK(empty.error_begin == empty.error_end);
+          CHECK(empty.ploidy == 3);
+
+          // As in util::string_split, a leading separator belongs to the first allele
+          auto leading = scan("/1", 1);
+          CHECK(leading.error == vcf::AlleleError::not_integer);
+          CHECK(leading.error_end == 2);
+          CHECK(leading.ploidy == 1);
+      }
+
+      SECTION("Only the first invalid allele is reported")
+      {
+          auto genotype = scan("5/x/7", 1);
+          CHECK(genotype.error == vcf::AlleleError::out_of_range);
+          CHECK(genotype.error_value == 5);
+          CHECK(genotype.ploidy == 3);
+      }
+  }
+
+  TEST_CASE("Genotypes counted", "[genotype]")
+  {
+      CHECK(vcf::count_genotypes(2, 3) == 6);
+      CHECK(vcf::count_genotypes(1, 5) == 5);
+      CHECK(vcf::count_genotypes(0, 5) == 1);
+      CHECK(vcf::count_genotypes(3, 2) == 4);
+      CHECK(vcf::count_genotypes(4, 5) == 70);
+
+      // Both sides of the limits of the table
+      CHECK(vcf::count_genotypes(8, 64) == 10639125640);
+      CHECK(vcf::count_genotypes(8, 65) == 11969016345);
+      CHECK(vcf::count_genotypes(9, 64) == 85113005120);
+
+      // Exact even where a float would round
+      CHECK(vcf::count_genotypes(2, 100000) == 5000050000);
+      CHECK(vcf::count_genotypes(2, 4294967295) == 9223372034707292160);
+      CHECK(vcf::count_genotypes(40, 1000) == std::numeric_limits<long>::max());
+  }
+}
@@ -0,0 +1,138 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "util/line_scanner.hpp"
+
+namespace ebi
+{
+  TEST_CASE("Line breaks found in blocks", "[line_scanner]")
+  {
+      // Sparse and dense line breaks, at every alignment and across the boundaries of the blocks compared at once
+      std::mt19937 random{42};
+      for (size_t density : {2, 7, 40, 200}) {
+          std::string text;
+          for (size_t i = 0; i < 300; ++i) {
+              size_t r = random() % density;
+              text.push_back(r == 0 ? '\n' : r == 1 ? '\r' : static_cast<char>('A' + random() % 26));
+          }
+
+          for (size_t begin = 0; begin < 70; ++begin) {
+              for (size_t end = begin; end <= text.size(); end += 13) {
+                  char const * first = text.data() + begin;
+                  char const * last = text.data() + end;
+                  auto expected = std::find_if(first, last, [](char c) { return c == '\n' || c == '\r'; });
+                  CHECK(util::find_line_break(first, last) == expected);
+                  CHECK(util::count_newlines(first, last) == static_cast<size_t>(std::count(first, last, '\n')));
+              }
+          }
+      }
+  }
+
+  TEST_CASE("Line breaks not found", "[line_scanner]")
+  {
+      std::string text(100, 'A');
+      CHECK(util::find_line_break(text.data(), text.data() + text.size()) == text.data() + text.size());
+      CHECK(util::count_newlines(text.data(), text.data() + text.size()) == 0);
+      CHECK(util::find_line_break(text.data(), text.data()) == text.data());
+  }
+
+  TEST_CASE("Structural characters found in blocks", "[line_scanner]")
+  {
+      // One character of each kind, one that is of none, and some outside ASCII
+      std::string const alphabet = "\n\t;:,= \rA\x7f\x80\xff";
+      std::vector<unsigned> const kinds = {util::StructuralIndex::newline, util::StructuralIndex::tab,
+                                           util::StructuralIndex::semicolon, util::StructuralIndex::colon,
+                                           util::StructuralIndex::comma, util::StructuralIndex::equals,
+                                           util::StructuralIndex::space, util::StructuralIndex::control, 0,
+                                           util::StructuralIndex::control, util::StructuralIndex::control,
+                                           util::StructuralIndex::control};
+      auto kind_of = [&](char c) { return kinds[alphabet.find(c)]; };
+
+      std::mt19937 random{42};
+      for (size_t density : {2, 13, 300}) {
+          std::string text;
+          for (size_t i = 0; i < 300; ++i) {
+              text.push_back(random() % density == 0 ? alphabet[random() % alphabet.size()] : 'A');
+          }
+
+          util::StructuralIndex index;
+          for (size_t begin = 0; begin < 70; begin += 3) {
+              char const * first = text.data() + begin;
+              char const * last = text.data() + text.size() - begin / 2;
+              index.build(first, last);
+              for (unsigned searched : {util::StructuralIndex::tab | util::StructuralIndex::newline,
+                                        util::StructuralIndex::colon | util::StructuralIndex::space |
+                                        util::StructuralIndex::control,
+                                        util::StructuralIndex::semicolon | util::StructuralIndex::comma |
+                                        util::StructuralIndex::equals}) {
+                  for (char const * from = first; from <= last; from += 5) {
+                      auto expected = std::find_if(from, last, [&](char c) { return kind_of(c) & searched; });
+                      CHECK(index.find(from, searched) == expected);
+                  }
+              }
+          }
+      }
+  }
+
+  TEST_CASE("Structural characters not found", "[line_scanner]")
+  {
+      std::string text(100, 'A');
+      util::StructuralIndex index;
+      index.build(text.data(), text.data() + text.size());
+      CHECK(index.find(text.data(), util::StructuralIndex::tab) == text.data() + text.size());
+      CHECK(index.find(text.data() + text.size(), util::StructuralIndex::tab) == text.data() + text.size());
+
+      index.build(text.data(), text.data());
+      CHECK(index.find(text.data(), util::StructuralIndex::tab) == text.data());
+  }
+
+  TEST_CASE("Long runs of characters skipped at once", "[line_scanner]")
+  {
+      unsigned const stops = util::StructuralIndex::colon | util::StructuralIndex::tab | util::StructuralIndex::control;
+      std::string text = "0/1:12,30:abcdefghijklmnopqrstuvwxyz\t1/1:3abcdefghij\x80klm\n";
+      util::StructuralIndex index;
+      index.build(text.data(), text.data() + text.size());
+
+      // Runs shorter than a word are left to the caller
+      CHECK(index.find_after_long_run(text.data() + 4, stops) == nullptr);
+      CHECK(index.find_after_long_run(text.data() + 6, stops) == nullptr);
+
+      SECTION("The end of a long run is found")
+      {
+          CHECK(index.find_after_long_run(text.data() + 13, stops) == text.data() + text.find('\t'));
+          CHECK(index.find_after_long_run(text.data() + 20, stops) == text.data() + text.find('\t'));
+      }
+
+      SECTION("Non-ASCII characters end a run")
+      {
+          CHECK(index.find_after_long_run(text.data() + text.find("3abc"), util::StructuralIndex::control) ==
+                text.data() + text.find('\x80'));
+      }
+
+      SECTION("The last characters of the buffer are left to the caller")
+      {
+          CHECK(index.find_after_long_run(text.data() + text.size() - 4, stops) == nullptr);
+      }
+  }
+}
@@ -0,0 +1,210 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "util/number_scanner.hpp"
+
+namespace ebi
+{
+  util::NumberStatus scan_integer(std::string const & text, int64_t & value)
+  {
+      return util::scan_integer(text.data(), text.data() + text.size(), value);
+  }
+
+  util::NumberStatus scan_float(std::string const & text, double & value)
+  {
+      return util::scan_float(text.data(), text.data() + text.size(), value);
+  }
+
+  TEST_CASE("Integers scanned", "[number_scanner]")
+  {
+      int64_t value;
+
+      SECTION("Valid integers")
+      {
+          CHECK(scan_integer("0", value) == util::NumberStatus::valid);
+          CHECK(value == 0);
+          CHECK(scan_integer("123", value) == util::NumberStatus::valid);
+          CHECK(value == 123);
+          CHECK(scan_integer("-45", value) == util::NumberStatus::valid);
+          CHECK(value == -45);
+          CHECK(scan_integer("+007", value) == util::NumberStatus::valid);
+          CHECK(value == 7);
+          CHECK(scan_integer("3000000000", value) == util::NumberStatus::valid);
+          CHECK(value == 3000000000);
+          CHECK(scan_integer("9223372036854775807", value) == util::NumberStatus::valid);
+          CHECK(value == INT64_MAX);
+          CHECK(scan_integer("-9223372036854775808", value) == util::NumberStatus::valid);
+          CHECK(value == INT64_MIN);
+      }
+
+      SECTION("Invalid integers")
+      {
+          for (std::string text : {"", "-", "+", "1.0", "1e3", " 1", "1 ", "12abc", "0x10", "--1", "."}) {
+              CHECK(scan_integer(text, value) == util::NumberStatus::invalid);
+          }
+      }
+
+      SECTION("Integers out of range")
+      {
+          CHECK(scan_integer("9223372036854775808", value) == util::NumberStatus::out_of_range);
+          CHECK(value == INT64_MAX);
+          CHECK(scan_integer("-9223372036854775809", value) == util::NumberStatus::out_of_range);
+          CHECK(value == INT64_MIN);
+          CHECK(scan_integer("123456789012345678901234567890", value) == util::NumberStatus::out_of_range);
+      }
+  }
+
+  TEST_CASE("Floats scanned", "[number_scanner]")
+  {
+      double value;
+
+      SECTION("Valid floats")
+      {
+          std::vector<std::pair<std::string, double>> floats{
+                  {"0", 0}, {"1", 1}, {"-2.5", -2.5}, {"+.5", 0.5}, {"5.", 5}, {"0.1", 0.1}, {"1e3", 1e3},
+                  {"1.5E-3", 1.5e-3}, {"-7e+2", -7e2}, {"0.3333333333333333", 0.3333333333333333},
+                  {"123456789012345678901234", 123456789012345678901234.0}, {"1e300", 1e300}, {"2.5e-310", 2.5e-310},
+                  {"0.00000000000000000000000000001", 1e-29}};
+
+          for (auto & number : floats) {
+              CHECK(scan_float(number.first, value) == util::NumberStatus::valid);
+              CHECK(value == Approx(number.second));
+          }
+
+          // Exact for the common short numbers
+          CHECK(scan_float("0.1", value) == util::NumberStatus::valid);
+          CHECK(value == 0.1);
+          CHECK(scan_float("12.375", value) == util::NumberStatus::valid);
+          CHECK(value == 12.375);
+      }
+
+      SECTION("Infinity and NaN")
+      {
+          CHECK(scan_float("Inf", value) == util::NumberStatus::valid);
+          CHECK(value == HUGE_VAL);
+          CHECK(scan_float("-INFINITY", value) == util::NumberStatus::valid);
+          CHECK(value == -HUGE_VAL);
+          CHECK(scan_float("NaN", value) == util::NumberStatus::valid);
+          CHECK(std::isnan(value));
+          CHECK(scan_float("nan", value) == util::NumberStatus::valid);
+      }
+
+      SECTION("Very small floats")
+      {
+          CHECK(scan_float("1e-400", value) == util::NumberStatus::valid);
+          CHECK(value == 0);
+      }
+
+      SECTION("Invalid floats")
+      {
+          for (std::string text : {"", ".", "-", "e5", "1e", "1e+", "1.5abc", " 1", "1,5", "0x1p3", "1..2", "In", "nana"}) {
+              CHECK(scan_float(text, value) == util::NumberStatus::invalid);
+          }
+      }
+
+      SECTION("Floats out of range")
+      {
+          CHECK(scan_float("1e400", value) == util::NumberStatus::out_of_range);
+          CHECK(scan_float("-1e99999999999", value) == util::NumberStatus::out_of_range);
+      }
+  }
+
+  /**
+   * Returns the nanoseconds per call taken by `scan` over all the `texts`
+   */
+  template <typename Function>
+  double nanoseconds_per_call(std::vector<std::string> const & texts, Function scan)
+  {
+      size_t const repetitions = 200;
+      double checksum = 0;
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < repetitions; ++i) {
+          for (auto & text : texts) {
+              checksum += scan(text);
+          }
+      }
+      auto elapsed = std::chrono::steady_clock::now() - start;
+      CHECK(checksum != 0);   // so the calls are not optimized away
+      return std::chrono::duration<double, std::nano>(elapsed).count() / (repetitions * texts.size());
+  }
+
+  TEST_CASE("Numeric scanning against the standard conversions", "[.][benchmark]")
+  {
+      std::vector<std::string> integers;
+      std::vector<std::string> floats;
+      for (int i = 0; i < 10000; ++i) {
+          integers.push_back(std::to_string(i * 7919 % 1000000));
+          floats.push_back(std::to_string((i % 1000) / 997.0));
+      }
+
+      auto report = [](std::string const & name, double standard, double scanner) {
+          std::cout << name << ": " << standard << " ns with the standard functions, " << scanner
+                    << " ns with the scanner" << std::endl;
+      };
+
+      report("POS (std::stoi on a copied token)",
+             nanoseconds_per_call(integers, [](std::string const & text) {
+                 std::string token{text.data(), text.data() + text.size()};
+                 return std::stoi(token);
+             }),
+             nanoseconds_per_call(integers, [](std::string const & text) {
+                 int64_t value;
+                 util::scan_integer(text.data(), text.data() + text.size(), value);
+                 return value;
+             }));
+
+      report("Integer type check (std::stoi, std::stof and std::fmod)",
+             nanoseconds_per_call(integers, [](std::string const & text) {
+                 std::stoi(text);
+                 return std::fmod(std::stof(text), 1) == 0;
+             }),
+             nanoseconds_per_call(integers, [](std::string const & text) {
+                 int64_t value;
+                 return util::scan_integer(text.data(), text.data() + text.size(), value) == util::NumberStatus::valid;
+             }));
+
+      report("QUAL (std::stof on a copied token)",
+             nanoseconds_per_call(floats, [](std::string const & text) {
+                 std::string token{text.data(), text.data() + text.size()};
+                 return std::stof(token);
+             }),
+             nanoseconds_per_call(floats, [](std::string const & text) {
+                 double value;
+                 util::scan_float(text.data(), text.data() + text.size(), value);
+                 return value;
+             }));
+
+      report("AF interval (std::stold twice)",
+             nanoseconds_per_call(floats, [](std::string const & text) {
+                 return !(std::stold(text) < 0 || std::stold(text) > 1);
+             }),
+             nanoseconds_per_call(floats, [](std::string const & text) {
+                 double value;
+                 return util::scan_float(text.data(), text.data() + text.size(), value) == util::NumberStatus::valid
+                         && !(value < 0 || value > 1);
+             }));
+  }
+}
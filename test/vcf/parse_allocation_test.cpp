@@ -0,0 +1,94 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+
+#include "catch/catch.hpp"
+
+#include "vcf/validator.hpp"
+
+/*
+ * The global allocation functions are replaced for the whole test executable, only to count the calls. Memory is
+ * still handled by malloc and free.
+ */
+namespace
+{
+  std::atomic<size_t> n_allocations{0};
+}
+
+void * operator new(size_t size)
+{
+    ++n_allocations;
+    void * memory = std::malloc(size != 0 ? size : 1);
+    if (memory == nullptr) {
+        throw std::bad_alloc{};
+    }
+    return memory;
+}
+
+void operator delete(void * memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void * memory, size_t) noexcept
+{
+    std::free(memory);
+}
+
+namespace ebi
+{
+  TEST_CASE("Heap allocations per record", "[.][benchmark]")
+  {
+      std::string const header =
+          "##fileformat=VCFv4.3\n"
+          "##contig=<ID=1,length=100000000>\n"
+          "##INFO=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+          "##INFO=<ID=AF,Number=A,Type=Float,Description=\"Frequency\">\n"
+          "##FORMAT=<ID=GT,Number=1,Type=String,Description=\"Genotype\">\n"
+          "##FORMAT=<ID=DP,Number=1,Type=Integer,Description=\"Depth\">\n"
+          "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\tFORMAT\tS1\tS2\tS3\tS4\n";
+      size_t const n_records = 400;
+
+      // Two kinds of records at increasing positions, so no errors are reported for duplicated or unsorted variants
+      std::string body;
+      for (size_t i = 0; i < n_records; i += 2) {
+          body += "1\t" + std::to_string(100 + i * 100) + "\trs1\tA\tT\t50\tPASS\tDP=10;AF=0.5\tGT:DP"
+                  "\t0/1:3\t1/1:4\t0/0:5\t0/1:6\n";
+          body += "1\t" + std::to_string(200 + i * 100) + "\trs2\tC\tG,T\t60\tPASS\tDP=12;AF=0.1,0.2\tGT:DP"
+                  "\t0/1:3\t1/2:4\t0/0:5\t0/1:6\n";
+      }
+
+      std::shared_ptr<vcf::Source> source{
+          new vcf::Source{"allocations", vcf::InputFormat::VCF_FILE_VCF, vcf::Version::v43, vcf::Ploidy{2}}};
+      vcf::FullValidator_v43 parser{source};
+      parser.parse(header);
+
+      size_t before = n_allocations;
+      parser.parse(body);
+      size_t allocations = n_allocations - before;
+
+      CHECK(parser.is_valid());
+      std::cout << "Heap allocations per record: " << static_cast<double>(allocations) / n_records << std::endl;
+  }
+}
@@ -0,0 +1,77 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  /**
+   * Parses a file in pieces of `piece_size` characters, each of them copied into the same buffer, so the tokens
+   * split between pieces can only be read correctly if they are copied before the buffer is overwritten
+   */
+  std::vector<std::string> validate_in_pieces(std::string const &text, size_t piece_size)
+  {
+      std::shared_ptr<vcf::Source> source{
+          new vcf::Source{"pieces", vcf::InputFormat::VCF_FILE_VCF, vcf::Version::v43, vcf::Ploidy{2}}};
+      vcf::FullValidator_v43 parser{source};
+
+      std::vector<std::string> messages;
+      auto collect = [&]() {
+          for (auto &error : parser.errors()) {
+              messages.push_back(std::to_string(error->line) + ": " + error->what());
+          }
+      };
+
+      std::vector<char> buffer;
+      for (size_t begin = 0; begin < text.size(); begin += piece_size) {
+          buffer.assign(text.begin() + begin, text.begin() + std::min(begin + piece_size, text.size()));
+          parser.parse(buffer);
+          collect();
+          buffer.assign(buffer.size(), '?');
+      }
+      parser.end();
+      collect();
+      return messages;
+  }
+
+  TEST_CASE("Tokens split between buffers", "[parse_policy]")
+  {
+      for (auto directory : {"test/input_files/v4.3/passed", "test/input_files/v4.3/failed"}) {
+          for (boost::filesystem::directory_iterator it{directory}, end; it != end; ++it) {
+              std::ifstream input{it->path().string()};
+              std::string text{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+
+              SECTION(it->path().string())
+              {
+                  auto expected = validate_in_pieces(text, text.size() + 1);
+                  CHECK(validate_in_pieces(text, 1) == expected);
+                  CHECK(validate_in_pieces(text, 7) == expected);
+              }
+          }
+      }
+  }
+}
@@ -20,13 +20,18 @@
 #include <iostream>
 #include <fstream>
 #include <memory>
+#include <set>
+#include <string>
+#include <vector>
 
 #include <boost/filesystem.hpp>
 
 #include "catch/catch.hpp"
 
+#include "util/mapped_file.hpp"
 #include "util/stream_utils.hpp"
 #include "vcf/file_structure.hpp"
+#include "vcf/report_writer.hpp"
 #include "vcf/validator.hpp"
 
 namespace ebi
@@ -38,6 +43,87 @@ namespace ebi
 
         return vcf::is_valid_vcf_file(input, path, vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs);
     }
+
+    inline bool is_valid_mapped(std::string path)
+    {
+        util::MappedFile input{path};
+        std::vector<std::unique_ptr<ebi::vcf::ReportWriter>> outputs;
+
+        return vcf::is_valid_vcf_file(input, path, vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs);
+    }
+
+    /**
+     * What a CollectingReportWriter was given: the errors and warnings in the order they were reported, and the
+     * amount of reports kept when the validation was resumed from a checkpoint
+     */
+    struct CollectedReports
+    {
+        std::vector<std::string> messages;  ///< "line: message", followed by " (warning)" for the warnings
+        std::vector<size_t> error_lines;
+        std::vector<size_t> warning_lines;
+        size_t n_resumed_reports;
+
+        CollectedReports() : n_resumed_reports{0} { }
+
+        /**
+         * Lines of all the errors and warnings
+         */
+        std::multiset<size_t> lines() const
+        {
+            std::multiset<size_t> lines(error_lines.begin(), error_lines.end());
+            lines.insert(warning_lines.begin(), warning_lines.end());
+            return lines;
+        }
+    };
+
+    class CollectingReportWriter : public vcf::ReportWriter
+    {
+      public:
+        CollectingReportWriter(CollectedReports &reports) : reports(reports) { }
+
+        void write_error(vcf::Error &error) override
+        {
+            reports.messages.push_back(std::to_string(error.line) + ": " + error.what());
+            reports.error_lines.push_back(error.line);
+        }
+
+        void write_warning(vcf::Error &error) override
+        {
+            reports.messages.push_back(std::to_string(error.line) + ": " + error.what() + " (warning)");
+            reports.warning_lines.push_back(error.line);
+        }
+
+        void resume(size_t n_reports) override
+        {
+            reports.n_resumed_reports = n_reports;
+        }
+
+      private:
+        CollectedReports &reports;
+    };
+
+    /**
+     * Outputs of a validation that only collect its reports
+     */
+    inline std::vector<std::unique_ptr<vcf::ReportWriter>> collecting_outputs(CollectedReports &reports)
+    {
+        std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+        outputs.emplace_back(new CollectingReportWriter{reports});
+        return outputs;
+    }
+
+    /**
+     * Meta and header sections of a VCFv4.3 file without samples, defining the given contigs, and followed by the
+     * `meta` lines if any
+     */
+    inline std::string vcf_header(std::vector<std::string> const &contigs, std::string const &meta = "")
+    {
+        std::string header = "##fileformat=VCFv4.3\n##reference=file:///ref.fa\n";
+        for (auto &contig : contigs) {
+            header += "##contig=<ID=" + contig + ",length=100000000>\n";
+        }
+        return header + meta + "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n";
+    }
 }
 
 #endif // EBI_PARSER_TEST_AUX_HPP
@@ -30,6 +30,7 @@ namespace ebi
           SECTION(path.string())
           {
               CHECK_FALSE(is_valid(path.string()));
+              CHECK_FALSE(is_valid_mapped(path.string()));
           }
       }
   }
@@ -45,6 +46,7 @@ namespace ebi
           SECTION(path.string())
           {
               CHECK(is_valid(path.string()));
+              CHECK(is_valid_mapped(path.string()));
           }
       }
   }
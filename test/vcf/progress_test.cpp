@@ -0,0 +1,101 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "util/progress.hpp"
+#include "vcf/report_writer.hpp"
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  std::string const progress_path = "test/input_files/progress_test.json";
+
+  std::string read_progress_file()
+  {
+      std::ifstream input{progress_path};
+      return {std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+  }
+
+  TEST_CASE("Progress counters", "[progress]")
+  {
+      std::string text =
+              "##fileformat=VCFv4.3\n"
+              "##contig=<ID=1,length=1000000>\n"
+              "#CHROM\tPOS\tID\tREF\tALT\tQUAL\tFILTER\tINFO\n"
+              "1\t100\t.\tA\tT\t10\tPASS\t.\n"
+              "1\t200\t.\tA\tT\tq10\tPASS\t.\n"
+              "1\t300\t.\tA\tT\t10\tPASS\t.\n";
+
+      auto & counters = util::progress_counters();
+      uint64_t lines = counters.lines, bytes = counters.bytes, records = counters.records, errors = counters.errors;
+
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+      outputs.emplace_back(new vcf::ProgressReportWriter);
+      CHECK_FALSE(vcf::is_valid_vcf_file(text.data(), text.data() + text.size(), "progress",
+                                         vcf::ValidationLevel::error, vcf::Ploidy{2}, outputs));
+
+      CHECK(counters.lines - lines == 6);
+      CHECK(counters.bytes - bytes == text.size());
+      CHECK(counters.records - records == 3);
+      CHECK(counters.errors - errors == 1);
+  }
+
+  TEST_CASE("Progress reports", "[progress]")
+  {
+      std::remove(progress_path.c_str());
+
+      SECTION("Written on demand")
+      {
+          util::ProgressReporter reporter{{0, progress_path, 0}};
+          reporter.report();
+          auto report = read_progress_file();
+          CHECK(report.find("\"lines\": ") != std::string::npos);
+          CHECK(report.find("\"eta_seconds\": null") != std::string::npos);
+      }
+
+      SECTION("Written when the process receives SIGUSR1")
+      {
+          util::ProgressReporter reporter{{0, progress_path, 1000}};
+          std::raise(SIGUSR1);
+          for (size_t i = 0; i < 50 && read_progress_file().empty(); ++i) {
+              std::this_thread::sleep_for(std::chrono::milliseconds{100});
+          }
+          CHECK(read_progress_file().find("\"total_bytes\": 1000") != std::string::npos);
+      }
+
+      SECTION("Written when the reporter is destroyed")
+      {
+          {
+              util::ProgressReporter reporter{{util::default_progress_interval, progress_path, 0}};
+          }
+          CHECK(read_progress_file().find("\"records\": ") != std::string::npos);
+      }
+
+      std::remove(progress_path.c_str());
+  }
+}
@@ -0,0 +1,93 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "catch/catch.hpp"
+
+#include "vcf/validator.hpp"
+
+namespace ebi
+{
+  namespace
+  {
+    std::vector<std::string> read_test_inputs(std::string const & version)
+    {
+        std::vector<std::string> texts;
+        for (std::string folder : {"passed", "failed"}) {
+            boost::filesystem::path path{"test/input_files/" + version + "/" + folder};
+            for (boost::filesystem::directory_iterator it{path}, end; it != end; ++it) {
+                std::ifstream input{it->path().string()};
+                texts.emplace_back(std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{});
+            }
+        }
+        return texts;
+    }
+
+    /**
+     * Megabytes per second parsed by a new `Parser` for each text, repeating them for at least half a second
+     */
+    template <typename Parser>
+    double megabytes_per_second(std::vector<std::string> const & texts)
+    {
+        size_t bytes = 0;
+        auto start = std::chrono::steady_clock::now();
+        std::chrono::duration<double> elapsed{0};
+        while (elapsed.count() < 0.5) {
+            for (auto & text : texts) {
+                std::shared_ptr<vcf::Source> source{
+                    new vcf::Source{"benchmark", vcf::InputFormat::VCF_FILE_VCF, vcf::Version::v43, vcf::Ploidy{2}}};
+                Parser parser{source};
+                parser.parse(text);
+                parser.end();
+                bytes += text.size();
+            }
+            elapsed = std::chrono::steady_clock::now() - start;
+        }
+        return bytes / elapsed.count() / 1e6;
+    }
+
+    template <typename QuickValidator, typename FullValidator>
+    void report_speed(std::string const & version)
+    {
+        auto texts = read_test_inputs(version);
+        REQUIRE_FALSE(texts.empty());
+        std::cout << "Ragel machine " << version << ": "
+                  << megabytes_per_second<QuickValidator>(texts) << " MB/s with the quick validator, "
+                  << megabytes_per_second<FullValidator>(texts) << " MB/s with the full validator" << std::endl;
+    }
+  }
+
+  /*
+   * The test executable links the machines checked in, and CMake builds one more for each code style that Ragel
+   * can generate (benchmark_ragel_goto, benchmark_ragel_table and benchmark_ragel_flat) to compare them
+   */
+  TEST_CASE("Parsing speed of the Ragel machines", "[.][benchmark]")
+  {
+      report_speed<vcf::QuickValidator_v41, vcf::FullValidator_v41>("v4.1");
+      report_speed<vcf::QuickValidator_v42, vcf::FullValidator_v42>("v4.2");
+      report_speed<vcf::QuickValidator_v43, vcf::FullValidator_v43>("v4.3");
+  }
+}
@@ -0,0 +1,94 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "catch/catch.hpp"
+
+#include "util/read_ahead.hpp"
+
+namespace ebi
+{
+  /**
+   * Stream buffer whose reads always fail
+   */
+  class FailingStreambuf : public std::streambuf
+  {
+    protected:
+      int_type underflow() override
+      {
+          throw std::runtime_error{"The input could not be read"};
+      }
+  };
+
+  TEST_CASE("Read a stream ahead", "[read_ahead]")
+  {
+      std::ifstream plain_input{"test/input_files/v4.3/passed/complexfile_passed_000.vcf"};
+      std::string plain{std::istreambuf_iterator<char>(plain_input), std::istreambuf_iterator<char>()};
+      REQUIRE(plain.size() > 0);
+
+      SECTION("Default buffers")
+      {
+          std::istringstream input{plain};
+          util::ReadAheadStreambuf read_ahead{input};
+          std::istream text{&read_ahead};
+          CHECK(std::string(std::istreambuf_iterator<char>(text), std::istreambuf_iterator<char>()) == plain);
+      }
+
+      SECTION("Buffers smaller than a line")
+      {
+          std::istringstream input{plain};
+          util::ReadAheadStreambuf read_ahead{input, 7, 2};
+          std::istream text{&read_ahead};
+          CHECK(std::string(std::istreambuf_iterator<char>(text), std::istreambuf_iterator<char>()) == plain);
+      }
+
+      SECTION("Empty input")
+      {
+          std::istringstream input{""};
+          util::ReadAheadStreambuf read_ahead{input, 7, 2};
+          std::istream text{&read_ahead};
+          CHECK(std::string(std::istreambuf_iterator<char>(text), std::istreambuf_iterator<char>()) == "");
+      }
+
+      SECTION("Stop reading before the end")
+      {
+          std::istringstream input{plain};
+          util::ReadAheadStreambuf read_ahead{input, 7, 2};
+          std::istream text{&read_ahead};
+          std::string line;
+          std::getline(text, line);
+          CHECK(line == "##fileformat=VCFv4.3");
+      }
+  }
+
+  TEST_CASE("Report reading errors", "[read_ahead]")
+  {
+      FailingStreambuf failing;
+      std::istream input{&failing};
+      input.exceptions(std::ios::badbit);
+
+      util::ReadAheadStreambuf read_ahead{input, 7, 2};
+      std::istream text{&read_ahead};
+      text.exceptions(std::ios::badbit);
+      std::string line;
+      CHECK_THROWS_AS(std::getline(text, line), std::runtime_error);
+  }
+}
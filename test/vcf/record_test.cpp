@@ -20,6 +20,7 @@
 
 #include "vcf/file_structure.hpp"
 #include "vcf/error.hpp"
+#include "vcf/record.hpp"
 
 namespace ebi
 {
@@ -35,7 +36,7 @@ namespace ebi
                 {},
                 { "Sample1" }}};
             
-        source->meta_entries.emplace("FORMAT",
+        source->add_meta(
             vcf::MetaEntry{
                 1,
                 "FORMAT",
@@ -48,7 +49,7 @@ namespace ebi
                 source
         });
            
-        source->meta_entries.emplace("FORMAT",
+        source->add_meta(
             vcf::MetaEntry{
                 1,
                 "FORMAT",
@@ -61,7 +62,7 @@ namespace ebi
                 source
             });
 
-        source->meta_entries.emplace("INFO",
+        source->add_meta(
             vcf::MetaEntry{
                 1,
                 "INFO",
@@ -74,7 +75,7 @@ namespace ebi
                 source
         });
            
-        source->meta_entries.emplace("INFO",
+        source->add_meta(
             vcf::MetaEntry{
                 1,
                 "INFO",
@@ -364,6 +365,47 @@ namespace ebi
                             vcf::FormatBodyError*);
         }
 
+        SECTION("Sample subfields")
+        {
+            vcf::Record record{
+                    1,
+                    "chr1",
+                    123456,
+                    { "id123" },
+                    "A",
+                    { "T", "C" },
+                    1.0,
+                    { "PASS" },
+                    { {"AN", "12"}, {"AF", "0.5,0.3"} },
+                    { "GT", "DP" },
+                    { "0|1:" },
+                    source};
+
+            CHECK(record.n_sample_subfields(0) == 1);
+            CHECK(record.sample_subfield(0, 0) == "0|1");
+            CHECK(record.sample_subfield(0, 1) == "");
+
+            vcf::Record empty_subfield{
+                    1,
+                    "chr1",
+                    123456,
+                    { "id123" },
+                    "A",
+                    { "T", "C" },
+                    1.0,
+                    { "PASS" },
+                    { {"AN", "12"}, {"AF", "0.5,0.3"} },
+                    { "GT", "GQ", "DP" },
+                    { "1/2::12" },
+                    source};
+
+            vcf::Record copy = empty_subfield;
+            CHECK(copy.n_sample_subfields(0) == 3);
+            CHECK(copy.sample_subfield(0, 0) == "1/2");
+            CHECK(copy.sample_subfield(0, 1) == "");
+            CHECK(copy.sample_subfield(0, 2) == "12");
+        }
+
         SECTION("Unusual ploidy")
         {
             CHECK_NOTHROW( (vcf::Record{
@@ -423,7 +465,7 @@ namespace ebi
                 {},
                 { "Sample1" }}};
 
-        source->meta_entries.emplace("FORMAT",
+        source->add_meta(
             vcf::MetaEntry{
                 1,
                 "FORMAT",
@@ -436,7 +478,7 @@ namespace ebi
                 source
         });
            
-        source->meta_entries.emplace("FORMAT",
+        source->add_meta(
             vcf::MetaEntry{
                 1,
                 "FORMAT",
@@ -449,7 +491,7 @@ namespace ebi
                 source
             });
 
-        source->meta_entries.emplace("INFO",
+        source->add_meta(
             vcf::MetaEntry{
                 1,
                 "INFO",
@@ -462,7 +504,7 @@ namespace ebi
                 source
         });
            
-        source->meta_entries.emplace("INFO",
+        source->add_meta(
             vcf::MetaEntry{
                 1,
                 "INFO",
@@ -511,4 +553,227 @@ namespace ebi
                             vcf::IdBodyError*);
         }
     }
+
+    TEST_CASE("Field definitions from the meta section", "[constructor]")
+    {
+        std::shared_ptr<vcf::Source> source{
+            new vcf::Source{
+                "Example VCF source",
+                vcf::InputFormat::VCF_FILE_VCF,
+                vcf::Version::v43,
+                vcf::Ploidy{2},
+                {},
+                { "Sample1" }}};
+
+        source->add_meta(
+            vcf::MetaEntry{
+                1,
+                "INFO",
+                {
+                    { "ID", "XC" },
+                    { "Number", "A" },
+                    { "Type", "Integer" },
+                    { "Description", "Some count" }
+                },
+                source
+            });
+
+        source->add_meta(
+            vcf::MetaEntry{
+                2,
+                "INFO",
+                {
+                    { "ID", "XC" },
+                    { "Number", "1" },
+                    { "Type", "Float" },
+                    { "Description", "Duplicated count" }
+                },
+                source
+            });
+
+        auto info_xc = source->info_definition("XC");
+        auto definition = info_xc;
+        REQUIRE(definition != nullptr);
+        CHECK(definition->number_kind == vcf::NumberKind::alternate_alleles);
+        CHECK(definition->field_type == vcf::FieldType::integer);
+        CHECK(source->info_definition("DP") == nullptr);
+        CHECK(source->format_definition("XC") == nullptr);
+
+        // Entries added later are also found
+        source->add_meta(
+            vcf::MetaEntry{
+                3,
+                "FORMAT",
+                {
+                    { "ID", "XQ" },
+                    { "Number", "2" },
+                    { "Type", "Integer" },
+                    { "Description", "Some quality" }
+                },
+                source
+            });
+
+        definition = source->format_definition("XQ");
+        REQUIRE(definition != nullptr);
+        CHECK(definition->number_kind == vcf::NumberKind::fixed);
+        CHECK(definition->number_count == 2);
+        CHECK(source->info_definition("XC") == info_xc);
+
+        CHECK_THROWS_AS( (vcf::Record{
+                            1,
+                            "chr1",
+                            123456,
+                            { "id123" },
+                            "A",
+                            { "T", "C" },
+                            1.0,
+                            { "PASS" },
+                            { {"XC", "1"} },
+                            { "GT", "XQ" },
+                            { "0|1:10" },
+                            source}),
+                        vcf::InfoBodyError*);
+
+        CHECK_THROWS_AS( (vcf::Record{
+                            1,
+                            "chr1",
+                            123456,
+                            { "id123" },
+                            "A",
+                            { "T", "C" },
+                            1.0,
+                            { "PASS" },
+                            { {"XC", "1,1"} },
+                            { "GT", "XQ" },
+                            { "0|1:10" },
+                            source}),
+                        vcf::SamplesFieldBodyError*);
+
+        CHECK_NOTHROW( (vcf::Record{
+                            1,
+                            "chr1",
+                            123456,
+                            { "id123" },
+                            "A",
+                            { "T", "C" },
+                            1.0,
+                            { "PASS" },
+                            { {"XC", "1,1"} },
+                            { "GT", "XQ" },
+                            { "0|1:10,12" },
+                            source}) );
+    }
+
+    TEST_CASE("Record errors collected at once", "[constructor]")
+    {
+        std::shared_ptr<vcf::Source> source{
+            new vcf::Source{
+                "Example VCF source",
+                vcf::InputFormat::VCF_FILE_VCF,
+                vcf::Version::v43,
+                vcf::Ploidy{2},
+                {},
+                { "Sample1", "Sample2" }}};
+
+        SECTION("All the errors are added")
+        {
+            vcf::RecordErrors errors;
+            CHECK_NOTHROW( (vcf::Record{
+                                1,
+                                "chr 1:1",
+                                123456,
+                                { "id123", "id123" },
+                                "A",
+                                { "T" },
+                                -1.0,
+                                { "PASS" },
+                                { {"AN", "12"} },
+                                { "GT" },
+                                { "0|3" },
+                                source,
+                                nullptr,
+                                &errors}) );
+
+            REQUIRE(errors.size() == 6);
+            CHECK(dynamic_cast<vcf::ChromosomeBodyError*>(errors[0].get()) != nullptr);
+            CHECK(dynamic_cast<vcf::ChromosomeBodyError*>(errors[1].get()) != nullptr);
+            CHECK(dynamic_cast<vcf::IdBodyError*>(errors[2].get()) != nullptr);
+            CHECK(dynamic_cast<vcf::QualityBodyError*>(errors[3].get()) != nullptr);
+            CHECK(dynamic_cast<vcf::SamplesBodyError*>(errors[4].get()) != nullptr);
+            CHECK(dynamic_cast<vcf::SamplesFieldBodyError*>(errors[5].get()) != nullptr);
+        }
+
+        SECTION("Only the first error is thrown")
+        {
+            CHECK_THROWS_AS( (vcf::Record{
+                                1,
+                                "chr 1:1",
+                                123456,
+                                { "id123", "id123" },
+                                "A",
+                                { "T" },
+                                -1.0,
+                                { "PASS" },
+                                { {"AN", "12"} },
+                                { "GT" },
+                                { "0|3" },
+                                source}),
+                            vcf::ChromosomeBodyError*);
+        }
+    }
+
+    TEST_CASE("Symbolic alleles, AA and CIGAR", "[constructor]")
+    {
+        std::shared_ptr<vcf::Source> source{
+            new vcf::Source{
+                "Example VCF source",
+                vcf::InputFormat::VCF_FILE_VCF,
+                vcf::Version::v43,
+                vcf::Ploidy{2},
+                {},
+                { "Sample1" }}};
+
+        auto record_errors = [&source](std::vector<std::string> const & alternates,
+                                       std::map<std::string, std::string> const & info) {
+            vcf::RecordErrors errors;
+            vcf::Record{1, "chr1", 123456, { "id123" }, "A", alternates, 1.0, { "PASS" }, info, { "GT" }, { "0|1" },
+                        source, nullptr, &errors};
+            return errors.size();
+        };
+
+        SECTION("Symbolic alleles")
+        {
+            size_t id_length;
+            CHECK(vcf::is_symbolic_allele("<DEL:ME:ALU>", id_length));
+            CHECK(id_length == 10);
+            CHECK(vcf::is_symbolic_allele("<X_1>", id_length));
+            CHECK(id_length == 3);
+            CHECK_FALSE(vcf::is_symbolic_allele("<>", id_length));
+            CHECK_FALSE(vcf::is_symbolic_allele("<DEL", id_length));
+            CHECK_FALSE(vcf::is_symbolic_allele("<DEL-ME>", id_length));
+            CHECK_FALSE(vcf::is_symbolic_allele("A<DEL>", id_length));
+            CHECK_FALSE(vcf::is_symbolic_allele("<*>", id_length));
+
+            CHECK(record_errors({ "<DUP:TANDEM>" }, { {"AN", "2"} }) == 0);
+            CHECK(record_errors({ "<CNV>" }, { {"AN", "2"} }) == 0);
+            CHECK(record_errors({ "<XYZ>" }, { {"AN", "2"} }) == 1);
+            CHECK(record_errors({ "<DE>" }, { {"AN", "2"} }) == 1);
+        }
+
+        SECTION("AA")
+        {
+            CHECK(record_errors({ "T" }, { {"AA", "T"} }) == 0);
+            CHECK(record_errors({ "T" }, { {"AA", "a b"} }) == 0);
+            CHECK(record_errors({ "T" }, { {"AA", "a;b"} }) == 1);
+            CHECK(record_errors({ "T" }, { {"AA", "a\tb"} }) == 1);
+        }
+
+        SECTION("CIGAR")
+        {
+            CHECK(record_errors({ "T", "C" }, { {"CIGAR", "1M,2I10X"} }) == 0);
+            CHECK(record_errors({ "T", "C" }, { {"CIGAR", "1M,2"} }) == 1);
+            CHECK(record_errors({ "T", "C" }, { {"CIGAR", "1M,M"} }) == 1);
+            CHECK(record_errors({ "T", "C" }, { {"CIGAR", "1M,3Z"} }) == 1);
+        }
+    }
 }
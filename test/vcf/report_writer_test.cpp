@@ -107,6 +107,23 @@ namespace ebi
       }
 
 
+      SECTION("Drop the reports written after a checkpoint")
+      {
+          ebi::vcf::Error test_error{1, "testing errors"};
+          errorDAO.write_error(test_error);
+          errorDAO.write_error(test_error);
+          errorDAO.write_warning(test_error);
+          errorDAO.resume(1);
+          CHECK(errorDAO.count_errors() == 1);
+          CHECK(errorDAO.count_warnings() == 0);
+
+          errorDAO.write_warning(test_error);
+          errorDAO.flush();
+          CHECK(errorDAO.count_errors() == 1);
+          CHECK(errorDAO.count_warnings() == 1);
+      }
+
+
       SECTION("Write and read error codes")
       {
           size_t line = 8;
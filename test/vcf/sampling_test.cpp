@@ -0,0 +1,138 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "vcf/sampling.hpp"
+
+#include "parser_test_aux.hpp"
+
+namespace ebi
+{
+  std::string const sample_header = vcf_header({"1"});
+
+  /**
+   * @param error_every every how many records one has an invalid quality, or 0 for none
+   */
+  std::string sample_text(size_t n_records, size_t error_every)
+  {
+      std::string text = sample_header;
+      for (size_t i = 1; i <= n_records; ++i) {
+          bool error = error_every != 0 && i % error_every == 0;
+          text += "1\t" + std::to_string(i * 10) + "\t.\tA\tT\t" + (error ? "q10" : "10") + "\tPASS\t.\n";
+      }
+      return text;
+  }
+
+  bool is_valid_sample(std::string const &text,
+                       vcf::SamplingOptions const &options,
+                       vcf::SampleSummary &summary,
+                       CollectedReports &reports)
+  {
+      auto outputs = collecting_outputs(reports);
+      return vcf::is_valid_vcf_sample(text.data(), text.data() + text.size(), "sample", vcf::ValidationLevel::warning,
+                                      vcf::Ploidy{2}, outputs, options, summary);
+  }
+
+  TEST_CASE("Sample the body of a plain text file", "[sampling]")
+  {
+      vcf::SamplingOptions options{10, 0, 4096, 1};
+      vcf::SampleSummary summary;
+      CollectedReports reports;
+
+      SECTION("Valid file")
+      {
+          CHECK(is_valid_sample(sample_text(50000, 0), options, summary, reports));
+          CHECK(summary.sampled);
+          CHECK(summary.n_windows >= 2);
+          CHECK(summary.n_windows <= 12);
+          CHECK(summary.n_records < 50000);
+          CHECK(summary.n_erroneous_records == 0);
+          CHECK(summary.error_rate == 0);
+          CHECK(summary.error_rate_high > 0);
+      }
+
+      SECTION("File with errors")
+      {
+          CHECK_FALSE(is_valid_sample(sample_text(50000, 20), options, summary, reports));
+          CHECK(summary.sampled);
+          CHECK(summary.n_erroneous_records == reports.error_lines.size());
+          CHECK(summary.error_rate_low <= 0.05);
+          CHECK(summary.error_rate_high >= 0.05);
+          // Only the records in the sample are validated, numbered as if they came right after the header
+          CHECK(reports.error_lines.back() <= summary.n_records + 4);
+      }
+
+      SECTION("Fraction of the file")
+      {
+          options.fraction = 0.2;
+          CHECK(is_valid_sample(sample_text(50000, 0), options, summary, reports));
+          CHECK(summary.n_records > 50000 * 0.1);
+          CHECK(summary.n_records < 50000 * 0.4);
+      }
+
+      SECTION("Small file")
+      {
+          CHECK_FALSE(is_valid_sample(sample_text(100, 20), options, summary, reports));
+          CHECK_FALSE(summary.sampled);
+          CHECK(reports.error_lines.size() == 5);
+      }
+  }
+
+  TEST_CASE("Sample the body of a bgzipped file", "[sampling]")
+  {
+      vcf::SampleSummary summary;
+      std::vector<std::unique_ptr<vcf::ReportWriter>> outputs;
+
+      SECTION("Big enough to be sampled")
+      {
+          std::string path = "test/input_files/compressed/regions_000.tbi.vcf.gz";
+          std::ifstream input{path, std::ios::binary};
+          vcf::SamplingOptions options{3, 0, 4096, 1};
+          vcf::is_valid_vcf_sample(input, path, vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs, options,
+                                   summary);
+          CHECK(summary.sampled);
+          CHECK(summary.n_windows >= 2);
+          CHECK(summary.n_records > 0);
+          CHECK(summary.n_records < 6000);
+      }
+
+      SECTION("Small file")
+      {
+          std::string path = "test/input_files/compressed/complexfile_passed_000.bgzip.vcf.gz";
+          std::ifstream input{path, std::ios::binary};
+          vcf::SamplingOptions options{3, 0, 4096, 1};
+          CHECK(vcf::is_valid_vcf_sample(input, path, vcf::ValidationLevel::warning, vcf::Ploidy{2}, outputs,
+                                         options, summary));
+          CHECK_FALSE(summary.sampled);
+      }
+
+      SECTION("Gzipped files can't be sampled")
+      {
+          std::string path = "test/input_files/compressed/complexfile_passed_000.gzip.vcf.gz";
+          std::ifstream input{path, std::ios::binary};
+          vcf::SamplingOptions options{3, 0, 4096, 1};
+          CHECK_THROWS_AS(vcf::is_valid_vcf_sample(input, path, vcf::ValidationLevel::warning, vcf::Ploidy{2},
+                                                   outputs, options, summary),
+                          std::runtime_error);
+      }
+  }
+}
@@ -0,0 +1,138 @@
+/**
+ * Copyright 2017 EMBL - European Bioinformatics Institute
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "util/compression.hpp"
+#include "vcf/tabix_index.hpp"
+#include "vcf/validator.hpp"
+
+#include "parser_test_aux.hpp"
+
+namespace ebi
+{
+  std::string const tbi_path = "test/input_files/compressed/regions_000.tbi.vcf.gz";
+  std::string const csi_path = "test/input_files/compressed/regions_000.csi.vcf.gz";
+
+  vcf::TabixIndex read_index(std::string const &path)
+  {
+      std::ifstream input{vcf::find_tabix_index(path), std::ios::binary};
+      return vcf::TabixIndex{input};
+  }
+
+  bool is_valid_region(std::string const &path, std::vector<std::string> const &regions, CollectedReports &reports)
+  {
+      std::vector<vcf::Region> parsed;
+      for (auto &region : regions) {
+          parsed.push_back(vcf::parse_region(region));
+      }
+      auto outputs = collecting_outputs(reports);
+      std::ifstream input{path, std::ios::binary};
+      return vcf::is_valid_vcf_file(input, read_index(path), parsed, path, vcf::ValidationLevel::warning,
+                                    vcf::Ploidy{2}, outputs);
+  }
+
+  TEST_CASE("Parse regions", "[tabix]")
+  {
+      auto region = vcf::parse_region("chr1:1-5,000,000");
+      CHECK(region.contig == "chr1");
+      CHECK(region.begin == 1);
+      CHECK(region.end == 5000000);
+
+      region = vcf::parse_region("chr1");
+      CHECK(region.contig == "chr1");
+      CHECK(region.begin == 1);
+      CHECK(region.end == UINT64_MAX);
+
+      region = vcf::parse_region("chr1:100");
+      CHECK(region.begin == 100);
+      CHECK(region.end == UINT64_MAX);
+
+      region = vcf::parse_region("HLA-A*01:01:01:01:10-20");
+      CHECK(region.contig == "HLA-A*01:01:01:01");
+      CHECK(region.begin == 10);
+      CHECK(region.end == 20);
+
+      CHECK_THROWS_AS(vcf::parse_region(":1-10"), std::invalid_argument);
+      CHECK_THROWS_AS(vcf::parse_region("chr1:0-10"), std::invalid_argument);
+      CHECK_THROWS_AS(vcf::parse_region("chr1:20-10"), std::invalid_argument);
+  }
+
+  TEST_CASE("Read the chunks of a region", "[tabix]")
+  {
+      for (auto path : {tbi_path, csi_path}) {
+          INFO(path);
+          auto chunks = read_index(path).chunks({vcf::parse_region("2")});
+          REQUIRE_FALSE(chunks.empty());
+
+          std::ifstream input{path, std::ios::binary};
+          util::BgzfRangeStreambuf inflated{input, chunks};
+          std::istream text{&inflated};
+          std::string line;
+          size_t n_records = 0;
+          while (std::getline(text, line)) {
+              CHECK(line.substr(0, 2) == "2\t");
+              ++n_records;
+          }
+          CHECK(n_records == 2000);
+
+          CHECK(read_index(path).chunks({vcf::parse_region("X")}).empty());
+      }
+  }
+
+  TEST_CASE("Validate regions of a bgzipped file", "[tabix]")
+  {
+      for (auto path : {tbi_path, csi_path}) {
+          INFO(path);
+          CollectedReports reports;
+
+          SECTION("Region without errors")
+          {
+              CHECK(is_valid_region(path, {"1:1-10000", "3:200000-250000"}, reports));
+              CHECK(reports.error_lines.empty());
+          }
+
+          SECTION("Region with an error")
+          {
+              CHECK_FALSE(is_valid_region(path, {"2:140000-160000"}, reports));
+              CHECK(reports.error_lines.size() == 1);
+          }
+
+          SECTION("Several regions with errors")
+          {
+              CHECK_FALSE(is_valid_region(path, {"2", "1"}, reports));
+              REQUIRE(reports.error_lines.size() == 2);
+              // Records are numbered as if the ones validated came right after the 6 lines of the header
+              CHECK(reports.error_lines[0] == 6 + 200);
+              CHECK(reports.error_lines[1] == 6 + 2000 + 1000);
+          }
+
+          SECTION("Contig not in the index")
+          {
+              CHECK(is_valid_region(path, {"X:1-1000"}, reports));
+              CHECK(reports.error_lines.empty());
+          }
+      }
+  }
+}
@@ -51,7 +51,7 @@ namespace ebi
                                                           {},
                                                           {"NA001", "NA002", "NA003", "NA004"}}};
 
-      source->meta_entries.emplace("FORMAT",
+      source->add_meta(
                                    vcf::MetaEntry{
                                            1,
                                            "FORMAT",